@@ -63,6 +63,7 @@ def install_dependencies():
     install_dep('imgui[sdl3-binding,vulkan-binding,docking-experimental]', False)
     install_dep('implot', False)
     install_dep('gtest', False)
+    install_dep('benchmark', False)
     install_dep('nlohmann-json', False)
     install_dep('assimp', False)
     install_dep('vulkan-headers', False)
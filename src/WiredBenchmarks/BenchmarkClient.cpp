@@ -0,0 +1,526 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "BenchmarkClient.h"
+#include "SamplingMetrics.h"
+
+#include <Wired/Engine/IEngineAccess.h>
+#include <Wired/Engine/IResources.h>
+#include <Wired/Engine/Model/Model.h>
+#include <Wired/Engine/Physics/IPhysicsAccess.h>
+#include <Wired/Engine/World/Camera3D.h>
+#include <Wired/Engine/World/Components.h>
+
+#include <Wired/Render/Metrics.h>
+#include <Wired/Render/Mesh/Mesh.h>
+#include <Wired/Render/Mesh/StaticMeshData.h>
+#include <Wired/Render/Material/Material.h>
+
+#include <NEON/Common/ImageData.h>
+#include <NEON/Common/Log/ILogger.h>
+
+#include <glm/gtc/quaternion.hpp>
+
+#include <cmath>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+namespace Wired
+{
+
+static const auto BENCHMARK_PHYSICS_SCENE = Engine::PhysicsSceneName("Benchmark");
+static constexpr auto BENCHMARK_TAG = "Benchmark";
+static constexpr auto SKINNED_ANIMATION_NAME = "Spin";
+static constexpr float GRID_SPACING = 2.0f;
+static constexpr uint32_t TERRAIN_CHUNK_QUADS = 64;
+static constexpr float TERRAIN_DISPLACEMENT = 10.0f;
+
+struct CubeVertex
+{
+    glm::vec3 position;
+    glm::vec3 normal;
+    glm::vec2 uv;
+};
+
+/**
+ * @return The 24 vertices and 36 indices of a unit cube centered on the origin
+ */
+static std::pair<std::vector<CubeVertex>, std::vector<uint32_t>> GenerateCube()
+{
+    struct Face { glm::vec3 normal; glm::vec3 right; glm::vec3 up; };
+
+    const std::array<Face, 6> faces = {{
+        {{0, 0, 1}, {1, 0, 0}, {0, 1, 0}},
+        {{0, 0, -1}, {-1, 0, 0}, {0, 1, 0}},
+        {{1, 0, 0}, {0, 0, -1}, {0, 1, 0}},
+        {{-1, 0, 0}, {0, 0, 1}, {0, 1, 0}},
+        {{0, 1, 0}, {1, 0, 0}, {0, 0, -1}},
+        {{0, -1, 0}, {1, 0, 0}, {0, 0, 1}}
+    }};
+
+    std::vector<CubeVertex> vertices;
+    std::vector<uint32_t> indices;
+
+    for (const auto& face : faces)
+    {
+        const auto baseIndex = (uint32_t)vertices.size();
+        const glm::vec3 center = face.normal * 0.5f;
+
+        vertices.push_back({center - (face.right * 0.5f) - (face.up * 0.5f), face.normal, {0, 1}});
+        vertices.push_back({center + (face.right * 0.5f) - (face.up * 0.5f), face.normal, {1, 1}});
+        vertices.push_back({center + (face.right * 0.5f) + (face.up * 0.5f), face.normal, {1, 0}});
+        vertices.push_back({center - (face.right * 0.5f) + (face.up * 0.5f), face.normal, {0, 0}});
+
+        indices.insert(indices.end(), {
+            baseIndex, baseIndex + 1, baseIndex + 2,
+            baseIndex, baseIndex + 2, baseIndex + 3
+        });
+    }
+
+    return {vertices, indices};
+}
+
+/**
+ * @return The position of the index'th cell of a square grid, laid out on the xz plane and centered on the origin
+ */
+static glm::vec3 GridPosition(uint32_t index, uint32_t count, float y)
+{
+    const auto gridWidth = (uint32_t)std::ceil(std::sqrt((double)count));
+    const auto halfWidth = ((float)gridWidth - 1.0f) * GRID_SPACING / 2.0f;
+
+    return {
+        ((float)(index % gridWidth) * GRID_SPACING) - halfWidth,
+        y,
+        ((float)(index / gridWidth) * GRID_SPACING) - halfWidth
+    };
+}
+
+/**
+ * Creates a single bone cube model with a looping animation which spins the bone, so that
+ * the engine has to pose its skeleton every step
+ */
+static std::unique_ptr<Engine::Model> CreateSkinnedCubeModel()
+{
+    auto model = std::make_unique<Engine::Model>();
+
+    //
+    // Mesh, with every vertex fully weighted to the one bone
+    //
+    const auto cube = GenerateCube();
+
+    std::vector<Render::BoneMeshVertex> boneVertices;
+    for (const auto& vertex : cube.first)
+    {
+        boneVertices.emplace_back(vertex.position, vertex.normal, vertex.uv, glm::vec3(0), glm::ivec4(0, -1, -1, -1), glm::vec4(1, 0, 0, 0));
+    }
+
+    Engine::ModelMesh modelMesh{};
+    modelMesh.meshIndex = 0;
+    modelMesh.name = "Cube";
+    modelMesh.meshType = Render::MeshType::Bone;
+    modelMesh.boneVertices = boneVertices;
+    modelMesh.indices = cube.second;
+    modelMesh.materialIndex = 0;
+    modelMesh.boneMap.insert({"Bone", Engine::ModelBone("Bone", 0, glm::mat4(1))});
+    model->meshes.insert({0, modelMesh});
+
+    auto material = std::make_unique<Engine::ModelPBRMaterial>();
+    material->name = "Cube";
+    material->materialIndex = 0;
+    material->metallicFactor = 0.0f;
+    material->roughnessFactor = 0.5f;
+    model->materials.insert({0, std::move(material)});
+
+    //
+    // Nodes; the root holds the mesh, its child is the skeleton's bone
+    //
+    auto rootNode = std::make_shared<Engine::ModelNode>();
+    rootNode->id = 0;
+    rootNode->name = "Root";
+    rootNode->meshIndices = {0};
+
+    auto boneNode = std::make_shared<Engine::ModelNode>();
+    boneNode->id = 1;
+    boneNode->name = "Bone";
+    boneNode->parent = rootNode;
+
+    rootNode->children = {boneNode};
+    rootNode->meshSkeletonRoots.insert({0, boneNode});
+
+    model->rootNode = rootNode;
+    model->nodeMap = {{0, rootNode}, {1, boneNode}};
+    model->nodesWithMeshes = {0};
+
+    //
+    // Animation
+    //
+    Engine::NodeKeyFrames boneKeyFrames{};
+    for (unsigned int x = 0; x <= 4; ++x)
+    {
+        const auto angle = glm::radians(90.0f * (float)x);
+        boneKeyFrames.rotationKeyFrames.emplace_back(glm::angleAxis(angle, glm::vec3(0, 1, 0)), (double)x * 25.0);
+    }
+
+    Engine::ModelAnimation animation{};
+    animation.animationName = SKINNED_ANIMATION_NAME;
+    animation.animationDurationTicks = 100.0;
+    animation.animationTicksPerSecond = 50.0;
+    animation.nodeKeyFrameMap.insert({"Bone", boneKeyFrames});
+    model->animations.insert({SKINNED_ANIMATION_NAME, animation});
+
+    return model;
+}
+
+BenchmarkClient::BenchmarkClient(const BenchmarkParams& params, SamplingMetrics* pMetrics)
+    : m_params(params)
+    , m_pMetrics(pMetrics)
+{
+
+}
+
+void BenchmarkClient::OnClientStart(Engine::IEngineAccess* pEngine)
+{
+    Engine::Client::OnClientStart(pEngine);
+
+    if (!CreateResources())
+    {
+        engine->GetLogger()->Fatal("BenchmarkClient::OnClientStart: Failed to create benchmark resources");
+        m_failed = true;
+        engine->Quit();
+        return;
+    }
+
+    if (!engine->GetDefaultWorld()->GetPhysics()->CreatePhysicsScene(BENCHMARK_PHYSICS_SCENE))
+    {
+        engine->GetLogger()->Fatal("BenchmarkClient::OnClientStart: Failed to create benchmark physics scene");
+        m_failed = true;
+        engine->Quit();
+        return;
+    }
+
+    SpawnStaticMeshes();
+    SpawnSkinnedModels();
+    SpawnLights();
+    SpawnSprites();
+    SpawnPhysicsBodies();
+    SpawnTerrain();
+
+    // Look down over the scene from far enough back to keep its grids in view
+    const auto totalCount = m_params.staticMeshCount + m_params.skinnedModelCount + m_params.physicsBodyCount;
+    const auto viewDistance = std::max(10.0f, std::sqrt((float)totalCount) * GRID_SPACING);
+
+    auto pCamera = engine->GetDefaultWorld()->GetDefaultCamera3D();
+    pCamera->SetPosition({0, viewDistance * 0.5f, viewDistance});
+    pCamera->SetLookUnit(glm::normalize(glm::vec3(0, -0.5f, -1.0f)));
+}
+
+void BenchmarkClient::OnSimulationStep(unsigned int)
+{
+    if (m_failed || m_completed)
+    {
+        return;
+    }
+
+    m_stepCount++;
+
+    if (!m_pMetrics->IsRecording() && m_stepCount >= m_params.warmupSteps)
+    {
+        m_pMetrics->SetRecording(true);
+    }
+
+    if (m_pMetrics->IsRecording() && m_pMetrics->GetSampleCount(Render::METRIC_RENDERER_CPU_ALL_FRAME_WORK) >= m_params.frameCount)
+    {
+        m_pMetrics->SetRecording(false);
+        m_completed = true;
+        engine->Quit();
+    }
+}
+
+bool BenchmarkClient::CreateResources()
+{
+    auto pResources = engine->GetResources();
+
+    //
+    // Cube mesh
+    //
+    const auto cube = GenerateCube();
+
+    std::vector<Render::MeshVertex> staticVertices;
+    for (const auto& vertex : cube.first)
+    {
+        staticVertices.emplace_back(vertex.position, vertex.normal, vertex.uv);
+    }
+
+    auto staticMeshData = std::make_unique<Render::StaticMeshData>(staticVertices, cube.second);
+    staticMeshData->cullVolume = Render::Volume(glm::vec3(-0.5f), glm::vec3(0.5f));
+
+    Render::Mesh cubeMesh{};
+    cubeMesh.type = Render::MeshType::Static;
+    cubeMesh.lodData.at(0) = Render::MeshLOD{
+        .isValid = true,
+        .pMeshData = std::move(staticMeshData)
+    };
+
+    const auto cubeMeshId = pResources->CreateMesh(&cubeMesh, BENCHMARK_TAG);
+    if (!cubeMeshId)
+    {
+        engine->GetLogger()->Error("BenchmarkClient::CreateResources: Failed to create cube mesh");
+        return false;
+    }
+    m_cubeMeshId = *cubeMeshId;
+
+    //
+    // Cube material
+    //
+    Render::PBRMaterial material{};
+    material.albedoColor = {0.8f, 0.8f, 0.8f, 1.0f};
+    material.metallicFactor = 0.0f;
+    material.roughnessFactor = 0.5f;
+
+    const auto materialId = pResources->CreateMaterial(&material, BENCHMARK_TAG);
+    if (!materialId)
+    {
+        engine->GetLogger()->Error("BenchmarkClient::CreateResources: Failed to create cube material");
+        return false;
+    }
+    m_materialId = *materialId;
+
+    //
+    // Skinned model
+    //
+    const auto skinnedModelId = pResources->CreateModel(CreateSkinnedCubeModel(), {}, BENCHMARK_TAG);
+    if (!skinnedModelId)
+    {
+        engine->GetLogger()->Error("BenchmarkClient::CreateResources: Failed to create skinned model");
+        return false;
+    }
+    m_skinnedModelId = *skinnedModelId;
+
+    //
+    // Sprite texture
+    //
+    static constexpr std::size_t SPRITE_SIZE = 16;
+
+    const NCommon::ImageData spriteImage(
+        std::vector<std::byte>(SPRITE_SIZE * SPRITE_SIZE * 4, std::byte{255}),
+        1,
+        SPRITE_SIZE,
+        SPRITE_SIZE,
+        NCommon::ImageData::PixelFormat::B8G8R8A8_SRGB
+    );
+
+    const auto spriteTextureId = pResources->CreateTexture_FromImage(&spriteImage, Render::TextureType::Texture2D, false, BENCHMARK_TAG);
+    if (!spriteTextureId)
+    {
+        engine->GetLogger()->Error("BenchmarkClient::CreateResources: Failed to create sprite texture");
+        return false;
+    }
+    m_spriteTextureId = *spriteTextureId;
+
+    //
+    // Terrain, from a rolling grayscale height map image with one pixel per data point
+    //
+    if (m_params.terrainSize > 0)
+    {
+        const auto terrainSize = m_params.terrainSize;
+
+        std::vector<std::byte> heightPixels((std::size_t)terrainSize * terrainSize * 4, std::byte{255});
+
+        for (uint32_t y = 0; y < terrainSize; ++y)
+        {
+            for (uint32_t x = 0; x < terrainSize; ++x)
+            {
+                const auto height = 0.5f + (0.25f * std::sin((float)x * 0.05f)) + (0.25f * std::cos((float)y * 0.07f));
+                heightPixels[(((std::size_t)y * terrainSize) + x) * 4] = (std::byte)(uint8_t)(height * 255.0f);
+            }
+        }
+
+        const NCommon::ImageData heightMapImage(
+            std::move(heightPixels),
+            1,
+            terrainSize,
+            terrainSize,
+            NCommon::ImageData::PixelFormat::B8G8R8A8_SRGB
+        );
+
+        // One world unit between data points; the terrain is sized through its mesh size rather than scaled,
+        // as its chunk LOD distances are world space distances
+        const auto terrain = pResources->CreateHeightMapTerrainFromImage(
+            &heightMapImage,
+            {terrainSize, terrainSize},
+            TERRAIN_DISPLACEMENT,
+            {(float)(terrainSize - 1), (float)(terrainSize - 1)},
+            std::nullopt,
+            TERRAIN_CHUNK_QUADS,
+            BENCHMARK_TAG
+        );
+        if (!terrain)
+        {
+            engine->GetLogger()->Error("BenchmarkClient::CreateResources: Failed to create terrain");
+            return false;
+        }
+        m_terrain = *terrain;
+    }
+
+    return true;
+}
+
+void BenchmarkClient::SpawnStaticMeshes()
+{
+    auto pWorld = engine->GetDefaultWorld();
+
+    for (uint32_t x = 0; x < m_params.staticMeshCount; ++x)
+    {
+        const auto entityId = pWorld->CreateEntity();
+
+        Engine::TransformComponent transform{};
+        transform.SetPosition(GridPosition(x, m_params.staticMeshCount, 0.0f));
+        Engine::AddOrUpdateComponent(pWorld, entityId, transform);
+
+        Engine::MeshRenderableComponent renderable{};
+        renderable.meshId = m_cubeMeshId;
+        renderable.materialId = m_materialId;
+        Engine::AddOrUpdateComponent(pWorld, entityId, renderable);
+    }
+}
+
+void BenchmarkClient::SpawnSkinnedModels()
+{
+    auto pWorld = engine->GetDefaultWorld();
+
+    for (uint32_t x = 0; x < m_params.skinnedModelCount; ++x)
+    {
+        const auto entityId = pWorld->CreateEntity();
+
+        Engine::TransformComponent transform{};
+        transform.SetPosition(GridPosition(x, m_params.skinnedModelCount, 2.0f));
+        Engine::AddOrUpdateComponent(pWorld, entityId, transform);
+
+        // Stagger the animations so that every model's skeleton is posed differently
+        Engine::ModelRenderableComponent renderable{};
+        renderable.modelId = m_skinnedModelId;
+        renderable.animationState = Engine::ModelAnimationState(Engine::ModelAnimationType::Looping, SKINNED_ANIMATION_NAME, (double)(x % 100));
+        Engine::AddOrUpdateComponent(pWorld, entityId, renderable);
+    }
+}
+
+void BenchmarkClient::SpawnLights()
+{
+    auto pWorld = engine->GetDefaultWorld();
+
+    for (uint32_t x = 0; x < m_params.lightCount; ++x)
+    {
+        const auto entityId = pWorld->CreateEntity();
+
+        Engine::TransformComponent transform{};
+        transform.SetPosition(GridPosition(x, m_params.lightCount, 4.0f));
+        Engine::AddOrUpdateComponent(pWorld, entityId, transform);
+
+        Engine::LightComponent light{};
+        light.type = Render::LightType::Point;
+        light.color = glm::vec3(1.0f);
+        Engine::AddOrUpdateComponent(pWorld, entityId, light);
+    }
+}
+
+void BenchmarkClient::SpawnSprites()
+{
+    auto pWorld = engine->GetDefaultWorld();
+
+    const auto virtualResolution = engine->GetVirtualResolution();
+
+    for (uint32_t x = 0; x < m_params.spriteCount; ++x)
+    {
+        const auto entityId = pWorld->CreateEntity();
+
+        // Spread the sprites across the virtual screen
+        Engine::TransformComponent transform{};
+        transform.SetPosition({
+            (float)((x * 37) % virtualResolution.w),
+            (float)((x * 53) % virtualResolution.h),
+            0.0f
+        });
+        Engine::AddOrUpdateComponent(pWorld, entityId, transform);
+
+        Engine::SpriteRenderableComponent sprite{};
+        sprite.textureId = m_spriteTextureId;
+        Engine::AddOrUpdateComponent(pWorld, entityId, sprite);
+    }
+}
+
+void BenchmarkClient::SpawnPhysicsBodies()
+{
+    if (m_params.physicsBodyCount == 0)
+    {
+        return;
+    }
+
+    auto pWorld = engine->GetDefaultWorld();
+
+    //
+    // Ground for the bodies to fall onto
+    //
+    const auto groundHalfWidth = std::max(10.0f, std::sqrt((float)m_params.physicsBodyCount) * GRID_SPACING);
+
+    Engine::PhysicsShape groundShape{};
+    groundShape.bounds = Engine::PhysicsBounds_Box{
+        .min = {-groundHalfWidth, -1.0f, -groundHalfWidth},
+        .max = {groundHalfWidth, 0.0f, groundHalfWidth}
+    };
+
+    const auto groundEntityId = pWorld->CreateEntity();
+    Engine::AddOrUpdateComponent(pWorld, groundEntityId, Engine::TransformComponent{});
+    Engine::AddOrUpdateComponent(pWorld, groundEntityId, Engine::PhysicsComponent::StaticBody(BENCHMARK_PHYSICS_SCENE, groundShape));
+
+    //
+    // Dynamic cubes, rendered so that their movement drives renderable state updates
+    //
+    Engine::PhysicsShape cubeShape{};
+    cubeShape.bounds = Engine::PhysicsBounds_Box{
+        .min = glm::vec3(-0.5f),
+        .max = glm::vec3(0.5f)
+    };
+
+    for (uint32_t x = 0; x < m_params.physicsBodyCount; ++x)
+    {
+        const auto entityId = pWorld->CreateEntity();
+
+        Engine::TransformComponent transform{};
+        transform.SetPosition(GridPosition(x, m_params.physicsBodyCount, 10.0f + (float)(x % 7)));
+        Engine::AddOrUpdateComponent(pWorld, entityId, transform);
+
+        Engine::MeshRenderableComponent renderable{};
+        renderable.meshId = m_cubeMeshId;
+        renderable.materialId = m_materialId;
+        Engine::AddOrUpdateComponent(pWorld, entityId, renderable);
+
+        Engine::AddOrUpdateComponent(pWorld, entityId, Engine::PhysicsComponent::DynamicBody(BENCHMARK_PHYSICS_SCENE, cubeShape, 1.0f));
+    }
+}
+
+void BenchmarkClient::SpawnTerrain()
+{
+    auto pWorld = engine->GetDefaultWorld();
+
+    // Every chunk's vertices are in the terrain's model space, so all the chunks share the terrain's transform
+    Engine::TransformComponent transform{};
+    transform.SetPosition({0.0f, -TERRAIN_DISPLACEMENT, 0.0f});
+
+    for (const auto& chunkMeshId : m_terrain.chunkMeshIds)
+    {
+        const auto entityId = pWorld->CreateEntity();
+
+        Engine::AddOrUpdateComponent(pWorld, entityId, transform);
+
+        Engine::MeshRenderableComponent renderable{};
+        renderable.meshId = chunkMeshId;
+        renderable.materialId = m_materialId;
+        Engine::AddOrUpdateComponent(pWorld, entityId, renderable);
+    }
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDBENCHMARKS_BENCHMARKCLIENT_H
+#define WIREDBENCHMARKS_BENCHMARKCLIENT_H
+
+#include <Wired/Engine/Client.h>
+#include <Wired/Engine/EngineCommon.h>
+#include <Wired/Engine/IResources.h>
+
+#include <Wired/Render/Id.h>
+
+#include <cstdint>
+
+namespace Wired
+{
+    class SamplingMetrics;
+
+    /**
+     * The contents of a procedurally spawned benchmark scene, and how long to run it for
+     */
+    struct BenchmarkParams
+    {
+        uint32_t staticMeshCount{0};
+        uint32_t skinnedModelCount{0};
+        uint32_t lightCount{0};
+        uint32_t spriteCount{0};
+        uint32_t physicsBodyCount{0};
+
+        // Data points along each side of a chunked height map terrain, or 0 for no terrain
+        uint32_t terrainSize{0};
+
+        // Simulation steps to run before samples start being recorded
+        uint32_t warmupSteps{60};
+
+        // Rendered frames to record samples for before quitting
+        uint32_t frameCount{600};
+    };
+
+    /**
+     * Engine client which spawns a benchmark scene through the default world when started, lets it run
+     * for a warm-up period, then records metric samples until the requested number of frames have been
+     * rendered, at which point it quits the engine.
+     */
+    class BenchmarkClient : public Engine::Client
+    {
+        public:
+
+            BenchmarkClient(const BenchmarkParams& params, SamplingMetrics* pMetrics);
+
+            void OnClientStart(Engine::IEngineAccess* pEngine) override;
+            void OnSimulationStep(unsigned int timeStepMs) override;
+
+        private:
+
+            [[nodiscard]] bool CreateResources();
+
+            void SpawnStaticMeshes();
+            void SpawnSkinnedModels();
+            void SpawnLights();
+            void SpawnSprites();
+            void SpawnPhysicsBodies();
+            void SpawnTerrain();
+
+        private:
+
+            BenchmarkParams m_params;
+            SamplingMetrics* m_pMetrics;
+
+            Render::MeshId m_cubeMeshId{};
+            Render::MaterialId m_materialId{};
+            Engine::ModelId m_skinnedModelId{};
+            Render::TextureId m_spriteTextureId{};
+            Engine::HeightMapTerrain m_terrain{};
+
+            bool m_failed{false};
+            bool m_completed{false};
+            uint32_t m_stepCount{0};
+    };
+}
+
+#endif //WIREDBENCHMARKS_BENCHMARKCLIENT_H
@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "BenchmarkReport.h"
+
+#include <algorithm>
+#include <numeric>
+#include <fstream>
+#include <format>
+#include <cmath>
+
+namespace Wired
+{
+
+/**
+ * Nearest-rank percentile of sorted samples
+ */
+static double Percentile(const std::vector<double>& sortedSamples, double percentile)
+{
+    const auto rank = (std::size_t)std::ceil((percentile / 100.0) * (double)sortedSamples.size());
+    return sortedSamples.at(std::clamp<std::size_t>(rank, 1, sortedSamples.size()) - 1);
+}
+
+PhaseReport BuildPhaseReport(const std::string& phaseName, const std::string& metricName, std::vector<double> samples)
+{
+    PhaseReport report{};
+    report.phaseName = phaseName;
+    report.metricName = metricName;
+    report.sampleCount = samples.size();
+
+    if (samples.empty())
+    {
+        return report;
+    }
+
+    std::ranges::sort(samples);
+
+    report.mean = std::accumulate(samples.cbegin(), samples.cend(), 0.0) / (double)samples.size();
+    report.p50 = Percentile(samples, 50.0);
+    report.p90 = Percentile(samples, 90.0);
+    report.p99 = Percentile(samples, 99.0);
+    report.max = samples.back();
+
+    return report;
+}
+
+void PrintReport(std::ostream& stream, const BenchmarkParams& params, const std::vector<PhaseReport>& phaseReports)
+{
+    stream << std::format("Scene: {} static meshes, {} skinned models, {} lights, {} sprites, {} physics bodies, {}x{} terrain\n",
+                          params.staticMeshCount, params.skinnedModelCount, params.lightCount, params.spriteCount, params.physicsBodyCount,
+                          params.terrainSize, params.terrainSize);
+    stream << std::format("Run: {} warm-up steps, {} recorded frames\n\n", params.warmupSteps, params.frameCount);
+
+    stream << std::format("{:<16}{:>10}{:>10}{:>10}{:>10}{:>10}{:>10}\n", "Phase (ms)", "Samples", "Mean", "P50", "P90", "P99", "Max");
+
+    for (const auto& report : phaseReports)
+    {
+        stream << std::format("{:<16}{:>10}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}{:>10.3f}\n",
+                              report.phaseName, report.sampleCount, report.mean, report.p50, report.p90, report.p99, report.max);
+    }
+}
+
+bool WriteJsonReport(const std::filesystem::path& filePath, const BenchmarkParams& params, const std::vector<PhaseReport>& phaseReports)
+{
+    std::ofstream file(filePath, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    file << "{\n";
+    file << "  \"scene\": {\n";
+    file << std::format("    \"staticMeshes\": {},\n", params.staticMeshCount);
+    file << std::format("    \"skinnedModels\": {},\n", params.skinnedModelCount);
+    file << std::format("    \"lights\": {},\n", params.lightCount);
+    file << std::format("    \"sprites\": {},\n", params.spriteCount);
+    file << std::format("    \"physicsBodies\": {},\n", params.physicsBodyCount);
+    file << std::format("    \"terrainSize\": {}\n", params.terrainSize);
+    file << "  },\n";
+    file << std::format("  \"warmupSteps\": {},\n", params.warmupSteps);
+    file << std::format("  \"frames\": {},\n", params.frameCount);
+    file << "  \"phases\": [\n";
+
+    for (std::size_t x = 0; x < phaseReports.size(); ++x)
+    {
+        const auto& report = phaseReports[x];
+
+        file << std::format(
+            "    {{\"phase\": \"{}\", \"metric\": \"{}\", \"samples\": {}, \"meanMs\": {:.4f}, \"p50Ms\": {:.4f}, \"p90Ms\": {:.4f}, \"p99Ms\": {:.4f}, \"maxMs\": {:.4f}}}{}\n",
+            report.phaseName, report.metricName, report.sampleCount, report.mean, report.p50, report.p90, report.p99, report.max,
+            (x + 1 < phaseReports.size()) ? "," : ""
+        );
+    }
+
+    file << "  ]\n";
+    file << "}\n";
+
+    return file.good();
+}
+
+}
@@ -0,0 +1,41 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDBENCHMARKS_BENCHMARKREPORT_H
+#define WIREDBENCHMARKS_BENCHMARKREPORT_H
+
+#include "BenchmarkClient.h"
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <filesystem>
+#include <cstddef>
+
+namespace Wired
+{
+    /**
+     * Distribution of the samples recorded for one phase of frame work, in milliseconds
+     */
+    struct PhaseReport
+    {
+        std::string phaseName;
+        std::string metricName;
+        std::size_t sampleCount{0};
+        double mean{0.0};
+        double p50{0.0};
+        double p90{0.0};
+        double p99{0.0};
+        double max{0.0};
+    };
+
+    [[nodiscard]] PhaseReport BuildPhaseReport(const std::string& phaseName, const std::string& metricName, std::vector<double> samples);
+
+    void PrintReport(std::ostream& stream, const BenchmarkParams& params, const std::vector<PhaseReport>& phaseReports);
+    [[nodiscard]] bool WriteJsonReport(const std::filesystem::path& filePath, const BenchmarkParams& params, const std::vector<PhaseReport>& phaseReports);
+}
+
+#endif //WIREDBENCHMARKS_BENCHMARKREPORT_H
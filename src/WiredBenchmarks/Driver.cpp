@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "BenchmarkClient.h"
+#include "BenchmarkReport.h"
+#include "SamplingMetrics.h"
+
+#include <Wired/Engine/DesktopEngine.h>
+#include <Wired/Engine/Metrics.h>
+
+#include <Wired/Render/Metrics.h>
+
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <optional>
+#include <charconv>
+
+static constexpr auto USAGE =
+    "Usage: WiredBenchmarks [--static-meshes=N] [--skinned-models=N] [--lights=N] [--sprites=N] [--physics-bodies=N]\n"
+    "                       [--terrain-size=N] [--warmup-steps=N] [--frames=N] [--device=NAME] [--json=PATH]";
+
+static bool ParseCount(std::string_view value, uint32_t& out)
+{
+    const auto result = std::from_chars(value.data(), value.data() + value.size(), out);
+    return result.ec == std::errc{} && result.ptr == value.data() + value.size();
+}
+
+/**
+ * Runs the engine headless over a procedurally spawned scene for a fixed number of frames, then reports the
+ * distribution of each phase of frame work's timings, so that performance changes can be compared against a
+ * baseline run of the same scene.
+ */
+int main(int argc, char* argv[])
+{
+    using namespace Wired;
+
+    BenchmarkParams params{};
+    std::optional<std::string> deviceName;
+    std::optional<std::string> jsonPath;
+
+    for (int x = 1; x < argc; ++x)
+    {
+        const std::string_view arg(argv[x]);
+
+        const auto separator = arg.find('=');
+        if (!arg.starts_with("--") || separator == std::string_view::npos)
+        {
+            std::cerr << USAGE << std::endl;
+            return 1;
+        }
+
+        const auto name = arg.substr(2, separator - 2);
+        const auto value = arg.substr(separator + 1);
+
+        bool valid = true;
+
+        if (name == "static-meshes") { valid = ParseCount(value, params.staticMeshCount); }
+        else if (name == "skinned-models") { valid = ParseCount(value, params.skinnedModelCount); }
+        else if (name == "lights") { valid = ParseCount(value, params.lightCount); }
+        else if (name == "sprites") { valid = ParseCount(value, params.spriteCount); }
+        else if (name == "physics-bodies") { valid = ParseCount(value, params.physicsBodyCount); }
+        else if (name == "terrain-size") { valid = ParseCount(value, params.terrainSize) && params.terrainSize != 1; }
+        else if (name == "warmup-steps") { valid = ParseCount(value, params.warmupSteps); }
+        else if (name == "frames") { valid = ParseCount(value, params.frameCount) && params.frameCount > 0; }
+        else if (name == "device") { deviceName = std::string(value); }
+        else if (name == "json") { jsonPath = std::string(value); }
+        else { valid = false; }
+
+        if (!valid)
+        {
+            std::cerr << "Invalid argument: " << arg << std::endl << USAGE << std::endl;
+            return 1;
+        }
+    }
+
+    //
+    // Run the benchmark scene
+    //
+    auto metrics = std::make_unique<SamplingMetrics>();
+    auto pMetrics = metrics.get();
+
+    Engine::DesktopEngine desktopEngine{};
+    if (!desktopEngine.Initialize("WiredBenchmarks", {0,0,1}, Engine::RunMode::Headless, NCommon::LogLevel::Warning, std::move(metrics)))
+    {
+        return 1;
+    }
+
+    if (deviceName)
+    {
+        desktopEngine.SetRequiredPhysicalDevice(*deviceName);
+    }
+
+    desktopEngine.ExecHeadless(std::make_unique<BenchmarkClient>(params, pMetrics));
+
+    //
+    // Report on the recorded samples
+    //
+    const std::vector<PhaseReport> phaseReports = {
+        BuildPhaseReport("Sim Step", Engine::METRIC_SIM_STEP_TIME, pMetrics->GetSamples(Engine::METRIC_SIM_STEP_TIME)),
+        BuildPhaseReport("State Compile", Engine::METRIC_RENDER_STATE_COMPILE_TIME, pMetrics->GetSamples(Engine::METRIC_RENDER_STATE_COMPILE_TIME)),
+        BuildPhaseReport("Render Record", Render::METRIC_RENDERER_CPU_ALL_FRAME_WORK, pMetrics->GetSamples(Render::METRIC_RENDERER_CPU_ALL_FRAME_WORK)),
+        BuildPhaseReport("GPU", Render::METRIC_RENDERER_GPU_ALL_FRAME_WORK, pMetrics->GetSamples(Render::METRIC_RENDERER_GPU_ALL_FRAME_WORK))
+    };
+
+    const bool completed = pMetrics->GetSampleCount(Render::METRIC_RENDERER_CPU_ALL_FRAME_WORK) >= params.frameCount;
+
+    desktopEngine.Destroy();
+
+    if (!completed)
+    {
+        std::cerr << "Benchmark did not run to completion" << std::endl;
+        return 1;
+    }
+
+    PrintReport(std::cout, params, phaseReports);
+
+    if (jsonPath && !WriteJsonReport(*jsonPath, params, phaseReports))
+    {
+        std::cerr << "Failed to write JSON report: " << *jsonPath << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
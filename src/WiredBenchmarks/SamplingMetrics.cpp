@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "SamplingMetrics.h"
+
+namespace Wired
+{
+
+void SamplingMetrics::SetCounterValue(const std::string& name, uintmax_t value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_counters[name] = value;
+}
+
+void SamplingMetrics::IncrementCounterValue(const std::string& name)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_counters[name]++;
+}
+
+std::optional<uintmax_t> SamplingMetrics::GetCounterValue(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_counters.find(name);
+    if (it == m_counters.cend())
+    {
+        return std::nullopt;
+    }
+
+    return it->second;
+}
+
+void SamplingMetrics::SetDoubleValue(const std::string& name, double value)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_doubles[name] = value;
+
+    if (m_recording)
+    {
+        m_samples[name].push_back(value);
+    }
+}
+
+std::optional<double> SamplingMetrics::GetDoubleValue(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_doubles.find(name);
+    if (it == m_doubles.cend())
+    {
+        return std::nullopt;
+    }
+
+    return it->second;
+}
+
+std::size_t SamplingMetrics::GetSampleCount(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_samples.find(name);
+    if (it == m_samples.cend())
+    {
+        return 0;
+    }
+
+    return it->second.size();
+}
+
+std::vector<double> SamplingMetrics::GetSamples(const std::string& name) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_samples.find(name);
+    if (it == m_samples.cend())
+    {
+        return {};
+    }
+
+    return it->second;
+}
+
+}
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDBENCHMARKS_SAMPLINGMETRICS_H
+#define WIREDBENCHMARKS_SAMPLINGMETRICS_H
+
+#include <NEON/Common/Metrics/IMetrics.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <mutex>
+#include <atomic>
+#include <cstddef>
+
+namespace Wired
+{
+    /**
+     * Metrics store which, in addition to tracking the latest value of each metric, keeps every
+     * double value that's recorded while recording is enabled, so that their distribution can be
+     * reported after a benchmark run.
+     *
+     * Thread safe; the engine records metrics from both its simulation and render threads.
+     */
+    class SamplingMetrics : public NCommon::IMetrics
+    {
+        public:
+
+            void SetCounterValue(const std::string& name, uintmax_t value) override;
+            void IncrementCounterValue(const std::string& name) override;
+            [[nodiscard]] std::optional<uintmax_t> GetCounterValue(const std::string& name) const override;
+            void SetDoubleValue(const std::string& name, double value) override;
+            [[nodiscard]] std::optional<double> GetDoubleValue(const std::string& name) const override;
+
+            void SetRecording(bool recording) { m_recording = recording; }
+            [[nodiscard]] bool IsRecording() const { return m_recording; }
+
+            [[nodiscard]] std::size_t GetSampleCount(const std::string& name) const;
+            [[nodiscard]] std::vector<double> GetSamples(const std::string& name) const;
+
+        private:
+
+            std::atomic<bool> m_recording{false};
+
+            mutable std::mutex m_mutex;
+            std::unordered_map<std::string, uintmax_t> m_counters;
+            std::unordered_map<std::string, double> m_doubles;
+            std::unordered_map<std::string, std::vector<double>> m_samples;
+    };
+}
+
+#endif //WIREDBENCHMARKS_SAMPLINGMETRICS_H
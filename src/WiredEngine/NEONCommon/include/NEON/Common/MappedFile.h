@@ -0,0 +1,58 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef NEONCOMMON_INCLUDE_NEON_COMMON_MAPPEDFILE_H
+#define NEONCOMMON_INCLUDE_NEON_COMMON_MAPPEDFILE_H
+
+#include <NEON/Common/SharedLib.h>
+
+#include <filesystem>
+#include <expected>
+#include <memory>
+#include <span>
+#include <cstddef>
+
+namespace NCommon
+{
+    /**
+     * A read-only memory mapping of a file's contents. The file is paged in by the OS on access rather
+     * than read up front; the mapping lasts until the object is destroyed.
+     */
+    class NEON_PUBLIC MappedFile
+    {
+        public:
+
+            [[nodiscard]] static std::expected<std::unique_ptr<MappedFile>, bool> Open(const std::filesystem::path& filePath);
+
+        public:
+
+            ~MappedFile();
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            /**
+             * @return A view of the file's contents
+             */
+            [[nodiscard]] std::span<const std::byte> GetBytes() const noexcept { return {m_pData, m_size}; }
+
+        private:
+
+            MappedFile() = default;
+
+        private:
+
+            std::byte const* m_pData{nullptr};
+            std::size_t m_size{0};
+
+            #if defined(_WIN32) || defined(_WIN64)
+                void* m_fileHandle{nullptr};
+                void* m_mappingHandle{nullptr};
+            #endif
+    };
+}
+
+#endif //NEONCOMMON_INCLUDE_NEON_COMMON_MAPPEDFILE_H
@@ -10,10 +10,14 @@
 #include "IMetrics.h"
 
 #include <unordered_map>
+#include <mutex>
 
 namespace NCommon
 {
-    // TODO: Memory safety, add mutexes
+    /**
+     * IMetrics implementation which keeps metric values in memory. Thread safe; metrics can be
+     * written from systems running concurrently.
+     */
     class NEON_PUBLIC InMemoryMetrics : public IMetrics
     {
         public:
@@ -27,6 +31,7 @@ namespace NCommon
 
         private:
 
+            mutable std::mutex m_mutex;
             std::unordered_map<std::string, uintmax_t> m_counters;
             std::unordered_map<std::string, double> m_doubles;
     };
@@ -100,6 +100,11 @@ namespace NCommon
                 return future;
             }
 
+            /**
+             * @return The number of threads in the pool
+             */
+            [[nodiscard]] unsigned int GetPoolSize() const noexcept { return m_poolSize; }
+
         private:
 
             struct EnqueuedMessage
@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <NEON/Common/MappedFile.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace NCommon
+{
+
+std::expected<std::unique_ptr<MappedFile>, bool> MappedFile::Open(const std::filesystem::path& filePath)
+{
+    auto mappedFile = std::unique_ptr<MappedFile>(new MappedFile());
+
+    #if defined(_WIN32) || defined(_WIN64)
+        const HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE)
+        {
+            return std::unexpected(false);
+        }
+        mappedFile->m_fileHandle = fileHandle;
+
+        LARGE_INTEGER fileSize{};
+        if (!GetFileSizeEx(fileHandle, &fileSize))
+        {
+            return std::unexpected(false);
+        }
+
+        // Mapping an empty file isn't allowed; leave the view empty
+        if (fileSize.QuadPart == 0)
+        {
+            return mappedFile;
+        }
+
+        const HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr)
+        {
+            return std::unexpected(false);
+        }
+        mappedFile->m_mappingHandle = mappingHandle;
+
+        const auto pView = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+        if (pView == nullptr)
+        {
+            return std::unexpected(false);
+        }
+
+        mappedFile->m_pData = static_cast<std::byte const*>(pView);
+        mappedFile->m_size = static_cast<std::size_t>(fileSize.QuadPart);
+    #else
+        const int fd = open(filePath.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            return std::unexpected(false);
+        }
+
+        struct stat fileStat{};
+        if (fstat(fd, &fileStat) != 0)
+        {
+            close(fd);
+            return std::unexpected(false);
+        }
+
+        // Mapping an empty file isn't allowed; leave the view empty
+        if (fileStat.st_size == 0)
+        {
+            close(fd);
+            return mappedFile;
+        }
+
+        const auto fileSize = static_cast<std::size_t>(fileStat.st_size);
+
+        void* pView = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        // The mapping holds its own reference to the file, so the descriptor isn't needed past this point
+        close(fd);
+
+        if (pView == MAP_FAILED)
+        {
+            return std::unexpected(false);
+        }
+
+        mappedFile->m_pData = static_cast<std::byte const*>(pView);
+        mappedFile->m_size = fileSize;
+    #endif
+
+    return mappedFile;
+}
+
+MappedFile::~MappedFile()
+{
+    #if defined(_WIN32) || defined(_WIN64)
+        if (m_pData != nullptr) { UnmapViewOfFile(m_pData); }
+        if (m_mappingHandle != nullptr) { CloseHandle(m_mappingHandle); }
+        if (m_fileHandle != nullptr) { CloseHandle(m_fileHandle); }
+    #else
+        if (m_pData != nullptr) { munmap(const_cast<std::byte*>(m_pData), m_size); }
+    #endif
+
+    m_pData = nullptr;
+    m_size = 0;
+}
+
+}
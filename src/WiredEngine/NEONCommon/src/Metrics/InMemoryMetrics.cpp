@@ -11,18 +11,23 @@ namespace NCommon
 
 void InMemoryMetrics::SetCounterValue(const std::string& name, uintmax_t value)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_counters.insert_or_assign(name, value);
 }
 
 void InMemoryMetrics::IncrementCounterValue(const std::string& name)
 {
-    const auto curValue = GetCounterValue(name);
-    const auto newValue = curValue ? *curValue + 1 : 0;
-    SetCounterValue(name, newValue);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    const auto it = m_counters.find(name);
+    const auto newValue = it != m_counters.cend() ? it->second + 1 : 0;
+    m_counters.insert_or_assign(name, newValue);
 }
 
 std::optional<uintmax_t> InMemoryMetrics::GetCounterValue(const std::string& name) const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     const auto it = m_counters.find(name);
     if (it == m_counters.cend())
     {
@@ -34,11 +39,14 @@ std::optional<uintmax_t> InMemoryMetrics::GetCounterValue(const std::string& nam
 
 void InMemoryMetrics::SetDoubleValue(const std::string& name, double value)
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
     m_doubles.insert_or_assign(name, value);
 }
 
 std::optional<double> InMemoryMetrics::GetDoubleValue(const std::string& name) const
 {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
     const auto it = m_doubles.find(name);
     if (it == m_doubles.cend())
     {
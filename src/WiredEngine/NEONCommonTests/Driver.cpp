@@ -5,6 +5,8 @@
  */
  
 #include "SpaceUtilTests.h"
+#include "MappedFileTests.h"
+#include "InMemoryMetricsTests.h"
 
 #include <gtest/gtest.h>
 
@@ -0,0 +1,74 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_NEONCOMMONTESTS_INMEMORYMETRICSTESTS_H
+#define WIREDENGINE_NEONCOMMONTESTS_INMEMORYMETRICSTESTS_H
+
+#include <gtest/gtest.h>
+
+#include <NEON/Common/Metrics/InMemoryMetrics.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace NCommon
+{
+    TEST(InMemoryMetricsTests, StoresValues)
+    {
+        InMemoryMetrics metrics;
+
+        EXPECT_FALSE(metrics.GetCounterValue("counter"));
+        EXPECT_FALSE(metrics.GetDoubleValue("double"));
+
+        metrics.SetCounterValue("counter", 5);
+        metrics.IncrementCounterValue("counter");
+        metrics.SetDoubleValue("double", 2.5);
+
+        EXPECT_EQ(metrics.GetCounterValue("counter"), 6U);
+        EXPECT_EQ(metrics.GetDoubleValue("double"), 2.5);
+    }
+
+    TEST(InMemoryMetricsTests, ConcurrentWritesAreNotLost)
+    {
+        constexpr unsigned int NUM_THREADS = 8;
+        constexpr unsigned int NUM_INCREMENTS = 10000;
+
+        InMemoryMetrics metrics;
+        metrics.SetCounterValue("shared", 0);
+
+        std::vector<std::thread> threads;
+
+        for (unsigned int t = 0; t < NUM_THREADS; ++t)
+        {
+            threads.emplace_back([&metrics, t](){
+                const auto ownName = "thread" + std::to_string(t);
+
+                for (unsigned int x = 0; x < NUM_INCREMENTS; ++x)
+                {
+                    metrics.IncrementCounterValue("shared");
+                    metrics.SetCounterValue(ownName, x);
+                    metrics.SetDoubleValue(ownName, static_cast<double>(x));
+                }
+            });
+        }
+
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+
+        EXPECT_EQ(metrics.GetCounterValue("shared"), NUM_THREADS * NUM_INCREMENTS);
+
+        for (unsigned int t = 0; t < NUM_THREADS; ++t)
+        {
+            EXPECT_EQ(metrics.GetCounterValue("thread" + std::to_string(t)), NUM_INCREMENTS - 1);
+            EXPECT_EQ(metrics.GetDoubleValue("thread" + std::to_string(t)), static_cast<double>(NUM_INCREMENTS - 1));
+        }
+    }
+}
+
+#endif //WIREDENGINE_NEONCOMMONTESTS_INMEMORYMETRICSTESTS_H
@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_NEONCOMMONTESTS_MAPPEDFILETESTS_H
+#define WIREDENGINE_NEONCOMMONTESTS_MAPPEDFILETESTS_H
+
+#include <gtest/gtest.h>
+
+#include <NEON/Common/MappedFile.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <cstddef>
+
+namespace NCommon
+{
+    [[nodiscard]] static std::filesystem::path WriteMappedFileTestFile(const std::string& fileName, const std::vector<std::byte>& contents)
+    {
+        const auto filePath = std::filesystem::temp_directory_path() / fileName;
+
+        std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+
+        return filePath;
+    }
+
+    TEST(MappedFileTests, MapsFileContents)
+    {
+        std::vector<std::byte> contents(10000);
+        for (std::size_t x = 0; x < contents.size(); ++x)
+        {
+            contents[x] = static_cast<std::byte>(x % 251);
+        }
+
+        const auto filePath = WriteMappedFileTestFile("NEONCommonTests_MapsFileContents.bin", contents);
+
+        {
+            const auto mappedFile = MappedFile::Open(filePath);
+            ASSERT_TRUE(mappedFile.has_value());
+
+            const auto bytes = (*mappedFile)->GetBytes();
+            ASSERT_EQ(bytes.size(), contents.size());
+            EXPECT_TRUE(std::equal(bytes.begin(), bytes.end(), contents.begin()));
+        }
+
+        std::filesystem::remove(filePath);
+    }
+
+    TEST(MappedFileTests, EmptyFileMapsToEmptyView)
+    {
+        const auto filePath = WriteMappedFileTestFile("NEONCommonTests_EmptyFileMapsToEmptyView.bin", {});
+
+        {
+            const auto mappedFile = MappedFile::Open(filePath);
+            ASSERT_TRUE(mappedFile.has_value());
+            EXPECT_TRUE((*mappedFile)->GetBytes().empty());
+        }
+
+        std::filesystem::remove(filePath);
+    }
+
+    TEST(MappedFileTests, MissingFileFailsToOpen)
+    {
+        const auto filePath = std::filesystem::temp_directory_path() / "NEONCommonTests_MissingFileFailsToOpen.bin";
+        std::filesystem::remove(filePath);
+
+        EXPECT_FALSE(MappedFile::Open(filePath).has_value());
+    }
+}
+
+#endif //WIREDENGINE_NEONCOMMONTESTS_MAPPEDFILETESTS_H
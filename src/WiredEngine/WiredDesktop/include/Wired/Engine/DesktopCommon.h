@@ -12,6 +12,7 @@ namespace Wired::Engine
     const auto WIRED_FILES_SUBDIR = "wired";
     const auto PACKAGES_FILES_SUBDIR = "packages";
     const auto SHADERS_FILES_SUBDIR = "shaders";
+    const auto CACHE_FILES_SUBDIR = "cache";
 }
 
 #endif //WIREDENGINE_WIREDDESKTOP_INCLUDE_WIRED_ENGINE_DESKTOPCOMMON_H
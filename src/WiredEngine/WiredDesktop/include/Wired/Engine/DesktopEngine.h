@@ -11,6 +11,7 @@
 
 #include <NEON/Common/SharedLib.h>
 #include <NEON/Common/Log/ILogger.h>
+#include <NEON/Common/Metrics/IMetrics.h>
 
 #include <string>
 #include <utility>
@@ -18,11 +19,6 @@
 #include <memory>
 #include <vector>
 
-namespace NCommon
-{
-    class IMetrics;
-}
-
 namespace Wired::Render
 {
     class IRenderer;
@@ -50,10 +46,14 @@ namespace Wired::Engine
             DesktopEngine();
             ~DesktopEngine();
 
+            /**
+             * @param metrics Optional metrics sink for the engine to record to. Defaults to an in-memory store.
+             */
             [[nodiscard]] bool Initialize(const std::string& applicationName,
                                           const std::tuple<uint32_t, uint32_t, uint32_t>& applicationVersion,
                                           RunMode runMode,
-                                          NCommon::LogLevel minlogLevel = NCommon::LogLevel::Warning);
+                                          NCommon::LogLevel minlogLevel = NCommon::LogLevel::Warning,
+                                          std::unique_ptr<NCommon::IMetrics> metrics = nullptr);
             void Destroy();
 
             //
@@ -70,6 +70,7 @@ namespace Wired::Engine
         private:
 
             bool m_initialized{false};
+            std::string m_applicationName;
             RunMode m_runMode{};
             std::unique_ptr<NCommon::ILogger> m_logger;
             std::unique_ptr<NCommon::IMetrics> m_metrics;
@@ -65,11 +65,13 @@ PFN_vkGetInstanceProcAddr GetSDLVulkanGetInstanceProcAddr()
 bool DesktopEngine::Initialize(const std::string& applicationName,
                                const std::tuple<uint32_t, uint32_t, uint32_t>& applicationVersion,
                                RunMode runMode,
-                               NCommon::LogLevel minlogLevel)
+                               NCommon::LogLevel minlogLevel,
+                               std::unique_ptr<NCommon::IMetrics> metrics)
 {
+    m_applicationName = applicationName;
     m_runMode = runMode;
     m_logger = std::make_unique<NCommon::StdLogger>(minlogLevel);
-    m_metrics = std::make_unique<NCommon::InMemoryMetrics>();
+    m_metrics = metrics ? std::move(metrics) : std::make_unique<NCommon::InMemoryMetrics>();
 
     //
     // Initialize SDL video system
@@ -157,7 +159,8 @@ void DesktopEngine::SetRequiredPhysicalDevice(const std::string& physicalDeviceN
     m_gpu->SetRequiredPhysicalDevice(physicalDeviceName);
 }
 
-bool ExecWithWindow(NCommon::ILogger* pLogger,
+bool ExecWithWindow(const std::string& applicationName,
+                    NCommon::ILogger* pLogger,
                     NCommon::IMetrics* pMetrics,
                     GPU::WiredGPUVk* pGPU,
                     Render::IRenderer* pRenderer,
@@ -181,7 +184,7 @@ bool ExecWithWindow(NCommon::ILogger* pLogger,
     //
     // Setup platform systems
     //
-    auto desktopFiles = std::make_unique<Platform::DesktopFiles>(pLogger);
+    auto desktopFiles = std::make_unique<Platform::DesktopFiles>(pLogger, applicationName);
     auto events = std::make_unique<Platform::SDLEvents>(pRenderer);
     auto image = std::make_unique<Platform::SDLImage>(pLogger);
     auto text = std::make_unique<Platform::SDLText>(pLogger);
@@ -216,6 +219,7 @@ bool DesktopEngine::ExecWindowed(const std::string& windowTitle, const NCommon::
     }
 
     return ExecWithWindow(
+        m_applicationName,
         m_logger.get(),
         m_metrics.get(),
         m_gpu.get(),
@@ -241,6 +245,7 @@ bool DesktopEngine::ExecMaximized(const std::string& windowTitle, std::unique_pt
     }
 
     return ExecWithWindow(
+        m_applicationName,
         m_logger.get(),
         m_metrics.get(),
         m_gpu.get(),
@@ -266,6 +271,7 @@ bool DesktopEngine::ExecFullscreenBorderless(const std::string& windowTitle, std
     }
 
     return ExecWithWindow(
+        m_applicationName,
         m_logger.get(),
         m_metrics.get(),
         m_gpu.get(),
@@ -293,7 +299,7 @@ bool DesktopEngine::ExecHeadless(std::unique_ptr<Client> pClient)
     //
     // Setup platform systems
     //
-    auto desktopFiles = std::make_unique<Platform::DesktopFiles>(m_logger.get());
+    auto desktopFiles = std::make_unique<Platform::DesktopFiles>(m_logger.get(), m_applicationName);
     auto window = std::make_shared<Platform::SDLWindow>(m_logger.get());
     auto events = std::make_unique<Platform::SDLEvents>( m_renderer.get());
     auto image = std::make_unique<Platform::SDLImage>(m_logger.get());
@@ -324,6 +330,7 @@ void DesktopEngine::Destroy()
     SDL_Quit();
 
     m_initialized = false;
+    m_applicationName = {};
     m_runMode = {};
     m_logger = nullptr;
     m_metrics = nullptr;
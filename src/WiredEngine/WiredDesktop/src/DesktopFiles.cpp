@@ -8,10 +8,13 @@
 
 #include <Wired/Engine/DesktopCommon.h>
 #include <Wired/Engine/Package/DiskPackageSource.h>
+#include <Wired/Engine/Package/ArchivePackageSource.h>
 
 #include <NEON/Common/Log/ILogger.h>
 
 #include <SDL3/SDL_filesystem.h>
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_stdinc.h>
 
 #include <fstream>
 #include <ranges>
@@ -20,8 +23,9 @@
 namespace Wired::Platform
 {
 
-DesktopFiles::DesktopFiles(NCommon::ILogger* pLogger)
+DesktopFiles::DesktopFiles(NCommon::ILogger* pLogger, std::string applicationName)
     : m_pLogger(pLogger)
+    , m_applicationName(std::move(applicationName))
 {
 
 }
@@ -106,10 +110,45 @@ std::expected<std::vector<std::unique_ptr<Engine::IPackageSource>>, bool> Deskto
         return std::unexpected(false);
     }
 
+    const auto packageFilePaths = GetFilesInDirectory(packagesDirectory);
+    if (!packageFilePaths)
+    {
+        return std::unexpected(false);
+    }
+
     std::vector<std::unique_ptr<Engine::IPackageSource>> packageSources;
+    std::unordered_set<std::string> archivedPackageNames;
+
+    //
+    // Package archives
+    //
+    for (const auto& packageFilePath : *packageFilePaths)
+    {
+        if (packageFilePath.extension().string() != std::string(".") + Engine::PACKAGE_ARCHIVE_EXTENSION)
+        {
+            continue;
+        }
+
+        auto packageSource = std::make_unique<Engine::ArchivePackageSource>(packageFilePath);
+        if (!packageSource->OpenBlocking(m_pLogger))
+        {
+            continue;
+        }
 
+        archivedPackageNames.insert(packageFilePath.stem().string());
+        packageSources.emplace_back(std::move(packageSource));
+    }
+
+    //
+    // Package directories; a package which is also present as an archive is loaded from the archive
+    //
     for (const auto& packageDirectoryPath : *packageDirectoryPaths)
     {
+        if (archivedPackageNames.contains(packageDirectoryPath.filename().string()))
+        {
+            continue;
+        }
+
         auto packageSource = std::make_unique<Engine::DiskPackageSource>(packageDirectoryPath);
         if (!packageSource->OpenBlocking(m_pLogger))
         {
@@ -177,4 +216,20 @@ std::expected<IFiles::ShaderContentsMap, bool> DesktopFiles::GetEngineShaderCont
     return shaderAssetContents;
 }
 
+std::optional<std::filesystem::path> DesktopFiles::GetCacheDirectoryPath() const
+{
+    // SDL gives a per-user, per-app writable directory, creating it if needed
+    char* pPrefPath = SDL_GetPrefPath(Engine::WIRED_FILES_SUBDIR, m_applicationName.c_str());
+    if (pPrefPath == nullptr)
+    {
+        LogWarning("DesktopFiles::GetCacheDirectoryPath: Failed to get pref path: {}", SDL_GetError());
+        return std::nullopt;
+    }
+
+    const auto prefPath = std::filesystem::path(pPrefPath);
+    SDL_free(pPrefPath);
+
+    return prefPath / Engine::CACHE_FILES_SUBDIR;
+}
+
 }
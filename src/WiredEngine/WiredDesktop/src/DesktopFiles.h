@@ -12,6 +12,7 @@
 #include <Wired/Platform/IFiles.h>
 
 #include <filesystem>
+#include <string>
 
 namespace NCommon
 {
@@ -24,11 +25,12 @@ namespace Wired::Platform
     {
         public:
 
-            explicit DesktopFiles(NCommon::ILogger* pLogger);
+            DesktopFiles(NCommon::ILogger* pLogger, std::string applicationName);
             ~DesktopFiles() override;
 
             [[nodiscard]] std::expected<std::vector<std::unique_ptr<Engine::IPackageSource>>, bool> GetPackageSourcesBlocking() const override;
             [[nodiscard]] std::expected<ShaderContentsMap, bool> GetEngineShaderContentsBlocking(GPU::ShaderBinaryType shaderBinaryType) const override;
+            [[nodiscard]] std::optional<std::filesystem::path> GetCacheDirectoryPath() const override;
 
         private:
 
@@ -37,6 +39,7 @@ namespace Wired::Platform
         private:
 
             NCommon::ILogger* m_pLogger;
+            std::string m_applicationName;
     };
 }
 
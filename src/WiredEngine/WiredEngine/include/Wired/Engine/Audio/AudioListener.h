@@ -32,6 +32,9 @@ namespace Wired::Engine
         // The listener's position, in world space
         glm::vec3 worldPosition{0.0f, 0.0f, 0.0f};
 
+        // The listener's velocity, in world units per second. Used for doppler.
+        glm::vec3 worldVelocity{0.0f, 0.0f, 0.0f};
+
         // The listener's orientation unit vector
         glm::vec3 lookUnit{0.0f, 0.0f, -1.0f};
 
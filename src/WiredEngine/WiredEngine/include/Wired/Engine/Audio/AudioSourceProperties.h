@@ -7,6 +7,8 @@
 #ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_AUDIO_AUDIOSOURCEPROPERTIES_H
 #define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_AUDIO_AUDIOSOURCEPROPERTIES_H
 
+#include <cstdint>
+
 namespace Wired::Engine
 {
     /**
@@ -26,6 +28,10 @@ namespace Wired::Engine
         // about -6dB. Each multiplicaton by 2 equals an amplification of about +6dB. A value
         // of 0.0 is meaningless with respect to a logarithmic scale; it is silent.
         float gain{1.0f};
+
+        // When more sources are playing than there are voices available, higher priority sources are
+        // given voices first, while the others are virtualized (their playback is tracked, silently)
+        uint32_t priority{0};
     };
 }
 
@@ -23,6 +23,7 @@
 #include <NEON/Common/AudioData.h>
 #include <NEON/Common/Space/Size2D.h>
 #include <NEON/Common/Space/Size3D.h>
+#include <NEON/Common/Space/Rect.h>
 
 #include <expected>
 #include <string>
@@ -43,6 +44,24 @@ namespace Wired::Engine
         glm::vec3 pointNormalUnit_modelSpace{0.0f};
     };
 
+    /**
+     * A height map which is rendered as a set of independently culled and LODed chunk meshes
+     */
+    struct HeightMapTerrain
+    {
+        /**
+         * Identifies the terrain's height map as a whole, for use with height map queries and
+         * PhysicsBounds_HeightMap. Also the mesh of the terrain's first chunk.
+         */
+        Render::MeshId heightMapMeshId{};
+
+        /**
+         * The meshes of the terrain's chunks. Chunk vertices are all in the terrain's model space, so
+         * each chunk mesh should be rendered with the terrain's transform.
+         */
+        std::vector<Render::MeshId> chunkMeshIds;
+    };
+
     struct RenderTextResult
     {
         /**
@@ -59,6 +78,38 @@ namespace Wired::Engine
         NCommon::Size2DUInt textRenderSize{};
     };
 
+    /**
+     * One glyph of laid out text, drawn from a glyph atlas page
+     */
+    struct TextGlyph
+    {
+        /**
+         * The atlas page texture which contains the glyph. All glyphs on the same page render as
+         * one sprite batch.
+         */
+        Render::TextureId textureId{};
+
+        /**
+         * The glyph's pixel area within the atlas page, for use as a sprite's srcPixelRect
+         */
+        NCommon::RectReal srcPixelRect{};
+
+        /**
+         * Pixel offset of the glyph's top-left from the top-left of the text
+         */
+        glm::vec2 offset{0.0f};
+    };
+
+    struct LayoutTextResult
+    {
+        std::vector<TextGlyph> glyphs;
+
+        /**
+         * The pixel size of the laid out text
+         */
+        NCommon::Size2DUInt textRenderSize{};
+    };
+
     class IResources
     {
         public:
@@ -100,6 +151,20 @@ namespace Wired::Engine
                 const NCommon::Size2DReal& meshSize_worldSpace,
                 const std::optional<float>& uvSpanWorldSize,
                 const std::string& userTag) = 0;
+            /**
+             * Creates a height map which is rendered as chunks of (at most) chunkQuads x chunkQuads quads, each with
+             * its own culling and LODs. Chunk LOD distances are world space distances derived from meshSize_worldSpace,
+             * so the terrain's entities should be rendered without scale; size the terrain with meshSize_worldSpace.
+             */
+            [[nodiscard]] virtual std::expected<HeightMapTerrain, bool> CreateHeightMapTerrainFromImage(
+                const NCommon::ImageData* pImage,
+                const NCommon::Size2DUInt& dataSize,
+                const float& displacementFactor,
+                const NCommon::Size2DReal& meshSize_worldSpace,
+                const std::optional<float>& uvSpanWorldSize,
+                const uint32_t& chunkQuads,
+                const std::string& userTag) = 0;
+            virtual void DestroyHeightMapTerrain(const HeightMapTerrain& terrain) = 0;
             [[nodiscard]] virtual std::optional<NCommon::Size2DReal> GetHeightMapMeshWorldSize(const Render::MeshId& meshId) const = 0;
             [[nodiscard]] virtual std::optional<HeightMapQueryResult> QueryHeightMapMesh(const Render::MeshId& meshId,
                                                                                          const glm::vec2& point_modelSpace) const = 0;
@@ -119,6 +184,12 @@ namespace Wired::Engine
             // Audio
             //
             [[nodiscard]] virtual bool CreateResourceAudio(const ResourceIdentifier& resourceIdentifier, const NCommon::AudioData* pAudioData) = 0;
+
+            /**
+             * Creates resource audio which is kept in its encoded form and decoded in chunks while it's played, rather
+             * than being decoded up front. Intended for long audio, such as music. Only WAV data is supported.
+             */
+            [[nodiscard]] virtual bool CreateResourceStreamedAudio(const ResourceIdentifier& resourceIdentifier, std::vector<std::byte> encodedAudio) = 0;
             virtual void DestroyResourceAudio(const ResourceIdentifier& resourceIdentifier) = 0;
 
             //
@@ -130,6 +201,20 @@ namespace Wired::Engine
                                                                                    const ResourceIdentifier& font,
                                                                                    const Platform::TextProperties& textProperties) = 0;
 
+            /**
+             * Lays out text as glyphs from a glyph atlas for the font, size and foreground color, rather than
+             * rendering it to a texture of its own. Glyphs are rasterized into the atlas the first time they're
+             * used; after that, laying out text costs no rasterization or texture creation. textProperties'
+             * bgColor is ignored; glyphs have transparent backgrounds.
+             *
+             * Create a sprite per returned glyph to draw the text. When an atlas fills up, its least recently
+             * used page is evicted, which invalidates glyphs previously laid out from that page; re-lay out text
+             * that is kept on screen when it changes.
+             */
+            [[nodiscard]] virtual std::expected<LayoutTextResult, bool> LayoutText(const std::string& text,
+                                                                                   const ResourceIdentifier& font,
+                                                                                   const Platform::TextProperties& textProperties) = 0;
+
             //
             // Materials
             //
@@ -0,0 +1,69 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_ARCHIVEPACKAGESOURCE_H
+#define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_ARCHIVEPACKAGESOURCE_H
+
+#include "IPackageSource.h"
+#include "PackageArchive.h"
+
+#include <NEON/Common/SharedLib.h>
+#include <NEON/Common/MappedFile.h>
+
+#include <filesystem>
+#include <optional>
+#include <memory>
+
+namespace NCommon
+{
+    class ILogger;
+}
+
+namespace Wired::Engine
+{
+    /**
+     * Package source backed by a single package archive file (see PackageArchive.h). The archive is memory
+     * mapped, so asset spans are views directly into the mapping with no copying or per-asset file opens.
+     */
+    class NEON_PUBLIC ArchivePackageSource : public IPackageSource
+    {
+        public:
+
+            explicit ArchivePackageSource(std::filesystem::path archiveFilePath);
+
+            [[nodiscard]] std::expected<void, bool> OpenBlocking(NCommon::ILogger* pLogger);
+
+            // IPackageSource
+            [[nodiscard]] PackageName GetPackageName() const override;
+            [[nodiscard]] Package GetMetadata() const override;
+            [[nodiscard]] std::expected<std::vector<std::byte>, bool>
+                GetAssetBytesBlocking(AssetType assetType, std::string_view assetName) const override;
+            [[nodiscard]] std::expected<std::vector<std::byte>, bool>
+                GetModelSubAssetBytesBlocking(std::string_view modelAssetName, std::string_view assetName) const override;
+            [[nodiscard]] std::expected<std::span<const std::byte>, bool>
+                GetAssetSpanBlocking(AssetType assetType, std::string_view assetName) const override;
+            [[nodiscard]] std::expected<std::span<const std::byte>, bool>
+                GetModelSubAssetSpanBlocking(std::string_view modelAssetName, std::string_view assetName) const override;
+
+        private:
+
+            [[nodiscard]] std::optional<ArchiveIndexEntry> FindEntry(ArchiveEntryType entryType, uint32_t assetType, std::string_view name) const;
+            [[nodiscard]] std::expected<std::span<const std::byte>, bool> GetEntrySpan(const ArchiveIndexEntry& entry) const;
+            [[nodiscard]] std::string_view GetEntryName(const ArchiveIndexEntry& entry) const;
+
+        private:
+
+            std::filesystem::path m_archiveFilePath;
+
+            std::unique_ptr<NCommon::MappedFile> m_mappedFile;
+            std::span<const ArchiveIndexEntry> m_index;
+            std::span<const char> m_strings;
+
+            Package m_package{};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_ARCHIVEPACKAGESOURCE_H
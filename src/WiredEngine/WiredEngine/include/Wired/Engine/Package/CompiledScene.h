@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_COMPILEDSCENE_H
+#define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_COMPILEDSCENE_H
+
+#include "Scene.h"
+
+#include <NEON/Common/SharedLib.h>
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <expected>
+#include <span>
+#include <cstdint>
+#include <cstddef>
+#include <limits>
+
+namespace Wired::Engine
+{
+    /**
+     * Compact, structure-of-arrays form of a Scene, used for fast scene loading and bulk entity instantiation.
+     *
+     * Names are stored once in a string table and referenced by index. Each component type's values are stored
+     * in their own arrays, alongside the index of the entity node each value belongs to. Entity nodes are
+     * numbered in the order they appear in the source scene.
+     */
+    struct CompiledScene
+    {
+        static constexpr uint32_t NO_STRING = std::numeric_limits<uint32_t>::max();
+
+        std::string name;
+        std::vector<std::string> strings;
+
+        // Per entity node, the string index of its name
+        std::vector<uint32_t> entityNames;
+
+        struct Transforms
+        {
+            std::vector<uint32_t> entities;
+            std::vector<glm::vec3> positions;
+            std::vector<glm::vec3> scales;
+            std::vector<glm::vec3> eulerRotations;
+        } transforms;
+
+        struct Sprites
+        {
+            std::vector<uint32_t> entities;
+            std::vector<uint32_t> imageAssetNames; // String index, or NO_STRING
+            std::vector<glm::vec2> destVirtualSizes;
+        } sprites;
+
+        struct Models
+        {
+            std::vector<uint32_t> entities;
+            std::vector<uint32_t> modelAssetNames; // String index, or NO_STRING
+        } models;
+
+        struct PhysicsBoxes
+        {
+            std::vector<uint32_t> entities;
+            std::vector<uint32_t> physicsScenes;
+            std::vector<glm::vec3> localScales;
+            std::vector<glm::vec3> mins;
+            std::vector<glm::vec3> maxs;
+        } physicsBoxes;
+
+        struct PhysicsSpheres
+        {
+            std::vector<uint32_t> entities;
+            std::vector<uint32_t> physicsScenes;
+            std::vector<float> localScales;
+            std::vector<float> radii;
+        } physicsSpheres;
+
+        struct PhysicsHeightMaps
+        {
+            std::vector<uint32_t> entities;
+            std::vector<uint32_t> physicsScenes;
+            std::vector<glm::vec3> localScales;
+        } physicsHeightMaps;
+
+        struct Players
+        {
+            std::vector<uint32_t> names;
+            std::vector<glm::vec3> positions;
+            std::vector<float> heights;
+            std::vector<float> radii;
+        } players;
+    };
+
+    [[nodiscard]] NEON_PUBLIC CompiledScene CompileScene(const Scene& scene);
+    [[nodiscard]] NEON_PUBLIC std::shared_ptr<Scene> DecompileScene(const CompiledScene& compiledScene);
+
+    /**
+     * Binary scene encoding. Arrays are stored as raw, contiguous, little-endian blocks.
+     */
+    [[nodiscard]] NEON_PUBLIC std::vector<std::byte> CompiledSceneToBytes(const CompiledScene& compiledScene);
+    [[nodiscard]] NEON_PUBLIC std::expected<CompiledScene, bool> CompiledSceneFromBytes(std::span<const std::byte> bytes);
+}
+
+#endif //WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_COMPILEDSCENE_H
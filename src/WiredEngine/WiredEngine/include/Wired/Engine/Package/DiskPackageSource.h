@@ -37,6 +37,10 @@ namespace Wired::Engine
             [[nodiscard]] std::expected<std::vector<std::byte>, bool>
                 GetModelSubAssetBytesBlocking(std::string_view modelAssetName, std::string_view assetName) const override;
 
+        private:
+
+            [[nodiscard]] std::filesystem::path GetModelDirectoryPath(std::string_view modelAssetName) const;
+
         private:
 
             std::filesystem::path m_packageDirectoryPath;
@@ -18,6 +18,7 @@
 #include <vector>
 #include <cstddef>
 #include <expected>
+#include <span>
 
 namespace Wired::Engine
 {
@@ -36,6 +37,15 @@ namespace Wired::Engine
                 GetAssetBytesBlocking(AssetType assetType, std::string_view assetName) const = 0;
             [[nodiscard]] virtual std::expected<std::vector<std::byte>, bool>
                 GetModelSubAssetBytesBlocking(std::string_view modelAssetName, std::string_view assetName) const = 0;
+
+            // Optional; sources which hold their contents in memory can return views of content bytes directly,
+            // avoiding a copy. Views remain valid for the lifetime of the source.
+            [[nodiscard]] virtual std::expected<std::span<const std::byte>, bool>
+                GetAssetSpanBlocking(AssetType, std::string_view) const
+                { return std::unexpected(false); }
+            [[nodiscard]] virtual std::expected<std::span<const std::byte>, bool>
+                GetModelSubAssetSpanBlocking(std::string_view, std::string_view) const
+                { return std::unexpected(false); }
     };
 }
 
@@ -10,8 +10,10 @@
 #include "PackageManifest.h"
 #include "AssetNames.h"
 #include "Scene.h"
+#include "CompiledScene.h"
 
 #include <vector>
+#include <memory>
 
 namespace Wired::Engine
 {
@@ -19,7 +21,11 @@ namespace Wired::Engine
     {
         Engine::PackageManifest manifest{};
         Engine::AssetNames assetNames{};
+        // Scenes available in editable form; scenes which were only provided in binary form aren't present
         std::vector<std::shared_ptr<Scene>> scenes{};
+
+        // All of the package's scenes, compiled once when the package was read, ready to be loaded into worlds
+        std::vector<std::shared_ptr<const CompiledScene>> compiledScenes{};
     };
 }
 
@@ -0,0 +1,101 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_PACKAGEARCHIVE_H
+#define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_PACKAGEARCHIVE_H
+
+#include "PackageCommon.h"
+
+#include <NEON/Common/SharedLib.h>
+
+#include <filesystem>
+#include <expected>
+#include <string>
+#include <string_view>
+#include <cstdint>
+
+namespace NCommon
+{
+    class ILogger;
+}
+
+namespace Wired::Engine
+{
+    /**
+     * Package archives contain the entire contents of a package directory in a single file:
+     *
+     * [ArchiveHeader][entry data ...][ArchiveIndexEntry x entryCount][name strings]
+     *
+     * Entry data blobs start at PACKAGE_ARCHIVE_DATA_ALIGNMENT aligned offsets so that they can be uploaded to
+     * the GPU directly from a mapping of the file. Index entries are sorted by (entryType, assetType, nameHash,
+     * name) so that entries can be binary searched. All values are little-endian.
+     */
+    constexpr auto PACKAGE_ARCHIVE_EXTENSION = "wpa";
+    constexpr uint32_t PACKAGE_ARCHIVE_MAGIC = 0x4150574E; // "NWPA"
+    constexpr uint32_t PACKAGE_ARCHIVE_VERSION = 1;
+    constexpr uint64_t PACKAGE_ARCHIVE_DATA_ALIGNMENT = 256;
+
+    enum class ArchiveEntryType : uint32_t
+    {
+        Manifest,       // The package's manifest
+        Scene,          // A scene, in CompiledScene binary form, named by its source file name
+        Asset,          // An asset, named by asset name
+        ModelSubAsset   // A file within a model's directory, named by "<model asset name>/<relative file path>"
+    };
+
+    enum class ArchiveCompression : uint32_t
+    {
+        None
+    };
+
+    struct ArchiveHeader
+    {
+        uint32_t magic{PACKAGE_ARCHIVE_MAGIC};
+        uint32_t version{PACKAGE_ARCHIVE_VERSION};
+        uint64_t entryCount{0};
+        uint64_t indexOffset{0};
+        uint64_t stringsOffset{0};
+        uint64_t stringsByteSize{0};
+    };
+    static_assert(sizeof(ArchiveHeader) == 40);
+
+    struct ArchiveIndexEntry
+    {
+        uint32_t entryType{0};      // ArchiveEntryType
+        uint32_t assetType{0};      // AssetType, for Asset entries
+        uint64_t nameHash{0};       // ArchiveNameHash of the entry's name
+        uint64_t nameOffset{0};     // Offset of the entry's name within the strings block
+        uint32_t nameByteSize{0};
+        uint32_t compression{0};    // ArchiveCompression
+        uint64_t dataOffset{0};     // Offset of the entry's data from the start of the archive
+        uint64_t dataByteSize{0};   // Stored (possibly compressed) size of the entry's data
+        uint64_t uncompressedByteSize{0};
+    };
+    static_assert(sizeof(ArchiveIndexEntry) == 56);
+
+    /**
+     * Stable (FNV-1a) hash of an entry name, as stored in archive indices
+     */
+    [[nodiscard]] NEON_PUBLIC uint64_t ArchiveNameHash(std::string_view name);
+
+    /**
+     * @return The entry name a model sub-asset is stored under. Path separators in the sub-asset name are
+     * normalized so that lookups match regardless of how the model file references them.
+     */
+    [[nodiscard]] NEON_PUBLIC std::string ArchiveModelSubAssetName(std::string_view modelAssetName, std::string_view assetName);
+
+    /**
+     * Builds a package archive from the contents of a package directory.
+     *
+     * @param packageDirectoryPath The package directory to archive
+     * @param archiveFilePath Path of the archive file to write. Written atomically; replaces any existing file.
+     */
+    [[nodiscard]] NEON_PUBLIC std::expected<void, bool> WritePackageArchive(NCommon::ILogger* pLogger,
+                                                                           const std::filesystem::path& packageDirectoryPath,
+                                                                           const std::filesystem::path& archiveFilePath);
+}
+
+#endif //WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PACKAGE_PACKAGEARCHIVE_H
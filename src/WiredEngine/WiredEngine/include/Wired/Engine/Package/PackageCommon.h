@@ -64,6 +64,7 @@ namespace Wired::Engine
 
     constexpr auto PACKAGE_EXTENSION = "wpk";
     constexpr auto SCENE_EXTENSION = "wsc";
+    constexpr auto SCENE_BINARY_EXTENSION = "wscb"; // CompiledScene binary encoding, see CompiledScene.h
     constexpr auto PACKAGE_SCENES_DIRECTORY = "scenes";
     constexpr auto PACKAGE_ASSETS_DIRECTORY = "assets";
     constexpr auto PACKAGE_ASSETS_IMAGES_DIRECTORY = "images";
@@ -73,6 +74,8 @@ namespace Wired::Engine
     constexpr auto PACKAGE_ASSETS_FONTS_DIRECTORY = "fonts";
 
     constexpr auto SHADER_BINARY_SPIRV_EXTENSION = "spv";
+    constexpr auto MODEL_COLLISION_EXTENSION = "wcol";
+    constexpr auto PACKAGES_CACHE_DIRECTORY = "packages"; // Within the platform's cache directory
 
     [[nodiscard]] NEON_PUBLIC std::string GetDirectoryNameForAssetType(const AssetType& assetType);
     [[nodiscard]] NEON_PUBLIC std::expected<std::vector<std::string>, bool> GetFileNamesInDirectory(const std::filesystem::path& directory);
@@ -7,6 +7,8 @@
 #ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_ICHARACTERCONTROLLER_H
 #define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_ICHARACTERCONTROLLER_H
 
+#include "PhysicsCommon.h"
+
 #include <glm/glm.hpp>
 
 #include <optional>
@@ -26,6 +28,8 @@ namespace Wired::Engine
 
         glm::vec3 position;
 
+        PhysicsCollisionFilter collisionFilter{};
+
         CharacterControllerSettings settings;
     };
 
@@ -8,6 +8,7 @@
 #define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_IPHYSICSACCESS_H
 
 #include "ICharacterController.h"
+#include "PhysicsQuery.h"
 
 #include <Wired/Engine/World/WorldCommon.h>
 #include <Wired/Engine/Physics/PhysicsCommon.h>
@@ -17,6 +18,8 @@
 #include <string>
 #include <optional>
 #include <expected>
+#include <span>
+#include <vector>
 
 namespace Wired::Engine
 {
@@ -38,6 +41,17 @@ namespace Wired::Engine
                 const CharacterControllerParams& params
             ) = 0;
             [[nodiscard]] virtual std::optional<ICharacterController*> GetCharacterController(const PhysicsSceneName& scene, const std::string& name) const = 0;
+
+            //
+            // Queries
+            //
+            // Each call answers a batch of queries against a scene, in parallel, returning one result per
+            // query in the same order as the queries. Prefer batching many queries into one call over
+            // making many calls.
+            //
+            [[nodiscard]] virtual std::vector<PhysicsQueryResult> RayCast(const PhysicsSceneName& scene, std::span<const RayCastQuery> queries) const = 0;
+            [[nodiscard]] virtual std::vector<PhysicsQueryResult> ShapeCast(const PhysicsSceneName& scene, std::span<const ShapeCastQuery> queries) const = 0;
+            [[nodiscard]] virtual std::vector<PhysicsQueryResult> Overlap(const PhysicsSceneName& scene, std::span<const OverlapQuery> queries) const = 0;
     };
 }
 
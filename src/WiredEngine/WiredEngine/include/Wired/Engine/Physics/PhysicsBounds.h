@@ -10,6 +10,8 @@
 #include "PhysicsBounds_Sphere.h"
 #include "PhysicsBounds_Box.h"
 #include "PhysicsBounds_HeightMap.h"
+#include "PhysicsBounds_ConvexHull.h"
+#include "PhysicsBounds_TriangleMesh.h"
 
 #include <variant>
 
@@ -18,7 +20,9 @@ namespace Wired::Engine
     using PhysicsBoundsVariant = std::variant<
         PhysicsBounds_Sphere,
         PhysicsBounds_Box,
-        PhysicsBounds_HeightMap
+        PhysicsBounds_HeightMap,
+        PhysicsBounds_ConvexHull,
+        PhysicsBounds_TriangleMesh
     >;
 }
 
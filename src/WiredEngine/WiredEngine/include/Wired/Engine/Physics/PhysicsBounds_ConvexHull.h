@@ -0,0 +1,26 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSBOUNDS_CONVEXHULL_H
+#define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSBOUNDS_CONVEXHULL_H
+
+#include <Wired/Engine/EngineCommon.h>
+
+namespace Wired::Engine
+{
+    /**
+     * Convex hull bounds wrapping the bind-pose vertices of all of a model's meshes.
+     *
+     * The hull is cooked once when the model is loaded from a package and shared by
+     * every body which references it. Usable with any body type.
+     */
+    struct PhysicsBounds_ConvexHull
+    {
+        ModelId modelId{};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSBOUNDS_CONVEXHULL_H
@@ -0,0 +1,26 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSBOUNDS_TRIANGLEMESH_H
+#define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSBOUNDS_TRIANGLEMESH_H
+
+#include <Wired/Engine/EngineCommon.h>
+
+namespace Wired::Engine
+{
+    /**
+     * Exact triangle mesh bounds built from the bind-pose geometry of all of a model's meshes.
+     *
+     * The mesh is cooked once when the model is loaded from a package and shared by every
+     * body which references it. Only supported for static and kinematic bodies.
+     */
+    struct PhysicsBounds_TriangleMesh
+    {
+        ModelId modelId{};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSBOUNDS_TRIANGLEMESH_H
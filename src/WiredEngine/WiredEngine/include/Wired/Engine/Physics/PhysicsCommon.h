@@ -16,6 +16,7 @@
 
 #include <optional>
 #include <vector>
+#include <cstdint>
 
 namespace Wired::Engine
 {
@@ -40,6 +41,37 @@ namespace Wired::Engine
         Trigger
     };
 
+    enum class PhysicsBodyCategory
+    {
+        /** Determined by body type; static bodies are non-moving, kinematic/dynamic bodies are moving */
+        Default,
+
+        /** Moving bodies which only collide with non-moving bodies; never with moving bodies, characters,
+         * triggers, or other debris. Cheap to simulate in large numbers. */
+        Debris,
+
+        /** Moving bodies which represent characters */
+        Character
+    };
+
+    /** The number of user-defined collision layers available */
+    static constexpr unsigned int PHYSICS_NUM_COLLISION_LAYERS = 32;
+
+    /**
+    * User-defined collision filtering. Two bodies only collide if each body's mask contains the
+    * other body's layer (in addition to their body categories being able to collide at all).
+    */
+    struct PhysicsCollisionFilter
+    {
+        /** The collision layer the body belongs to, in [0, PHYSICS_NUM_COLLISION_LAYERS) */
+        uint8_t layer{0};
+
+        /** Bitmask of the collision layers the body collides with (defaults to all) */
+        uint32_t mask{0xFFFFFFFF};
+
+        auto operator<=>(const PhysicsCollisionFilter&) const = default;
+    };
+
     struct PhysicsMaterial
     {
         float friction{1.0f};
@@ -0,0 +1,130 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSQUERY_H
+#define WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSQUERY_H
+
+#include <Wired/Engine/World/WorldCommon.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <optional>
+#include <variant>
+#include <vector>
+#include <cstdint>
+
+namespace Wired::Engine
+{
+    enum class PhysicsQueryMode
+    {
+        /** Report only the closest hit */
+        Closest,
+
+        /** Report any one hit, whichever is found first. Cheapest; use for yes/no checks such as line of sight */
+        Any,
+
+        /** Report all hits, sorted from closest to furthest */
+        All
+    };
+
+    /**
+    * Determines which bodies a query can hit
+    */
+    struct PhysicsQueryFilter
+    {
+        /** Bitmask of the collision layers which can be hit (defaults to all) */
+        uint32_t layerMask{0xFFFFFFFF};
+
+        /** Whether trigger shapes can be hit */
+        bool includeTriggers{false};
+
+        /** An entity which can't be hit, such as the entity doing the querying */
+        std::optional<EntityId> ignoreEntity;
+    };
+
+    struct PhysicsQueryShape_Sphere
+    {
+        float radius{0.5f};
+    };
+
+    struct PhysicsQueryShape_Box
+    {
+        glm::vec3 halfExtents{0.5f};
+    };
+
+    struct PhysicsQueryShape_Capsule
+    {
+        /** Total height of the capsule, including its end caps; must be greater than twice its radius */
+        float height{2.0f};
+        float radius{0.5f};
+    };
+
+    /**
+    * The shape swept or overlapped by a query. Shapes must have a non-zero size; queries with a zero-size
+    * (or otherwise invalid) shape hit nothing.
+    */
+    using PhysicsQueryShape = std::variant<PhysicsQueryShape_Sphere, PhysicsQueryShape_Box, PhysicsQueryShape_Capsule>;
+
+    struct RayCastQuery
+    {
+        glm::vec3 origin_worldSpace{0.0f};
+        glm::vec3 direction_worldSpace{0.0f, 0.0f, -1.0f}; // Unit direction
+        float distance{100.0f};
+
+        PhysicsQueryMode mode{PhysicsQueryMode::Closest};
+        PhysicsQueryFilter filter{};
+    };
+
+    /**
+    * Sweeps a shape along a direction, reporting the bodies it hits along the way
+    */
+    struct ShapeCastQuery
+    {
+        PhysicsQueryShape shape{};
+        glm::vec3 position_worldSpace{0.0f};
+        glm::quat orientation_worldSpace{glm::identity<glm::quat>()};
+
+        glm::vec3 direction_worldSpace{0.0f, 0.0f, -1.0f}; // Unit direction
+        float distance{1.0f};
+
+        PhysicsQueryMode mode{PhysicsQueryMode::Closest};
+        PhysicsQueryFilter filter{};
+    };
+
+    /**
+    * Reports the bodies which a shape overlaps. Hits are reported once per entity, ordered by
+    * decreasing penetration depth.
+    */
+    struct OverlapQuery
+    {
+        PhysicsQueryShape shape{};
+        glm::vec3 position_worldSpace{0.0f};
+        glm::quat orientation_worldSpace{glm::identity<glm::quat>()};
+
+        PhysicsQueryMode mode{PhysicsQueryMode::All};
+        PhysicsQueryFilter filter{};
+    };
+
+    struct PhysicsQueryHit
+    {
+        EntityId entity{};
+
+        /** Distance along the ray/cast at which the hit occurred (0 for overlaps) */
+        float distance{0.0f};
+
+        glm::vec3 point_worldSpace{0.0f};
+        glm::vec3 normal_worldSpace{0.0f};
+    };
+
+    struct PhysicsQueryResult
+    {
+        /** Empty if nothing was hit */
+        std::vector<PhysicsQueryHit> hits;
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_INCLUDE_WIRED_ENGINE_PHYSICS_PHYSICSQUERY_H
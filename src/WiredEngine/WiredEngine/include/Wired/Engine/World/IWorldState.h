@@ -15,6 +15,7 @@
 #include <Wired/Engine/Audio/AudioSourceProperties.h>
 #include <Wired/Engine/Physics/PhysicsCommon.h>
 #include <Wired/Engine/Package/Scene.h>
+#include <Wired/Engine/Package/CompiledScene.h>
 #include <Wired/Engine/Package/PackageCommon.h>
 
 #include <Wired/Render/Id.h>
@@ -57,8 +58,36 @@ namespace Wired::Engine
             // Entities
             //
             [[nodiscard]] virtual EntityId CreateEntity() = 0;
+
+            /**
+             * Destroys the entity, along with all of its attached descendants
+             */
             virtual void DestroyEntity(const EntityId& entityId) = 0;
 
+            /**
+             * Attaches an entity to a parent entity, or detaches it if parentId is nullopt. The entity's
+             * TransformComponent is thereafter relative to the parent's transform.
+             *
+             * Physics bodies are simulated in world space, so an entity with a PhysicsComponent can't be attached to
+             * a parent, although it can be the parent of other entities.
+             *
+             * Non-uniform scale on a parent is only fully supported for meshes and models. An attached sprite's world
+             * scale is its ancestors' scales multiplied per axis, which doesn't account for the skew of a rotated child
+             * under a non-uniformly scaled parent.
+             *
+             * @return False if either entity is invalid, if the entity has a PhysicsComponent, or if the attachment
+             * would create a cycle
+             */
+            [[nodiscard]] virtual bool SetEntityParent(const EntityId& entityId, const std::optional<EntityId>& parentId) = 0;
+
+            /**
+             * Note: The world transforms of attached entities are updated after each simulation step's
+             * systems have run.
+             *
+             * @return The entity's world space transform, or std::nullopt if the entity is invalid
+             */
+            [[nodiscard]] virtual std::optional<TransformComponent> GetEntityWorldTransform(const EntityId& entityId) const = 0;
+
             //
             // Physics
             //
@@ -99,6 +128,14 @@ namespace Wired::Engine
                                                                                        const PackageResources& packageResources,
                                                                                        const TransformComponent& transform) = 0;
 
+            /**
+             * Instantiates all of a compiled scene's entities in bulk. LoadSceneEntities compiles its scene and
+             * then instantiates it via this.
+             */
+            [[nodiscard]] virtual std::optional<LoadedSceneEntities> LoadCompiledSceneEntities(const CompiledScene& scene,
+                                                                                               const PackageResources& packageResources,
+                                                                                               const TransformComponent& transform) = 0;
+
             [[nodiscard]] virtual std::optional<glm::vec3> GetPackageScenePlayerPosition(const PackageName& packageName,
                                                                                          const std::string& sceneName,
                                                                                          const std::string& playerName) const = 0;
@@ -21,6 +21,8 @@ namespace Wired::Engine
      *
      * Note that only position, orientation, and linear velocity can be updated dynamically; re-create
      * the entity if any other physics property needs to be explicitly changed after creation.
+     *
+     * Physics entities can't be attached to a parent entity (IWorldState::SetEntityParent).
      */
     struct PhysicsComponent
     {
@@ -68,6 +70,12 @@ namespace Wired::Engine
         RigidBodyType bodyType{RigidBodyType::Dynamic};
         PhysicsShape shape;
 
+        //
+        // Collision filtering
+        //
+        PhysicsBodyCategory category{PhysicsBodyCategory::Default};
+        PhysicsCollisionFilter collisionFilter{};
+
         //
         // Dynamic/Kinematic body properties
         //
@@ -16,7 +16,10 @@
 namespace Wired::Engine
 {
     /**
-     * Allows for an entity to be located in world space
+     * Allows for an entity to be located in world space.
+     *
+     * If the entity has been attached to a parent entity (IWorldState::SetEntityParent), the transform is relative
+     * to its parent's world transform.
      */
     class TransformComponent
     {
@@ -28,9 +31,7 @@ namespace Wired::Engine
                 : m_position(position)
                 , m_orientation(orientation)
                 , m_scale(scale)
-            {
-                SyncTransform();
-            }
+            { }
 
             bool operator==(const TransformComponent&) const = default;
 
@@ -50,9 +51,17 @@ namespace Wired::Engine
             [[nodiscard]] glm::vec3 GetScale() const { return m_scale; }
 
             /**
-             * @return The entity's position/rotation/scale transform matrix
+             * @return The entity's position/rotation/scale transform matrix. Computed on demand, rather than
+             * whenever the transform is modified.
              */
-            [[nodiscard]] glm::mat4 GetTransformMatrix() const { return m_transformMatrix; }
+            [[nodiscard]] glm::mat4 GetTransformMatrix() const
+            {
+                const glm::mat4 translationMat = glm::translate(glm::mat4(1), m_position);
+                const glm::mat4 rotationMat = glm::mat4_cast(m_orientation);
+                const glm::mat4 scaleMat = glm::scale(glm::mat4(1), m_scale);
+
+                return translationMat * rotationMat * scaleMat;
+            }
 
             /**
              * Set the entity's position
@@ -62,7 +71,6 @@ namespace Wired::Engine
             void SetPosition(const glm::vec3& position)
             {
                 m_position = position;
-                SyncTransform();
             }
 
             /**
@@ -73,7 +81,6 @@ namespace Wired::Engine
             void SetOrientation(const glm::quat& orientation)
             {
                 m_orientation = orientation;
-                SyncTransform();
             }
 
             /**
@@ -85,8 +92,6 @@ namespace Wired::Engine
             {
                 m_position = rotation.ApplyToPosition(m_position);
                 m_orientation = rotation.ApplyToOrientation(m_orientation);
-
-                SyncTransform();
             }
 
             /**
@@ -97,18 +102,6 @@ namespace Wired::Engine
             void SetScale(const glm::vec3& scale)
             {
                 m_scale = scale;
-                SyncTransform();
-            }
-
-        private:
-
-            void SyncTransform()
-            {
-                const glm::mat4 translationMat = glm::translate(glm::mat4(1), m_position);
-                const glm::mat4 rotationMat = glm::mat4_cast(m_orientation);
-                const glm::mat4 scaleMat = glm::scale(glm::mat4(1), m_scale);
-
-                m_transformMatrix = translationMat * rotationMat * scaleMat;
             }
 
         private:
@@ -116,8 +109,6 @@ namespace Wired::Engine
             glm::vec3 m_position{0};
             glm::quat m_orientation{glm::identity<glm::quat>()};
             glm::vec3 m_scale{1.0f};
-
-            glm::mat4 m_transformMatrix{1.0f};
     };
 }
 
@@ -7,12 +7,16 @@
 #include "AudioManager.h"
 #include "AudioUtil.h"
 
+#include "../WorkThreadPool.h"
+
 #include <Wired/Engine/Metrics.h>
 
 #include <NEON/Common/Log/ILogger.h>
 #include <NEON/Common/Metrics/IMetrics.h>
 
 #include <cassert>
+#include <algorithm>
+#include <cmath>
 
 namespace Wired::Engine
 {
@@ -52,9 +56,10 @@ static ALenum AudioDataFormatToAlFormat(const NCommon::AudioDataFormat& format)
     return AL_FORMAT_MONO8;
 }
 
-AudioManager::AudioManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics)
+AudioManager::AudioManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, WorkThreadPool* pWorkThreadPool)
     : m_pLogger(pLogger)
     , m_pMetrics(pMetrics)
+    , m_pWorkThreadPool(pWorkThreadPool)
 {
 
 }
@@ -145,6 +150,36 @@ bool AudioManager::Startup()
         return false;
     }
 
+    //
+    // Look up optional extension functionality
+    //
+    if (alIsExtensionPresent("AL_SOFT_deferred_updates"))
+    {
+        m_alDeferUpdatesSOFT = reinterpret_cast<LPALDEFERUPDATESSOFT>(alGetProcAddress("alDeferUpdatesSOFT"));
+        m_alProcessUpdatesSOFT = reinterpret_cast<LPALPROCESSUPDATESSOFT>(alGetProcAddress("alProcessUpdatesSOFT"));
+    }
+
+    if (m_alDeferUpdatesSOFT == nullptr || m_alProcessUpdatesSOFT == nullptr)
+    {
+        LogWarning("AudioManager: AL_SOFT_deferred_updates isn't supported, batched source updates won't be deferred");
+        m_alDeferUpdatesSOFT = nullptr;
+        m_alProcessUpdatesSOFT = nullptr;
+    }
+
+    //
+    // Limit the number of real voices to what the device supports
+    //
+    ALCint deviceMonoSources{0};
+    alcGetIntegerv(m_pDevice, ALC_MONO_SOURCES, 1, &deviceMonoSources);
+
+    m_maxRealVoices = MAX_REAL_VOICES;
+    if (deviceMonoSources > 0)
+    {
+        m_maxRealVoices = std::min(m_maxRealVoices, (uint32_t)deviceMonoSources);
+    }
+
+    LogInfo("AudioManager: Using a maximum of {} real voices", m_maxRealVoices);
+
     return true;
 }
 
@@ -158,6 +193,9 @@ void AudioManager::Shutdown()
     // Shutdown and destroy the audio context + device
     alcMakeContextCurrent(nullptr);
 
+    m_alDeferUpdatesSOFT = nullptr;
+    m_alProcessUpdatesSOFT = nullptr;
+
     if (m_pContext != nullptr)
     {
         alcDestroyContext(m_pContext);
@@ -184,6 +222,11 @@ void AudioManager::DestroyAll()
     {
         DestroyBuffer(m_buffers.cbegin()->first);
     }
+
+    m_resourceToStreamedAudio.clear();
+    m_lastVoiceUpdate = std::nullopt;
+
+    SyncMetrics();
 }
 
 bool AudioManager::LoadResourceAudio(const ResourceIdentifier& resourceIdentifier, const NCommon::AudioData* pAudioData)
@@ -209,10 +252,12 @@ bool AudioManager::LoadResourceAudio(const ResourceIdentifier& resourceIdentifie
 
     const auto bufferFormat = AudioDataFormatToAlFormat(pAudioData->format);
 
-    const auto buffer = Buffer(*bufferId, bufferFormat, resourceIdentifier, pAudioData->Duration());
+    auto buffer = Buffer(*bufferId, bufferFormat, resourceIdentifier, pAudioData->Duration());
+    buffer.byteSize = pAudioData->data.size();
 
     m_buffers.insert({*bufferId, buffer});
     m_resourceToBuffer.insert({resourceIdentifier, *bufferId});
+    m_decodedByteSize += buffer.byteSize;
 
     LogInfo("AudioManager: Created buffer {} for resource audio: {}", *bufferId, resourceIdentifier.GetUniqueName());
 
@@ -221,6 +266,25 @@ bool AudioManager::LoadResourceAudio(const ResourceIdentifier& resourceIdentifie
     return true;
 }
 
+bool AudioManager::LoadResourceStreamedAudio(const ResourceIdentifier& resourceIdentifier, std::shared_ptr<const StreamedAudio> streamedAudio)
+{
+    AssertStartedUp();
+
+    LogInfo("AudioManager: Loading resource streamed audio: {}", resourceIdentifier.GetUniqueName());
+
+    std::lock_guard buffersLock(m_buffersMutex);
+
+    if (IsResourceAudioLoaded(resourceIdentifier))
+    {
+        LogWarning("AudioManager::LoadResourceStreamedAudio: Resource already has audio loaded, ignoring: {}", resourceIdentifier.GetUniqueName());
+        return true;
+    }
+
+    m_resourceToStreamedAudio.insert({resourceIdentifier, std::move(streamedAudio)});
+
+    return true;
+}
+
 std::expected<ALuint, bool> AudioManager::LoadStreamedAudio(const NCommon::AudioData* pAudioData, double streamStartTime)
 {
     AssertStartedUp();
@@ -238,9 +302,11 @@ std::expected<ALuint, bool> AudioManager::LoadStreamedAudio(const NCommon::Audio
 
     const auto bufferFormat = AudioDataFormatToAlFormat(pAudioData->format);
 
-    const auto buffer = Buffer(*bufferId, bufferFormat, std::nullopt, pAudioData->Duration(), streamStartTime);
+    auto buffer = Buffer(*bufferId, bufferFormat, std::nullopt, pAudioData->Duration(), streamStartTime);
+    buffer.byteSize = pAudioData->data.size();
 
     m_buffers.insert({*bufferId, buffer});
+    m_decodedByteSize += buffer.byteSize;
 
     LogDebug("AudioManager: Created buffer {} for streamed audio", *bufferId);
 
@@ -253,7 +319,7 @@ bool AudioManager::IsResourceAudioLoaded(const ResourceIdentifier& resourceIdent
 {
     std::lock_guard buffersLock(m_buffersMutex);
 
-    return m_resourceToBuffer.contains(resourceIdentifier);
+    return m_resourceToBuffer.contains(resourceIdentifier) || m_resourceToStreamedAudio.contains(resourceIdentifier);
 }
 
 void AudioManager::DestroyResourceAudio(const ResourceIdentifier& resourceIdentifier)
@@ -264,6 +330,34 @@ void AudioManager::DestroyResourceAudio(const ResourceIdentifier& resourceIdenti
 
     std::lock_guard buffersLock(m_buffersMutex);
 
+    //
+    // Streamed resource audio; destroy any sources which are playing it
+    //
+    const auto streamedIt = m_resourceToStreamedAudio.find(resourceIdentifier);
+    if (streamedIt != m_resourceToStreamedAudio.cend())
+    {
+        std::vector<AudioSourceId> toDestroy;
+
+        for (const auto& sourceIt : m_sources)
+        {
+            if (sourceIt.second.streamedAudio == streamedIt->second)
+            {
+                toDestroy.push_back(sourceIt.first);
+            }
+        }
+
+        for (const auto& sourceId : toDestroy)
+        {
+            DestroySource(sourceId);
+        }
+
+        m_resourceToStreamedAudio.erase(streamedIt);
+        return;
+    }
+
+    //
+    // Fully loaded resource audio
+    //
     const auto it = m_resourceToBuffer.find(resourceIdentifier);
     if (it == m_resourceToBuffer.cend())
     {
@@ -322,58 +416,61 @@ std::expected<AudioSourceId, bool> AudioManager::CreateResourceSource(
 
     std::lock_guard lock(m_buffersMutex);
 
-    const auto resourceIt = m_resourceToBuffer.find(resourceIdentifier);
-    if (resourceIt == m_resourceToBuffer.cend())
-    {
-        LogError("AudioManager::CreateResourceSource: Unable to create source as resource has no audio loaded: {}", resourceIdentifier.GetUniqueName());
-        return std::unexpected(false);
-    }
+    Source source(sourcePlayType, SourceDataType::Static, properties, isTransient);
+    source.worldPosition = initialPosition.value_or(glm::vec3(0.0f));
 
-    const auto bufferIt = m_buffers.find(resourceIt->second);
-    if (bufferIt == m_buffers.cend())
+    bool isMonoFormat{false};
+
+    if (const auto streamedIt = m_resourceToStreamedAudio.find(resourceIdentifier); streamedIt != m_resourceToStreamedAudio.cend())
     {
-        LogError("AudioManager::CreateResourceSource: No such buffer exists: {}", resourceIt->second);
-        return std::unexpected(false);
+        source.streamedAudio = streamedIt->second;
+        source.length = streamedIt->second->Duration().count();
+        isMonoFormat = streamedIt->second->numChannels == 1;
     }
-
-    // If we're creating a local source, the audio must be in mono format, as OpenAL can't spatialize a
-    // stereo audio source
-    if (sourcePlayType == SourcePlayType::Local)
+    else
     {
-        if (bufferIt->second.bufferFormat != AL_FORMAT_MONO8 && bufferIt->second.bufferFormat != AL_FORMAT_MONO16)
+        const auto resourceIt = m_resourceToBuffer.find(resourceIdentifier);
+        if (resourceIt == m_resourceToBuffer.cend())
         {
-            LogError("AudioManager::CreateResourceSource: Local audio sources require mono-format audio data");
+            LogError("AudioManager::CreateResourceSource: Unable to create source as resource has no audio loaded: {}", resourceIdentifier.GetUniqueName());
             return std::unexpected(false);
         }
-    }
 
-    //
-    // Create the source
-    //
-    std::vector<ALuint> initialBuffers = {bufferIt->first};
+        const auto bufferIt = m_buffers.find(resourceIt->second);
+        if (bufferIt == m_buffers.cend())
+        {
+            LogError("AudioManager::CreateResourceSource: No such buffer exists: {}", resourceIt->second);
+            return std::unexpected(false);
+        }
+
+        source.resourceBufferId = bufferIt->first;
+        source.length = bufferIt->second.length.count();
+        isMonoFormat = bufferIt->second.bufferFormat == AL_FORMAT_MONO8 || bufferIt->second.bufferFormat == AL_FORMAT_MONO16;
+    }
 
-    const auto sourceId = ALCreateSource(SourceDataType::Static, properties, initialBuffers, initialPosition);
-    if (!sourceId)
+    // If we're creating a local source, the audio must be in mono format, as OpenAL can't spatialize a
+    // stereo audio source
+    if (sourcePlayType == SourcePlayType::Local && !isMonoFormat)
     {
-        LogError("AudioManager::CreateResourceSource: Failed to create source for resource: {}", resourceIt->second);
+        LogError("AudioManager::CreateResourceSource: Local audio sources require mono-format audio data");
         return std::unexpected(false);
     }
 
     //
-    // Update the asset's buffer to know it's in-use by this source
+    // Record the source and return. The source is created virtual; it's given a real voice when it's played.
     //
-    bufferIt->second.sourceUsage.insert(*sourceId);
+    const auto sourceId = m_nextSourceId++;
 
-    //
-    // Record the source and return
-    //
-    Source source(sourcePlayType, SourceDataType::Static, *sourceId, properties, isTransient, initialBuffers);
+    if (source.resourceBufferId)
+    {
+        m_buffers.at(*source.resourceBufferId).sourceUsage.insert(sourceId);
+    }
 
-    m_sources.insert({*sourceId, std::move(source)});
+    m_sources.insert({sourceId, std::move(source)});
 
     SyncMetrics();
 
-    return *sourceId;
+    return sourceId;
 }
 
 std::expected<AudioSourceId, bool> AudioManager::CreateStreamedSource(
@@ -386,11 +483,13 @@ std::expected<AudioSourceId, bool> AudioManager::CreateStreamedSource(
 
     LogInfo("AudioManager: Creating source for streamed audio");
 
+    std::lock_guard lock(m_buffersMutex);
+
     //
-    // Create the source
+    // Create the source. Streamed sources always have a real voice, as their data is provided by the client.
     //
-    const auto sourceId = ALCreateSource(SourceDataType::Streamed, properties, {}, initialPosition);
-    if (!sourceId)
+    const auto alSourceId = ALCreateSource(SourceDataType::Streamed, properties, initialPosition);
+    if (!alSourceId)
     {
         LogError("AudioManager::CreateStreamedSource: Failed to create source");
         return std::unexpected(false);
@@ -399,50 +498,136 @@ std::expected<AudioSourceId, bool> AudioManager::CreateStreamedSource(
     //
     // Record the source and return
     //
-    Source source(sourcePlayType, SourceDataType::Streamed, *sourceId, properties, false, {});
+    Source source(sourcePlayType, SourceDataType::Streamed, properties, false);
+    source.alSourceId = *alSourceId;
+    source.worldPosition = initialPosition.value_or(glm::vec3(0.0f));
+
+    const auto sourceId = m_nextSourceId++;
 
-    m_sources.insert({*sourceId, std::move(source)});
+    m_sources.insert({sourceId, std::move(source)});
+    m_numRealVoices++;
 
     SyncMetrics();
 
-    return *sourceId;
+    return sourceId;
 }
 
-bool AudioManager::PlaySource(const AudioSourceId& sourceId) const
+bool AudioManager::PlaySource(const AudioSourceId& sourceId)
 {
     AssertStartedUp();
 
     LogDebug("AudioManager: Playing audio source: {}", sourceId);
 
-    if (!m_sources.contains(sourceId)) { return false; }
+    std::lock_guard lock(m_buffersMutex);
+
+    const auto sourceIt = m_sources.find(sourceId);
+    if (sourceIt == m_sources.cend()) { return false; }
+
+    auto& source = sourceIt->second;
+
+    if (!source.IsVoiceManaged())
+    {
+        alSourcePlay(*source.alSourceId);
+        return true;
+    }
+
+    const auto playState = ResolvePlayState(source);
+
+    if (playState == PlayState::Playing)
+    {
+        return true;
+    }
+
+    // Playing from a non-paused state restarts the audio
+    if (playState != PlayState::Paused)
+    {
+        source.playTime = 0.0;
+    }
 
-    alSourcePlay(sourceId);
+    // Drop any voice left over from a previous play through
+    ReleaseVoice(sourceId, source);
+
+    source.playState = PlayState::Playing;
+
+    // Give the source a real voice immediately if one is free; otherwise it starts out virtual, and competes
+    // for a voice at the next voice update
+    if (HasFreeVoice() && GetAudibility(source) >= MIN_AUDIBLE_GAIN)
+    {
+        if (!AcquireVoice(sourceId, source))
+        {
+            LogWarning("AudioManager::PlaySource: Failed to acquire a voice for source, it'll play virtually: {}", sourceId);
+        }
+    }
+
+    SyncMetrics();
 
     return true;
 }
 
-bool AudioManager::PauseSource(const AudioSourceId& sourceId) const
+bool AudioManager::PauseSource(const AudioSourceId& sourceId)
 {
     AssertStartedUp();
 
     LogInfo("AudioManager: Pausing audio source: {}", sourceId);
 
-    if (!m_sources.contains(sourceId)) { return false; }
+    std::lock_guard lock(m_buffersMutex);
+
+    const auto sourceIt = m_sources.find(sourceId);
+    if (sourceIt == m_sources.cend()) { return false; }
+
+    auto& source = sourceIt->second;
+
+    if (!source.IsVoiceManaged())
+    {
+        alSourcePause(*source.alSourceId);
+        return true;
+    }
+
+    if (ResolvePlayState(source) != PlayState::Playing)
+    {
+        return true;
+    }
+
+    // Only playing sources hold a real voice; record where the source was paused and give up its voice
+    if (const auto realPlayTime = QueryRealPlayTime(source))
+    {
+        source.playTime = *realPlayTime;
+    }
 
-    alSourcePause(sourceId);
+    ReleaseVoice(sourceId, source);
+    source.playState = PlayState::Paused;
+
+    SyncMetrics();
 
     return true;
 }
 
-bool AudioManager::StopSource(const AudioSourceId& sourceId) const
+bool AudioManager::StopSource(const AudioSourceId& sourceId)
 {
     AssertStartedUp();
 
     LogDebug("AudioManager: Stopping audio source: {}", sourceId);
 
-    if (!m_sources.contains(sourceId)) { return false; }
+    std::lock_guard lock(m_buffersMutex);
+
+    const auto sourceIt = m_sources.find(sourceId);
+    if (sourceIt == m_sources.cend()) { return false; }
+
+    auto& source = sourceIt->second;
+
+    if (!source.IsVoiceManaged())
+    {
+        alSourceStop(*source.alSourceId);
+        return true;
+    }
+
+    ReleaseVoice(sourceId, source);
+
+    // As with OpenAL sources, a stopped source is considered to be at the end of its audio
+    source.playState = PlayState::Stopped;
+    source.playTime = source.length;
 
-    alSourceStop(sourceId);
+    SyncMetrics();
 
     return true;
 }
@@ -458,9 +643,19 @@ std::optional<PlayState> AudioManager::GetPlayState(const AudioSourceId& sourceI
         return std::nullopt;
     }
 
+    if (sourceIt->second.IsVoiceManaged())
+    {
+        return ResolvePlayState(sourceIt->second);
+    }
+
+    return ALGetPlayState(*sourceIt->second.alSourceId);
+}
+
+std::optional<PlayState> AudioManager::ALGetPlayState(ALuint alSourceId) const
+{
     alGetError();
     ALint sourceState{AL_INVALID};
-    alGetSourcei(sourceId, AL_SOURCE_STATE, &sourceState);
+    alGetSourcei(alSourceId, AL_SOURCE_STATE, &sourceState);
     if (const auto error = alGetError(); error != AL_NO_ERROR)
     {
         return std::nullopt;
@@ -472,7 +667,7 @@ std::optional<PlayState> AudioManager::GetPlayState(const AudioSourceId& sourceI
     else if (sourceState == AL_STOPPED) { return PlayState::Stopped; }
     else
     {
-        LogError("AudioManager::GetSourceState: Unhandled OpenAL source state: {}", sourceState);
+        LogError("AudioManager::ALGetPlayState: Unhandled OpenAL source state: {}", sourceState);
         return std::nullopt;
     }
 }
@@ -488,13 +683,25 @@ std::optional<double> AudioManager::GetPlayTime(const AudioSourceId& sourceId) c
         return std::nullopt;
     }
 
+    const auto& source = sourceIt->second;
+
+    if (source.IsVoiceManaged())
+    {
+        if (ResolvePlayState(source) == PlayState::Stopped)
+        {
+            return source.length;
+        }
+
+        return QueryRealPlayTime(source).value_or(source.playTime);
+    }
+
     // If the source has no data associated with it, we can't determine play time
-    if (sourceIt->second.attachedBuffers.empty())
+    if (source.attachedBuffers.empty())
     {
         return std::nullopt;
     }
 
-    const auto frontBufferId = sourceIt->second.attachedBuffers.front();
+    const auto frontBufferId = source.attachedBuffers.front();
     const auto frontBufferIt = m_buffers.find(frontBufferId);
     if (frontBufferIt == m_buffers.cend())
     {
@@ -502,7 +709,7 @@ std::optional<double> AudioManager::GetPlayTime(const AudioSourceId& sourceId) c
         return std::nullopt;
     }
 
-    const auto backBufferId = sourceIt->second.attachedBuffers.back();
+    const auto backBufferId = source.attachedBuffers.back();
     const auto backBufferIt = m_buffers.find(backBufferId);
     if (backBufferIt == m_buffers.cend())
     {
@@ -533,7 +740,7 @@ std::optional<double> AudioManager::GetPlayTime(const AudioSourceId& sourceId) c
             float sourceSecOffset{0.0f};
 
             alGetError();
-            alGetSourcef(sourceId, AL_SEC_OFFSET, &sourceSecOffset);
+            alGetSourcef(*source.alSourceId, AL_SEC_OFFSET, &sourceSecOffset);
             if (const auto error = alGetError(); error != AL_NO_ERROR)
             {
                 LogError("AudioManager::GetPlayTime: Failed to query for source offset");
@@ -559,6 +766,8 @@ std::optional<AudioSourceState> AudioManager::GetSourceState(const AudioSourceId
 {
     AssertStartedUp();
 
+    std::lock_guard lock(m_buffersMutex);
+
     const auto playState = GetPlayState(sourceId);
     if (!playState)
     {
@@ -684,7 +893,7 @@ bool AudioManager::EnqueueStreamedData(const AudioSourceId& sourceId,
     // Enqueue the buffers with the source
     //
     alGetError();
-    alSourceQueueBuffers(sourceId, (ALsizei)audioDataBufferIds.size(), audioDataBufferIds.data());
+    alSourceQueueBuffers(*sourceIt->second.alSourceId, (ALsizei)audioDataBufferIds.size(), audioDataBufferIds.data());
     if (const auto error = alGetError(); error != AL_NO_ERROR)
     {
         LogError("AudioManager::EnqueueStreamedData: alSourceQueueBuffers failed, error code: {}", error);
@@ -722,6 +931,8 @@ bool AudioManager::EnqueueStreamedData(const AudioSourceId& sourceId,
 
 void AudioManager::FlushEnqueuedData(const AudioSourceId& sourceId)
 {
+    std::lock_guard lock(m_buffersMutex);
+
     const auto sourceIt = m_sources.find(sourceId);
     if (sourceIt == m_sources.cend())
     {
@@ -746,7 +957,7 @@ void AudioManager::FlushEnqueuedData(const AudioSourceId& sourceId)
     sourceIt->second.attachedBuffers.clear();
 
     alGetError();
-    alSourceUnqueueBuffers(sourceId, (ALsizei)attachedBuffers.size(), attachedBuffers.data());
+    alSourceUnqueueBuffers(*sourceIt->second.alSourceId, (ALsizei)attachedBuffers.size(), attachedBuffers.data());
     if (const auto error = alGetError(); error != AL_NO_ERROR)
     {
         LogError("AudioManager::FlushEnqueuedData: alSourceUnqueueBuffers failed, error code: {}", error);
@@ -775,6 +986,8 @@ void AudioManager::DestroySource(const AudioSourceId& sourceId)
 
     LogInfo("AudioManager: Destroying audio source: {}", sourceId);
 
+    std::lock_guard lock(m_buffersMutex);
+
     const auto sourceIt = m_sources.find(sourceId);
     if (sourceIt == m_sources.cend())
     {
@@ -782,37 +995,34 @@ void AudioManager::DestroySource(const AudioSourceId& sourceId)
         return;
     }
 
-    // Make sure the source isn't playing
-    alSourceStop(sourceId);
+    // Give up the source's voice, if it has one. Also marks its attached buffers as no longer used by it.
+    ReleaseVoice(sourceId, sourceIt->second);
 
-    // For each buffer attached to the source, record it that it's no longer in use by the source
+    // Record that the source no longer uses its resource buffer
+    if (sourceIt->second.resourceBufferId)
     {
-        std::lock_guard lock(m_buffersMutex);
-
-        for (const auto& attachedBuffer : sourceIt->second.attachedBuffers)
+        const auto bufferIt = m_buffers.find(*sourceIt->second.resourceBufferId);
+        if (bufferIt != m_buffers.cend())
         {
-            const auto bufferIt = m_buffers.find(attachedBuffer);
-            if (bufferIt != m_buffers.cend())
-            {
-                bufferIt->second.sourceUsage.erase(sourceId);
-            }
+            bufferIt->second.sourceUsage.erase(sourceId);
         }
     }
 
-    // Destroy and erase the source
-    ALDestroySource(sourceId);
-    m_sources.erase(sourceId);
+    m_sources.erase(sourceIt);
 
     SyncMetrics();
 }
 
-void AudioManager::UpdateAudioListener(const AudioListener& listener) const
+void AudioManager::UpdateAudioListener(const AudioListener& listener)
 {
     AssertStartedUp();
 
+    m_listenerPosition = listener.worldPosition;
+
     alListenerf(AL_GAIN, listener.gain);
 
     alListener3f(AL_POSITION, listener.worldPosition.x, listener.worldPosition.y, listener.worldPosition.z);
+    alListener3f(AL_VELOCITY, listener.worldVelocity.x, listener.worldVelocity.y, listener.worldVelocity.z);
 
     float orientationVals[6];
     orientationVals[0] = listener.lookUnit.x;
@@ -824,10 +1034,12 @@ void AudioManager::UpdateAudioListener(const AudioListener& listener) const
     alListenerfv(AL_ORIENTATION, orientationVals);
 }
 
-bool AudioManager::UpdateLocalSourcePosition(const AudioSourceId& sourceId, const glm::vec3& worldPosition) const
+bool AudioManager::UpdateLocalSourcePosition(const AudioSourceId& sourceId, const glm::vec3& worldPosition)
 {
     AssertStartedUp();
 
+    std::lock_guard lock(m_buffersMutex);
+
     const auto sourceIt = m_sources.find(sourceId);
     if (sourceIt == m_sources.cend())
     {
@@ -835,16 +1047,92 @@ bool AudioManager::UpdateLocalSourcePosition(const AudioSourceId& sourceId, cons
         return false;
     }
 
-    alSource3f(sourceId, AL_POSITION, worldPosition.x, worldPosition.y, worldPosition.z);
+    sourceIt->second.worldPosition = worldPosition;
+
+    if (sourceIt->second.alSourceId)
+    {
+        alSource3f(*sourceIt->second.alSourceId, AL_POSITION, worldPosition.x, worldPosition.y, worldPosition.z);
+    }
 
     return true;
 }
 
+void AudioManager::UpdateLocalSources(std::span<const LocalSourceUpdate> updates)
+{
+    AssertStartedUp();
+
+    if (updates.empty())
+    {
+        return;
+    }
+
+    std::lock_guard lock(m_buffersMutex);
+
+    // Batch all the source changes into one mixer update, rather than the mixer potentially
+    // picking up a partially applied set of changes
+    if (m_alDeferUpdatesSOFT != nullptr) { m_alDeferUpdatesSOFT(); }
+
+    for (const auto& update : updates)
+    {
+        const auto sourceIt = m_sources.find(update.sourceId);
+        if (sourceIt == m_sources.cend() || sourceIt->second.playType != SourcePlayType::Local)
+        {
+            continue;
+        }
+
+        // Tracked for virtual sources too, as their position determines whether they get a real voice
+        sourceIt->second.worldPosition = update.worldPosition;
+        sourceIt->second.worldVelocity = update.worldVelocity;
+
+        if (!sourceIt->second.alSourceId)
+        {
+            continue;
+        }
+
+        const auto alSourceId = *sourceIt->second.alSourceId;
+
+        alSource3f(alSourceId, AL_POSITION, update.worldPosition.x, update.worldPosition.y, update.worldPosition.z);
+        alSource3f(alSourceId, AL_VELOCITY, update.worldVelocity.x, update.worldVelocity.y, update.worldVelocity.z);
+    }
+
+    if (m_alProcessUpdatesSOFT != nullptr) { m_alProcessUpdatesSOFT(); }
+}
+
+void AudioManager::GetFinishedSources(std::span<const AudioSourceId> sourceIds, std::vector<std::size_t>& finishedIndices) const
+{
+    AssertStartedUp();
+
+    std::lock_guard lock(m_buffersMutex);
+
+    for (std::size_t x = 0; x < sourceIds.size(); ++x)
+    {
+        const auto sourceIt = m_sources.find(sourceIds[x]);
+        if (sourceIt == m_sources.cend())
+        {
+            finishedIndices.push_back(x);
+            continue;
+        }
+
+        // Streamed sources are kept around even when they're temporarily out of data
+        if (sourceIt->second.dataType != SourceDataType::Static)
+        {
+            continue;
+        }
+
+        if (ResolvePlayState(sourceIt->second) == PlayState::Stopped)
+        {
+            finishedIndices.push_back(x);
+        }
+    }
+}
+
 void AudioManager::DestroyFinishedTransientSources()
 {
     AssertStartedUp();
 
-    std::unordered_set<ALuint> toDestroy;
+    std::lock_guard lock(m_buffersMutex);
+
+    std::unordered_set<AudioSourceId> toDestroy;
 
     //
     // Find sources that are marked as transient and are in stopped state
@@ -898,11 +1186,13 @@ void AudioManager::DestroyFinishedStreamedData()
             continue;
         }
 
+        const auto alSourceId = *sourceIt.second.alSourceId;
+
         //
         // Query for the source's number of finished/processed buffers
         //
         ALint numBuffersProcessed{0};
-        alGetSourcei(sourceId, AL_BUFFERS_PROCESSED, &numBuffersProcessed);
+        alGetSourcei(alSourceId, AL_BUFFERS_PROCESSED, &numBuffersProcessed);
 
         // Nothing to clean up
         if (numBuffersProcessed <= 0)
@@ -945,7 +1235,7 @@ void AudioManager::DestroyFinishedStreamedData()
         }
 
         alGetError();
-        alSourceUnqueueBuffers(sourceId, (ALsizei)processedBuffers.size(), processedBuffers.data());
+        alSourceUnqueueBuffers(alSourceId, (ALsizei)processedBuffers.size(), processedBuffers.data());
         if (const auto error = alGetError(); error != AL_NO_ERROR)
         {
             LogError("AudioManager::DestroyFinishedStreamedData: alSourceUnqueueBuffers failed, error code: {}", error);
@@ -969,6 +1259,404 @@ void AudioManager::DestroyFinishedStreamedData()
     }
 }
 
+void AudioManager::UpdateVoices()
+{
+    AssertStartedUp();
+
+    std::lock_guard lock(m_buffersMutex);
+
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsedSeconds = m_lastVoiceUpdate ? std::chrono::duration<double>(now - *m_lastVoiceUpdate).count() : 0.0;
+    m_lastVoiceUpdate = now;
+
+    //
+    // Advance the playback of playing voice managed sources, and gather them as candidates for real voices
+    //
+    std::size_t numUnmanagedVoices = 0;
+
+    m_voiceCandidates.clear();
+
+    for (auto& [sourceId, source] : m_sources)
+    {
+        if (!source.IsVoiceManaged())
+        {
+            numUnmanagedVoices++;
+            continue;
+        }
+
+        if (source.playState != PlayState::Playing)
+        {
+            continue;
+        }
+
+        if (source.alSourceId)
+        {
+            // The source's voice has finished playing its audio
+            if (ResolvePlayState(source) == PlayState::Stopped)
+            {
+                ReleaseVoice(sourceId, source);
+                source.playState = PlayState::Stopped;
+                source.playTime = source.length;
+                continue;
+            }
+
+            if (const auto realPlayTime = QueryRealPlayTime(source))
+            {
+                source.playTime = *realPlayTime;
+            }
+
+            if (source.streamedAudio)
+            {
+                PumpStream(sourceId, source);
+            }
+        }
+        else
+        {
+            source.playTime += elapsedSeconds;
+
+            if (source.playTime >= source.length)
+            {
+                if (source.audioSourceProperties.looping && source.length > 0.0)
+                {
+                    source.playTime = std::fmod(source.playTime, source.length);
+                }
+                else
+                {
+                    source.playState = PlayState::Stopped;
+                    source.playTime = source.length;
+                    continue;
+                }
+            }
+        }
+
+        m_voiceCandidates.push_back(VoiceCandidate{
+            .sourceId = sourceId,
+            .priority = source.audioSourceProperties.priority,
+            .audibility = GetAudibility(source)
+        });
+    }
+
+    //
+    // Rank the candidates: audible sources first, then by priority, then by how loud they are
+    //
+    std::ranges::sort(m_voiceCandidates, [](const VoiceCandidate& a, const VoiceCandidate& b){
+        const bool aAudible = a.audibility >= MIN_AUDIBLE_GAIN;
+        const bool bAudible = b.audibility >= MIN_AUDIBLE_GAIN;
+
+        if (aAudible != bAudible) { return aAudible; }
+        if (a.priority != b.priority) { return a.priority > b.priority; }
+        return a.audibility > b.audibility;
+    });
+
+    // Streamed (enqueued data) sources always have a voice, so they reduce the voices available to the rest
+    const std::size_t numManagedVoices = m_maxRealVoices > numUnmanagedVoices ? m_maxRealVoices - numUnmanagedVoices : 0;
+
+    const auto shouldBeReal = [&](std::size_t rank){
+        return rank < numManagedVoices && m_voiceCandidates[rank].audibility >= MIN_AUDIBLE_GAIN;
+    };
+
+    //
+    // Virtualize sources which lost their voice, before giving voices to the sources which gained one
+    //
+    for (std::size_t rank = 0; rank < m_voiceCandidates.size(); ++rank)
+    {
+        if (shouldBeReal(rank)) { continue; }
+
+        const auto sourceId = m_voiceCandidates[rank].sourceId;
+        auto& source = m_sources.at(sourceId);
+
+        if (source.alSourceId)
+        {
+            LogDebug("AudioManager: Virtualizing source: {}", sourceId);
+            ReleaseVoice(sourceId, source);
+        }
+    }
+
+    m_numVirtualVoices = 0;
+
+    for (std::size_t rank = 0; rank < m_voiceCandidates.size(); ++rank)
+    {
+        if (!shouldBeReal(rank))
+        {
+            m_numVirtualVoices++;
+            continue;
+        }
+
+        const auto sourceId = m_voiceCandidates[rank].sourceId;
+        auto& source = m_sources.at(sourceId);
+
+        if (!source.alSourceId)
+        {
+            LogDebug("AudioManager: Giving source a real voice: {}", sourceId);
+
+            if (!AcquireVoice(sourceId, source))
+            {
+                m_numVirtualVoices++;
+            }
+        }
+    }
+
+    SyncMetrics();
+}
+
+bool AudioManager::AcquireVoice(const AudioSourceId& sourceId, Source& source)
+{
+    const auto dataType = source.streamedAudio ? SourceDataType::Streamed : SourceDataType::Static;
+
+    const auto alSourceId = ALCreateSource(dataType, source.audioSourceProperties, source.worldPosition);
+    if (!alSourceId)
+    {
+        LogError("AudioManager::AcquireVoice: Failed to create source for: {}", sourceId);
+        return false;
+    }
+
+    alSource3f(*alSourceId, AL_VELOCITY, source.worldVelocity.x, source.worldVelocity.y, source.worldVelocity.z);
+
+    source.alSourceId = *alSourceId;
+    m_numRealVoices++;
+
+    //
+    // Fully loaded audio plays immediately, from the source's tracked position
+    //
+    if (source.resourceBufferId)
+    {
+        alSourcei(*alSourceId, AL_BUFFER, (ALint)*source.resourceBufferId);
+        alSourcef(*alSourceId, AL_SEC_OFFSET, (float)source.playTime);
+        alSourcePlay(*alSourceId);
+
+        source.attachedBuffers = {*source.resourceBufferId};
+    }
+    //
+    // Streamed audio starts decoding from the source's tracked position, and plays once its first chunk is ready
+    //
+    else
+    {
+        source.streamNextFrame = (std::size_t)(source.playTime * (double)source.streamedAudio->sampleRate);
+        PumpStream(sourceId, source);
+    }
+
+    return true;
+}
+
+void AudioManager::ReleaseVoice(const AudioSourceId& sourceId, Source& source)
+{
+    if (!source.alSourceId)
+    {
+        return;
+    }
+
+    const auto alSourceId = *source.alSourceId;
+
+    alSourceStop(alSourceId);
+    alSourcei(alSourceId, AL_BUFFER, AL_NONE);
+    ALDestroySource(alSourceId);
+
+    source.alSourceId = std::nullopt;
+    m_numRealVoices = m_numRealVoices > 0 ? m_numRealVoices - 1 : 0;
+
+    // Any decode in progress is abandoned; its result is discarded when it finishes
+    source.pendingChunk = std::nullopt;
+
+    //
+    // Buffers owned by the source (streamed chunks or enqueued data) are destroyed along with its voice. Resource
+    // buffers remain in use by the source, for when it's next given a voice.
+    //
+    const auto attachedBuffers = std::move(source.attachedBuffers);
+    source.attachedBuffers.clear();
+
+    for (const auto& bufferId : attachedBuffers)
+    {
+        if (source.resourceBufferId == bufferId)
+        {
+            continue;
+        }
+
+        const auto bufferIt = m_buffers.find(bufferId);
+        if (bufferIt == m_buffers.cend())
+        {
+            continue;
+        }
+
+        bufferIt->second.sourceUsage.erase(sourceId);
+        DestroyBuffer(bufferId);
+    }
+}
+
+void AudioManager::PumpStream(const AudioSourceId& sourceId, Source& source)
+{
+    const auto alSourceId = *source.alSourceId;
+    const auto sampleRate = source.streamedAudio->sampleRate;
+
+    //
+    // Reclaim chunks which have finished playing
+    //
+    ALint numBuffersProcessed{0};
+    alGetSourcei(alSourceId, AL_BUFFERS_PROCESSED, &numBuffersProcessed);
+    numBuffersProcessed = std::min(numBuffersProcessed, (ALint)source.attachedBuffers.size());
+
+    if (numBuffersProcessed > 0)
+    {
+        std::vector<ALuint> processedBuffers(source.attachedBuffers.begin(), source.attachedBuffers.begin() + numBuffersProcessed);
+        source.attachedBuffers.erase(source.attachedBuffers.begin(), source.attachedBuffers.begin() + numBuffersProcessed);
+
+        alGetError();
+        alSourceUnqueueBuffers(alSourceId, (ALsizei)processedBuffers.size(), processedBuffers.data());
+        if (const auto error = alGetError(); error != AL_NO_ERROR)
+        {
+            LogError("AudioManager::PumpStream: alSourceUnqueueBuffers failed, error code: {}", error);
+        }
+
+        for (const auto& bufferId : processedBuffers)
+        {
+            m_buffers.at(bufferId).sourceUsage.erase(sourceId);
+            DestroyBuffer(bufferId);
+        }
+    }
+
+    //
+    // Queue a chunk which has finished decoding
+    //
+    if (source.pendingChunk && source.pendingChunk->wait_for(std::chrono::seconds(0)) == std::future_status::ready)
+    {
+        const auto chunk = source.pendingChunk->get();
+        source.pendingChunk = std::nullopt;
+
+        if (chunk)
+        {
+            const auto bufferId = LoadStreamedAudio(chunk.get(), source.pendingChunkStartTime);
+            if (bufferId)
+            {
+                alSourceQueueBuffers(alSourceId, 1, &(*bufferId));
+                source.attachedBuffers.push_back(*bufferId);
+                m_buffers.at(*bufferId).sourceUsage.insert(sourceId);
+            }
+            else
+            {
+                LogError("AudioManager::PumpStream: Failed to load decoded chunk for source: {}", sourceId);
+            }
+        }
+    }
+
+    //
+    // Decode the next chunk on a worker thread, if the source's queue isn't full
+    //
+    if (!source.pendingChunk && source.attachedBuffers.size() < STREAM_QUEUE_DEPTH)
+    {
+        if (source.streamNextFrame >= source.streamedAudio->numFrames && source.audioSourceProperties.looping)
+        {
+            source.streamNextFrame = 0;
+        }
+
+        if (source.streamNextFrame < source.streamedAudio->numFrames)
+        {
+            const auto startFrame = source.streamNextFrame;
+            const auto numFrames = std::max<std::size_t>(1, (std::size_t)(STREAM_CHUNK_SECONDS * (double)sampleRate));
+
+            source.pendingChunkStartTime = (double)startFrame / (double)sampleRate;
+            source.streamNextFrame += numFrames;
+            source.pendingChunk = m_pWorkThreadPool->SubmitForResult<std::shared_ptr<NCommon::AudioData>>(
+                [streamedAudio = source.streamedAudio, startFrame, numFrames](bool const*){
+                    return std::shared_ptr<NCommon::AudioData>(AudioUtil::DecodeStreamedAudio(*streamedAudio, startFrame, numFrames));
+                }
+            );
+        }
+    }
+
+    //
+    // (Re)start playback once there's data queued; the voice was either just acquired, or it ran out of data
+    //
+    if (!source.attachedBuffers.empty())
+    {
+        const auto alPlayState = ALGetPlayState(alSourceId);
+        if (alPlayState == PlayState::Initial || alPlayState == PlayState::Stopped)
+        {
+            alSourcePlay(alSourceId);
+        }
+    }
+}
+
+float AudioManager::GetAudibility(const Source& source) const
+{
+    float audibility = source.audioSourceProperties.gain;
+
+    if (source.playType == SourcePlayType::Local)
+    {
+        // Matches OpenAL's default inverse distance clamped attenuation model, with a rolloff factor of 1
+        const float referenceDistance = source.audioSourceProperties.referenceDistance;
+        const float distance = glm::distance(source.worldPosition, m_listenerPosition);
+
+        if (referenceDistance > 0.0f && distance > referenceDistance)
+        {
+            audibility *= referenceDistance / distance;
+        }
+    }
+
+    return audibility;
+}
+
+bool AudioManager::HasFreeVoice() const
+{
+    return m_numRealVoices < m_maxRealVoices;
+}
+
+PlayState AudioManager::ResolvePlayState(const Source& source) const
+{
+    if (!source.alSourceId || source.playState != PlayState::Playing)
+    {
+        return source.playState;
+    }
+
+    if (ALGetPlayState(*source.alSourceId) != PlayState::Stopped)
+    {
+        return source.playState;
+    }
+
+    // Fully loaded audio has finished once its voice has stopped. A streamed voice also stops when it runs out
+    // of decoded data, so streamed audio has only finished once all of it has been decoded and played.
+    if (source.resourceBufferId)
+    {
+        return PlayState::Stopped;
+    }
+
+    const bool streamExhausted = !source.audioSourceProperties.looping &&
+                                 !source.pendingChunk &&
+                                 source.streamNextFrame >= source.streamedAudio->numFrames;
+
+    return streamExhausted ? PlayState::Stopped : PlayState::Playing;
+}
+
+std::optional<double> AudioManager::QueryRealPlayTime(const Source& source) const
+{
+    if (!source.alSourceId || source.attachedBuffers.empty())
+    {
+        return std::nullopt;
+    }
+
+    const auto alPlayState = ALGetPlayState(*source.alSourceId);
+    if (alPlayState != PlayState::Playing && alPlayState != PlayState::Paused)
+    {
+        return std::nullopt;
+    }
+
+    float sourceSecOffset{0.0f};
+
+    alGetError();
+    alGetSourcef(*source.alSourceId, AL_SEC_OFFSET, &sourceSecOffset);
+    if (const auto error = alGetError(); error != AL_NO_ERROR)
+    {
+        return std::nullopt;
+    }
+
+    // Streamed chunks are offset by the start time of the oldest chunk still queued
+    const auto frontBufferIt = m_buffers.find(source.attachedBuffers.front());
+    if (frontBufferIt == m_buffers.cend())
+    {
+        return std::nullopt;
+    }
+
+    return frontBufferIt->second.streamStartTime + (double)sourceSecOffset;
+}
+
 void AudioManager::DestroyBuffer(ALuint bufferId)
 {
     AssertStartedUp();
@@ -977,7 +1665,7 @@ void AudioManager::DestroyBuffer(ALuint bufferId)
 
     std::lock_guard buffersLock(m_buffersMutex);
 
-    const auto bufferIt = m_buffers.find(bufferId);
+    auto bufferIt = m_buffers.find(bufferId);
     if (bufferIt == m_buffers.cend())
     {
         LogWarning("AudioManager::DestroyBuffer: No such buffer record exists: {}", bufferId);
@@ -1003,9 +1691,18 @@ void AudioManager::DestroyBuffer(ALuint bufferId)
         DestroySource(sourceUsage);
     }
 
+    // Destroying a source which streams its own buffers destroys those buffers, possibly including this one
+    bufferIt = m_buffers.find(bufferId);
+    if (bufferIt == m_buffers.cend())
+    {
+        return;
+    }
+
     //
     // Destroy and erase the buffer
     //
+    m_decodedByteSize -= std::min(m_decodedByteSize, bufferIt->second.byteSize);
+
     ALDestroyBuffer(bufferId);
     m_buffers.erase(bufferIt);
 
@@ -1069,7 +1766,6 @@ void AudioManager::ALDestroyBuffer(ALuint bufferId)
 
 std::expected<ALuint, bool> AudioManager::ALCreateSource(const SourceDataType& dataType,
                                                          const AudioSourceProperties& audioSourceProperties,
-                                                         const std::vector<ALuint>& initialBufferIds,
                                                          const std::optional<glm::vec3>& initialPosition)
 {
     AssertStartedUp();
@@ -1103,34 +1799,6 @@ std::expected<ALuint, bool> AudioManager::ALCreateSource(const SourceDataType& d
         alSource3f(sourceId, AL_POSITION, initialPosition->x, initialPosition->y, initialPosition->z);
     }
 
-    //
-    // Attach initial buffers to the source
-    //
-
-    // Validation
-    if (dataType == SourceDataType::Static && initialBufferIds.size() != 1)
-    {
-        LogError("AudioManager::ALCreateSource: Static sources require exactly one initial data buffer to be provided");
-        return std::unexpected(false);
-    }
-
-    if (!initialBufferIds.empty())
-    {
-        switch (dataType)
-        {
-            case SourceDataType::Static:
-            {
-                alSourcei(sourceId, AL_BUFFER, (ALint)initialBufferIds.front());
-            }
-                break;
-            case SourceDataType::Streamed:
-            {
-                alSourceQueueBuffers(sourceId, (ALsizei)initialBufferIds.size(), initialBufferIds.data());
-            }
-                break;
-        }
-    }
-
     return sourceId;
 }
 
@@ -1145,6 +1813,9 @@ void AudioManager::SyncMetrics()
 {
     m_pMetrics->SetCounterValue(METRIC_AUDIO_NUM_BUFFERS, m_buffers.size());
     m_pMetrics->SetCounterValue(METRIC_AUDIO_NUM_SOURCES, m_sources.size());
+    m_pMetrics->SetCounterValue(METRIC_AUDIO_NUM_REAL_VOICES, m_numRealVoices);
+    m_pMetrics->SetCounterValue(METRIC_AUDIO_NUM_VIRTUAL_VOICES, m_numVirtualVoices);
+    m_pMetrics->SetCounterValue(METRIC_AUDIO_DECODED_BYTES, m_decodedByteSize);
 }
 
 }
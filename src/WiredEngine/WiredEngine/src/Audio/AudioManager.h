@@ -12,6 +12,8 @@
 #include <Wired/Engine/Audio/AudioListener.h>
 #include <Wired/Engine/Audio/AudioSourceProperties.h>
 
+#include "AudioUtil.h"
+
 #include <NEON//Common/AudioData.h>
 
 #include <alext.h>
@@ -26,6 +28,10 @@
 #include <deque>
 #include <optional>
 #include <string>
+#include <span>
+#include <memory>
+#include <future>
+#include <chrono>
 
 namespace NCommon
 {
@@ -35,6 +41,8 @@ namespace NCommon
 
 namespace Wired::Engine
 {
+    class WorkThreadPool;
+
     enum class PlayState
     {
         Initial,
@@ -55,11 +63,44 @@ namespace Wired::Engine
         std::optional<double> playTime;
     };
 
+    struct LocalSourceUpdate
+    {
+        AudioSourceId sourceId{};
+        glm::vec3 worldPosition{0.0f};
+        glm::vec3 worldVelocity{0.0f}; // World units per second, used for doppler
+    };
+
+    /**
+     * Owns all OpenAL state.
+     *
+     * Sources created from resource audio are voice managed: at most m_maxRealVoices of them are given an OpenAL
+     * source (a real voice) at a time, chosen by priority and then audibility. The rest are virtual; their
+     * playback position continues to be tracked, and they're given a real voice, at their tracked position,
+     * once they're among the most important audible sources again. Streamed (enqueued data) sources always
+     * have a real voice, and count against the limit.
+     *
+     * Resource audio is either fully decoded up front, or streamed: kept encoded and decoded in chunks on worker
+     * threads, only while a real voice is playing it.
+     */
     class AudioManager
     {
         public:
 
-            AudioManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics);
+            // Upper limit on the number of real voices, further clamped to what the output device supports
+            static constexpr uint32_t MAX_REAL_VOICES = 64;
+
+            // Sources whose gain, after distance attenuation, is below this aren't given a real voice
+            static constexpr float MIN_AUDIBLE_GAIN = 0.001f;
+
+            // Length of each chunk of streamed resource audio that's decoded at a time
+            static constexpr double STREAM_CHUNK_SECONDS = 0.5;
+
+            // Number of decoded chunks kept queued ahead of a playing streamed resource source
+            static constexpr std::size_t STREAM_QUEUE_DEPTH = 3;
+
+        public:
+
+            AudioManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, WorkThreadPool* pWorkThreadPool);
 
             bool Startup();
             void Shutdown();
@@ -70,6 +111,8 @@ namespace Wired::Engine
             // Load/Destroy asset audio resources
             //
             [[nodiscard]] bool LoadResourceAudio(const ResourceIdentifier& resourceIdentifier, const NCommon::AudioData* pAudioData);
+            [[nodiscard]] bool LoadResourceStreamedAudio(const ResourceIdentifier& resourceIdentifier,
+                                                         std::shared_ptr<const StreamedAudio> streamedAudio);
             [[nodiscard]] bool IsResourceAudioLoaded(const ResourceIdentifier& resourceIdentifier);
             void DestroyResourceAudio(const ResourceIdentifier& resourceIdentifier);
 
@@ -94,9 +137,9 @@ namespace Wired::Engine
                 const AudioSourceProperties& properties,
                 const glm::vec3& position
             );
-            [[nodiscard]] bool PlaySource(const AudioSourceId& sourceId) const;
-            [[nodiscard]] bool PauseSource(const AudioSourceId& sourceId) const;
-            [[nodiscard]] bool StopSource(const AudioSourceId& sourceId) const;
+            [[nodiscard]] bool PlaySource(const AudioSourceId& sourceId);
+            [[nodiscard]] bool PauseSource(const AudioSourceId& sourceId);
+            [[nodiscard]] bool StopSource(const AudioSourceId& sourceId);
             [[nodiscard]] std::optional<AudioSourceState> GetSourceState(const AudioSourceId& sourceId) const;
             [[nodiscard]] std::optional<SourceDataType> GetSourceDataType(const AudioSourceId& sourceId) const;
             [[nodiscard]] bool EnqueueStreamedData(const AudioSourceId& sourceId,
@@ -109,11 +152,34 @@ namespace Wired::Engine
             //
             // System-driven
             //
-            void UpdateAudioListener(const AudioListener& listener) const;
-            [[nodiscard]] bool UpdateLocalSourcePosition(const AudioSourceId& sourceId, const glm::vec3& worldPosition) const;
+            void UpdateAudioListener(const AudioListener& listener);
+            [[nodiscard]] bool UpdateLocalSourcePosition(const AudioSourceId& sourceId, const glm::vec3& worldPosition);
+
+            /**
+             * Applies a batch of local source position/velocity updates under a single lock, with OpenAL
+             * updates deferred so that all the changes are applied to the mixer together.
+             */
+            void UpdateLocalSources(std::span<const LocalSourceUpdate> updates);
+
+            /**
+             * Finds which of the provided sources are static (non-streamed) sources which have finished
+             * playing, or which no longer exist. Appends the index of each such source within sourceIds
+             * to finishedIndices.
+             */
+            void GetFinishedSources(std::span<const AudioSourceId> sourceIds, std::vector<std::size_t>& finishedIndices) const;
+
             void DestroyFinishedTransientSources();
             void DestroyFinishedStreamedData();
 
+            /**
+             * Advances the playback of virtual sources, feeds decoded chunks to streamed resource sources, and
+             * re-assigns real voices to the most important audible sources. Virtual playback is advanced by wall
+             * clock time.
+             *
+             * Engine thread. Called once per simulation step, after all worlds' systems have executed.
+             */
+            void UpdateVoices();
+
         private:
 
             struct Buffer
@@ -135,8 +201,9 @@ namespace Wired::Engine
                 std::optional<ResourceIdentifier> resourceIdentifier;
                 std::chrono::duration<double> length;
                 double streamStartTime; // Start time (sec) of this buffer within the full audio stream it belongs to
+                std::size_t byteSize{0};
 
-                std::unordered_set<ALuint> sourceUsage;
+                std::unordered_set<AudioSourceId> sourceUsage;
             };
 
             enum class SourcePlayType
@@ -149,26 +216,47 @@ namespace Wired::Engine
             {
                 Source(SourcePlayType _playType,
                        SourceDataType _dataType,
-                       ALuint _sourceId,
                        const AudioSourceProperties& _audioSourceProperties,
-                       bool _isTransient,
-                       std::vector<ALuint> _initialBuffers = {})
+                       bool _isTransient)
                     : playType(_playType)
                     , dataType(_dataType)
-                    , sourceId(_sourceId)
                     , audioSourceProperties(_audioSourceProperties)
                     , isTransient(_isTransient)
-                {
-                    std::ranges::copy(_initialBuffers, std::back_inserter(attachedBuffers));
-                }
+                { }
+
+                [[nodiscard]] bool IsVoiceManaged() const noexcept { return dataType == SourceDataType::Static; }
 
                 SourcePlayType playType;
                 SourceDataType dataType;
-                ALuint sourceId;
                 AudioSourceProperties audioSourceProperties;
                 bool isTransient;
 
+                // The OpenAL source giving this source a real voice, if it currently has one
+                std::optional<ALuint> alSourceId;
                 std::deque<ALuint> attachedBuffers;
+
+                // The resource audio played by voice managed sources; either a fully loaded buffer, or streamed audio
+                std::optional<ALuint> resourceBufferId;
+                std::shared_ptr<const StreamedAudio> streamedAudio;
+                double length{0.0};
+
+                // Tracked playback state of voice managed sources, which is maintained while they're virtual
+                PlayState playState{PlayState::Initial};
+                double playTime{0.0};
+                glm::vec3 worldPosition{0.0f};
+                glm::vec3 worldVelocity{0.0f};
+
+                // Streamed resource audio decode state
+                std::size_t streamNextFrame{0};
+                std::optional<std::future<std::shared_ptr<NCommon::AudioData>>> pendingChunk;
+                double pendingChunkStartTime{0.0};
+            };
+
+            struct VoiceCandidate
+            {
+                AudioSourceId sourceId{};
+                uint32_t priority{0};
+                float audibility{0.0f};
             };
 
         private:
@@ -192,14 +280,25 @@ namespace Wired::Engine
 
             void DestroyBuffer(ALuint bufferId);
 
+            //
+            // Voice management
+            //
+            [[nodiscard]] bool AcquireVoice(const AudioSourceId& sourceId, Source& source);
+            void ReleaseVoice(const AudioSourceId& sourceId, Source& source);
+            void PumpStream(const AudioSourceId& sourceId, Source& source);
+            [[nodiscard]] float GetAudibility(const Source& source) const;
+            [[nodiscard]] bool HasFreeVoice() const;
+            [[nodiscard]] PlayState ResolvePlayState(const Source& source) const;
+            [[nodiscard]] std::optional<double> QueryRealPlayTime(const Source& source) const;
+
             [[nodiscard]] std::expected<ALuint, bool> ALCreateBuffer(const std::vector<const NCommon::AudioData*>& audioDatas);
             void ALDestroyBuffer(ALuint bufferId);
 
             [[nodiscard]] std::expected<ALuint, bool> ALCreateSource(const SourceDataType& dataType,
                                                                      const AudioSourceProperties& audioSourceProperties,
-                                                                     const std::vector<ALuint>& initialBufferIds,
                                                                      const std::optional<glm::vec3>& initialPosition);
             void ALDestroySource(ALuint sourceId);
+            [[nodiscard]] std::optional<PlayState> ALGetPlayState(ALuint alSourceId) const;
 
             [[nodiscard]] std::optional<PlayState> GetPlayState(const AudioSourceId& sourceId) const;
             [[nodiscard]] std::optional<double> GetPlayTime(const AudioSourceId& sourceId) const;
@@ -210,15 +309,33 @@ namespace Wired::Engine
 
             const NCommon::ILogger* m_pLogger;
             NCommon::IMetrics* m_pMetrics;
+            WorkThreadPool* m_pWorkThreadPool;
 
             ALCdevice* m_pDevice{nullptr};
             ALCcontext* m_pContext{nullptr};
 
+            // AL_SOFT_deferred_updates entry points, if supported
+            LPALDEFERUPDATESSOFT m_alDeferUpdatesSOFT{nullptr};
+            LPALPROCESSUPDATESSOFT m_alProcessUpdatesSOFT{nullptr};
+
             mutable std::recursive_mutex m_buffersMutex;
             std::unordered_map<ALuint, Buffer> m_buffers;
             std::unordered_map<ResourceIdentifier, ALuint> m_resourceToBuffer;
+            std::unordered_map<ResourceIdentifier, std::shared_ptr<const StreamedAudio>> m_resourceToStreamedAudio;
+
+            AudioSourceId m_nextSourceId{1};
+            std::unordered_map<AudioSourceId, Source> m_sources;
+
+            uint32_t m_maxRealVoices{MAX_REAL_VOICES};
+            std::size_t m_numRealVoices{0};
+            std::size_t m_numVirtualVoices{0};
+            std::size_t m_decodedByteSize{0};
+
+            glm::vec3 m_listenerPosition{0.0f};
+            std::optional<std::chrono::steady_clock::time_point> m_lastVoiceUpdate;
 
-            std::unordered_map<ALuint, Source> m_sources;
+            // Scratch space re-used across UpdateVoices calls
+            std::vector<VoiceCandidate> m_voiceCandidates;
     };
 }
 
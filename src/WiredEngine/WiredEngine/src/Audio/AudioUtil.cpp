@@ -9,6 +9,7 @@
 #include <bit>
 #include <array>
 #include <algorithm>
+#include <cstring>
 
 namespace Wired::Engine
 {
@@ -111,6 +112,211 @@ std::expected<std::unique_ptr<NCommon::AudioData>, bool> AudioUtil::AudioDataFro
     );
 }
 
+static uint16_t ReadUInt16LE(const std::byte* pBytes)
+{
+    return static_cast<uint16_t>(std::to_integer<uint16_t>(pBytes[0]) | (std::to_integer<uint16_t>(pBytes[1]) << 8));
+}
+
+static uint32_t ReadUInt32LE(const std::byte* pBytes)
+{
+    return std::to_integer<uint32_t>(pBytes[0]) |
+           (std::to_integer<uint32_t>(pBytes[1]) << 8) |
+           (std::to_integer<uint32_t>(pBytes[2]) << 16) |
+           (std::to_integer<uint32_t>(pBytes[3]) << 24);
+}
+
+static bool ChunkIdEquals(const std::byte* pBytes, const char* id)
+{
+    return std::memcmp(pBytes, id, 4) == 0;
+}
+
+/**
+ * Reads one encoded little-endian WAV sample and returns its value in the range [-1,1]
+ */
+static double ReadWavSample(const std::byte* pSample, uint16_t bitDepth, bool isFloat)
+{
+    if (isFloat)
+    {
+        if (bitDepth == 32)
+        {
+            const uint32_t bits = ReadUInt32LE(pSample);
+            return (double)std::bit_cast<float>(bits);
+        }
+
+        const uint64_t bits = (uint64_t)ReadUInt32LE(pSample) | ((uint64_t)ReadUInt32LE(pSample + 4) << 32);
+        return std::bit_cast<double>(bits);
+    }
+
+    switch (bitDepth)
+    {
+        case 8: return ((double)std::to_integer<uint8_t>(pSample[0]) - 128.0) / 128.0;
+        case 16: return (double)static_cast<int16_t>(ReadUInt16LE(pSample)) / 32768.0;
+        case 24:
+        {
+            auto value = (int32_t)(std::to_integer<uint32_t>(pSample[0]) |
+                                   (std::to_integer<uint32_t>(pSample[1]) << 8) |
+                                   (std::to_integer<uint32_t>(pSample[2]) << 16));
+            if (value & 0x800000) { value |= ~0xFFFFFF; }
+            return (double)value / 8388608.0;
+        }
+        case 32: return (double)static_cast<int32_t>(ReadUInt32LE(pSample)) / 2147483648.0;
+        default: return 0.0;
+    }
+}
+
+std::expected<std::shared_ptr<const StreamedAudio>, bool> AudioUtil::StreamedAudioFromBytes(std::vector<std::byte> bytes)
+{
+    static constexpr uint16_t WAVE_FORMAT_PCM = 0x0001;
+    static constexpr uint16_t WAVE_FORMAT_IEEE_FLOAT = 0x0003;
+    static constexpr uint16_t WAVE_FORMAT_EXTENSIBLE = 0xFFFE;
+
+    if (bytes.size() < 12 || !ChunkIdEquals(bytes.data(), "RIFF") || !ChunkIdEquals(bytes.data() + 8, "WAVE"))
+    {
+        return std::unexpected(false);
+    }
+
+    auto streamedAudio = std::make_shared<StreamedAudio>();
+
+    uint16_t audioFormat{0};
+    bool foundFmt = false;
+    bool foundData = false;
+    std::size_t dataByteSize{0};
+
+    //
+    // Walk the RIFF chunks, looking for the format and data chunks
+    //
+    std::size_t offset = 12;
+
+    while (offset + 8 <= bytes.size() && !foundData)
+    {
+        const std::byte* pChunk = bytes.data() + offset;
+        const std::size_t chunkSize = ReadUInt32LE(pChunk + 4);
+        const std::size_t chunkDataOffset = offset + 8;
+        const std::size_t chunkAvailable = std::min(chunkSize, bytes.size() - chunkDataOffset);
+
+        if (ChunkIdEquals(pChunk, "fmt "))
+        {
+            if (chunkAvailable < 16) { return std::unexpected(false); }
+
+            const std::byte* pFmt = bytes.data() + chunkDataOffset;
+            audioFormat = ReadUInt16LE(pFmt);
+            streamedAudio->numChannels = ReadUInt16LE(pFmt + 2);
+            streamedAudio->sampleRate = ReadUInt32LE(pFmt + 4);
+            streamedAudio->blockAlign = ReadUInt16LE(pFmt + 12);
+            streamedAudio->bitDepth = ReadUInt16LE(pFmt + 14);
+
+            // The sub-format of an extensible format starts with the actual format tag
+            if (audioFormat == WAVE_FORMAT_EXTENSIBLE && chunkAvailable >= 26)
+            {
+                audioFormat = ReadUInt16LE(pFmt + 24);
+            }
+
+            foundFmt = true;
+        }
+        else if (ChunkIdEquals(pChunk, "data"))
+        {
+            streamedAudio->dataOffset = chunkDataOffset;
+            dataByteSize = chunkAvailable;
+            foundData = true;
+        }
+
+        // Chunks are padded to an even size
+        offset = chunkDataOffset + chunkSize + (chunkSize % 2);
+    }
+
+    if (!foundFmt || !foundData) { return std::unexpected(false); }
+
+    //
+    // Validate that it's a layout we're able to decode
+    //
+    const uint16_t bitDepth = streamedAudio->bitDepth;
+
+    if (audioFormat == WAVE_FORMAT_PCM)
+    {
+        if (bitDepth != 8 && bitDepth != 16 && bitDepth != 24 && bitDepth != 32) { return std::unexpected(false); }
+    }
+    else if (audioFormat == WAVE_FORMAT_IEEE_FLOAT)
+    {
+        if (bitDepth != 32 && bitDepth != 64) { return std::unexpected(false); }
+        streamedAudio->isFloat = true;
+    }
+    else
+    {
+        return std::unexpected(false);
+    }
+
+    if (streamedAudio->numChannels == 0 || streamedAudio->numChannels > 2 ||
+        streamedAudio->sampleRate == 0 ||
+        streamedAudio->blockAlign < streamedAudio->numChannels * (bitDepth / 8))
+    {
+        return std::unexpected(false);
+    }
+
+    // We transform all bit depth >= 16 to 16 bit as that's the most OpenAL supports
+    if (streamedAudio->numChannels == 1)
+    {
+        streamedAudio->format = bitDepth == 8 ? NCommon::AudioDataFormat::Mono8 : NCommon::AudioDataFormat::Mono16;
+    }
+    else
+    {
+        streamedAudio->format = bitDepth == 8 ? NCommon::AudioDataFormat::Stereo8 : NCommon::AudioDataFormat::Stereo16;
+    }
+
+    streamedAudio->numFrames = dataByteSize / streamedAudio->blockAlign;
+    streamedAudio->encodedBytes = std::move(bytes);
+
+    return streamedAudio;
+}
+
+std::unique_ptr<NCommon::AudioData> AudioUtil::DecodeStreamedAudio(const StreamedAudio& streamedAudio,
+                                                                   std::size_t startFrame,
+                                                                   std::size_t numFrames)
+{
+    if (startFrame >= streamedAudio.numFrames)
+    {
+        return nullptr;
+    }
+
+    numFrames = std::min(numFrames, streamedAudio.numFrames - startFrame);
+
+    const unsigned int outBitDepth = streamedAudio.bitDepth == 8 ? 8 : 16;
+    const std::size_t sampleByteSize = streamedAudio.bitDepth / 8;
+
+    std::vector<std::byte> byteBuffer;
+    byteBuffer.reserve(numFrames * streamedAudio.numChannels * (outBitDepth / 8));
+
+    const std::byte* pFrame = streamedAudio.encodedBytes.data() + streamedAudio.dataOffset + (startFrame * streamedAudio.blockAlign);
+
+    for (std::size_t frame = 0; frame < numFrames; ++frame)
+    {
+        for (uint16_t channel = 0; channel < streamedAudio.numChannels; ++channel)
+        {
+            const std::byte* pSample = pFrame + (channel * sampleByteSize);
+
+            // 8 and 16 bit integer samples are already in the output format; copy them as-is rather than
+            // round-tripping them through [-1,1], which would lose their lowest bit
+            if (!streamedAudio.isFloat && streamedAudio.bitDepth == 8)
+            {
+                byteBuffer.push_back(pSample[0]);
+            }
+            else if (!streamedAudio.isFloat && streamedAudio.bitDepth == 16)
+            {
+                const std::array<std::byte, 2> bytes = Int16ToBytes(static_cast<int16_t>(ReadUInt16LE(pSample)));
+                byteBuffer.push_back(bytes[0]);
+                byteBuffer.push_back(bytes[1]);
+            }
+            else
+            {
+                AppendSample(byteBuffer, outBitDepth, ReadWavSample(pSample, streamedAudio.bitDepth, streamedAudio.isFloat));
+            }
+        }
+
+        pFrame += streamedAudio.blockAlign;
+    }
+
+    return std::make_unique<NCommon::AudioData>(streamedAudio.format, streamedAudio.sampleRate, std::move(byteBuffer));
+}
+
 void AudioUtil::AppendSample(std::vector<std::byte>& byteBuffer, const unsigned int& bitDepth, const double& sample)
 {
     if (bitDepth == 8)
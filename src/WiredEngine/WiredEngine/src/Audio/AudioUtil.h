@@ -17,13 +17,55 @@
 #include <cstdint>
 #include <numeric>
 #include <expected>
+#include <memory>
+#include <chrono>
 
 namespace Wired::Engine
 {
+    /**
+     * Audio which is kept in its encoded (file) form and decoded in chunks, on demand, as it's played,
+     * rather than being decoded up front in its entirety.
+     */
+    struct StreamedAudio
+    {
+        std::vector<std::byte> encodedBytes;
+
+        // Format that chunks are decoded to
+        NCommon::AudioDataFormat format{};
+        uint32_t sampleRate{0};
+
+        // Layout of the encoded sample data within encodedBytes
+        uint16_t numChannels{0};
+        uint16_t bitDepth{0};
+        uint16_t blockAlign{0};
+        bool isFloat{false};
+        std::size_t dataOffset{0};
+        std::size_t numFrames{0};
+
+        [[nodiscard]] std::chrono::duration<double> Duration() const
+        {
+            return std::chrono::duration<double>((double)numFrames / (double)sampleRate);
+        }
+    };
+
     struct AudioUtil
     {
         static std::expected<std::unique_ptr<NCommon::AudioData>, bool> AudioDataFromBytes(const std::vector<std::byte>& bytes);
 
+        /**
+         * Parses the header of an encoded audio file so that its audio can be chunk decoded via DecodeStreamedAudio.
+         * Only WAV files (integer or float PCM, mono or stereo) are supported.
+         */
+        static std::expected<std::shared_ptr<const StreamedAudio>, bool> StreamedAudioFromBytes(std::vector<std::byte> bytes);
+
+        /**
+         * Decodes up to numFrames frames of streamed audio, starting at frame startFrame. Returns nullptr if startFrame
+         * is past the end of the audio. Safe to call from any thread.
+         */
+        static std::unique_ptr<NCommon::AudioData> DecodeStreamedAudio(const StreamedAudio& streamedAudio,
+                                                                       std::size_t startFrame,
+                                                                       std::size_t numFrames);
+
         /**
          * Appends a sample value (range of [-1,1]) to a byte buffer. Converts the sample to bytes as determined by
          * bitDepth parameter. A bitDepth of 8 results in a single byte sample value being appended, while any other
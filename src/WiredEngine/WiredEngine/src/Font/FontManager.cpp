@@ -14,10 +14,11 @@
 namespace Wired::Engine
 {
 
-FontManager::FontManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, Platform::IText* pText)
+FontManager::FontManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, Platform::IText* pText, Render::IRenderer* pRenderer)
     : m_pLogger(pLogger)
     , m_pMetrics(pMetrics)
     , m_pText(pText)
+    , m_pRenderer(pRenderer)
 {
 
 }
@@ -27,6 +28,7 @@ FontManager::~FontManager()
     m_pLogger = nullptr;
     m_pMetrics = nullptr;
     m_pText = nullptr;
+    m_pRenderer = nullptr;
 }
 
 bool FontManager::Startup()
@@ -40,11 +42,13 @@ void FontManager::Shutdown()
 {
     LogInfo("FontManager shutting down");
 
+    DestroyGlyphAtlases({});
     m_pText->Destroy();
 }
 
 void FontManager::DestroyAll()
 {
+    DestroyGlyphAtlases({});
     m_pText->UnloadAllFonts();
 }
 
@@ -64,6 +68,7 @@ void FontManager::DestroyResourceFont(const ResourceIdentifier& resourceIdentifi
 {
     LogInfo("FontManager: Destroying resource font: {}", resourceIdentifier.GetUniqueName());
 
+    DestroyGlyphAtlases(resourceIdentifier.GetUniqueName());
     m_pText->UnloadFont(resourceIdentifier.GetUniqueName());
 }
 
@@ -74,4 +79,40 @@ std::expected<Platform::RenderedText, bool> FontManager::RenderText(const std::s
     return m_pText->RenderText(text, font.GetUniqueName(), properties);
 }
 
+std::expected<LayoutTextResult, bool> FontManager::LayoutText(const std::string& text,
+                                                              const ResourceIdentifier& font,
+                                                              const Platform::TextProperties& properties)
+{
+    const auto fontName = font.GetUniqueName();
+
+    if (!m_pText->IsFontLoaded(fontName))
+    {
+        LogError("FontManager::LayoutText: Font is not loaded: {}", fontName);
+        return std::unexpected(false);
+    }
+
+    const auto& color = properties.fgColor;
+    const uint32_t packedColor = ((uint32_t)color.r << 24) | ((uint32_t)color.g << 16) | ((uint32_t)color.b << 8) | (uint32_t)color.a;
+
+    const auto key = GlyphAtlasKey{fontName, properties.fontSize, packedColor};
+
+    auto it = m_glyphAtlases.find(key);
+    if (it == m_glyphAtlases.cend())
+    {
+        it = m_glyphAtlases.insert({key, std::make_unique<GlyphAtlas>(m_pLogger, m_pText, m_pRenderer, fontName, properties.fontSize, color)}).first;
+    }
+
+    return it->second->LayoutText(text, properties.wrapLength);
+}
+
+void FontManager::DestroyGlyphAtlases(const std::string& fontName)
+{
+    std::erase_if(m_glyphAtlases, [&](auto& atlasIt){
+        if (!fontName.empty() && std::get<0>(atlasIt.first) != fontName) { return false; }
+
+        atlasIt.second->Destroy();
+        return true;
+    });
+}
+
 }
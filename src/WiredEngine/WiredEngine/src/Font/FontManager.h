@@ -7,13 +7,19 @@
 #ifndef WIREDENGINE_WIREDENGINE_SRC_FONT_FONTMANAGER_H
 #define WIREDENGINE_WIREDENGINE_SRC_FONT_FONTMANAGER_H
 
+#include "GlyphAtlas.h"
+
 #include <Wired/Engine/ResourceIdentifier.h>
+#include <Wired/Engine/IResources.h>
 
 #include <Wired/Platform/Text.h>
 
 #include <span>
 #include <vector>
 #include <unordered_map>
+#include <map>
+#include <tuple>
+#include <memory>
 #include <expected>
 
 namespace NCommon
@@ -27,13 +33,18 @@ namespace Wired::Platform
     class IText;
 }
 
+namespace Wired::Render
+{
+    class IRenderer;
+}
+
 namespace Wired::Engine
 {
     class FontManager
     {
         public:
 
-            FontManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, Platform::IText* pText);
+            FontManager(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, Platform::IText* pText, Render::IRenderer* pRenderer);
             ~FontManager();
 
             bool Startup();
@@ -49,11 +60,27 @@ namespace Wired::Engine
                                                                                  const ResourceIdentifier& font,
                                                                                  const Platform::TextProperties& properties);
 
+            [[nodiscard]] std::expected<LayoutTextResult, bool> LayoutText(const std::string& text,
+                                                                           const ResourceIdentifier& font,
+                                                                           const Platform::TextProperties& properties);
+
+        private:
+
+            // Font unique name, font size, packed RGBA foreground color
+            using GlyphAtlasKey = std::tuple<std::string, Platform::FontSize, uint32_t>;
+
+        private:
+
+            void DestroyGlyphAtlases(const std::string& fontName);
+
         private:
 
             const NCommon::ILogger* m_pLogger;
             NCommon::IMetrics* m_pMetrics;
             Platform::IText* m_pText;
+            Render::IRenderer* m_pRenderer;
+
+            std::map<GlyphAtlasKey, std::unique_ptr<GlyphAtlas>> m_glyphAtlases;
     };
 }
 
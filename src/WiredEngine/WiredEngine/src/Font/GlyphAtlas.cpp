@@ -0,0 +1,335 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "GlyphAtlas.h"
+#include "TextLayout.h"
+
+#include <Wired/Platform/IText.h>
+
+#include <Wired/Render/IRenderer.h>
+
+#include <NEON/Common/Log/ILogger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <format>
+
+namespace Wired::Engine
+{
+
+// Transparent border kept around each glyph so that sampling at a glyph's edges never picks up its neighbours
+static constexpr uint32_t GLYPH_PADDING = 1;
+
+GlyphAtlas::GlyphAtlas(const NCommon::ILogger* pLogger,
+                       Platform::IText* pText,
+                       Render::IRenderer* pRenderer,
+                       std::string fontName,
+                       Platform::FontSize fontSize,
+                       const Platform::Color& fgColor)
+    : m_pLogger(pLogger)
+    , m_pText(pText)
+    , m_pRenderer(pRenderer)
+    , m_fontName(std::move(fontName))
+    , m_fontSize(fontSize)
+    , m_fgColor(fgColor)
+{
+
+}
+
+GlyphAtlas::~GlyphAtlas()
+{
+    m_pLogger = nullptr;
+    m_pText = nullptr;
+    m_pRenderer = nullptr;
+}
+
+void GlyphAtlas::Destroy()
+{
+    for (const auto& page : m_pages)
+    {
+        m_pRenderer->DestroyTexture(page.textureId);
+    }
+
+    m_pages.clear();
+    m_glyphs.clear();
+}
+
+std::expected<LayoutTextResult, bool> GlyphAtlas::LayoutText(const std::string& text, uint32_t wrapLength)
+{
+    ++m_useCounter;
+
+    if (!m_fontMetrics)
+    {
+        const auto fontMetrics = m_pText->GetFontMetrics(m_fontName, m_fontSize);
+        if (!fontMetrics)
+        {
+            LogError("GlyphAtlas::LayoutText: Failed to get font metrics for font: {}", m_fontName);
+            return std::unexpected(false);
+        }
+        m_fontMetrics = *fontMetrics;
+    }
+
+    LayoutTextResult result{};
+
+    TextLayout layout(wrapLength, m_fontMetrics->lineSkip);
+
+    for (const auto& codepoint : DecodeUTF8(text))
+    {
+        if (codepoint == '\n')
+        {
+            layout.NewLine();
+            continue;
+        }
+
+        const auto glyph = EnsureGlyph(codepoint);
+        if (!glyph)
+        {
+            LogError("GlyphAtlas::LayoutText: Failed to get glyph {} for font: {}", codepoint, m_fontName);
+            return std::unexpected(false);
+        }
+
+        const auto previousCodepoint = layout.GetPreviousCodepoint();
+        const int32_t kerning = previousCodepoint ? m_pText->GetGlyphKerning(m_fontName, m_fontSize, *previousCodepoint, codepoint) : 0;
+
+        layout.AddGlyph(codepoint, glyph->advance, kerning, glyph->hasImage);
+
+        if (glyph->hasImage)
+        {
+            result.glyphs.push_back(TextGlyph{
+                .textureId = m_pages[glyph->page].textureId,
+                .srcPixelRect = NCommon::RectReal((float)glyph->rect.x, (float)glyph->rect.y, (float)glyph->rect.w, (float)glyph->rect.h)
+            });
+        }
+    }
+
+    //
+    // Send all newly rasterized glyphs to their pages before the layout is used
+    //
+    if (!FlushPendingUploads())
+    {
+        LogError("GlyphAtlas::LayoutText: Failed to upload glyphs for font: {}", m_fontName);
+        return std::unexpected(false);
+    }
+
+    // Layout offsets are only final once all the glyphs have been added
+    const auto& glyphOffsets = layout.GetGlyphOffsets();
+
+    for (std::size_t x = 0; x < result.glyphs.size(); ++x)
+    {
+        result.glyphs[x].offset = glyphOffsets[x];
+    }
+
+    uint32_t textWidth = 0;
+
+    for (const auto& textGlyph : result.glyphs)
+    {
+        textWidth = std::max(textWidth, (uint32_t)(textGlyph.offset.x + textGlyph.srcPixelRect.w));
+    }
+
+    result.textRenderSize = {textWidth, (uint32_t)(layout.GetLineTop() + m_fontMetrics->height)};
+
+    return result;
+}
+
+std::expected<GlyphAtlas::Glyph, bool> GlyphAtlas::EnsureGlyph(uint32_t codepoint)
+{
+    const auto it = m_glyphs.find(codepoint);
+    if (it != m_glyphs.cend())
+    {
+        if (it->second.hasImage)
+        {
+            m_pages[it->second.page].lastUsed = m_useCounter;
+        }
+
+        return it->second;
+    }
+
+    auto renderedGlyph = m_pText->RenderGlyph(m_fontName, m_fontSize, codepoint, m_fgColor);
+    if (!renderedGlyph)
+    {
+        return std::unexpected(false);
+    }
+
+    Glyph glyph{};
+    glyph.advance = renderedGlyph->advance;
+
+    if (renderedGlyph->imageData)
+    {
+        const auto* pGlyphImage = renderedGlyph->imageData.get();
+
+        const auto glyphWidth = (uint32_t)pGlyphImage->GetPixelWidth();
+        const auto glyphHeight = (uint32_t)pGlyphImage->GetPixelHeight();
+        const auto paddedWidth = glyphWidth + (2 * GLYPH_PADDING);
+        const auto paddedHeight = glyphHeight + (2 * GLYPH_PADDING);
+
+        const auto space = AllocateGlyphSpace(paddedWidth, paddedHeight);
+        if (!space)
+        {
+            return std::unexpected(false);
+        }
+
+        // Copy the glyph into the middle of a transparent, padded, image
+        static constexpr std::size_t BYTES_PER_PIXEL = 4;
+
+        std::vector<std::byte> paddedBytes(paddedWidth * paddedHeight * BYTES_PER_PIXEL, std::byte{0});
+
+        for (uint32_t row = 0; row < glyphHeight; ++row)
+        {
+            std::memcpy(
+                paddedBytes.data() + ((((row + GLYPH_PADDING) * paddedWidth) + GLYPH_PADDING) * BYTES_PER_PIXEL),
+                pGlyphImage->GetPixelData() + (row * glyphWidth * BYTES_PER_PIXEL),
+                glyphWidth * BYTES_PER_PIXEL
+            );
+        }
+
+        auto paddedImage = std::make_unique<NCommon::ImageData>(
+            std::move(paddedBytes),
+            1,
+            paddedWidth,
+            paddedHeight,
+            pGlyphImage->GetPixelFormat()
+        );
+
+        auto& page = m_pages[space->first];
+        page.pendingUpdates.push_back(Render::TextureUpdate{
+            .pImageData = paddedImage.get(),
+            .x = space->second.x,
+            .y = space->second.y
+        });
+        page.pendingImages.push_back(std::move(paddedImage));
+        page.lastUsed = m_useCounter;
+
+        glyph.hasImage = true;
+        glyph.page = space->first;
+        glyph.rect = NCommon::RectUInt(space->second.x + GLYPH_PADDING, space->second.y + GLYPH_PADDING, glyphWidth, glyphHeight);
+    }
+
+    m_glyphs.insert({codepoint, glyph});
+
+    return glyph;
+}
+
+std::expected<std::pair<uint32_t, NCommon::RectUInt>, bool> GlyphAtlas::AllocateGlyphSpace(uint32_t width, uint32_t height)
+{
+    if (width > PAGE_SIZE || height > PAGE_SIZE)
+    {
+        LogError("GlyphAtlas::AllocateGlyphSpace: Glyph is larger than an atlas page: {}x{}", width, height);
+        return std::unexpected(false);
+    }
+
+    //
+    // Space on an existing page
+    //
+    for (uint32_t pageIndex = 0; pageIndex < m_pages.size(); ++pageIndex)
+    {
+        const auto rect = m_pages[pageIndex].packer.Allocate(width, height);
+        if (rect)
+        {
+            return std::make_pair(pageIndex, *rect);
+        }
+    }
+
+    //
+    // Otherwise, a new page, or the least recently used page, emptied
+    //
+    uint32_t pageIndex = 0;
+
+    if (m_pages.size() < MAX_PAGES)
+    {
+        const auto newPageIndex = CreatePage();
+        if (!newPageIndex)
+        {
+            return std::unexpected(false);
+        }
+        pageIndex = *newPageIndex;
+    }
+    else
+    {
+        const auto lruIt = std::ranges::min_element(m_pages, {}, &Page::lastUsed);
+
+        // Pages used by the text currently being laid out can't be evicted
+        if (lruIt->lastUsed == m_useCounter)
+        {
+            LogError("GlyphAtlas::AllocateGlyphSpace: Text uses more glyphs than the atlas can hold, for font: {}", m_fontName);
+            return std::unexpected(false);
+        }
+
+        pageIndex = (uint32_t)std::distance(m_pages.begin(), lruIt);
+        EvictPage(pageIndex);
+    }
+
+    const auto rect = m_pages[pageIndex].packer.Allocate(width, height);
+    if (!rect)
+    {
+        return std::unexpected(false);
+    }
+
+    return std::make_pair(pageIndex, *rect);
+}
+
+std::expected<uint32_t, bool> GlyphAtlas::CreatePage()
+{
+    const auto blankImage = NCommon::ImageData(
+        std::vector<std::byte>(PAGE_SIZE * PAGE_SIZE * 4, std::byte{0}),
+        1,
+        PAGE_SIZE,
+        PAGE_SIZE,
+        NCommon::ImageData::PixelFormat::B8G8R8A8_SRGB
+    );
+
+    const auto textureId = m_pRenderer->CreateTexture_FromImage(&blankImage, Render::TextureType::Texture2D, false, std::format("GlyphAtlas-{}", m_fontName)).get();
+    if (!textureId)
+    {
+        LogError("GlyphAtlas::CreatePage: Failed to create page texture for font: {}", m_fontName);
+        return std::unexpected(false);
+    }
+
+    Page page{};
+    page.textureId = *textureId;
+    page.lastUsed = m_useCounter;
+
+    m_pages.push_back(std::move(page));
+
+    return (uint32_t)(m_pages.size() - 1);
+}
+
+void GlyphAtlas::EvictPage(uint32_t pageIndex)
+{
+    LogInfo("GlyphAtlas: Evicting page {} of font: {}", pageIndex, m_fontName);
+
+    std::erase_if(m_glyphs, [&](const auto& glyphIt){
+        return glyphIt.second.hasImage && glyphIt.second.page == pageIndex;
+    });
+
+    auto& page = m_pages[pageIndex];
+    page.packer.Clear();
+    page.pendingUpdates.clear();
+    page.pendingImages.clear();
+}
+
+bool GlyphAtlas::FlushPendingUploads()
+{
+    bool allSuccessful = true;
+
+    for (auto& page : m_pages)
+    {
+        if (page.pendingUpdates.empty()) { continue; }
+
+        // One transfer per page, no matter how many glyphs were added to it. Waits for the transfer, as the
+        // update images are released afterward.
+        if (!m_pRenderer->UpdateTexture(page.textureId, page.pendingUpdates).get())
+        {
+            allSuccessful = false;
+        }
+
+        page.pendingUpdates.clear();
+        page.pendingImages.clear();
+    }
+
+    return allSuccessful;
+}
+
+}
@@ -0,0 +1,123 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_FONT_GLYPHATLAS_H
+#define WIREDENGINE_WIREDENGINE_SRC_FONT_GLYPHATLAS_H
+
+#include "ShelfPacker.h"
+
+#include <Wired/Engine/IResources.h>
+
+#include <Wired/Platform/Text.h>
+
+#include <Wired/Render/Id.h>
+#include <Wired/Render/TextureCommon.h>
+
+#include <NEON/Common/ImageData.h>
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <expected>
+#include <optional>
+#include <cstdint>
+
+namespace NCommon
+{
+    class ILogger;
+}
+
+namespace Wired::Platform
+{
+    class IText;
+}
+
+namespace Wired::Render
+{
+    class IRenderer;
+}
+
+namespace Wired::Engine
+{
+    /**
+     * Caches the rendered glyphs of one font, at one size and color, in shelf-packed atlas page textures,
+     * and lays out text from them.
+     *
+     * Pages are created on demand, up to MAX_PAGES. Once that many pages are full, the least recently used
+     * page is evicted to make room for new glyphs.
+     */
+    class GlyphAtlas
+    {
+        public:
+
+            static constexpr uint32_t PAGE_SIZE = 1024;
+            static constexpr uint32_t MAX_PAGES = 4;
+
+        public:
+
+            GlyphAtlas(const NCommon::ILogger* pLogger,
+                       Platform::IText* pText,
+                       Render::IRenderer* pRenderer,
+                       std::string fontName,
+                       Platform::FontSize fontSize,
+                       const Platform::Color& fgColor);
+            ~GlyphAtlas();
+
+            [[nodiscard]] std::expected<LayoutTextResult, bool> LayoutText(const std::string& text, uint32_t wrapLength);
+
+            void Destroy();
+
+        private:
+
+            struct Glyph
+            {
+                bool hasImage{false};
+                uint32_t page{0};
+                NCommon::RectUInt rect{};
+                int32_t advance{0};
+            };
+
+            struct Page
+            {
+                Render::TextureId textureId{};
+                ShelfPacker packer{PAGE_SIZE, PAGE_SIZE};
+                uint64_t lastUsed{0};
+
+                // Glyph uploads not yet sent to the page's texture
+                std::vector<std::unique_ptr<NCommon::ImageData>> pendingImages;
+                std::vector<Render::TextureUpdate> pendingUpdates;
+            };
+
+        private:
+
+            [[nodiscard]] std::expected<Glyph, bool> EnsureGlyph(uint32_t codepoint);
+            [[nodiscard]] std::expected<std::pair<uint32_t, NCommon::RectUInt>, bool> AllocateGlyphSpace(uint32_t width, uint32_t height);
+            [[nodiscard]] std::expected<uint32_t, bool> CreatePage();
+            void EvictPage(uint32_t pageIndex);
+            [[nodiscard]] bool FlushPendingUploads();
+
+        private:
+
+            const NCommon::ILogger* m_pLogger;
+            Platform::IText* m_pText;
+            Render::IRenderer* m_pRenderer;
+
+            std::string m_fontName;
+            Platform::FontSize m_fontSize;
+            Platform::Color m_fgColor;
+
+            std::optional<Platform::FontMetrics> m_fontMetrics;
+
+            std::unordered_map<uint32_t, Glyph> m_glyphs;
+            std::vector<Page> m_pages;
+
+            // Incremented per LayoutText call; pages record the value of their last use for LRU eviction
+            uint64_t m_useCounter{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_FONT_GLYPHATLAS_H
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "ShelfPacker.h"
+
+namespace Wired::Engine
+{
+
+ShelfPacker::ShelfPacker(uint32_t width, uint32_t height)
+    : m_width(width)
+    , m_height(height)
+{
+
+}
+
+std::optional<NCommon::RectUInt> ShelfPacker::Allocate(uint32_t width, uint32_t height)
+{
+    if (width > m_width || height > m_height)
+    {
+        return std::nullopt;
+    }
+
+    // The shortest shelf that the rect fits on
+    Shelf* pBestShelf = nullptr;
+
+    for (auto& shelf : m_shelves)
+    {
+        if (shelf.height < height || shelf.nextX + width > m_width) { continue; }
+
+        if (pBestShelf == nullptr || shelf.height < pBestShelf->height)
+        {
+            pBestShelf = &shelf;
+        }
+    }
+
+    // Otherwise, open a new shelf, if there's room for one
+    if (pBestShelf == nullptr)
+    {
+        if (m_nextShelfY + height > m_height)
+        {
+            return std::nullopt;
+        }
+
+        m_shelves.push_back(Shelf{.y = m_nextShelfY, .height = height, .nextX = 0});
+        m_nextShelfY += height;
+        pBestShelf = &m_shelves.back();
+    }
+
+    const auto rect = NCommon::RectUInt(pBestShelf->nextX, pBestShelf->y, width, height);
+    pBestShelf->nextX += width;
+
+    return rect;
+}
+
+void ShelfPacker::Clear()
+{
+    m_shelves.clear();
+    m_nextShelfY = 0;
+}
+
+}
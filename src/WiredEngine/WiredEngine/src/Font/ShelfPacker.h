@@ -0,0 +1,62 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_FONT_SHELFPACKER_H
+#define WIREDENGINE_WIREDENGINE_SRC_FONT_SHELFPACKER_H
+
+#include <NEON/Common/Space/Rect.h>
+
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace Wired::Engine
+{
+    /**
+     * Packs rects into a fixed size area, in rows ("shelves") as tall as the first rect placed on them.
+     *
+     * Each rect goes on the shortest shelf it fits on. If it fits on none of them, a new shelf is opened
+     * below the existing ones.
+     */
+    class ShelfPacker
+    {
+        public:
+
+            ShelfPacker(uint32_t width, uint32_t height);
+
+            /**
+             * @return Where the rect was placed, or std::nullopt if there's no room left for it
+             */
+            [[nodiscard]] std::optional<NCommon::RectUInt> Allocate(uint32_t width, uint32_t height);
+
+            /**
+             * Empties the area
+             */
+            void Clear();
+
+            [[nodiscard]] std::size_t GetShelfCount() const noexcept { return m_shelves.size(); }
+
+        private:
+
+            struct Shelf
+            {
+                uint32_t y{0};
+                uint32_t height{0};
+                uint32_t nextX{0};
+            };
+
+        private:
+
+            uint32_t m_width;
+            uint32_t m_height;
+
+            std::vector<Shelf> m_shelves;
+            uint32_t m_nextShelfY{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_FONT_SHELFPACKER_H
@@ -0,0 +1,116 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "TextLayout.h"
+
+namespace Wired::Engine
+{
+
+static constexpr uint32_t REPLACEMENT_CODEPOINT = 0xFFFD;
+
+std::vector<uint32_t> DecodeUTF8(const std::string& text)
+{
+    std::vector<uint32_t> codepoints;
+    codepoints.reserve(text.size());
+
+    std::size_t pos = 0;
+
+    while (pos < text.size())
+    {
+        const auto lead = static_cast<uint8_t>(text[pos]);
+
+        uint32_t codepoint = 0;
+        std::size_t length = 0;
+
+        if (lead < 0x80)                { codepoint = lead; length = 1; }
+        else if ((lead & 0xE0) == 0xC0) { codepoint = lead & 0x1F; length = 2; }
+        else if ((lead & 0xF0) == 0xE0) { codepoint = lead & 0x0F; length = 3; }
+        else if ((lead & 0xF8) == 0xF0) { codepoint = lead & 0x07; length = 4; }
+        else
+        {
+            codepoints.push_back(REPLACEMENT_CODEPOINT);
+            pos += 1;
+            continue;
+        }
+
+        bool valid = pos + length <= text.size();
+
+        for (std::size_t x = 1; valid && x < length; ++x)
+        {
+            const auto continuation = static_cast<uint8_t>(text[pos + x]);
+            valid = (continuation & 0xC0) == 0x80;
+            codepoint = (codepoint << 6) | (continuation & 0x3F);
+        }
+
+        codepoints.push_back(valid ? codepoint : REPLACEMENT_CODEPOINT);
+        pos += valid ? length : 1;
+    }
+
+    return codepoints;
+}
+
+TextLayout::TextLayout(uint32_t wrapLength, int32_t lineSkip)
+    : m_wrapLength(wrapLength)
+    , m_lineSkip(lineSkip)
+{
+
+}
+
+void TextLayout::NewLine()
+{
+    m_penX = 0;
+    m_lineTop += m_lineSkip;
+    m_previousCodepoint = std::nullopt;
+    m_breakGlyphIndex = std::nullopt;
+}
+
+void TextLayout::AddGlyph(uint32_t codepoint, int32_t advance, int32_t kerning, bool hasImage)
+{
+    if (m_previousCodepoint)
+    {
+        m_penX += kerning;
+    }
+
+    //
+    // Wrap, at the last space on the line if there is one, otherwise at this glyph
+    //
+    if ((m_wrapLength != 0) && (m_penX > 0) && (m_penX + advance > (int32_t)m_wrapLength))
+    {
+        if (m_breakGlyphIndex)
+        {
+            m_lineTop += m_lineSkip;
+
+            for (std::size_t x = *m_breakGlyphIndex; x < m_glyphOffsets.size(); ++x)
+            {
+                m_glyphOffsets[x].x -= (float)m_breakPenX;
+                m_glyphOffsets[x].y = (float)m_lineTop;
+            }
+
+            m_penX -= m_breakPenX;
+            m_breakGlyphIndex = std::nullopt;
+        }
+        else
+        {
+            NewLine();
+        }
+    }
+
+    if (hasImage)
+    {
+        m_glyphOffsets.emplace_back((float)m_penX, (float)m_lineTop);
+    }
+
+    m_penX += advance;
+    m_previousCodepoint = codepoint;
+
+    if (codepoint == ' ')
+    {
+        m_breakGlyphIndex = m_glyphOffsets.size();
+        m_breakPenX = m_penX;
+    }
+}
+
+}
@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_FONT_TEXTLAYOUT_H
+#define WIREDENGINE_WIREDENGINE_SRC_FONT_TEXTLAYOUT_H
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace Wired::Engine
+{
+    /**
+     * Decodes UTF-8 text into codepoints. Malformed sequences decode as U+FFFD.
+     */
+    [[nodiscard]] std::vector<uint32_t> DecodeUTF8(const std::string& text);
+
+    /**
+     * Positions glyphs along lines of text. Lines are broken at newlines, and lines which would grow wider
+     * than the wrap length are wrapped at their last space, or mid-word if they have none.
+     */
+    class TextLayout
+    {
+        public:
+
+            /**
+             * @param wrapLength Pixel width at which lines are wrapped, or 0 to not wrap lines
+             * @param lineSkip Pixel distance from the top of one line to the top of the next
+             */
+            TextLayout(uint32_t wrapLength, int32_t lineSkip);
+
+            /**
+             * @return The codepoint of the previous glyph on the current line, which the next glyph is kerned
+             * against, or std::nullopt at the start of a line
+             */
+            [[nodiscard]] std::optional<uint32_t> GetPreviousCodepoint() const noexcept { return m_previousCodepoint; }
+
+            void NewLine();
+
+            /**
+             * Places the next glyph on the current line, after wrapping the line if the glyph doesn't fit on it.
+             *
+             * @param kerning Kerning between the previous glyph on the line and this one
+             * @param hasImage Whether the glyph is drawn; only drawn glyphs are given an offset
+             */
+            void AddGlyph(uint32_t codepoint, int32_t advance, int32_t kerning, bool hasImage);
+
+            /**
+             * @return Pixel offset of the top-left of each drawn glyph from the top-left of the text, in the
+             * order the glyphs were added. Wrapping moves glyphs which were already placed, so offsets are only
+             * final once all the glyphs have been added.
+             */
+            [[nodiscard]] const std::vector<glm::vec2>& GetGlyphOffsets() const noexcept { return m_glyphOffsets; }
+
+            /**
+             * @return Pixel offset of the top of the current line from the top of the text
+             */
+            [[nodiscard]] int32_t GetLineTop() const noexcept { return m_lineTop; }
+
+        private:
+
+            uint32_t m_wrapLength;
+            int32_t m_lineSkip;
+
+            std::vector<glm::vec2> m_glyphOffsets;
+
+            int32_t m_penX{0};
+            int32_t m_lineTop{0};
+            std::optional<uint32_t> m_previousCodepoint;
+
+            // The first glyph after the most recent space on the current line, and the pen position after that
+            // space; where the line is broken if it needs to be wrapped
+            std::optional<std::size_t> m_breakGlyphIndex;
+            int32_t m_breakPenX{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_FONT_TEXTLAYOUT_H
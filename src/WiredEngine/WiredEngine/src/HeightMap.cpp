@@ -6,12 +6,15 @@
  
 #include "HeightMap.h"
 
-#include <Wired/Render/AABB.h>
 #include <Wired/Render/Mesh/StaticMeshData.h>
 #include <Wired/Render/VectorUtil.h>
 
 #include <NEON/Common/MapValue.h>
 
+#include <algorithm>
+#include <array>
+#include <limits>
+
 namespace Wired::Engine
 {
 
@@ -63,7 +66,8 @@ std::unique_ptr<Render::MeshData> GenerateHeightMapMeshData(const HeightMap* pHe
     std::vector<uint32_t> indices;
     indices.reserve(pHeightMap->dataSize.w * pHeightMap->dataSize.h);
 
-    Render::AABB verticesAABB{};
+    glm::vec3 verticesMin{std::numeric_limits<float>::max()};
+    glm::vec3 verticesMax{-std::numeric_limits<float>::max()};
 
     // World distance between adjacent vertices in x and z directions
     const float vertexXDelta = meshSize_worldSpace.w / (float)(pHeightMap->dataSize.w - 1);
@@ -111,7 +115,8 @@ std::unique_ptr<Render::MeshData> GenerateHeightMapMeshData(const HeightMap* pHe
             const auto normal = glm::vec3(0,0,0);
 
             vertices.emplace_back(position, normal, uv, tangent);
-            verticesAABB.AddPoints({position});
+            verticesMin = glm::min(verticesMin, position);
+            verticesMax = glm::max(verticesMax, position);
 
             xPos += vertexXDelta;
         }
@@ -136,7 +141,7 @@ std::unique_ptr<Render::MeshData> GenerateHeightMapMeshData(const HeightMap* pHe
             const auto dataIndex = x + (y * pHeightMap->dataSize.w);
 
             // Data positions for the two triangles within this grid square
-            const auto triDataPositions = std::vector<std::size_t>{
+            const auto triDataPositions = std::array<std::size_t, 6>{
                 // Square tri 1
                 dataIndex,
                 dataIndex + pHeightMap->dataSize.w,
@@ -205,9 +210,221 @@ std::unique_ptr<Render::MeshData> GenerateHeightMapMeshData(const HeightMap* pHe
     }
 
     auto staticMeshData = std::make_unique<Render::StaticMeshData>(vertices, indices);
-    staticMeshData->cullVolume = verticesAABB.GetVolume();
+    staticMeshData->cullVolume = Render::Volume(verticesMin, verticesMax);
 
     return staticMeshData;
 }
 
+std::vector<HeightMapChunk> GetHeightMapChunks(const HeightMap* pHeightMap, uint32_t chunkQuads)
+{
+    std::vector<HeightMapChunk> chunks;
+
+    const auto quadsX = (uint32_t)pHeightMap->dataSize.w - 1;
+    const auto quadsY = (uint32_t)pHeightMap->dataSize.h - 1;
+
+    for (uint32_t y = 0; y < quadsY; y += chunkQuads)
+    {
+        for (uint32_t x = 0; x < quadsX; x += chunkQuads)
+        {
+            chunks.push_back(HeightMapChunk{
+                .dataX = x,
+                .dataY = y,
+                .quadsX = std::min(chunkQuads, quadsX - x),
+                .quadsY = std::min(chunkQuads, quadsY - y)
+            });
+        }
+    }
+
+    return chunks;
+}
+
+static inline float GetDataValue(const HeightMap* pHeightMap, uint32_t x, uint32_t y)
+{
+    return pHeightMap->data[x + (y * pHeightMap->dataSize.w)];
+}
+
+/**
+ * Central difference normal at a data point, computed from the full resolution data regardless of which
+ * points a mesh samples, so that every mesh sharing the data point agrees on its normal.
+ */
+static glm::vec3 GetDataNormal(const HeightMap* pHeightMap, uint32_t x, uint32_t y, float vertexXDelta, float vertexZDelta)
+{
+    const uint32_t x0 = x > 0 ? x - 1 : x;
+    const uint32_t x1 = x < pHeightMap->dataSize.w - 1 ? x + 1 : x;
+    const uint32_t y0 = y > 0 ? y - 1 : y;
+    const uint32_t y1 = y < pHeightMap->dataSize.h - 1 ? y + 1 : y;
+
+    const float dHdX = (GetDataValue(pHeightMap, x1, y) - GetDataValue(pHeightMap, x0, y)) / ((float)(x1 - x0) * vertexXDelta);
+    const float dHdZ = (GetDataValue(pHeightMap, x, y1) - GetDataValue(pHeightMap, x, y0)) / ((float)(y1 - y0) * vertexZDelta);
+
+    return glm::normalize(glm::vec3(-dHdX, 1.0f, -dHdZ));
+}
+
+std::unique_ptr<Render::StaticMeshData> GenerateHeightMapChunkMeshData(const HeightMap* pHeightMap,
+                                                                       const HeightMapChunk& chunk,
+                                                                       uint32_t lodStride,
+                                                                       const NCommon::Size2DReal& meshSize_worldSpace,
+                                                                       const std::optional<float>& uvSpanWorldSize)
+{
+    // World distance between adjacent data points in x and z directions
+    const float vertexXDelta = meshSize_worldSpace.w / (float)(pHeightMap->dataSize.w - 1);
+    const float vertexZDelta = meshSize_worldSpace.h / (float)(pHeightMap->dataSize.h - 1);
+
+    // The number of sampled columns/rows; every lodStride'th data point, plus always the chunk's far edge
+    const uint32_t numCols = ((chunk.quadsX + lodStride - 1) / lodStride) + 1;
+    const uint32_t numRows = ((chunk.quadsY + lodStride - 1) / lodStride) + 1;
+
+    const auto sampleOffset = [&](uint32_t sample, uint32_t quads){
+        return std::min(sample * lodStride, quads);
+    };
+
+    //
+    // Allocate the chunk's vertices and indices up front; surface plus a skirt along each of the four edges
+    //
+    const uint32_t numSurfaceVertices = numCols * numRows;
+    const uint32_t numSkirtVertices = 2 * (numCols + numRows);
+    const uint32_t numSurfaceIndices = (numCols - 1) * (numRows - 1) * 6;
+    const uint32_t numSkirtIndices = 2 * ((numCols - 1) + (numRows - 1)) * 6;
+
+    auto meshData = std::make_unique<Render::StaticMeshData>();
+    auto& vertices = meshData->vertices;
+    auto& indices = meshData->indices;
+
+    vertices.reserve(numSurfaceVertices + numSkirtVertices);
+    indices.reserve(numSurfaceIndices + numSkirtIndices);
+
+    glm::vec3 verticesMin{std::numeric_limits<float>::max()};
+    glm::vec3 verticesMax{-std::numeric_limits<float>::max()};
+
+    //
+    // Surface vertices
+    //
+    for (uint32_t row = 0; row < numRows; ++row)
+    {
+        const uint32_t dataY = chunk.dataY + sampleOffset(row, chunk.quadsY);
+        const float zPos = (-1.0f * meshSize_worldSpace.h / 2.0f) + ((float)dataY * vertexZDelta);
+
+        for (uint32_t col = 0; col < numCols; ++col)
+        {
+            const uint32_t dataX = chunk.dataX + sampleOffset(col, chunk.quadsX);
+            const float xPos = (-1.0f * meshSize_worldSpace.w / 2.0f) + ((float)dataX * vertexXDelta);
+
+            const auto position = glm::vec3(xPos, GetDataValue(pHeightMap, dataX, dataY), zPos);
+
+            glm::vec2 uv{0.0f};
+
+            if (uvSpanWorldSize)
+            {
+                uv.x = (xPos + (meshSize_worldSpace.w / 2.0f)) / *uvSpanWorldSize;
+                uv.y = (zPos + (meshSize_worldSpace.h / 2.0f)) / *uvSpanWorldSize;
+            }
+            else
+            {
+                uv.x = (float)dataX / ((float)pHeightMap->dataSize.w - 1);
+                uv.y = (float)dataY / ((float)pHeightMap->dataSize.h - 1);
+            }
+
+            const auto normal = GetDataNormal(pHeightMap, dataX, dataY, vertexXDelta, vertexZDelta);
+
+            vertices.emplace_back(position, normal, uv, glm::vec3(0,1,0));
+
+            verticesMin = glm::min(verticesMin, position);
+            verticesMax = glm::max(verticesMax, position);
+        }
+    }
+
+    //
+    // Surface indices, same triangulation as GenerateHeightMapMeshData
+    //
+    for (uint32_t row = 0; row < numRows - 1; ++row)
+    {
+        for (uint32_t col = 0; col < numCols - 1; ++col)
+        {
+            const uint32_t i = col + (row * numCols);
+
+            indices.push_back(i);
+            indices.push_back(i + numCols);
+            indices.push_back(i + 1);
+
+            indices.push_back(i + 1);
+            indices.push_back(i + numCols);
+            indices.push_back(i + numCols + 1);
+        }
+    }
+
+    //
+    // Skirts. A coarser LOD's edge can deviate from a finer neighbour's edge by at most the chunk's height range,
+    // so a skirt that deep always covers the gap.
+    //
+    const float skirtDepth = std::max(verticesMax.y - verticesMin.y, std::min(vertexXDelta, vertexZDelta));
+
+    const auto addSkirt = [&](uint32_t numEdgeVertices, const auto& edgeVertexIndex, const glm::vec3& outwardDir){
+        const auto skirtStart = (uint32_t)vertices.size();
+
+        for (uint32_t e = 0; e < numEdgeVertices; ++e)
+        {
+            auto skirtVertex = vertices[edgeVertexIndex(e)];
+            skirtVertex.position.y -= skirtDepth;
+            vertices.push_back(skirtVertex);
+        }
+
+        for (uint32_t e = 0; e < numEdgeVertices - 1; ++e)
+        {
+            const uint32_t a = edgeVertexIndex(e);
+            const uint32_t b = edgeVertexIndex(e + 1);
+            const uint32_t sa = skirtStart + e;
+            const uint32_t sb = skirtStart + e + 1;
+
+            // Wind the skirt so that it faces away from the chunk
+            const auto faceDir = glm::cross(vertices[sa].position - vertices[a].position, vertices[b].position - vertices[a].position);
+
+            if (glm::dot(faceDir, outwardDir) >= 0.0f)
+            {
+                indices.insert(indices.end(), {a, sa, b, b, sa, sb});
+            }
+            else
+            {
+                indices.insert(indices.end(), {a, b, sa, b, sb, sa});
+            }
+        }
+    };
+
+    addSkirt(numCols, [&](uint32_t e){ return e; }, {0, 0, -1});
+    addSkirt(numCols, [&](uint32_t e){ return e + ((numRows - 1) * numCols); }, {0, 0, 1});
+    addSkirt(numRows, [&](uint32_t e){ return e * numCols; }, {-1, 0, 0});
+    addSkirt(numRows, [&](uint32_t e){ return (e * numCols) + (numCols - 1); }, {1, 0, 0});
+
+    verticesMin.y -= skirtDepth;
+    meshData->cullVolume = Render::Volume(verticesMin, verticesMax);
+
+    return meshData;
+}
+
+std::unique_ptr<Render::Mesh> GenerateHeightMapChunkMesh(const HeightMap* pHeightMap,
+                                                         const HeightMapChunk& chunk,
+                                                         const NCommon::Size2DReal& meshSize_worldSpace,
+                                                         const std::optional<float>& uvSpanWorldSize)
+{
+    const float chunkExtent = std::max(
+        (float)chunk.quadsX * (meshSize_worldSpace.w / (float)(pHeightMap->dataSize.w - 1)),
+        (float)chunk.quadsY * (meshSize_worldSpace.h / (float)(pHeightMap->dataSize.h - 1))
+    );
+
+    auto mesh = std::make_unique<Render::Mesh>();
+    mesh->type = Render::MeshType::Static;
+
+    for (uint32_t lod = 0; lod < Render::MESH_MAX_LOD; ++lod)
+    {
+        const uint32_t lodStride = 1U << lod;
+
+        mesh->lodData.at(lod) = Render::MeshLOD{
+            .isValid = true,
+            .renderDistance = lod == 0 ? 0.0f : chunkExtent * (float)(1U << lod),
+            .pMeshData = GenerateHeightMapChunkMeshData(pHeightMap, chunk, lodStride, meshSize_worldSpace, uvSpanWorldSize)
+        };
+    }
+
+    return mesh;
+}
+
 }
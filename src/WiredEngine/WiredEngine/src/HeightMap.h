@@ -7,7 +7,9 @@
 #ifndef WIREDENGINE_WIREDENGINE_SRC_HEIGHTMAP_H
 #define WIREDENGINE_WIREDENGINE_SRC_HEIGHTMAP_H
 
+#include <Wired/Render/Mesh/Mesh.h>
 #include <Wired/Render/Mesh/MeshData.h>
+#include <Wired/Render/Mesh/StaticMeshData.h>
 
 #include <NEON/Common/Build.h>
 #include <NEON/Common/ImageData.h>
@@ -15,6 +17,8 @@
 
 #include <vector>
 #include <memory>
+#include <optional>
+#include <cstdint>
 
 namespace Wired::Engine
 {
@@ -26,6 +30,19 @@ namespace Wired::Engine
         float maxValue{0.0f};
     };
 
+    /**
+     * A rectangular region of a height map's data points which is meshed independently of the rest of the
+     * height map. Covers data points [dataX, dataX + quadsX] x [dataY, dataY + quadsY], so adjacent chunks
+     * share their edge data points.
+     */
+    struct HeightMapChunk
+    {
+        uint32_t dataX{0};
+        uint32_t dataY{0};
+        uint32_t quadsX{0};
+        uint32_t quadsY{0};
+    };
+
     [[nodiscard]] std::unique_ptr<HeightMap> GenerateHeightMapFromImage(
         const NCommon::ImageData* pImage,
         const NCommon::Size2DUInt& dataSize,
@@ -37,6 +54,44 @@ namespace Wired::Engine
         const NCommon::Size2DReal& meshSize_worldSpace,
         const std::optional<float>& uvSpanWorldSize
     );
+
+    /**
+     * Splits a height map's data into chunks of (at most) chunkQuads x chunkQuads quads.
+     */
+    [[nodiscard]] std::vector<HeightMapChunk> GetHeightMapChunks(const HeightMap* pHeightMap, uint32_t chunkQuads);
+
+    /**
+     * Generates the mesh data for one chunk of a height map, sampling every lodStride'th data point. Vertices are
+     * in the same model space as GenerateHeightMapMeshData's mesh, so every chunk is rendered with the height map's
+     * transform.
+     *
+     * Normals are taken from the full resolution height map so that they match across chunk and LOD boundaries.
+     * A skirt is hung below the chunk's edges to hide the cracks that open up where neighbouring chunks are drawn
+     * at different LODs.
+     */
+    [[nodiscard]] std::unique_ptr<Render::StaticMeshData> GenerateHeightMapChunkMeshData(
+        const HeightMap* pHeightMap,
+        const HeightMapChunk& chunk,
+        uint32_t lodStride,
+        const NCommon::Size2DReal& meshSize_worldSpace,
+        const std::optional<float>& uvSpanWorldSize
+    );
+
+    /**
+     * Generates a renderer mesh for one chunk of a height map, with a LOD for each of the renderer's mesh LOD
+     * levels. Each successive LOD halves the chunk's sample density and is used from twice the distance of
+     * the previous one.
+     *
+     * LOD distances are world space distances derived from meshSize_worldSpace, as the renderer compares them
+     * against world space camera distances. They're only correct for a terrain rendered without scale; a larger
+     * terrain should be created with a larger meshSize_worldSpace rather than scaled.
+     */
+    [[nodiscard]] std::unique_ptr<Render::Mesh> GenerateHeightMapChunkMesh(
+        const HeightMap* pHeightMap,
+        const HeightMapChunk& chunk,
+        const NCommon::Size2DReal& meshSize_worldSpace,
+        const std::optional<float>& uvSpanWorldSize
+    );
 }
 
 #endif //WIREDENGINE_WIREDENGINE_SRC_HEIGHTMAP_H
@@ -6,8 +6,6 @@
  
 #include "HeightMapUtil.h"
 
-#include <Wired/Render/Mesh/StaticMeshData.h>
-
 #include <NEON/Common/MapValue.h>
 
 namespace Wired::Engine
@@ -15,8 +13,7 @@ namespace Wired::Engine
 
 static inline float GetHeightMapValue(const LoadedHeightMap* pLoadedHeightMap, unsigned int colIndex, unsigned int rowIndex)
 {
-    return dynamic_cast<Render::StaticMeshData*>(pLoadedHeightMap->meshData.get())
-        ->vertices[colIndex + (rowIndex * pLoadedHeightMap->heightMap->dataSize.w)].position.y;
+    return pLoadedHeightMap->heightMap->data[colIndex + (rowIndex * pLoadedHeightMap->heightMap->dataSize.w)];
 }
 
 static glm::vec2 ModelPointToDataPoint(const LoadedHeightMap* pLoadedHeightMap, const glm::vec2& modelSpacePoint)
@@ -18,6 +18,8 @@
 
 namespace Wired::Engine
 {
+    class LazyModelCollision;
+
     struct LoadedModel
     {
         // The parsed model definition
@@ -35,6 +37,10 @@ namespace Wired::Engine
         //
         // texture file name -> loaded texture id
         std::unordered_map<std::string, Render::TextureId> loadedTextures{};
+
+        // Physics collision shapes cooked from the model's geometry, on first use as physics bounds.
+        // Shared so physics shape caches can tell when the model is gone.
+        std::shared_ptr<LazyModelCollision> collision;
     };
 }
 
@@ -51,6 +51,13 @@ class PackageIOSystem : public Assimp::IOSystem
         {
             const auto fileStr = std::string(pFile);
 
+            // Sources which hold their contents in memory can be streamed from directly, without a copy
+            const auto modelDataSpan = m_packageSource->GetModelSubAssetSpanBlocking(m_modelAssetName, pFile);
+            if (modelDataSpan)
+            {
+                return new Assimp::MemoryIOStream((const uint8_t*) modelDataSpan->data(), modelDataSpan->size(), false);
+            }
+
             if (!m_fileContents.contains(fileStr))
             {
                 const auto modelData = m_packageSource->GetModelSubAssetBytesBlocking(m_modelAssetName, pFile);
@@ -0,0 +1,279 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Wired/Engine/Package/ArchivePackageSource.h>
+#include <Wired/Engine/Package/Serialization.h>
+#include <Wired/Engine/Package/CompiledScene.h>
+
+#include <NEON/Common/Log/ILogger.h>
+
+#include <algorithm>
+#include <cstring>
+#include <tuple>
+
+namespace Wired::Engine
+{
+
+ArchivePackageSource::ArchivePackageSource(std::filesystem::path archiveFilePath)
+    : m_archiveFilePath(std::move(archiveFilePath))
+{
+
+}
+
+std::expected<void, bool> ArchivePackageSource::OpenBlocking(NCommon::ILogger* pLogger)
+{
+    //
+    // Map the archive
+    //
+    auto mappedFile = NCommon::MappedFile::Open(m_archiveFilePath);
+    if (!mappedFile)
+    {
+        pLogger->Error("ArchivePackageSource::OpenBlocking: Failed to map archive file: {}", m_archiveFilePath.string());
+        return std::unexpected(false);
+    }
+
+    const auto archiveBytes = (*mappedFile)->GetBytes();
+
+    //
+    // Validate the header
+    //
+    if (archiveBytes.size() < sizeof(ArchiveHeader))
+    {
+        pLogger->Error("ArchivePackageSource::OpenBlocking: Archive file is too small: {}", m_archiveFilePath.string());
+        return std::unexpected(false);
+    }
+
+    ArchiveHeader header{};
+    std::memcpy(&header, archiveBytes.data(), sizeof(ArchiveHeader));
+
+    if (header.magic != PACKAGE_ARCHIVE_MAGIC || header.version != PACKAGE_ARCHIVE_VERSION)
+    {
+        pLogger->Error("ArchivePackageSource::OpenBlocking: Not a supported package archive: {}", m_archiveFilePath.string());
+        return std::unexpected(false);
+    }
+
+    const auto archiveByteSize = static_cast<uint64_t>(archiveBytes.size());
+
+    const bool indexValid =
+        (header.indexOffset % alignof(ArchiveIndexEntry) == 0) &&
+        (header.entryCount <= archiveByteSize / sizeof(ArchiveIndexEntry)) &&
+        (header.indexOffset <= archiveByteSize - (header.entryCount * sizeof(ArchiveIndexEntry)));
+
+    const bool stringsValid =
+        (header.stringsOffset <= archiveByteSize) &&
+        (header.stringsByteSize <= archiveByteSize - header.stringsOffset);
+
+    if (!indexValid || !stringsValid)
+    {
+        pLogger->Error("ArchivePackageSource::OpenBlocking: Archive index is out of bounds: {}", m_archiveFilePath.string());
+        return std::unexpected(false);
+    }
+
+    m_mappedFile = std::move(*mappedFile);
+    m_index = std::span<const ArchiveIndexEntry>(
+        reinterpret_cast<const ArchiveIndexEntry*>(archiveBytes.data() + header.indexOffset),
+        header.entryCount
+    );
+    m_strings = std::span<const char>(
+        reinterpret_cast<const char*>(archiveBytes.data() + header.stringsOffset),
+        header.stringsByteSize
+    );
+
+    //
+    // Validate entries and gather package metadata from them
+    //
+    Package package{};
+    bool foundManifest = false;
+
+    for (const auto& entry : m_index)
+    {
+        const bool entryValid =
+            (entry.nameOffset <= m_strings.size()) &&
+            (entry.nameByteSize <= m_strings.size() - entry.nameOffset) &&
+            (entry.dataOffset <= archiveByteSize) &&
+            (entry.dataByteSize <= archiveByteSize - entry.dataOffset);
+
+        if (!entryValid)
+        {
+            pLogger->Error("ArchivePackageSource::OpenBlocking: Archive entry is out of bounds: {}", m_archiveFilePath.string());
+            return std::unexpected(false);
+        }
+
+        if (entry.compression != static_cast<uint32_t>(ArchiveCompression::None))
+        {
+            pLogger->Error("ArchivePackageSource::OpenBlocking: Unsupported archive entry compression: {}", entry.compression);
+            return std::unexpected(false);
+        }
+
+        const auto entryName = std::string(GetEntryName(entry));
+
+        switch (static_cast<ArchiveEntryType>(entry.entryType))
+        {
+            case ArchiveEntryType::Manifest:
+            {
+                const auto entrySpan = *GetEntrySpan(entry);
+
+                const auto manifest = ObjectFromBytes<PackageManifest>(std::vector<std::byte>(entrySpan.begin(), entrySpan.end()));
+                if (!manifest)
+                {
+                    pLogger->Error("ArchivePackageSource::OpenBlocking: Failed to deserialize package manifest");
+                    return std::unexpected(false);
+                }
+
+                package.manifest = *manifest;
+                foundManifest = true;
+            }
+            break;
+
+            case ArchiveEntryType::Scene:
+            {
+                const auto entrySpan = *GetEntrySpan(entry);
+
+                auto compiledScene = CompiledSceneFromBytes(entrySpan);
+                if (!compiledScene)
+                {
+                    pLogger->Error("ArchivePackageSource::OpenBlocking: Failed to decode scene contents: {}", entryName);
+                    return std::unexpected(false);
+                }
+
+                package.compiledScenes.push_back(std::make_shared<const CompiledScene>(std::move(*compiledScene)));
+            }
+            break;
+
+            case ArchiveEntryType::Asset:
+            {
+                switch (static_cast<AssetType>(entry.assetType))
+                {
+                    case AssetType::Image: package.assetNames.imageAssetNames.push_back(entryName); break;
+                    case AssetType::Shader: package.assetNames.shaderAssetNames.push_back(entryName); break;
+                    case AssetType::Model: package.assetNames.modelAssetNames.push_back(entryName); break;
+                    case AssetType::Audio: package.assetNames.audioAssetNames.push_back(entryName); break;
+                    case AssetType::Font: package.assetNames.fontAssetNames.push_back(entryName); break;
+                    default:
+                    {
+                        pLogger->Warning("ArchivePackageSource::OpenBlocking: Ignoring asset of unknown type: {}", entryName);
+                    }
+                    break;
+                }
+            }
+            break;
+
+            case ArchiveEntryType::ModelSubAsset:
+                // Only looked up on demand
+            break;
+
+            default:
+            {
+                pLogger->Warning("ArchivePackageSource::OpenBlocking: Ignoring entry of unknown type: {}", entryName);
+            }
+            break;
+        }
+    }
+
+    if (!foundManifest)
+    {
+        pLogger->Error("ArchivePackageSource::OpenBlocking: Archive has no package manifest: {}", m_archiveFilePath.string());
+        return std::unexpected(false);
+    }
+
+    m_package = package;
+
+    return {};
+}
+
+PackageName ArchivePackageSource::GetPackageName() const
+{
+    return PackageName(m_package.manifest.packageName);
+}
+
+Package ArchivePackageSource::GetMetadata() const
+{
+    return m_package;
+}
+
+std::expected<std::vector<std::byte>, bool> ArchivePackageSource::GetAssetBytesBlocking(AssetType assetType, std::string_view assetName) const
+{
+    const auto assetSpan = GetAssetSpanBlocking(assetType, assetName);
+    if (!assetSpan)
+    {
+        return std::unexpected(false);
+    }
+
+    return std::vector<std::byte>(assetSpan->begin(), assetSpan->end());
+}
+
+std::expected<std::vector<std::byte>, bool> ArchivePackageSource::GetModelSubAssetBytesBlocking(std::string_view modelAssetName, std::string_view assetName) const
+{
+    const auto assetSpan = GetModelSubAssetSpanBlocking(modelAssetName, assetName);
+    if (!assetSpan)
+    {
+        return std::unexpected(false);
+    }
+
+    return std::vector<std::byte>(assetSpan->begin(), assetSpan->end());
+}
+
+std::expected<std::span<const std::byte>, bool> ArchivePackageSource::GetAssetSpanBlocking(AssetType assetType, std::string_view assetName) const
+{
+    const auto entry = FindEntry(ArchiveEntryType::Asset, static_cast<uint32_t>(assetType), assetName);
+    if (!entry)
+    {
+        return std::unexpected(false);
+    }
+
+    return GetEntrySpan(*entry);
+}
+
+std::expected<std::span<const std::byte>, bool> ArchivePackageSource::GetModelSubAssetSpanBlocking(std::string_view modelAssetName, std::string_view assetName) const
+{
+    const auto entry = FindEntry(ArchiveEntryType::ModelSubAsset, 0, ArchiveModelSubAssetName(modelAssetName, assetName));
+    if (!entry)
+    {
+        return std::unexpected(false);
+    }
+
+    return GetEntrySpan(*entry);
+}
+
+std::optional<ArchiveIndexEntry> ArchivePackageSource::FindEntry(ArchiveEntryType entryType, uint32_t assetType, std::string_view name) const
+{
+    const auto key = std::make_tuple(static_cast<uint32_t>(entryType), assetType, ArchiveNameHash(name));
+
+    const auto toKey = [](const ArchiveIndexEntry& entry){
+        return std::make_tuple(entry.entryType, entry.assetType, entry.nameHash);
+    };
+
+    // Index is sorted by key; scan the (almost always single) entries sharing the key for the name
+    auto it = std::ranges::lower_bound(m_index, key, {}, toKey);
+
+    for (; it != m_index.end() && toKey(*it) == key; ++it)
+    {
+        if (GetEntryName(*it) == name)
+        {
+            return *it;
+        }
+    }
+
+    return std::nullopt;
+}
+
+std::expected<std::span<const std::byte>, bool> ArchivePackageSource::GetEntrySpan(const ArchiveIndexEntry& entry) const
+{
+    if (!m_mappedFile)
+    {
+        return std::unexpected(false);
+    }
+
+    // Bounds were validated when the archive was opened
+    return m_mappedFile->GetBytes().subspan(entry.dataOffset, entry.dataByteSize);
+}
+
+std::string_view ArchivePackageSource::GetEntryName(const ArchiveIndexEntry& entry) const
+{
+    return {m_strings.data() + entry.nameOffset, entry.nameByteSize};
+}
+
+}
@@ -0,0 +1,482 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Wired/Engine/Package/CompiledScene.h>
+#include <Wired/Engine/Package/EntitySceneNode.h>
+#include <Wired/Engine/Package/PlayerSceneNode.h>
+#include <Wired/Engine/Package/SceneNodeTransformComponent.h>
+#include <Wired/Engine/Package/SceneNodeRenderableSpriteComponent.h>
+#include <Wired/Engine/Package/SceneNodeRenderableModelComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsBoxComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsSphereComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsHeightMapComponent.h>
+
+#include <unordered_map>
+#include <cstring>
+#include <type_traits>
+#include <algorithm>
+
+namespace Wired::Engine
+{
+
+static constexpr uint32_t COMPILED_SCENE_MAGIC = 0x4353574E; // "NWSC"
+static constexpr uint32_t COMPILED_SCENE_VERSION = 0;
+
+static_assert(sizeof(glm::vec2) == 2 * sizeof(float));
+static_assert(sizeof(glm::vec3) == 3 * sizeof(float));
+
+CompiledScene CompileScene(const Scene& scene)
+{
+    CompiledScene compiled{};
+    compiled.name = scene.name;
+
+    std::unordered_map<std::string, uint32_t> stringIndices;
+
+    const auto internString = [&](const std::string& str){
+        const auto it = stringIndices.find(str);
+        if (it != stringIndices.cend())
+        {
+            return it->second;
+        }
+
+        const auto index = static_cast<uint32_t>(compiled.strings.size());
+        compiled.strings.push_back(str);
+        stringIndices.insert({str, index});
+        return index;
+    };
+
+    const auto internOptionalString = [&](const std::optional<std::string>& str){
+        return str ? internString(*str) : CompiledScene::NO_STRING;
+    };
+
+    for (const auto& node : scene.nodes)
+    {
+        switch (node->GetType())
+        {
+            case SceneNode::Type::Entity:
+            {
+                const auto pEntityNode = dynamic_cast<const EntitySceneNode*>(node.get());
+                const auto entityIndex = static_cast<uint32_t>(compiled.entityNames.size());
+
+                compiled.entityNames.push_back(internString(pEntityNode->name));
+
+                for (const auto& component : pEntityNode->components)
+                {
+                    switch (component->GetType())
+                    {
+                        case SceneNodeComponent::Type::Transform:
+                        {
+                            const auto pComponent = dynamic_cast<const SceneNodeTransformComponent*>(component.get());
+                            compiled.transforms.entities.push_back(entityIndex);
+                            compiled.transforms.positions.push_back(pComponent->position);
+                            compiled.transforms.scales.push_back(pComponent->scale);
+                            compiled.transforms.eulerRotations.push_back(pComponent->eulerRotations);
+                        }
+                        break;
+                        case SceneNodeComponent::Type::RenderableSprite:
+                        {
+                            const auto pComponent = dynamic_cast<const SceneNodeRenderableSpriteComponent*>(component.get());
+                            compiled.sprites.entities.push_back(entityIndex);
+                            compiled.sprites.imageAssetNames.push_back(internOptionalString(pComponent->imageAssetName));
+                            compiled.sprites.destVirtualSizes.push_back(pComponent->destVirtualSize);
+                        }
+                        break;
+                        case SceneNodeComponent::Type::RenderableModel:
+                        {
+                            const auto pComponent = dynamic_cast<const SceneNodeRenderableModelComponent*>(component.get());
+                            compiled.models.entities.push_back(entityIndex);
+                            compiled.models.modelAssetNames.push_back(internOptionalString(pComponent->modelAssetName));
+                        }
+                        break;
+                        case SceneNodeComponent::Type::PhysicsBox:
+                        {
+                            const auto pComponent = dynamic_cast<const SceneNodePhysicsBoxComponent*>(component.get());
+                            compiled.physicsBoxes.entities.push_back(entityIndex);
+                            compiled.physicsBoxes.physicsScenes.push_back(internString(pComponent->physicsScene));
+                            compiled.physicsBoxes.localScales.push_back(pComponent->localScale);
+                            compiled.physicsBoxes.mins.push_back(pComponent->min);
+                            compiled.physicsBoxes.maxs.push_back(pComponent->max);
+                        }
+                        break;
+                        case SceneNodeComponent::Type::PhysicsSphere:
+                        {
+                            const auto pComponent = dynamic_cast<const SceneNodePhysicsSphereComponent*>(component.get());
+                            compiled.physicsSpheres.entities.push_back(entityIndex);
+                            compiled.physicsSpheres.physicsScenes.push_back(internString(pComponent->physicsScene));
+                            compiled.physicsSpheres.localScales.push_back(pComponent->localScale);
+                            compiled.physicsSpheres.radii.push_back(pComponent->radius);
+                        }
+                        break;
+                        case SceneNodeComponent::Type::PhysicsHeightMap:
+                        {
+                            const auto pComponent = dynamic_cast<const SceneNodePhysicsHeightMapComponent*>(component.get());
+                            compiled.physicsHeightMaps.entities.push_back(entityIndex);
+                            compiled.physicsHeightMaps.physicsScenes.push_back(internString(pComponent->physicsScene));
+                            compiled.physicsHeightMaps.localScales.push_back(pComponent->localScale);
+                        }
+                        break;
+                    }
+                }
+            }
+            break;
+            case SceneNode::Type::Player:
+            {
+                const auto pPlayerNode = dynamic_cast<const PlayerSceneNode*>(node.get());
+                compiled.players.names.push_back(internString(pPlayerNode->name));
+                compiled.players.positions.push_back(pPlayerNode->position);
+                compiled.players.heights.push_back(pPlayerNode->height);
+                compiled.players.radii.push_back(pPlayerNode->radius);
+            }
+            break;
+        }
+    }
+
+    return compiled;
+}
+
+std::shared_ptr<Scene> DecompileScene(const CompiledScene& compiledScene)
+{
+    const auto getOptionalString = [&](uint32_t index) -> std::optional<std::string> {
+        if (index == CompiledScene::NO_STRING) { return std::nullopt; }
+        return compiledScene.strings[index];
+    };
+
+    auto scene = std::make_shared<Scene>();
+    scene->name = compiledScene.name;
+
+    std::vector<std::shared_ptr<EntitySceneNode>> entityNodes;
+    entityNodes.reserve(compiledScene.entityNames.size());
+
+    for (const auto& nameIndex : compiledScene.entityNames)
+    {
+        auto entityNode = std::make_shared<EntitySceneNode>();
+        entityNode->name = compiledScene.strings[nameIndex];
+        entityNodes.push_back(entityNode);
+        scene->nodes.push_back(entityNode);
+    }
+
+    const auto& transforms = compiledScene.transforms;
+    for (std::size_t x = 0; x < transforms.entities.size(); ++x)
+    {
+        auto component = std::make_shared<SceneNodeTransformComponent>();
+        component->position = transforms.positions[x];
+        component->scale = transforms.scales[x];
+        component->eulerRotations = transforms.eulerRotations[x];
+        entityNodes[transforms.entities[x]]->components.push_back(component);
+    }
+
+    const auto& sprites = compiledScene.sprites;
+    for (std::size_t x = 0; x < sprites.entities.size(); ++x)
+    {
+        auto component = std::make_shared<SceneNodeRenderableSpriteComponent>();
+        component->imageAssetName = getOptionalString(sprites.imageAssetNames[x]);
+        component->destVirtualSize = sprites.destVirtualSizes[x];
+        entityNodes[sprites.entities[x]]->components.push_back(component);
+    }
+
+    const auto& models = compiledScene.models;
+    for (std::size_t x = 0; x < models.entities.size(); ++x)
+    {
+        auto component = std::make_shared<SceneNodeRenderableModelComponent>();
+        component->modelAssetName = getOptionalString(models.modelAssetNames[x]);
+        entityNodes[models.entities[x]]->components.push_back(component);
+    }
+
+    const auto& physicsBoxes = compiledScene.physicsBoxes;
+    for (std::size_t x = 0; x < physicsBoxes.entities.size(); ++x)
+    {
+        auto component = std::make_shared<SceneNodePhysicsBoxComponent>();
+        component->physicsScene = compiledScene.strings[physicsBoxes.physicsScenes[x]];
+        component->localScale = physicsBoxes.localScales[x];
+        component->min = physicsBoxes.mins[x];
+        component->max = physicsBoxes.maxs[x];
+        entityNodes[physicsBoxes.entities[x]]->components.push_back(component);
+    }
+
+    const auto& physicsSpheres = compiledScene.physicsSpheres;
+    for (std::size_t x = 0; x < physicsSpheres.entities.size(); ++x)
+    {
+        auto component = std::make_shared<SceneNodePhysicsSphereComponent>();
+        component->physicsScene = compiledScene.strings[physicsSpheres.physicsScenes[x]];
+        component->localScale = physicsSpheres.localScales[x];
+        component->radius = physicsSpheres.radii[x];
+        entityNodes[physicsSpheres.entities[x]]->components.push_back(component);
+    }
+
+    const auto& physicsHeightMaps = compiledScene.physicsHeightMaps;
+    for (std::size_t x = 0; x < physicsHeightMaps.entities.size(); ++x)
+    {
+        auto component = std::make_shared<SceneNodePhysicsHeightMapComponent>();
+        component->physicsScene = compiledScene.strings[physicsHeightMaps.physicsScenes[x]];
+        component->localScale = physicsHeightMaps.localScales[x];
+        entityNodes[physicsHeightMaps.entities[x]]->components.push_back(component);
+    }
+
+    const auto& players = compiledScene.players;
+    for (std::size_t x = 0; x < players.names.size(); ++x)
+    {
+        auto playerNode = std::make_shared<PlayerSceneNode>();
+        playerNode->name = compiledScene.strings[players.names[x]];
+        playerNode->position = players.positions[x];
+        playerNode->height = players.heights[x];
+        playerNode->radius = players.radii[x];
+        scene->nodes.push_back(playerNode);
+    }
+
+    return scene;
+}
+
+//
+// Binary encoding
+//
+
+class SceneBytesWriter
+{
+    public:
+
+        template <typename T>
+        void Write(const T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            const auto pBytes = reinterpret_cast<const std::byte*>(&value);
+            m_bytes.insert(m_bytes.end(), pBytes, pBytes + sizeof(T));
+        }
+
+        void WriteString(const std::string& str)
+        {
+            Write(static_cast<uint32_t>(str.size()));
+            const auto pBytes = reinterpret_cast<const std::byte*>(str.data());
+            m_bytes.insert(m_bytes.end(), pBytes, pBytes + str.size());
+        }
+
+        template <typename T>
+        void WriteArray(const std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            Write(static_cast<uint32_t>(values.size()));
+            const auto pBytes = reinterpret_cast<const std::byte*>(values.data());
+            m_bytes.insert(m_bytes.end(), pBytes, pBytes + (values.size() * sizeof(T)));
+        }
+
+        [[nodiscard]] std::vector<std::byte> Take() { return std::move(m_bytes); }
+
+    private:
+
+        std::vector<std::byte> m_bytes;
+};
+
+class SceneBytesReader
+{
+    public:
+
+        explicit SceneBytesReader(std::span<const std::byte> bytes)
+            : m_bytes(bytes)
+        { }
+
+        template <typename T>
+        [[nodiscard]] bool Read(T& value)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            if (m_bytes.size() - m_offset < sizeof(T)) { return false; }
+            std::memcpy(&value, m_bytes.data() + m_offset, sizeof(T));
+            m_offset += sizeof(T);
+            return true;
+        }
+
+        [[nodiscard]] bool ReadString(std::string& str)
+        {
+            uint32_t size{0};
+            if (!Read(size)) { return false; }
+            if (m_bytes.size() - m_offset < size) { return false; }
+            str.assign(reinterpret_cast<const char*>(m_bytes.data() + m_offset), size);
+            m_offset += size;
+            return true;
+        }
+
+        template <typename T>
+        [[nodiscard]] bool ReadArray(std::vector<T>& values)
+        {
+            static_assert(std::is_trivially_copyable_v<T>);
+            uint32_t count{0};
+            if (!Read(count)) { return false; }
+            if ((m_bytes.size() - m_offset) / sizeof(T) < count) { return false; }
+            values.resize(count);
+            std::memcpy(values.data(), m_bytes.data() + m_offset, count * sizeof(T));
+            m_offset += count * sizeof(T);
+            return true;
+        }
+
+    private:
+
+        std::span<const std::byte> m_bytes;
+        std::size_t m_offset{0};
+};
+
+std::vector<std::byte> CompiledSceneToBytes(const CompiledScene& compiledScene)
+{
+    SceneBytesWriter writer{};
+
+    writer.Write(COMPILED_SCENE_MAGIC);
+    writer.Write(COMPILED_SCENE_VERSION);
+    writer.WriteString(compiledScene.name);
+
+    writer.Write(static_cast<uint32_t>(compiledScene.strings.size()));
+    for (const auto& str : compiledScene.strings)
+    {
+        writer.WriteString(str);
+    }
+
+    writer.WriteArray(compiledScene.entityNames);
+
+    writer.WriteArray(compiledScene.transforms.entities);
+    writer.WriteArray(compiledScene.transforms.positions);
+    writer.WriteArray(compiledScene.transforms.scales);
+    writer.WriteArray(compiledScene.transforms.eulerRotations);
+
+    writer.WriteArray(compiledScene.sprites.entities);
+    writer.WriteArray(compiledScene.sprites.imageAssetNames);
+    writer.WriteArray(compiledScene.sprites.destVirtualSizes);
+
+    writer.WriteArray(compiledScene.models.entities);
+    writer.WriteArray(compiledScene.models.modelAssetNames);
+
+    writer.WriteArray(compiledScene.physicsBoxes.entities);
+    writer.WriteArray(compiledScene.physicsBoxes.physicsScenes);
+    writer.WriteArray(compiledScene.physicsBoxes.localScales);
+    writer.WriteArray(compiledScene.physicsBoxes.mins);
+    writer.WriteArray(compiledScene.physicsBoxes.maxs);
+
+    writer.WriteArray(compiledScene.physicsSpheres.entities);
+    writer.WriteArray(compiledScene.physicsSpheres.physicsScenes);
+    writer.WriteArray(compiledScene.physicsSpheres.localScales);
+    writer.WriteArray(compiledScene.physicsSpheres.radii);
+
+    writer.WriteArray(compiledScene.physicsHeightMaps.entities);
+    writer.WriteArray(compiledScene.physicsHeightMaps.physicsScenes);
+    writer.WriteArray(compiledScene.physicsHeightMaps.localScales);
+
+    writer.WriteArray(compiledScene.players.names);
+    writer.WriteArray(compiledScene.players.positions);
+    writer.WriteArray(compiledScene.players.heights);
+    writer.WriteArray(compiledScene.players.radii);
+
+    return writer.Take();
+}
+
+[[nodiscard]] static bool ValidateCompiledScene(const CompiledScene& scene)
+{
+    const auto entityCount = scene.entityNames.size();
+    const auto stringCount = scene.strings.size();
+
+    const auto allOf = [](const std::vector<uint32_t>& indices, auto predicate){
+        return std::ranges::all_of(indices, predicate);
+    };
+    const auto isString = [&](uint32_t index){ return index < stringCount; };
+    const auto isOptionalString = [&](uint32_t index){ return index == CompiledScene::NO_STRING || index < stringCount; };
+    const auto isEntity = [&](uint32_t index){ return index < entityCount; };
+
+    const auto& t = scene.transforms;
+    const auto& s = scene.sprites;
+    const auto& m = scene.models;
+    const auto& b = scene.physicsBoxes;
+    const auto& sp = scene.physicsSpheres;
+    const auto& h = scene.physicsHeightMaps;
+    const auto& p = scene.players;
+
+    return
+        allOf(scene.entityNames, isString) &&
+
+        t.positions.size() == t.entities.size() && t.scales.size() == t.entities.size() &&
+        t.eulerRotations.size() == t.entities.size() && allOf(t.entities, isEntity) &&
+
+        s.imageAssetNames.size() == s.entities.size() && s.destVirtualSizes.size() == s.entities.size() &&
+        allOf(s.entities, isEntity) && allOf(s.imageAssetNames, isOptionalString) &&
+
+        m.modelAssetNames.size() == m.entities.size() &&
+        allOf(m.entities, isEntity) && allOf(m.modelAssetNames, isOptionalString) &&
+
+        b.physicsScenes.size() == b.entities.size() && b.localScales.size() == b.entities.size() &&
+        b.mins.size() == b.entities.size() && b.maxs.size() == b.entities.size() &&
+        allOf(b.entities, isEntity) && allOf(b.physicsScenes, isString) &&
+
+        sp.physicsScenes.size() == sp.entities.size() && sp.localScales.size() == sp.entities.size() &&
+        sp.radii.size() == sp.entities.size() &&
+        allOf(sp.entities, isEntity) && allOf(sp.physicsScenes, isString) &&
+
+        h.physicsScenes.size() == h.entities.size() && h.localScales.size() == h.entities.size() &&
+        allOf(h.entities, isEntity) && allOf(h.physicsScenes, isString) &&
+
+        p.positions.size() == p.names.size() && p.heights.size() == p.names.size() &&
+        p.radii.size() == p.names.size() && allOf(p.names, isString);
+}
+
+std::expected<CompiledScene, bool> CompiledSceneFromBytes(std::span<const std::byte> bytes)
+{
+    SceneBytesReader reader(bytes);
+
+    uint32_t magic{0};
+    uint32_t version{0};
+
+    if (!reader.Read(magic) || magic != COMPILED_SCENE_MAGIC) { return std::unexpected(false); }
+    if (!reader.Read(version) || version != COMPILED_SCENE_VERSION) { return std::unexpected(false); }
+
+    CompiledScene scene{};
+
+    if (!reader.ReadString(scene.name)) { return std::unexpected(false); }
+
+    uint32_t stringCount{0};
+    if (!reader.Read(stringCount) || stringCount > bytes.size()) { return std::unexpected(false); }
+
+    scene.strings.resize(stringCount);
+    for (auto& str : scene.strings)
+    {
+        if (!reader.ReadString(str)) { return std::unexpected(false); }
+    }
+
+    const bool success =
+        reader.ReadArray(scene.entityNames) &&
+
+        reader.ReadArray(scene.transforms.entities) &&
+        reader.ReadArray(scene.transforms.positions) &&
+        reader.ReadArray(scene.transforms.scales) &&
+        reader.ReadArray(scene.transforms.eulerRotations) &&
+
+        reader.ReadArray(scene.sprites.entities) &&
+        reader.ReadArray(scene.sprites.imageAssetNames) &&
+        reader.ReadArray(scene.sprites.destVirtualSizes) &&
+
+        reader.ReadArray(scene.models.entities) &&
+        reader.ReadArray(scene.models.modelAssetNames) &&
+
+        reader.ReadArray(scene.physicsBoxes.entities) &&
+        reader.ReadArray(scene.physicsBoxes.physicsScenes) &&
+        reader.ReadArray(scene.physicsBoxes.localScales) &&
+        reader.ReadArray(scene.physicsBoxes.mins) &&
+        reader.ReadArray(scene.physicsBoxes.maxs) &&
+
+        reader.ReadArray(scene.physicsSpheres.entities) &&
+        reader.ReadArray(scene.physicsSpheres.physicsScenes) &&
+        reader.ReadArray(scene.physicsSpheres.localScales) &&
+        reader.ReadArray(scene.physicsSpheres.radii) &&
+
+        reader.ReadArray(scene.physicsHeightMaps.entities) &&
+        reader.ReadArray(scene.physicsHeightMaps.physicsScenes) &&
+        reader.ReadArray(scene.physicsHeightMaps.localScales) &&
+
+        reader.ReadArray(scene.players.names) &&
+        reader.ReadArray(scene.players.positions) &&
+        reader.ReadArray(scene.players.heights) &&
+        reader.ReadArray(scene.players.radii);
+
+    if (!success || !ValidateCompiledScene(scene))
+    {
+        return std::unexpected(false);
+    }
+
+    return scene;
+}
+
+}
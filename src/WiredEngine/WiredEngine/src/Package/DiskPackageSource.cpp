@@ -80,14 +80,16 @@ std::expected<std::vector<std::byte>, bool> DiskPackageSource::GetAssetBytesBloc
 
 std::expected<std::vector<std::byte>, bool> DiskPackageSource::GetModelSubAssetBytesBlocking(std::string_view modelAssetName, std::string_view assetName) const
 {
-    auto assetDirectory = GetDirectoryPathForAssetType(m_packageDirectoryPath, AssetType::Model);
+    return GetFileContents(GetModelDirectoryPath(modelAssetName) / assetName);
+}
 
+std::filesystem::path DiskPackageSource::GetModelDirectoryPath(std::string_view modelAssetName) const
+{
     // Model files are additionally put in their own directories within the models directories
     std::filesystem::path p = modelAssetName;
     p.replace_extension("");
-    assetDirectory = assetDirectory / p.filename();
 
-    return GetFileContents(assetDirectory / assetName);
+    return GetDirectoryPathForAssetType(m_packageDirectoryPath, AssetType::Model) / p.filename();
 }
 
 }
@@ -0,0 +1,355 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Wired/Engine/Package/PackageArchive.h>
+#include <Wired/Engine/Package/CompiledScene.h>
+#include <Wired/Engine/Package/Serialization.h>
+
+#include <NEON/Common/Log/ILogger.h>
+
+#include <fstream>
+#include <algorithm>
+#include <unordered_map>
+#include <tuple>
+#include <optional>
+
+namespace Wired::Engine
+{
+
+uint64_t ArchiveNameHash(std::string_view name)
+{
+    uint64_t hash = 14695981039346656037ULL;
+
+    for (const auto& c : name)
+    {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 1099511628211ULL;
+    }
+
+    return hash;
+}
+
+std::string ArchiveModelSubAssetName(std::string_view modelAssetName, std::string_view assetName)
+{
+    std::string subAssetName(assetName);
+    std::ranges::replace(subAssetName, '\\', '/');
+
+    return std::string(modelAssetName) + "/" + std::filesystem::path(subAssetName).lexically_normal().generic_string();
+}
+
+struct PendingArchiveEntry
+{
+    ArchiveEntryType entryType{ArchiveEntryType::Asset};
+    uint32_t assetType{0};
+    std::string name;
+    std::filesystem::path filePath;
+
+    // If set, the entry's data, rather than the contents of filePath
+    std::optional<std::vector<std::byte>> contents;
+};
+
+[[nodiscard]] static std::expected<std::vector<PendingArchiveEntry>, bool> GatherArchiveEntries(NCommon::ILogger* pLogger,
+                                                                                                 const std::filesystem::path& packageDirectoryPath)
+{
+    std::error_code ec{};
+
+    const auto packageName = packageDirectoryPath.filename().string();
+    const auto manifestFilePath = GetPackageManifestPath(packageDirectoryPath.parent_path(), packageName);
+
+    // Reading the metadata both validates the package and gives us the names of its assets
+    const auto package = ReadPackageMetadataFromDisk(pLogger, manifestFilePath);
+    if (!package)
+    {
+        pLogger->Error("WritePackageArchive: Failed to read package metadata: {}", packageDirectoryPath.string());
+        return std::unexpected(false);
+    }
+
+    std::vector<PendingArchiveEntry> entries;
+
+    //
+    // Manifest
+    //
+    entries.push_back({ArchiveEntryType::Manifest, 0, manifestFilePath.filename().string(), manifestFilePath});
+
+    //
+    // Scenes
+    //
+    const auto scenesDirectory = packageDirectoryPath / PACKAGE_SCENES_DIRECTORY;
+    if (std::filesystem::is_directory(scenesDirectory, ec))
+    {
+        const auto sceneFileNames = GetFileNamesInDirectory(scenesDirectory);
+        if (!sceneFileNames)
+        {
+            pLogger->Error("WritePackageArchive: Failed to list files in scenes directory");
+            return std::unexpected(false);
+        }
+
+        for (const auto& sceneFileName : *sceneFileNames)
+        {
+            if (!std::filesystem::path(sceneFileName).extension().string().contains(SCENE_EXTENSION)) { continue; }
+
+            const auto sceneFilePath = scenesDirectory / sceneFileName;
+
+            if (sceneFilePath.extension() == std::string(".") + SCENE_BINARY_EXTENSION)
+            {
+                entries.push_back({ArchiveEntryType::Scene, 0, sceneFileName, sceneFilePath});
+                continue;
+            }
+
+            // JSON scenes are compiled to their binary form so that loading them from the archive needs no parsing
+            const auto sceneFileContents = GetFileContents(sceneFilePath);
+            if (!sceneFileContents)
+            {
+                pLogger->Error("WritePackageArchive: Failed to read scene file: {}", sceneFilePath.string());
+                return std::unexpected(false);
+            }
+
+            const auto scene = ObjectFromBytes<std::shared_ptr<Scene>>(*sceneFileContents);
+            if (!scene)
+            {
+                pLogger->Error("WritePackageArchive: Failed to deserialize scene contents: {}", sceneFileName);
+                return std::unexpected(false);
+            }
+
+            entries.push_back({ArchiveEntryType::Scene, 0, sceneFileName, sceneFilePath, CompiledSceneToBytes(CompileScene(**scene))});
+        }
+    }
+
+    //
+    // Assets
+    //
+    const auto addAssets = [&](AssetType assetType, const std::vector<std::string>& assetNames){
+        for (const auto& assetName : assetNames)
+        {
+            entries.push_back({
+                ArchiveEntryType::Asset,
+                static_cast<uint32_t>(assetType),
+                assetName,
+                GetDirectoryPathForAssetType(packageDirectoryPath, assetType) / assetName
+            });
+        }
+    };
+
+    addAssets(AssetType::Image, package->assetNames.imageAssetNames);
+    addAssets(AssetType::Shader, package->assetNames.shaderAssetNames);
+    addAssets(AssetType::Audio, package->assetNames.audioAssetNames);
+    addAssets(AssetType::Font, package->assetNames.fontAssetNames);
+
+    //
+    // Models; the model file itself, as well as every file within its model directory
+    //
+    for (const auto& modelAssetName : package->assetNames.modelAssetNames)
+    {
+        std::filesystem::path p = modelAssetName;
+        p.replace_extension("");
+
+        const auto modelDirectoryPath = GetDirectoryPathForAssetType(packageDirectoryPath, AssetType::Model) / p.filename();
+
+        entries.push_back({
+            ArchiveEntryType::Asset,
+            static_cast<uint32_t>(AssetType::Model),
+            modelAssetName,
+            modelDirectoryPath / modelAssetName
+        });
+
+        for (const auto& dirEntry : std::filesystem::recursive_directory_iterator(modelDirectoryPath, ec))
+        {
+            if (!dirEntry.is_regular_file(ec)) { continue; }
+
+            const auto relativePath = dirEntry.path().lexically_relative(modelDirectoryPath);
+
+            entries.push_back({
+                ArchiveEntryType::ModelSubAsset,
+                0,
+                ArchiveModelSubAssetName(modelAssetName, relativePath.generic_string()),
+                dirEntry.path()
+            });
+        }
+
+        if (ec)
+        {
+            pLogger->Error("WritePackageArchive: Failed to list files in model directory: {}", modelDirectoryPath.string());
+            return std::unexpected(false);
+        }
+    }
+
+    return entries;
+}
+
+[[nodiscard]] static bool WritePadding(std::ofstream& file, uint64_t alignment)
+{
+    const auto position = static_cast<uint64_t>(file.tellp());
+    const auto padding = (alignment - (position % alignment)) % alignment;
+
+    static constexpr char zeros[PACKAGE_ARCHIVE_DATA_ALIGNMENT] = {};
+    file.write(zeros, static_cast<std::streamsize>(padding));
+
+    return file.good();
+}
+
+[[nodiscard]] static std::expected<void, bool> WriteArchiveFile(NCommon::ILogger* pLogger,
+                                                                const std::vector<PendingArchiveEntry>& pendingEntries,
+                                                                const std::filesystem::path& filePath)
+{
+    std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        pLogger->Error("WritePackageArchive: Failed to open archive file for writing: {}", filePath.string());
+        return std::unexpected(false);
+    }
+
+    // Placeholder header; re-written once the index location is known
+    ArchiveHeader header{};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(ArchiveHeader));
+
+    //
+    // Entry data. Entries that refer to the same file (e.g. a model file is both an asset and a model
+    // sub-asset) share one copy of its data.
+    //
+    struct DataLocation
+    {
+        uint64_t offset{0};
+        uint64_t byteSize{0};
+    };
+
+    std::unordered_map<std::string, DataLocation> fileDataLocations;
+
+    std::vector<ArchiveIndexEntry> index;
+    index.reserve(pendingEntries.size());
+
+    std::string strings;
+
+    for (const auto& pendingEntry : pendingEntries)
+    {
+        // Entries with in-memory contents are keyed apart from the file they were produced from
+        const auto filePathStr = pendingEntry.contents ? pendingEntry.name + "@" + pendingEntry.filePath.string()
+                                                       : pendingEntry.filePath.string();
+
+        auto it = fileDataLocations.find(filePathStr);
+        if (it == fileDataLocations.cend())
+        {
+            const auto contents = pendingEntry.contents ? std::expected<std::vector<std::byte>, bool>(*pendingEntry.contents)
+                                                        : GetFileContents(pendingEntry.filePath);
+            if (!contents)
+            {
+                pLogger->Error("WritePackageArchive: Failed to read file contents: {}", filePathStr);
+                return std::unexpected(false);
+            }
+
+            if (!WritePadding(file, PACKAGE_ARCHIVE_DATA_ALIGNMENT))
+            {
+                pLogger->Error("WritePackageArchive: Failed to write to archive file");
+                return std::unexpected(false);
+            }
+
+            const DataLocation location{.offset = static_cast<uint64_t>(file.tellp()), .byteSize = contents->size()};
+
+            file.write(reinterpret_cast<const char*>(contents->data()), static_cast<std::streamsize>(contents->size()));
+            if (!file.good())
+            {
+                pLogger->Error("WritePackageArchive: Failed to write to archive file");
+                return std::unexpected(false);
+            }
+
+            it = fileDataLocations.insert({filePathStr, location}).first;
+        }
+
+        ArchiveIndexEntry entry{};
+        entry.entryType = static_cast<uint32_t>(pendingEntry.entryType);
+        entry.assetType = pendingEntry.assetType;
+        entry.nameHash = ArchiveNameHash(pendingEntry.name);
+        entry.nameOffset = strings.size();
+        entry.nameByteSize = static_cast<uint32_t>(pendingEntry.name.size());
+        entry.compression = static_cast<uint32_t>(ArchiveCompression::None);
+        entry.dataOffset = it->second.offset;
+        entry.dataByteSize = it->second.byteSize;
+        entry.uncompressedByteSize = it->second.byteSize;
+        index.push_back(entry);
+
+        strings += pendingEntry.name;
+    }
+
+    //
+    // Index, sorted for lookup
+    //
+    std::ranges::sort(index, [&](const ArchiveIndexEntry& a, const ArchiveIndexEntry& b){
+        const auto aName = std::string_view(strings).substr(a.nameOffset, a.nameByteSize);
+        const auto bName = std::string_view(strings).substr(b.nameOffset, b.nameByteSize);
+        return std::tie(a.entryType, a.assetType, a.nameHash, aName) < std::tie(b.entryType, b.assetType, b.nameHash, bName);
+    });
+
+    if (!WritePadding(file, alignof(ArchiveIndexEntry)))
+    {
+        pLogger->Error("WritePackageArchive: Failed to write to archive file");
+        return std::unexpected(false);
+    }
+
+    header.entryCount = index.size();
+    header.indexOffset = static_cast<uint64_t>(file.tellp());
+    file.write(reinterpret_cast<const char*>(index.data()), static_cast<std::streamsize>(index.size() * sizeof(ArchiveIndexEntry)));
+
+    header.stringsOffset = static_cast<uint64_t>(file.tellp());
+    header.stringsByteSize = strings.size();
+    file.write(strings.data(), static_cast<std::streamsize>(strings.size()));
+
+    //
+    // Final header
+    //
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(ArchiveHeader));
+
+    if (!file.good())
+    {
+        pLogger->Error("WritePackageArchive: Failed to write to archive file");
+        return std::unexpected(false);
+    }
+
+    return {};
+}
+
+std::expected<void, bool> WritePackageArchive(NCommon::ILogger* pLogger,
+                                              const std::filesystem::path& packageDirectoryPath,
+                                              const std::filesystem::path& archiveFilePath)
+{
+    std::error_code ec{};
+
+    if (!std::filesystem::is_directory(packageDirectoryPath, ec))
+    {
+        pLogger->Error("WritePackageArchive: Package directory is not a valid directory: {}", packageDirectoryPath.string());
+        return std::unexpected(false);
+    }
+
+    const auto entries = GatherArchiveEntries(pLogger, packageDirectoryPath);
+    if (!entries)
+    {
+        return std::unexpected(false);
+    }
+
+    // Write to a temp file and then rename it into place so that a partially written archive is never
+    // seen by a subsequent load
+    auto tempFilePath = archiveFilePath;
+    tempFilePath += ".tmp";
+
+    if (!WriteArchiveFile(pLogger, *entries, tempFilePath))
+    {
+        std::filesystem::remove(tempFilePath, ec);
+        return std::unexpected(false);
+    }
+
+    std::filesystem::rename(tempFilePath, archiveFilePath, ec);
+    if (ec)
+    {
+        pLogger->Error("WritePackageArchive: Failed to move archive into place: {}", archiveFilePath.string());
+        std::filesystem::remove(tempFilePath, ec);
+        return std::unexpected(false);
+    }
+
+    pLogger->Info("WritePackageArchive: Wrote {} entries to {}", entries->size(), archiveFilePath.string());
+
+    return {};
+}
+
+}
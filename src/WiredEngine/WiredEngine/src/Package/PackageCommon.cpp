@@ -6,6 +6,7 @@
  
 #include <Wired/Engine/Package/PackageCommon.h>
 #include <Wired/Engine/Package/Serialization.h>
+#include <Wired/Engine/Package/CompiledScene.h>
 
 #include <NEON/Common/Log/ILogger.h>
 
@@ -275,6 +276,19 @@ std::expected<Package, bool> ReadPackageMetadataFromDisk(NCommon::ILogger* pLogg
                 return std::unexpected(false);
             }
 
+            // Binary scenes skip JSON parsing entirely
+            if (std::filesystem::path(sceneFileName).extension() == std::string(".") + SCENE_BINARY_EXTENSION)
+            {
+                auto compiledScene = CompiledSceneFromBytes(*sceneFileContents);
+                if (!compiledScene)
+                {
+                    pLogger->Error("ReadPackageMetadataFromDisk: Failed to decode binary scene contents: {}", sceneFileName);
+                    return std::unexpected(false);
+                }
+                package.compiledScenes.push_back(std::make_shared<const CompiledScene>(std::move(*compiledScene)));
+                continue;
+            }
+
             const auto scene = ObjectFromBytes<std::shared_ptr<Engine::Scene>>(*sceneFileContents);
             if (!scene)
             {
@@ -282,6 +296,7 @@ std::expected<Package, bool> ReadPackageMetadataFromDisk(NCommon::ILogger* pLogg
                 return std::unexpected(false);
             }
             package.scenes.push_back(*scene);
+            package.compiledScenes.push_back(std::make_shared<const CompiledScene>(CompileScene(**scene)));
         }
     }
 
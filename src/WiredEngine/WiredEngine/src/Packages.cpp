@@ -25,9 +25,12 @@
 namespace Wired::Engine
 {
 
+// Audio assets at least this large are streamed rather than fully decoded (~6 seconds of 16 bit stereo 44.1kHz)
+static constexpr std::size_t STREAMED_AUDIO_MIN_BYTE_SIZE = 1024 * 1024;
+
 Packages::Packages(NCommon::ILogger* pLogger,
                    WorkThreadPool* workThreadPool,
-                   IResources* pResources,
+                   Resources* pResources,
                    Platform::IPlatform* pPlatform,
                    Render::IRenderer* pRenderer)
     : m_pLogger(pLogger)
@@ -436,7 +439,9 @@ void Packages::LoadPackageModels(IPackageSource const* packageSource, PackageRes
             modelTexturePtrs.insert({it.first, it.second.get()});
         }
 
-        const auto result = m_pResources->CreateModel(std::move(*model), modelTexturePtrs, modelAssetName);
+        const auto collisionCacheFilePath = GetModelCollisionCacheFilePath(packageSource->GetPackageName(), modelAssetName);
+
+        const auto result = m_pResources->CreateModel(std::move(*model), modelTexturePtrs, collisionCacheFilePath, modelAssetName);
         if (!result)
         {
             LogError("Packages::LoadPackageModels: Failed to create model: {}", modelAssetName);
@@ -447,10 +452,43 @@ void Packages::LoadPackageModels(IPackageSource const* packageSource, PackageRes
     }
 }
 
+std::optional<std::filesystem::path> Packages::GetModelCollisionCacheFilePath(const PackageName& packageName, const std::string& modelAssetName) const
+{
+    // Collision is cooked on first use and cached in the platform's cache directory rather than in the package,
+    // which may be read-only
+    const auto cacheDirectoryPath = m_pPlatform->GetFiles()->GetCacheDirectoryPath();
+    if (!cacheDirectoryPath)
+    {
+        return std::nullopt;
+    }
+
+    std::filesystem::path collisionFileName = modelAssetName;
+    collisionFileName.replace_extension(MODEL_COLLISION_EXTENSION);
+
+    return *cacheDirectoryPath / PACKAGES_CACHE_DIRECTORY / packageName.id / collisionFileName.filename();
+}
+
 void Packages::LoadPackageAudio(IPackageSource const* packageSource, const LoadedPackageData& loadedPackageData, PackageResources& packageResources) const
 {
     for (const auto& audioIt : *loadedPackageData.audioAssets)
     {
+        const auto resourceIdentifier = PRI(packageSource->GetPackageName(), audioIt.first);
+
+        //
+        // Long audio is streamed rather than being decoded up front. Falls back to a full decode if the audio
+        // isn't in a streamable format.
+        //
+        if (audioIt.second.size() >= STREAMED_AUDIO_MIN_BYTE_SIZE)
+        {
+            if (m_pResources->CreateResourceStreamedAudio(resourceIdentifier, audioIt.second))
+            {
+                packageResources.audio.push_back(audioIt.first);
+                continue;
+            }
+
+            LogInfo("Packages::LoadPackageAudio: Audio isn't streamable, fully decoding it: {}", audioIt.first);
+        }
+
         const auto audioData = AudioUtil::AudioDataFromBytes(audioIt.second);
         if (!audioData)
         {
@@ -458,7 +496,7 @@ void Packages::LoadPackageAudio(IPackageSource const* packageSource, const Loade
             continue;
         }
 
-        if (!m_pResources->CreateResourceAudio(PRI(packageSource->GetPackageName(), audioIt.first), audioData->get()))
+        if (!m_pResources->CreateResourceAudio(resourceIdentifier, audioData->get()))
         {
             m_pLogger->Error("Packages::LoadPackageAudio: Failed to create asset audio for: {}", audioIt.first);
             continue;
@@ -17,6 +17,8 @@
 #include <memory>
 #include <expected>
 #include <string>
+#include <filesystem>
+#include <optional>
 
 namespace NCommon
 {
@@ -36,7 +38,7 @@ namespace Wired::Render
 namespace Wired::Engine
 {
     class WorkThreadPool;
-    class IResources;
+    class Resources;
     class Model;
 
     class Packages : public IPackages
@@ -45,7 +47,7 @@ namespace Wired::Engine
 
             Packages(NCommon::ILogger* pLogger,
                      WorkThreadPool* workThreadPool,
-                     IResources* pResources,
+                     Resources* pResources,
                      Platform::IPlatform* pPlatform,
                      Render::IRenderer* pRenderer);
             ~Packages() override;
@@ -83,6 +85,8 @@ namespace Wired::Engine
             void LoadPackageTextures(const LoadedPackageData& loadedPackageData, PackageResources& packageResources) const;
             void LoadPackageShaders(const LoadedPackageData& loadedPackageData, PackageResources& packageResources) const;
             void LoadPackageModels(IPackageSource const* packageSource, PackageResources& packageResources) const;
+            [[nodiscard]] std::optional<std::filesystem::path> GetModelCollisionCacheFilePath(const PackageName& packageName,
+                                                                                              const std::string& modelAssetName) const;
             void LoadPackageAudio(IPackageSource const* packageSource, const LoadedPackageData& loadedPackageData, PackageResources& packageResources) const;
             void LoadPackageFonts(IPackageSource const* packageSource, const LoadedPackageData& loadedPackageData, PackageResources& packageResources) const;
 
@@ -108,7 +112,7 @@ namespace Wired::Engine
 
             NCommon::ILogger* m_pLogger;
             WorkThreadPool* m_pWorkThreadPool;
-            IResources* m_pResources;
+            Resources* m_pResources;
             Platform::IPlatform* m_pPlatform;
             Render::IRenderer* m_pRenderer;
 
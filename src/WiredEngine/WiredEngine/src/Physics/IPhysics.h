@@ -18,6 +18,7 @@
 #include <optional>
 #include <vector>
 #include <expected>
+#include <span>
 
 namespace Wired::Engine
 {
@@ -38,12 +39,20 @@ namespace Wired::Engine
 
             [[nodiscard]] virtual std::vector<PhysicsSceneName> GetAllSceneNames() const = 0;
 
-            [[nodiscard]] virtual std::expected<PhysicsId, bool> CreateRigidBody(const PhysicsSceneName& scene, const RigidBodyData& data) = 0;
+            /**
+             * Creates a batch of bodies, which are added to the simulation together. Returns a result for each
+             * body, in the same order as the provided data.
+             */
+            [[nodiscard]] virtual std::vector<std::expected<PhysicsId, bool>> CreateRigidBodies(const PhysicsSceneName& scene, std::span<const RigidBodyData> data) = 0;
             virtual void UpdateRigidBody(const PhysicsSceneName& scene, PhysicsId physicsId, const RigidBodyData& data) = 0;
             [[nodiscard]] virtual std::optional<const RigidBody*> GetRigidBody(const PhysicsSceneName& scene, PhysicsId physicsId) const = 0;
-            virtual void DestroyRigidBody(const PhysicsSceneName& scene, PhysicsId physicsId) = 0;
+            virtual void DestroyRigidBodies(const PhysicsSceneName& scene, std::span<const PhysicsId> physicsIds) = 0;
 
             virtual void UpdateBodiesFromSimulation() = 0;
+            /**
+             * Returns the bodies in the scene which the simulation has modified since the last MarkBodiesSynced call
+             */
+            [[nodiscard]] virtual std::span<const PhysicsId> GetDirtyBodies(const PhysicsSceneName& scene) const = 0;
             virtual void MarkBodiesSynced() = 0;
 
             [[nodiscard]] virtual std::vector<PhysicsContact> PopContacts(const PhysicsSceneName& scene) = 0;
@@ -6,6 +6,7 @@
  
 #include "JoltCharacterController.h"
 #include "JoltCommon.h"
+#include "JoltLayers.h"
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Physics/PhysicsSystem.h>
@@ -15,8 +16,16 @@
 namespace Wired::Engine
 {
 
-std::unique_ptr<JoltCharacterController> JoltCharacterController::Create(JPH::PhysicsSystem* pPhysics, const CharacterControllerParams& params)
+std::expected<std::unique_ptr<JoltCharacterController>, bool> JoltCharacterController::Create(JPH::PhysicsSystem* pPhysics,
+                                                                                             JoltObjectLayers* pObjectLayers,
+                                                                                             const CharacterControllerParams& params)
 {
+    const auto objectLayer = pObjectLayers->GetObjectLayer(BroadPhaseLayers::CHARACTER, params.collisionFilter);
+    if (!objectLayer)
+    {
+        return std::unexpected(false);
+    }
+
     // params's characterHeight is meant to be total/real height of the character, whereas the jolt capsule "height"
     // is the height of only the cylindrical portion of the capsule shape. Convert between the two here.
     assert(params.characterHeight > (2.0f * params.characterRadius));
@@ -38,18 +47,19 @@ std::unique_ptr<JoltCharacterController> JoltCharacterController::Create(JPH::Ph
     settings->mSupportingVolume = JPH::Plane(JPH::Vec3::sAxisY(), -params.characterRadius); // Accept contacts that touch the lower sphere of the capsule
     //settings->mEnhancedInternalEdgeRemoval = sEnhancedInternalEdgeRemoval;
     //settings->mInnerBodyShape = sCreateInnerBody? mInnerStandingShape : nullptr;
-    //settings->mInnerBodyLayer = Layers::MOVING;
+    //settings->mInnerBodyLayer = *objectLayer;
 
     JPH::Ref<JPH::CharacterVirtual> character = new JPH::CharacterVirtual(settings, JPH::RVec3::sZero(), JPH::Quat::sIdentity(), 0, pPhysics);
 
     character->SetPosition(ToJPH(params.position));
 
-    return std::make_unique<JoltCharacterController>(pPhysics, character);
+    return std::make_unique<JoltCharacterController>(pPhysics, character, *objectLayer);
 }
 
-JoltCharacterController::JoltCharacterController(JPH::PhysicsSystem* pPhysics, JPH::Ref<JPH::CharacterVirtual> characterVirtual)
+JoltCharacterController::JoltCharacterController(JPH::PhysicsSystem* pPhysics, JPH::Ref<JPH::CharacterVirtual> characterVirtual, JPH::ObjectLayer objectLayer)
     : m_physics(pPhysics)
     , m_characterVirtual(std::move(characterVirtual))
+    , m_objectLayer(objectLayer)
 {
 
 }
@@ -137,8 +147,8 @@ void JoltCharacterController::Update(float inDeltaTime, JPH::TempAllocator* pTem
         inDeltaTime,
         -m_characterVirtual->GetUp() * m_physics->GetGravity().Length(),
         settings,
-        m_physics->GetDefaultBroadPhaseLayerFilter(Layers::MOVING),
-        m_physics->GetDefaultLayerFilter(Layers::MOVING),
+        m_physics->GetDefaultBroadPhaseLayerFilter(m_objectLayer),
+        m_physics->GetDefaultLayerFilter(m_objectLayer),
         {}, // Body filter
         {}, // Shape filter
         *pTempAllocator
@@ -13,6 +13,7 @@
 #include <Jolt/Physics/Character/CharacterVirtual.h>
 
 #include <memory>
+#include <expected>
 
 namespace JPH
 {
@@ -21,15 +22,19 @@ namespace JPH
 
 namespace Wired::Engine
 {
+    class JoltObjectLayers;
+
     class JoltCharacterController : public ICharacterController
     {
         public:
 
-            static std::unique_ptr<JoltCharacterController> Create(JPH::PhysicsSystem* pPhysics, const CharacterControllerParams& params);
+            [[nodiscard]] static std::expected<std::unique_ptr<JoltCharacterController>, bool> Create(JPH::PhysicsSystem* pPhysics,
+                                                                                                    JoltObjectLayers* pObjectLayers,
+                                                                                                    const CharacterControllerParams& params);
 
         public:
 
-            JoltCharacterController(JPH::PhysicsSystem* pPhysics, JPH::Ref<JPH::CharacterVirtual> characterVirtual);
+            JoltCharacterController(JPH::PhysicsSystem* pPhysics, JPH::Ref<JPH::CharacterVirtual> characterVirtual, JPH::ObjectLayer objectLayer);
 
             //
             // ICharacterController
@@ -62,6 +67,7 @@ namespace Wired::Engine
 
             JPH::PhysicsSystem* m_physics;
             JPH::Ref<JPH::CharacterVirtual> m_characterVirtual;
+            JPH::ObjectLayer m_objectLayer;
     };
 }
 
@@ -8,7 +8,6 @@
 #define WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTCOMMON_H
 
 #include <Jolt/Jolt.h>
-#include <Jolt/Physics/Collision/ObjectLayer.h>
 
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
@@ -20,13 +19,6 @@ namespace Wired::Engine
 
     inline glm::quat FromJPH(const JPH::Quat& in) { return {in.GetW(), in.GetX(), in.GetY(), in.GetZ()}; }
     inline JPH::Quat ToJPH(const glm::quat& in) { return {in.x, in.y, in.z, in.w}; }
-
-    namespace Layers
-    {
-        static constexpr JPH::ObjectLayer NON_MOVING = 0;
-        static constexpr JPH::ObjectLayer MOVING = 1;
-        static constexpr JPH::ObjectLayer NUM_LAYERS = 2;
-    }
 }
 
 #endif //WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTCOMMON_H
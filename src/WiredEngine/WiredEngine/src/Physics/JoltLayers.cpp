@@ -0,0 +1,153 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "JoltLayers.h"
+
+#include <algorithm>
+
+namespace Wired::Engine
+{
+
+static constexpr JPH::BroadPhaseLayer::Type BroadPhaseIndex(JPH::BroadPhaseLayer layer)
+{
+    return static_cast<JPH::BroadPhaseLayer::Type>(layer);
+}
+
+static constexpr uint32_t BroadPhaseBit(JPH::BroadPhaseLayer layer)
+{
+    return 1U << BroadPhaseIndex(layer);
+}
+
+// Broadphase layer -> bitmask of the broadphase layers it can collide with. Must be symmetric.
+static constexpr std::array<uint32_t, BroadPhaseLayers::NUM_LAYERS> BROADPHASE_COLLIDE_MASKS = {
+    // NON_MOVING
+    BroadPhaseBit(BroadPhaseLayers::MOVING) | BroadPhaseBit(BroadPhaseLayers::DEBRIS) | BroadPhaseBit(BroadPhaseLayers::CHARACTER),
+    // MOVING
+    BroadPhaseBit(BroadPhaseLayers::NON_MOVING) | BroadPhaseBit(BroadPhaseLayers::MOVING) | BroadPhaseBit(BroadPhaseLayers::SENSOR) | BroadPhaseBit(BroadPhaseLayers::CHARACTER),
+    // DEBRIS
+    BroadPhaseBit(BroadPhaseLayers::NON_MOVING),
+    // SENSOR
+    BroadPhaseBit(BroadPhaseLayers::MOVING) | BroadPhaseBit(BroadPhaseLayers::CHARACTER),
+    // CHARACTER
+    BroadPhaseBit(BroadPhaseLayers::NON_MOVING) | BroadPhaseBit(BroadPhaseLayers::MOVING) | BroadPhaseBit(BroadPhaseLayers::SENSOR) | BroadPhaseBit(BroadPhaseLayers::CHARACTER)
+};
+
+JPH::BroadPhaseLayer GetBroadPhaseLayer(RigidBodyType bodyType, PhysicsBodyCategory category, ShapeUsage shapeUsage)
+{
+    if (shapeUsage == ShapeUsage::Trigger)
+    {
+        return BroadPhaseLayers::SENSOR;
+    }
+
+    if (bodyType == RigidBodyType::Static)
+    {
+        return BroadPhaseLayers::NON_MOVING;
+    }
+
+    switch (category)
+    {
+        case PhysicsBodyCategory::Default: return BroadPhaseLayers::MOVING;
+        case PhysicsBodyCategory::Debris: return BroadPhaseLayers::DEBRIS;
+        case PhysicsBodyCategory::Character: return BroadPhaseLayers::CHARACTER;
+    }
+
+    return BroadPhaseLayers::MOVING;
+}
+
+std::expected<JPH::ObjectLayer, bool> JoltObjectLayers::GetObjectLayer(JPH::BroadPhaseLayer broadPhaseLayer,
+                                                                       const PhysicsCollisionFilter& collisionFilter)
+{
+    if (collisionFilter.layer >= PHYSICS_NUM_COLLISION_LAYERS)
+    {
+        return std::unexpected(false);
+    }
+
+    // Registration is rare and the number of distinct layers is small, so a linear search is fine here
+    const auto begin = m_objectLayers.cbegin();
+    const auto end = m_objectLayers.cbegin() + m_numObjectLayers;
+
+    const auto it = std::find_if(begin, end, [&](const ObjectLayerInfo& info){
+        return info.broadPhaseLayer == broadPhaseLayer && info.collisionFilter == collisionFilter;
+    });
+    if (it != end)
+    {
+        return static_cast<JPH::ObjectLayer>(std::distance(begin, it));
+    }
+
+    if (m_numObjectLayers == MAX_OBJECT_LAYERS)
+    {
+        return std::unexpected(false);
+    }
+
+    m_objectLayers[m_numObjectLayers] = ObjectLayerInfo{
+        .broadPhaseLayer = broadPhaseLayer,
+        .broadPhaseCollideMask = BROADPHASE_COLLIDE_MASKS[BroadPhaseIndex(broadPhaseLayer)],
+        .collisionFilter = collisionFilter
+    };
+
+    return static_cast<JPH::ObjectLayer>(m_numObjectLayers++);
+}
+
+JoltBroadPhaseLayerInterface::JoltBroadPhaseLayerInterface(const JoltObjectLayers* pObjectLayers)
+    : m_pObjectLayers(pObjectLayers)
+{
+
+}
+
+unsigned int JoltBroadPhaseLayerInterface::GetNumBroadPhaseLayers() const
+{
+    return BroadPhaseLayers::NUM_LAYERS;
+}
+
+JPH::BroadPhaseLayer JoltBroadPhaseLayerInterface::GetBroadPhaseLayer(JPH::ObjectLayer inLayer) const
+{
+    JPH_ASSERT(inLayer < m_pObjectLayers->GetNumObjectLayers());
+    return m_pObjectLayers->GetObjectLayerInfo(inLayer).broadPhaseLayer;
+}
+
+#if defined(JPH_EXTERNAL_PROFILE) || defined(JPH_PROFILE_ENABLED)
+const char* JoltBroadPhaseLayerInterface::GetBroadPhaseLayerName(JPH::BroadPhaseLayer inLayer) const
+{
+    switch (BroadPhaseIndex(inLayer))
+    {
+        case BroadPhaseIndex(BroadPhaseLayers::NON_MOVING): return "NON_MOVING";
+        case BroadPhaseIndex(BroadPhaseLayers::MOVING): return "MOVING";
+        case BroadPhaseIndex(BroadPhaseLayers::DEBRIS): return "DEBRIS";
+        case BroadPhaseIndex(BroadPhaseLayers::SENSOR): return "SENSOR";
+        case BroadPhaseIndex(BroadPhaseLayers::CHARACTER): return "CHARACTER";
+        default: JPH_ASSERT(false); return "INVALID";
+    }
+}
+#endif
+
+JoltObjectVsBroadPhaseLayerFilter::JoltObjectVsBroadPhaseLayerFilter(const JoltObjectLayers* pObjectLayers)
+    : m_pObjectLayers(pObjectLayers)
+{
+
+}
+
+bool JoltObjectVsBroadPhaseLayerFilter::ShouldCollide(JPH::ObjectLayer inLayer1, JPH::BroadPhaseLayer inLayer2) const
+{
+    return m_pObjectLayers->GetObjectLayerInfo(inLayer1).broadPhaseCollideMask & BroadPhaseBit(inLayer2);
+}
+
+JoltObjectLayerPairFilter::JoltObjectLayerPairFilter(const JoltObjectLayers* pObjectLayers)
+    : m_pObjectLayers(pObjectLayers)
+{
+
+}
+
+bool JoltObjectLayerPairFilter::ShouldCollide(JPH::ObjectLayer inObject1, JPH::ObjectLayer inObject2) const
+{
+    const auto& info1 = m_pObjectLayers->GetObjectLayerInfo(inObject1);
+    const auto& info2 = m_pObjectLayers->GetObjectLayerInfo(inObject2);
+
+    return (info1.broadPhaseCollideMask & BroadPhaseBit(info2.broadPhaseLayer)) &&
+           (info1.collisionFilter.mask & (1U << info2.collisionFilter.layer)) &&
+           (info2.collisionFilter.mask & (1U << info1.collisionFilter.layer));
+}
+
+}
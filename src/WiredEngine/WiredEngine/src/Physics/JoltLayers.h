@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTLAYERS_H
+#define WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTLAYERS_H
+
+#include <Wired/Engine/Physics/PhysicsCommon.h>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/ObjectLayer.h>
+#include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
+
+#include <array>
+#include <cstdint>
+#include <expected>
+
+namespace Wired::Engine
+{
+    namespace BroadPhaseLayers
+    {
+        static constexpr JPH::BroadPhaseLayer NON_MOVING(0);
+        static constexpr JPH::BroadPhaseLayer MOVING(1);
+        static constexpr JPH::BroadPhaseLayer DEBRIS(2);
+        static constexpr JPH::BroadPhaseLayer SENSOR(3);
+        static constexpr JPH::BroadPhaseLayer CHARACTER(4);
+        static constexpr unsigned int NUM_LAYERS(5);
+    }
+
+    /**
+    * Returns the broadphase layer a body belongs in
+    */
+    [[nodiscard]] JPH::BroadPhaseLayer GetBroadPhaseLayer(RigidBodyType bodyType, PhysicsBodyCategory category, ShapeUsage shapeUsage);
+
+    /**
+    * Registry of the Jolt object layers in use. Each object layer represents a unique combination of
+    * broadphase layer and user collision filter, and is registered the first time a body needs it.
+    *
+    * Jolt queries layers from its hottest broadphase/narrowphase paths on all of its worker threads, so
+    * layer info is stored in a flat array indexed directly by object layer. Layers are only registered
+    * from the thread which creates bodies, never while a simulation step is running.
+    */
+    class JoltObjectLayers
+    {
+        public:
+
+            static constexpr unsigned int MAX_OBJECT_LAYERS = 1024;
+
+            struct ObjectLayerInfo
+            {
+                JPH::BroadPhaseLayer broadPhaseLayer{BroadPhaseLayers::NON_MOVING};
+                uint32_t broadPhaseCollideMask{0}; // Bit per broadphase layer this object layer can collide with
+                PhysicsCollisionFilter collisionFilter{};
+            };
+
+        public:
+
+            [[nodiscard]] std::expected<JPH::ObjectLayer, bool> GetObjectLayer(JPH::BroadPhaseLayer broadPhaseLayer,
+                                                                              const PhysicsCollisionFilter& collisionFilter);
+
+            [[nodiscard]] const ObjectLayerInfo& GetObjectLayerInfo(JPH::ObjectLayer objectLayer) const { return m_objectLayers[objectLayer]; }
+            [[nodiscard]] unsigned int GetNumObjectLayers() const noexcept { return m_numObjectLayers; }
+
+        private:
+
+            std::array<ObjectLayerInfo, MAX_OBJECT_LAYERS> m_objectLayers{};
+            unsigned int m_numObjectLayers{0};
+    };
+
+    class JoltBroadPhaseLayerInterface : public JPH::BroadPhaseLayerInterface
+    {
+        public:
+
+            explicit JoltBroadPhaseLayerInterface(const JoltObjectLayers* pObjectLayers);
+
+            [[nodiscard]] unsigned int GetNumBroadPhaseLayers() const override;
+            [[nodiscard]] JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer inLayer) const override;
+
+        #if defined(JPH_EXTERNAL_PROFILE) || defined(JPH_PROFILE_ENABLED)
+            [[nodiscard]] const char* GetBroadPhaseLayerName(JPH::BroadPhaseLayer inLayer) const override;
+        #endif
+
+        private:
+
+            const JoltObjectLayers* m_pObjectLayers;
+    };
+
+    class JoltObjectVsBroadPhaseLayerFilter : public JPH::ObjectVsBroadPhaseLayerFilter
+    {
+        public:
+
+            explicit JoltObjectVsBroadPhaseLayerFilter(const JoltObjectLayers* pObjectLayers);
+
+            [[nodiscard]] bool ShouldCollide(JPH::ObjectLayer inLayer1, JPH::BroadPhaseLayer inLayer2) const override;
+
+        private:
+
+            const JoltObjectLayers* m_pObjectLayers;
+    };
+
+    class JoltObjectLayerPairFilter : public JPH::ObjectLayerPairFilter
+    {
+        public:
+
+            explicit JoltObjectLayerPairFilter(const JoltObjectLayers* pObjectLayers);
+
+            [[nodiscard]] bool ShouldCollide(JPH::ObjectLayer inObject1, JPH::ObjectLayer inObject2) const override;
+
+        private:
+
+            const JoltObjectLayers* m_pObjectLayers;
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTLAYERS_H
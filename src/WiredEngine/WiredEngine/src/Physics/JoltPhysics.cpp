@@ -6,13 +6,13 @@
  
 #include "JoltPhysics.h"
 #include "JoltCommon.h"
+#include "JoltLayers.h"
 
 #include <Jolt/Jolt.h>
 #include <Jolt/RegisterTypes.h>
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/JobSystemThreadPool.h>
 #include <Jolt/Physics/PhysicsSystem.h>
-#include <Jolt/Physics/Collision/BroadPhase/BroadPhaseLayer.h>
 
 #include <NEON/Common/Log/ILogger.h>
 
@@ -73,69 +73,11 @@ static bool AssertFailedImpl(const char *inExpression, const char *inMessage, co
     return true;
 }
 
-////////////////
-
-struct ObjectLayerPairFilterImpl : public JPH::ObjectLayerPairFilter
-{
-    [[nodiscard]] bool ShouldCollide(JPH::ObjectLayer inObject1, JPH::ObjectLayer inObject2) const override
-    {
-        switch (inObject1)
-        {
-            case Layers::NON_MOVING: return inObject2 == Layers::MOVING; // Non-moving only collides with moving
-            case Layers::MOVING: return true; // Moving collides with everything
-            default: JPH_ASSERT(false); return false;
-        }
-    }
-};
-
-namespace BroadPhaseLayers
-{
-    static constexpr JPH::BroadPhaseLayer NON_MOVING(0);
-    static constexpr JPH::BroadPhaseLayer MOVING(1);
-    static constexpr unsigned int NUM_LAYERS(2);
-}
-
-class BroadPhaseLayerInterface : public JPH::BroadPhaseLayerInterface
-{
-    public:
-
-        [[nodiscard]] unsigned int GetNumBroadPhaseLayers() const override
-        {
-            return BroadPhaseLayers::NUM_LAYERS;
-        }
-
-        [[nodiscard]] JPH::BroadPhaseLayer GetBroadPhaseLayer(JPH::ObjectLayer inLayer) const override
-        {
-            const auto it = m_mapping.find(inLayer);
-            JPH_ASSERT(it != m_mapping.cend());
-            return it->second;
-        }
-
-    private:
-
-        std::unordered_map<JPH::ObjectLayer, JPH::BroadPhaseLayer> m_mapping = {
-            {Layers::NON_MOVING, BroadPhaseLayers::NON_MOVING},
-            {Layers::MOVING, BroadPhaseLayers::MOVING}
-        };
-};
-
-struct ObjectVsBroadPhaseLayerFilterImpl : public JPH::ObjectVsBroadPhaseLayerFilter
-{
-    [[nodiscard]] bool ShouldCollide(JPH::ObjectLayer inLayer1, JPH::BroadPhaseLayer inLayer2) const override
-    {
-        switch (inLayer1)
-        {
-            case Layers::NON_MOVING: return inLayer2 == BroadPhaseLayers::MOVING;
-            case Layers::MOVING: return true;
-            default: JPH_ASSERT(false); return false;
-        }
-    }
-};
-
 JoltPhysics::JoltPhysics(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, const Resources* pResources)
     : m_pLogger(pLogger)
     , m_pMetrics(pMetrics)
     , m_pResources(pResources)
+    , m_shapeCache(pLogger, pMetrics, pResources)
 {
     pJPHLogger = m_pLogger;
 }
@@ -183,9 +125,9 @@ bool JoltPhysics::StartUp()
     constexpr unsigned int maxPhysicsBarriers = 1024U;
     m_jobSystem = std::make_unique<JPH::JobSystemThreadPool>(maxPhysicsJobs, maxPhysicsBarriers, std::thread::hardware_concurrency() - 1);
 
-    m_broadPhaseLayerInterface = std::make_unique<BroadPhaseLayerInterface>();
-    m_objectVsBroadPhaseLayerFilter = std::make_unique<ObjectVsBroadPhaseLayerFilterImpl>();
-    m_objectLayerPairFilter = std::make_unique<ObjectLayerPairFilterImpl>();
+    m_broadPhaseLayerInterface = std::make_unique<JoltBroadPhaseLayerInterface>(&m_objectLayers);
+    m_objectVsBroadPhaseLayerFilter = std::make_unique<JoltObjectVsBroadPhaseLayerFilter>(&m_objectLayers);
+    m_objectLayerPairFilter = std::make_unique<JoltObjectLayerPairFilter>(&m_objectLayers);
 
     return true;
 }
@@ -199,6 +141,8 @@ void JoltPhysics::ShutDown()
         DestroyPhysicsScene(m_scenes.cbegin()->first);
     }
 
+    m_shapeCache.Clear();
+
     m_jobSystem = nullptr;
     m_broadPhaseLayerInterface = nullptr;
     m_objectVsBroadPhaseLayerFilter = nullptr;
@@ -242,16 +186,16 @@ std::vector<PhysicsSceneName> JoltPhysics::GetAllSceneNames() const
     return sceneNames;
 }
 
-std::expected<PhysicsId, bool> JoltPhysics::CreateRigidBody(const PhysicsSceneName& _scene, const RigidBodyData& data)
+std::vector<std::expected<PhysicsId, bool>> JoltPhysics::CreateRigidBodies(const PhysicsSceneName& _scene, std::span<const RigidBodyData> data)
 {
     const auto scene = GetPhysicsScene(_scene);
     if (!scene)
     {
-        m_pLogger->Error("JoltPhysics::CreateRigidBody: No such scene exists: {}", _scene.id);
-        return std::unexpected(false);
+        m_pLogger->Error("JoltPhysics::CreateRigidBodies: No such scene exists: {}", _scene.id);
+        return std::vector<std::expected<PhysicsId, bool>>(data.size(), std::unexpected(false));
     }
 
-    return (*scene)->CreateRigidBody(data);
+    return (*scene)->CreateRigidBodies(data);
 }
 
 void JoltPhysics::UpdateRigidBody(const PhysicsSceneName& _scene, PhysicsId physicsId, const RigidBodyData& data)
@@ -278,16 +222,16 @@ std::optional<const RigidBody*> JoltPhysics::GetRigidBody(const PhysicsSceneName
     return (*scene)->GetRigidBody(physicsId);
 }
 
-void JoltPhysics::DestroyRigidBody(const PhysicsSceneName& _scene, PhysicsId physicsId)
+void JoltPhysics::DestroyRigidBodies(const PhysicsSceneName& _scene, std::span<const PhysicsId> physicsIds)
 {
     const auto scene = GetPhysicsScene(_scene);
     if (!scene)
     {
-        m_pLogger->Error("JoltPhysics::DestroyRigidBody: No such scene exists: {}", _scene.id);
+        m_pLogger->Error("JoltPhysics::DestroyRigidBodies: No such scene exists: {}", _scene.id);
         return;
     }
 
-    (*scene)->DestroyRigidBody(physicsId);
+    (*scene)->DestroyRigidBodies(physicsIds);
 }
 
 void JoltPhysics::UpdateBodiesFromSimulation()
@@ -298,6 +242,18 @@ void JoltPhysics::UpdateBodiesFromSimulation()
     }
 }
 
+std::span<const PhysicsId> JoltPhysics::GetDirtyBodies(const PhysicsSceneName& _scene) const
+{
+    const auto scene = GetPhysicsScene(_scene);
+    if (!scene)
+    {
+        m_pLogger->Error("JoltPhysics::GetDirtyBodies: No such scene exists: {}", _scene.id);
+        return {};
+    }
+
+    return (*scene)->GetDirtyBodies();
+}
+
 void JoltPhysics::MarkBodiesSynced()
 {
     for (auto& scene : m_scenes)
@@ -347,7 +303,7 @@ bool JoltPhysics::CreatePhysicsScene(const PhysicsSceneName& scene)
 
     //physicsSystem->SetGravity({-9.81f, 0.0f, 0.0f});
 
-    auto physicsScene = std::make_unique<JoltScene>(m_pLogger, m_pMetrics, m_pResources, std::move(physicsSystem));
+    auto physicsScene = std::make_unique<JoltScene>(m_pLogger, m_pMetrics, &m_shapeCache, &m_objectLayers, std::move(physicsSystem));
 
     m_scenes.emplace(scene, std::move(physicsScene));
 
@@ -393,4 +349,40 @@ std::optional<ICharacterController*> JoltPhysics::GetCharacterController(const P
     return (*scene)->GetCharacterController(name);
 }
 
+std::vector<PhysicsQueryResult> JoltPhysics::RayCast(const PhysicsSceneName& _scene, std::span<const RayCastQuery> queries) const
+{
+    const auto scene = GetPhysicsScene(_scene);
+    if (!scene)
+    {
+        m_pLogger->Error("JoltPhysics::RayCast: No such scene exists: {}", _scene.id);
+        return std::vector<PhysicsQueryResult>(queries.size());
+    }
+
+    return (*scene)->RayCast(m_jobSystem.get(), queries);
+}
+
+std::vector<PhysicsQueryResult> JoltPhysics::ShapeCast(const PhysicsSceneName& _scene, std::span<const ShapeCastQuery> queries) const
+{
+    const auto scene = GetPhysicsScene(_scene);
+    if (!scene)
+    {
+        m_pLogger->Error("JoltPhysics::ShapeCast: No such scene exists: {}", _scene.id);
+        return std::vector<PhysicsQueryResult>(queries.size());
+    }
+
+    return (*scene)->ShapeCast(m_jobSystem.get(), queries);
+}
+
+std::vector<PhysicsQueryResult> JoltPhysics::Overlap(const PhysicsSceneName& _scene, std::span<const OverlapQuery> queries) const
+{
+    const auto scene = GetPhysicsScene(_scene);
+    if (!scene)
+    {
+        m_pLogger->Error("JoltPhysics::Overlap: No such scene exists: {}", _scene.id);
+        return std::vector<PhysicsQueryResult>(queries.size());
+    }
+
+    return (*scene)->Overlap(m_jobSystem.get(), queries);
+}
+
 }
@@ -9,6 +9,8 @@
 
 #include "IPhysics.h"
 #include "JoltScene.h"
+#include "JoltShapeCache.h"
+#include "JoltLayers.h"
 
 #include <Wired/Engine/World/WorldCommon.h>
 #include <Wired/Engine/Physics/IPhysicsAccess.h>
@@ -60,12 +62,13 @@ namespace Wired::Engine
 
             [[nodiscard]] std::vector<PhysicsSceneName> GetAllSceneNames() const override;
 
-            [[nodiscard]] std::expected<PhysicsId, bool> CreateRigidBody(const PhysicsSceneName& scene, const RigidBodyData& data) override;
+            [[nodiscard]] std::vector<std::expected<PhysicsId, bool>> CreateRigidBodies(const PhysicsSceneName& scene, std::span<const RigidBodyData> data) override;
             void UpdateRigidBody(const PhysicsSceneName& scene, PhysicsId physicsId, const RigidBodyData& data) override;
             [[nodiscard]] std::optional<const RigidBody*> GetRigidBody(const PhysicsSceneName& scene, PhysicsId physicsId) const override;
-            void DestroyRigidBody(const PhysicsSceneName& scene, PhysicsId physicsId) override;
+            void DestroyRigidBodies(const PhysicsSceneName& scene, std::span<const PhysicsId> physicsIds) override;
 
             void UpdateBodiesFromSimulation() override;
+            [[nodiscard]] std::span<const PhysicsId> GetDirtyBodies(const PhysicsSceneName& scene) const override;
             void MarkBodiesSynced() override;
 
             [[nodiscard]] std::vector<PhysicsContact> PopContacts(const PhysicsSceneName& scene) override;
@@ -80,6 +83,9 @@ namespace Wired::Engine
                 const std::string& name,
                 const CharacterControllerParams& params) override;
             [[nodiscard]] std::optional<ICharacterController*> GetCharacterController(const PhysicsSceneName& scene, const std::string& name) const override;
+            [[nodiscard]] std::vector<PhysicsQueryResult> RayCast(const PhysicsSceneName& scene, std::span<const RayCastQuery> queries) const override;
+            [[nodiscard]] std::vector<PhysicsQueryResult> ShapeCast(const PhysicsSceneName& scene, std::span<const ShapeCastQuery> queries) const override;
+            [[nodiscard]] std::vector<PhysicsQueryResult> Overlap(const PhysicsSceneName& scene, std::span<const OverlapQuery> queries) const override;
 
         private:
 
@@ -92,10 +98,13 @@ namespace Wired::Engine
             const Resources* m_pResources;
 
             std::unique_ptr<JPH::JobSystem> m_jobSystem;
+            JoltObjectLayers m_objectLayers;
             std::unique_ptr<JPH::BroadPhaseLayerInterface> m_broadPhaseLayerInterface;
             std::unique_ptr<JPH::ObjectVsBroadPhaseLayerFilter> m_objectVsBroadPhaseLayerFilter;
             std::unique_ptr<JPH::ObjectLayerPairFilter> m_objectLayerPairFilter;
 
+            JoltShapeCache m_shapeCache;
+
             std::unordered_map<PhysicsSceneName, std::unique_ptr<JoltScene>> m_scenes;
     };
 }
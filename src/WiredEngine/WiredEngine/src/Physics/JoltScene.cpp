@@ -7,30 +7,40 @@
 #include "JoltScene.h"
 #include "JoltCommon.h"
 #include "JoltCharacterController.h"
-
-#include "../Resources.h"
+#include "JoltShapeCache.h"
+#include "JoltLayers.h"
 
 #include <Wired/Engine/Metrics.h>
 
 #include <Jolt/Jolt.h>
+#include <Jolt/Core/JobSystem.h>
 #include <Jolt/Physics/PhysicsSystem.h>
-#include <Jolt/Physics/Collision/Shape/BoxShape.h>
-#include <Jolt/Physics/Collision/Shape/SphereShape.h>
-#include <Jolt/Physics/Collision/Shape/HeightFieldShape.h>
 #include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/Body/BodyLock.h>
+#include <Jolt/Physics/Collision/RayCast.h>
+#include <Jolt/Physics/Collision/CastResult.h>
+#include <Jolt/Physics/Collision/ShapeCast.h>
+#include <Jolt/Physics/Collision/CollideShape.h>
+#include <Jolt/Physics/Collision/CollisionCollectorImpl.h>
+#include <Jolt/Physics/Collision/NarrowPhaseQuery.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/CapsuleShape.h>
 
-#include <NEON/Common/Compare.h>
 #include <NEON/Common/Log/ILogger.h>
 #include <NEON/Common/Metrics/IMetrics.h>
 
+#include <algorithm>
+
 
 namespace Wired::Engine
 {
 
-JoltScene::JoltScene(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, const Resources* pResources, std::unique_ptr<JPH::PhysicsSystem> physics)
+JoltScene::JoltScene(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, JoltShapeCache* pShapeCache, JoltObjectLayers* pObjectLayers, std::unique_ptr<JPH::PhysicsSystem> physics)
     : m_pLogger(pLogger)
     , m_pMetrics(pMetrics)
-    , m_pResources(pResources)
+    , m_pShapeCache(pShapeCache)
+    , m_pObjectLayers(pObjectLayers)
     , m_tempAllocator(std::make_unique<JPH::TempAllocatorImpl>(10 * 1024 * 1024))
     , m_physics(std::move(physics))
 {
@@ -41,7 +51,8 @@ JoltScene::~JoltScene()
 {
     m_pLogger = nullptr;
     m_pMetrics = nullptr;
-    m_pResources = nullptr;
+    m_pShapeCache = nullptr;
+    m_pObjectLayers = nullptr;
     m_tempAllocator = nullptr;
     m_physics = nullptr;
 }
@@ -52,9 +63,10 @@ void JoltScene::Destroy()
 
     m_physics->SetContactListener(nullptr);
 
-    m_bodyIdToPhysicsId.clear();
-    m_physicsIdToBodyId.clear();
+    m_bodyIds.clear();
+    m_bodyIndexToPhysicsId.clear();
     m_rigidBodies.clear();
+    m_dirtyBodies.clear();
 
     m_characterControllers.clear();
 }
@@ -77,32 +89,38 @@ void JoltScene::Update(float inDeltaTime, int inCollisionSteps, JPH::JobSystem*
 
 void JoltScene::UpdateBodiesFromSimulation()
 {
-    JPH::BodyInterface& bodyInterface = m_physics->GetBodyInterface();
+    // Simulation isn't running, so bodies can be accessed directly without going through body locks
+    const JPH::BodyLockInterfaceNoLock& lockInterface = m_physics->GetBodyLockInterfaceNoLock();
 
     const auto numActiveRigidBodies = m_physics->GetNumActiveBodies(JPH::EBodyType::RigidBody);
     const auto activeRigidBodies = m_physics->GetActiveBodiesUnsafe(JPH::EBodyType::RigidBody);
 
     for (uint32_t x = 0; x < numActiveRigidBodies; ++x)
     {
-        const auto bodyId = activeRigidBodies[x];
+        const JPH::Body* pBody = lockInterface.TryGetBody(activeRigidBodies[x]);
+        if (pBody == nullptr)
+        {
+            continue;
+        }
 
-        const auto it = m_bodyIdToPhysicsId.find(bodyId);
-        if (it == m_bodyIdToPhysicsId.cend())
+        const auto physicsId = PhysicsId((NCommon::IdTypeIntegral)pBody->GetUserData());
+        if (physicsId.id >= m_rigidBodies.size())
         {
-            m_pLogger->Error("PhysicsScene::MarkActiveBodiesDirty: Body exists that isn't tied to a physics id: {}", bodyId.GetIndexAndSequenceNumber());
+            m_pLogger->Error("JoltScene::UpdateBodiesFromSimulation: Body exists that isn't tied to a physics id: {}", pBody->GetID().GetIndexAndSequenceNumber());
             continue;
         }
 
-        auto& rigidBody = m_rigidBodies.at(it->second.id);
+        auto& rigidBody = m_rigidBodies[physicsId.id];
 
-        rigidBody.isDirty = true;
+        if (!rigidBody.isDirty)
+        {
+            rigidBody.isDirty = true;
+            m_dirtyBodies.push_back(physicsId);
+        }
 
-        JPH::Vec3 position{};
-        JPH::Quat orientation{};
-        bodyInterface.GetPositionAndRotation(bodyId, position, orientation);
-        rigidBody.data.position = FromJPH(position);
-        rigidBody.data.orientation = FromJPH(orientation);
-        rigidBody.data.linearVelocity = FromJPH(bodyInterface.GetLinearVelocity(bodyId));
+        rigidBody.data.position = FromJPH(pBody->GetPosition());
+        rigidBody.data.orientation = FromJPH(pBody->GetRotation());
+        rigidBody.data.linearVelocity = FromJPH(pBody->GetLinearVelocity());
     }
 
     m_pMetrics->SetCounterValue(METRIC_PHYSICS_NUM_ACTIVE_BODIES, numActiveRigidBodies);
@@ -110,16 +128,16 @@ void JoltScene::UpdateBodiesFromSimulation()
 
 void JoltScene::MarkBodiesSynced()
 {
-    for (auto& rigidBody : m_rigidBodies)
+    for (const auto& physicsId : m_dirtyBodies)
     {
-        rigidBody.isDirty = false;
+        m_rigidBodies[physicsId.id].isDirty = false;
     }
+
+    m_dirtyBodies.clear();
 }
 
-std::expected<PhysicsId, bool> JoltScene::CreateRigidBody(const RigidBodyData& data)
+std::expected<JPH::BodyCreationSettings, bool> JoltScene::GetBodyCreationSettings(const RigidBodyData& data) const
 {
-    JPH::BodyInterface& jphBodyInterface = m_physics->GetBodyInterface();
-
     JPH::EMotionType motionType{};
     switch (data.type)
     {
@@ -128,108 +146,30 @@ std::expected<PhysicsId, bool> JoltScene::CreateRigidBody(const RigidBodyData& d
         case RigidBodyType::Dynamic: motionType = JPH::EMotionType::Dynamic; break;
     }
 
-    JPH::ObjectLayer objectLayer{};
-    switch (data.type)
+    const auto broadPhaseLayer = GetBroadPhaseLayer(data.type, data.category, data.shape.usage);
+    const auto objectLayer = m_pObjectLayers->GetObjectLayer(broadPhaseLayer, data.collisionFilter);
+    if (!objectLayer)
     {
-        case RigidBodyType::Static: objectLayer = Layers::NON_MOVING; break;
-        case RigidBodyType::Kinematic: objectLayer = Layers::MOVING; break;
-        case RigidBodyType::Dynamic: objectLayer = Layers::MOVING; break;
-    }
-
-    JPH::EActivation activation{};
-    switch (data.type)
-    {
-        case RigidBodyType::Static: activation = JPH::EActivation::DontActivate; break;
-        case RigidBodyType::Kinematic: activation = JPH::EActivation::Activate; break;
-        case RigidBodyType::Dynamic: activation = JPH::EActivation::Activate; break;
+        m_pLogger->Error("JoltScene::GetBodyCreationSettings: Invalid collision filter or too many distinct collision filters, layer: {}", (unsigned int)data.collisionFilter.layer);
+        return std::unexpected(false);
     }
 
-    JPH::BodyID bodyId{};
-
     const glm::vec3 shapePosition = data.position + data.shape.localTransform;
     const glm::quat shapeOrientation = data.orientation * data.shape.localOrientation;
     const glm::vec3 shapeScale = data.scale * data.shape.localScale;
 
     //
-    // Create a Shape object for the body
+    // Fetch a (shared) Shape object for the body
     //
-    JPH::Ref<JPH::Shape> jphShape{};
-
-    if (std::holds_alternative<PhysicsBounds_Sphere>(data.shape.bounds))
-    {
-        const auto& sphereBounds = std::get<PhysicsBounds_Sphere>(data.shape.bounds);
-
-        // Spheres require uniform scaling
-        const bool scaleIsUniform = NCommon::AreEqual(shapeScale.x, shapeScale.y) && NCommon::AreEqual(shapeScale.y, shapeScale.z);
-        assert(scaleIsUniform);
-
-        const float radiusScaled = sphereBounds.radius * shapeScale.x;
-
-        jphShape = new JPH::SphereShape(radiusScaled);
-    }
-    else if (std::holds_alternative<PhysicsBounds_Box>(data.shape.bounds))
+    const auto shape = m_pShapeCache->GetShape(data.shape.bounds, shapeScale, data.type);
+    if (!shape)
     {
-        const auto& boxBounds = std::get<PhysicsBounds_Box>(data.shape.bounds);
-
-        const auto boxSize = (boxBounds.max - boxBounds.min) * shapeScale;
-        const auto boxSizeHalfExtents = boxSize / 2.0f;
-
-        jphShape = new JPH::BoxShape(ToJPH(boxSizeHalfExtents));
-    }
-    else if (std::holds_alternative<PhysicsBounds_HeightMap>(data.shape.bounds))
-    {
-        const auto& heightMapBounds = std::get<PhysicsBounds_HeightMap>(data.shape.bounds);
-
-        // Fetch the mesh's height map from resources
-        const auto pHeightMap = m_pResources->GetLoadedHeightMap(heightMapBounds.heightMapMeshId);
-        if (!pHeightMap)
-        {
-            m_pLogger->Error("JoltScene::CreateRigidBody: No such height map mesh exists: {}", heightMapBounds.heightMapMeshId.id);
-            return std::unexpected(false);
-        }
-
-        // Offset
-
-        // Offset by half the mesh's size so that the height field shape is centered around the center of the mesh; Jolt
-        // by default extends its shape in the +X and +Z directions whereas we create height fields meshes with points that
-        // are centered around the mesh's (local) origin
-        glm::vec3 joltOffset = {
-            (*pHeightMap)->meshSize_worldSpace.w / -2.0f,
-            0.0f,
-            (*pHeightMap)->meshSize_worldSpace.h / -2.0f,
-        };
-
-        // Scale the offsetting to account for shape scale
-        joltOffset *= shapeScale;
-
-        // Scale
-
-        // Jolt uses the data point's dimensions as x/z world coordinates, so we need to scale those coordinates so that
-        // they match the mesh's world-space size
-        const float worldSpaceToDataSizeRatio = (*pHeightMap)->meshSize_worldSpace.w / (float)((*pHeightMap)->heightMap->dataSize.w - 1);
-
-        glm::vec3 joltScale = {worldSpaceToDataSizeRatio, 1.0f, worldSpaceToDataSizeRatio};
-
-        // Also scale the jolt data coordinates by the shape's scale
-        joltScale *= shapeScale;
-
-        auto settings = JPH::HeightFieldShapeSettings(
-            (*pHeightMap)->heightMap->data.data(),
-            ToJPH(joltOffset),
-            ToJPH(joltScale),
-            (*pHeightMap)->heightMap->dataSize.w
-        );
-        settings.mMinHeightValue = (*pHeightMap)->heightMap->minValue;
-        settings.mMaxHeightValue = (*pHeightMap)->heightMap->maxValue;
-
-        jphShape = settings.Create().Get();
-    }
-    else
-    {
-        m_pLogger->Error("JoltScene::CreateRigidBody: Unsupported physics bounds type");
+        m_pLogger->Error("JoltScene::GetBodyCreationSettings: Failed to create shape for body");
         return std::unexpected(false);
     }
 
+    const JPH::Ref<JPH::Shape>& jphShape = *shape;
+
     //
     // Set body creation settings
     //
@@ -238,7 +178,7 @@ std::expected<PhysicsId, bool> JoltScene::CreateRigidBody(const RigidBodyData& d
         ToJPH(shapePosition),
         ToJPH(shapeOrientation),
         motionType,
-        objectLayer
+        *objectLayer
     );
 
     if (data.shape.usage == ShapeUsage::Trigger)
@@ -262,42 +202,131 @@ std::expected<PhysicsId, bool> JoltScene::CreateRigidBody(const RigidBodyData& d
     bodyCreationSettings.mFriction = data.shape.material.friction;
     bodyCreationSettings.mRestitution = data.shape.material.restitution;
 
-    //
-    // Create body
-    //
-    bodyId = jphBodyInterface.CreateAndAddBody(bodyCreationSettings, activation);
+    return bodyCreationSettings;
+}
+
+std::vector<std::expected<PhysicsId, bool>> JoltScene::CreateRigidBodies(std::span<const RigidBodyData> data)
+{
+    JPH::BodyInterface& jphBodyInterface = m_physics->GetBodyInterface();
+
+    std::vector<std::expected<PhysicsId, bool>> results;
+    results.reserve(data.size());
+
+    // Bodies are created individually but added to the broadphase together, in one batch for bodies
+    // which start active and one for those which don't, rather than via CreateAndAddBody, which
+    // modifies the broadphase tree for every body
+    m_batchBodyIds.clear();
+    m_batchActivateBodyIds.clear();
+
+    for (const auto& bodyData : data)
+    {
+        auto bodyCreationSettings = GetBodyCreationSettings(bodyData);
+        if (!bodyCreationSettings)
+        {
+            results.emplace_back(std::unexpected(false));
+            continue;
+        }
+
+        const PhysicsId physicsId = m_ids.GetId();
+        bodyCreationSettings->mUserData = (uint64_t)physicsId.id;
+
+        JPH::Body* pBody = jphBodyInterface.CreateBody(*bodyCreationSettings);
+        if (pBody == nullptr)
+        {
+            m_pLogger->Error("JoltScene::CreateRigidBodies: Failed to create body, max bodies reached");
+            m_ids.ReturnId(physicsId);
+            results.emplace_back(std::unexpected(false));
+            continue;
+        }
+
+        if (bodyData.type == RigidBodyType::Static)
+        {
+            m_batchBodyIds.push_back(pBody->GetID());
+        }
+        else
+        {
+            m_batchActivateBodyIds.push_back(pBody->GetID());
+        }
 
-    PhysicsId physicsId = m_ids.GetId();
-    jphBodyInterface.SetUserData(bodyId, (uint64_t)physicsId.id);
+        if (m_rigidBodies.size() < physicsId.id + 1)
+        {
+            m_rigidBodies.resize(physicsId.id + 1);
+            m_bodyIds.resize(physicsId.id + 1);
+        }
+        m_rigidBodies[physicsId.id] = RigidBody{.isDirty = false, .data = bodyData};
+        m_bodyIds[physicsId.id] = pBody->GetID();
+
+        const auto bodyIndex = pBody->GetID().GetIndex();
+        if (m_bodyIndexToPhysicsId.size() < bodyIndex + 1)
+        {
+            m_bodyIndexToPhysicsId.resize(bodyIndex + 1);
+        }
+        m_bodyIndexToPhysicsId[bodyIndex] = physicsId;
 
-    m_bodyIdToPhysicsId.insert({bodyId, physicsId});
-    m_physicsIdToBodyId.insert({physicsId, bodyId});
+        results.emplace_back(physicsId);
+    }
+
+    AddBodies(m_batchBodyIds, JPH::EActivation::DontActivate);
+    AddBodies(m_batchActivateBodyIds, JPH::EActivation::Activate);
+
+    return results;
+}
 
-    if (m_rigidBodies.size() < physicsId.id + 1)
+void JoltScene::AddBodies(std::vector<JPH::BodyID>& bodyIds, JPH::EActivation activation)
+{
+    if (bodyIds.empty())
     {
-        m_rigidBodies.resize(physicsId.id + 1);
+        return;
+    }
+
+    JPH::BodyInterface& jphBodyInterface = m_physics->GetBodyInterface();
+
+    const auto addState = jphBodyInterface.AddBodiesPrepare(bodyIds.data(), (int)bodyIds.size());
+    jphBodyInterface.AddBodiesFinalize(bodyIds.data(), (int)bodyIds.size(), addState, activation);
+}
+
+std::optional<JPH::BodyID> JoltScene::GetBodyId(PhysicsId physicsId) const
+{
+    if (physicsId.id >= m_bodyIds.size() || m_bodyIds[physicsId.id].IsInvalid())
+    {
+        return std::nullopt;
+    }
+
+    return m_bodyIds[physicsId.id];
+}
+
+std::optional<PhysicsId> JoltScene::GetPhysicsId(const JPH::BodyID& bodyId) const
+{
+    const auto bodyIndex = bodyId.GetIndex();
+    if (bodyIndex >= m_bodyIndexToPhysicsId.size())
+    {
+        return std::nullopt;
+    }
+
+    // Body indices are re-used by Jolt, so verify the body at the index is the same body (sequence number)
+    const auto physicsId = m_bodyIndexToPhysicsId[bodyIndex];
+    if (!physicsId.IsValid() || m_bodyIds[physicsId.id] != bodyId)
+    {
+        return std::nullopt;
     }
-    m_rigidBodies.at(physicsId.id) = RigidBody{.isDirty = false, .data = data};
 
     return physicsId;
 }
 
 void JoltScene::UpdateRigidBody(PhysicsId physicsId, const RigidBodyData& data)
 {
-    const auto it = m_physicsIdToBodyId.find(physicsId);
-    if (it == m_physicsIdToBodyId.cend())
+    const auto bodyId = GetBodyId(physicsId);
+    if (!bodyId)
     {
         m_pLogger->Error("JoltScene::UpdateRigidBody: No such physics body exists: {}", physicsId.id);
         return;
     }
 
-    const auto& bodyId = it->second;
-
     JPH::BodyInterface& jphBodyInterface = m_physics->GetBodyInterface();
 
-    jphBodyInterface.SetPositionAndRotation(bodyId, ToJPH(data.position), ToJPH(data.orientation), JPH::EActivation::Activate);
+    jphBodyInterface.SetPositionAndRotation(*bodyId, ToJPH(data.position), ToJPH(data.orientation), JPH::EActivation::Activate);
 
-    if (data.linearVelocity) { jphBodyInterface.SetLinearVelocity(bodyId, ToJPH(*data.linearVelocity)); }
+    if (data.linearVelocity) { jphBodyInterface.SetLinearVelocity(*bodyId, ToJPH(*data.linearVelocity)); }
 }
 
 std::optional<const RigidBody*> JoltScene::GetRigidBody(PhysicsId physicsId) const
@@ -310,26 +339,36 @@ std::optional<const RigidBody*> JoltScene::GetRigidBody(PhysicsId physicsId) con
     return &m_rigidBodies.at(physicsId.id);
 }
 
-void JoltScene::DestroyRigidBody(PhysicsId physicsId)
+void JoltScene::DestroyRigidBodies(std::span<const PhysicsId> physicsIds)
 {
-    const auto it = m_physicsIdToBodyId.find(physicsId);
-    if (it == m_physicsIdToBodyId.cend())
+    m_batchBodyIds.clear();
+
+    for (const auto& physicsId : physicsIds)
     {
-        m_pLogger->Warning("JoltScene::DestroyRigidBody: Asked to destroy rigid body which doesn't exist: {}", physicsId.id);
-        return;
-    }
+        const auto bodyId = GetBodyId(physicsId);
+        if (!bodyId)
+        {
+            m_pLogger->Warning("JoltScene::DestroyRigidBodies: Asked to destroy rigid body which doesn't exist: {}", physicsId.id);
+            continue;
+        }
 
-    const auto bodyId = it->second;
+        m_batchBodyIds.push_back(*bodyId);
 
-    JPH::BodyInterface& jphBodyInterface = m_physics->GetBodyInterface();
-    jphBodyInterface.RemoveBody(bodyId);
-    jphBodyInterface.DestroyBody(bodyId);
+        m_bodyIndexToPhysicsId[bodyId->GetIndex()] = {};
+        m_bodyIds[physicsId.id] = JPH::BodyID{};
+        m_rigidBodies[physicsId.id] = {};
 
-    m_bodyIdToPhysicsId.erase(bodyId);
-    m_physicsIdToBodyId.erase(it);
-    m_rigidBodies.at(physicsId.id) = {};
+        m_ids.ReturnId(physicsId);
+    }
+
+    if (m_batchBodyIds.empty())
+    {
+        return;
+    }
 
-    m_ids.ReturnId(physicsId);
+    JPH::BodyInterface& jphBodyInterface = m_physics->GetBodyInterface();
+    jphBodyInterface.RemoveBodies(m_batchBodyIds.data(), (int)m_batchBodyIds.size());
+    jphBodyInterface.DestroyBodies(m_batchBodyIds.data(), (int)m_batchBodyIds.size());
 }
 
 std::expected<ICharacterController*, bool> JoltScene::CreateCharacterController(const std::string& name, const CharacterControllerParams& params)
@@ -340,11 +379,16 @@ std::expected<ICharacterController*, bool> JoltScene::CreateCharacterController(
         return std::unexpected(false);
     }
 
-    auto joltCharacterController = JoltCharacterController::Create(m_physics.get(), params);
+    auto joltCharacterController = JoltCharacterController::Create(m_physics.get(), m_pObjectLayers, params);
+    if (!joltCharacterController)
+    {
+        m_pLogger->Error("JoltScene::CreateCharacterController: Invalid collision filter or too many distinct collision filters: {}", name);
+        return std::unexpected(false);
+    }
 
-    auto pCharacterController = joltCharacterController.get();
+    auto pCharacterController = joltCharacterController->get();
 
-    m_characterControllers.insert({name, std::move(joltCharacterController)});
+    m_characterControllers.insert({name, std::move(*joltCharacterController)});
 
     return pCharacterController;
 }
@@ -398,21 +442,451 @@ void JoltScene::OnContactAdded(const JPH::Body& inBody1, const JPH::Body& inBody
 
 void JoltScene::OnContactRemoved(const JPH::SubShapeIDPair& inSubShapePair)
 {
-    const auto it1 = m_bodyIdToPhysicsId.find(inSubShapePair.GetBody1ID());
-    if (it1 == m_bodyIdToPhysicsId.cend()) { return; }
+    const auto physicsId1 = GetPhysicsId(inSubShapePair.GetBody1ID());
+    if (!physicsId1) { return; }
 
-    const auto it2 = m_bodyIdToPhysicsId.find(inSubShapePair.GetBody2ID());
-    if (it2 == m_bodyIdToPhysicsId.cend()) { return; }
+    const auto physicsId2 = GetPhysicsId(inSubShapePair.GetBody2ID());
+    if (!physicsId2) { return; }
 
     std::lock_guard<std::mutex> lock(m_contactsMutex);
 
     m_contacts.push_back(PhysicsContact{
-        .body1 = it1->second,
-        .body2 = it2->second,
+        .body1 = *physicsId1,
+        .body2 = *physicsId2,
         .details = {
             .type = ContactType::Removed
         }
     });
 }
 
+//
+// Queries
+//
+
+// Queries below this count are run inline on the calling thread, as the cost of dispatching
+// jobs would outweigh the cost of the queries themselves
+static constexpr std::size_t QUERIES_PER_JOB = 32;
+
+class QueryBroadPhaseLayerFilter : public JPH::BroadPhaseLayerFilter
+{
+    public:
+
+        explicit QueryBroadPhaseLayerFilter(const PhysicsQueryFilter& filter)
+            : m_filter(filter)
+        { }
+
+        [[nodiscard]] bool ShouldCollide(JPH::BroadPhaseLayer inLayer) const override
+        {
+            return m_filter.includeTriggers || inLayer != BroadPhaseLayers::SENSOR;
+        }
+
+    private:
+
+        const PhysicsQueryFilter& m_filter;
+};
+
+class QueryObjectLayerFilter : public JPH::ObjectLayerFilter
+{
+    public:
+
+        QueryObjectLayerFilter(const JoltObjectLayers* pObjectLayers, const PhysicsQueryFilter& filter)
+            : m_pObjectLayers(pObjectLayers)
+            , m_filter(filter)
+        { }
+
+        [[nodiscard]] bool ShouldCollide(JPH::ObjectLayer inLayer) const override
+        {
+            const auto& info = m_pObjectLayers->GetObjectLayerInfo(inLayer);
+
+            if (!m_filter.includeTriggers && info.broadPhaseLayer == BroadPhaseLayers::SENSOR)
+            {
+                return false;
+            }
+
+            return (m_filter.layerMask & (1U << info.collisionFilter.layer)) != 0;
+        }
+
+    private:
+
+        const JoltObjectLayers* m_pObjectLayers;
+        const PhysicsQueryFilter& m_filter;
+};
+
+class QueryBodyFilter : public JPH::BodyFilter
+{
+    public:
+
+        QueryBodyFilter(const std::vector<RigidBody>* pRigidBodies, const PhysicsQueryFilter& filter)
+            : m_pRigidBodies(pRigidBodies)
+            , m_filter(filter)
+        { }
+
+        [[nodiscard]] bool ShouldCollideLocked(const JPH::Body& inBody) const override
+        {
+            if (!m_filter.ignoreEntity)
+            {
+                return true;
+            }
+
+            const auto physicsIdIndex = (std::size_t)inBody.GetUserData();
+            if (physicsIdIndex >= m_pRigidBodies->size())
+            {
+                return true;
+            }
+
+            return (*m_pRigidBodies)[physicsIdIndex].data.entity != m_filter.ignoreEntity;
+        }
+
+    private:
+
+        const std::vector<RigidBody>* m_pRigidBodies;
+        const PhysicsQueryFilter& m_filter;
+};
+
+// Whether Jolt can build a shape from the query shape; zero, negative, and NaN sizes are rejected
+static bool IsValidQueryShape(const PhysicsQueryShape& shape)
+{
+    return std::visit([](const auto& s) -> bool {
+        using T = std::decay_t<decltype(s)>;
+
+        if constexpr (std::is_same_v<T, PhysicsQueryShape_Sphere>)
+        {
+            return s.radius > 0.0f;
+        }
+        else if constexpr (std::is_same_v<T, PhysicsQueryShape_Box>)
+        {
+            return s.halfExtents.x > 0.0f && s.halfExtents.y > 0.0f && s.halfExtents.z > 0.0f;
+        }
+        else if constexpr (std::is_same_v<T, PhysicsQueryShape_Capsule>)
+        {
+            return s.radius > 0.0f && s.height > (s.radius * 2.0f);
+        }
+    }, shape);
+}
+
+static JPH::Ref<JPH::Shape> CreateQueryShape(const PhysicsQueryShape& shape)
+{
+    return std::visit([](const auto& s) -> JPH::Ref<JPH::Shape> {
+        using T = std::decay_t<decltype(s)>;
+
+        if constexpr (std::is_same_v<T, PhysicsQueryShape_Sphere>)
+        {
+            return new JPH::SphereShape(s.radius);
+        }
+        else if constexpr (std::is_same_v<T, PhysicsQueryShape_Box>)
+        {
+            // Convex radius can't exceed the box's smallest half extent
+            const float minHalfExtent = std::min({s.halfExtents.x, s.halfExtents.y, s.halfExtents.z});
+            return new JPH::BoxShape(ToJPH(s.halfExtents), std::min(JPH::cDefaultConvexRadius, minHalfExtent));
+        }
+        else if constexpr (std::is_same_v<T, PhysicsQueryShape_Capsule>)
+        {
+            const float halfHeightOfCylinder = (s.height / 2.0f) - s.radius;
+            return new JPH::CapsuleShape(halfHeightOfCylinder, s.radius);
+        }
+    }, shape);
+}
+
+/**
+ * Runs queryFunc for each of the queries, writing into the corresponding entry of results. Spreads
+ * the queries out across the job system in chunks when there's enough of them to be worth it.
+ */
+template <typename Query, typename QueryFunc>
+static void RunQueries(JPH::JobSystem* pJobSystem,
+                       std::span<const Query> queries,
+                       std::vector<PhysicsQueryResult>& results,
+                       const QueryFunc& queryFunc)
+{
+    const auto runRange = [&](std::size_t begin, std::size_t end){
+        for (std::size_t x = begin; x < end; ++x)
+        {
+            results[x] = queryFunc(queries[x]);
+        }
+    };
+
+    if (pJobSystem == nullptr || queries.size() <= QUERIES_PER_JOB || pJobSystem->GetMaxConcurrency() <= 1)
+    {
+        runRange(0, queries.size());
+        return;
+    }
+
+    const std::size_t maxJobs = (std::size_t)pJobSystem->GetMaxConcurrency() * 4;
+    const std::size_t numJobs = std::min(maxJobs, (queries.size() + QUERIES_PER_JOB - 1) / QUERIES_PER_JOB);
+    const std::size_t queriesPerJob = (queries.size() + numJobs - 1) / numJobs;
+
+    JPH::JobSystem::Barrier* pBarrier = pJobSystem->CreateBarrier();
+
+    for (std::size_t job = 0; job < numJobs; ++job)
+    {
+        const std::size_t begin = job * queriesPerJob;
+        const std::size_t end = std::min(begin + queriesPerJob, queries.size());
+        if (begin >= end) { break; }
+
+        auto handle = pJobSystem->CreateJob("PhysicsQuery", JPH::Color::sGreen, [=](){ runRange(begin, end); });
+        pBarrier->AddJob(handle);
+    }
+
+    pJobSystem->WaitForJobs(pBarrier);
+    pJobSystem->DestroyBarrier(pBarrier);
+}
+
+std::vector<PhysicsQueryResult> JoltScene::RayCast(JPH::JobSystem* pJobSystem, std::span<const RayCastQuery> queries) const
+{
+    std::vector<PhysicsQueryResult> results(queries.size());
+    RunQueries(pJobSystem, queries, results, [this](const RayCastQuery& query){ return RunRayCast(query); });
+    return results;
+}
+
+std::vector<PhysicsQueryResult> JoltScene::ShapeCast(JPH::JobSystem* pJobSystem, std::span<const ShapeCastQuery> queries) const
+{
+    std::vector<PhysicsQueryResult> results(queries.size());
+    RunQueries(pJobSystem, queries, results, [this](const ShapeCastQuery& query){ return RunShapeCast(query); });
+    return results;
+}
+
+std::vector<PhysicsQueryResult> JoltScene::Overlap(JPH::JobSystem* pJobSystem, std::span<const OverlapQuery> queries) const
+{
+    std::vector<PhysicsQueryResult> results(queries.size());
+    RunQueries(pJobSystem, queries, results, [this](const OverlapQuery& query){ return RunOverlap(query); });
+    return results;
+}
+
+std::optional<EntityId> JoltScene::GetBodyEntity(const JPH::Body& body) const
+{
+    const auto physicsIdIndex = (std::size_t)body.GetUserData();
+    if (physicsIdIndex >= m_rigidBodies.size())
+    {
+        return std::nullopt;
+    }
+
+    return m_rigidBodies[physicsIdIndex].data.entity;
+}
+
+PhysicsQueryResult JoltScene::RunRayCast(const RayCastQuery& query) const
+{
+    const JPH::RRayCast ray(ToJPH(query.origin_worldSpace), ToJPH(query.direction_worldSpace * query.distance));
+
+    const QueryBroadPhaseLayerFilter broadPhaseLayerFilter(query.filter);
+    const QueryObjectLayerFilter objectLayerFilter(m_pObjectLayers, query.filter);
+    const QueryBodyFilter bodyFilter(&m_rigidBodies, query.filter);
+
+    const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_physics->GetNarrowPhaseQuery();
+
+    std::vector<JPH::RayCastResult> rayHits;
+
+    switch (query.mode)
+    {
+        case PhysicsQueryMode::Closest:
+        {
+            JPH::RayCastResult hit;
+            if (narrowPhaseQuery.CastRay(ray, hit, broadPhaseLayerFilter, objectLayerFilter, bodyFilter))
+            {
+                rayHits.push_back(hit);
+            }
+        }
+        break;
+        case PhysicsQueryMode::Any:
+        {
+            JPH::AnyHitCollisionCollector<JPH::CastRayCollector> collector;
+            narrowPhaseQuery.CastRay(ray, JPH::RayCastSettings{}, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            if (collector.HadHit()) { rayHits.push_back(collector.mHit); }
+        }
+        break;
+        case PhysicsQueryMode::All:
+        {
+            JPH::AllHitCollisionCollector<JPH::CastRayCollector> collector;
+            narrowPhaseQuery.CastRay(ray, JPH::RayCastSettings{}, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            collector.Sort();
+            rayHits.assign(collector.mHits.begin(), collector.mHits.end());
+        }
+        break;
+    }
+
+    PhysicsQueryResult result{};
+    result.hits.reserve(rayHits.size());
+
+    const JPH::BodyLockInterface& lockInterface = m_physics->GetBodyLockInterface();
+
+    for (const auto& rayHit : rayHits)
+    {
+        const JPH::BodyLockRead lock(lockInterface, rayHit.mBodyID);
+        if (!lock.Succeeded()) { continue; }
+
+        const JPH::Body& body = lock.GetBody();
+
+        const auto entity = GetBodyEntity(body);
+        if (!entity) { continue; }
+
+        const auto hitPoint = ray.GetPointOnRay(rayHit.mFraction);
+
+        result.hits.push_back(PhysicsQueryHit{
+            .entity = *entity,
+            .distance = rayHit.mFraction * query.distance,
+            .point_worldSpace = FromJPH(hitPoint),
+            .normal_worldSpace = FromJPH(body.GetWorldSpaceSurfaceNormal(rayHit.mSubShapeID2, hitPoint))
+        });
+    }
+
+    return result;
+}
+
+PhysicsQueryResult JoltScene::RunShapeCast(const ShapeCastQuery& query) const
+{
+    if (!IsValidQueryShape(query.shape))
+    {
+        m_pLogger->Warning("JoltScene::RunShapeCast: Query shape has an invalid size, ignoring");
+        return {};
+    }
+
+    const auto shape = CreateQueryShape(query.shape);
+
+    const auto shapeCast = JPH::RShapeCast::sFromWorldTransform(
+        shape,
+        JPH::Vec3::sReplicate(1.0f),
+        JPH::RMat44::sRotationTranslation(ToJPH(query.orientation_worldSpace), ToJPH(query.position_worldSpace)),
+        ToJPH(query.direction_worldSpace * query.distance)
+    );
+
+    JPH::ShapeCastSettings shapeCastSettings{};
+    shapeCastSettings.mReturnDeepestPoint = true;
+
+    const QueryBroadPhaseLayerFilter broadPhaseLayerFilter(query.filter);
+    const QueryObjectLayerFilter objectLayerFilter(m_pObjectLayers, query.filter);
+    const QueryBodyFilter bodyFilter(&m_rigidBodies, query.filter);
+
+    const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_physics->GetNarrowPhaseQuery();
+    const JPH::RVec3 baseOffset = shapeCast.mCenterOfMassStart.GetTranslation();
+
+    std::vector<JPH::ShapeCastResult> castHits;
+
+    switch (query.mode)
+    {
+        case PhysicsQueryMode::Closest:
+        {
+            JPH::ClosestHitCollisionCollector<JPH::CastShapeCollector> collector;
+            narrowPhaseQuery.CastShape(shapeCast, shapeCastSettings, baseOffset, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            if (collector.HadHit()) { castHits.push_back(collector.mHit); }
+        }
+        break;
+        case PhysicsQueryMode::Any:
+        {
+            JPH::AnyHitCollisionCollector<JPH::CastShapeCollector> collector;
+            narrowPhaseQuery.CastShape(shapeCast, shapeCastSettings, baseOffset, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            if (collector.HadHit()) { castHits.push_back(collector.mHit); }
+        }
+        break;
+        case PhysicsQueryMode::All:
+        {
+            JPH::AllHitCollisionCollector<JPH::CastShapeCollector> collector;
+            narrowPhaseQuery.CastShape(shapeCast, shapeCastSettings, baseOffset, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            collector.Sort();
+            castHits.assign(collector.mHits.begin(), collector.mHits.end());
+        }
+        break;
+    }
+
+    PhysicsQueryResult result{};
+    result.hits.reserve(castHits.size());
+
+    const JPH::BodyLockInterface& lockInterface = m_physics->GetBodyLockInterface();
+
+    for (const auto& castHit : castHits)
+    {
+        const JPH::BodyLockRead lock(lockInterface, castHit.mBodyID2);
+        if (!lock.Succeeded()) { continue; }
+
+        const auto entity = GetBodyEntity(lock.GetBody());
+        if (!entity) { continue; }
+
+        result.hits.push_back(PhysicsQueryHit{
+            .entity = *entity,
+            .distance = castHit.mFraction * query.distance,
+            .point_worldSpace = FromJPH(baseOffset + castHit.mContactPointOn2),
+            .normal_worldSpace = FromJPH(-castHit.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero()))
+        });
+    }
+
+    return result;
+}
+
+PhysicsQueryResult JoltScene::RunOverlap(const OverlapQuery& query) const
+{
+    if (!IsValidQueryShape(query.shape))
+    {
+        m_pLogger->Warning("JoltScene::RunOverlap: Query shape has an invalid size, ignoring");
+        return {};
+    }
+
+    const auto shape = CreateQueryShape(query.shape);
+
+    const auto shapeTransform = JPH::RMat44::sRotationTranslation(ToJPH(query.orientation_worldSpace), ToJPH(query.position_worldSpace));
+
+    JPH::CollideShapeSettings collideShapeSettings{};
+
+    const QueryBroadPhaseLayerFilter broadPhaseLayerFilter(query.filter);
+    const QueryObjectLayerFilter objectLayerFilter(m_pObjectLayers, query.filter);
+    const QueryBodyFilter bodyFilter(&m_rigidBodies, query.filter);
+
+    const JPH::NarrowPhaseQuery& narrowPhaseQuery = m_physics->GetNarrowPhaseQuery();
+    const JPH::RVec3 baseOffset = shapeTransform.GetTranslation();
+
+    std::vector<JPH::CollideShapeResult> collideHits;
+
+    switch (query.mode)
+    {
+        case PhysicsQueryMode::Closest:
+        {
+            JPH::ClosestHitCollisionCollector<JPH::CollideShapeCollector> collector;
+            narrowPhaseQuery.CollideShape(shape, JPH::Vec3::sReplicate(1.0f), shapeTransform, collideShapeSettings, baseOffset, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            if (collector.HadHit()) { collideHits.push_back(collector.mHit); }
+        }
+        break;
+        case PhysicsQueryMode::Any:
+        {
+            JPH::AnyHitCollisionCollector<JPH::CollideShapeCollector> collector;
+            narrowPhaseQuery.CollideShape(shape, JPH::Vec3::sReplicate(1.0f), shapeTransform, collideShapeSettings, baseOffset, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            if (collector.HadHit()) { collideHits.push_back(collector.mHit); }
+        }
+        break;
+        case PhysicsQueryMode::All:
+        {
+            JPH::AllHitCollisionCollector<JPH::CollideShapeCollector> collector;
+            narrowPhaseQuery.CollideShape(shape, JPH::Vec3::sReplicate(1.0f), shapeTransform, collideShapeSettings, baseOffset, collector, broadPhaseLayerFilter, objectLayerFilter, bodyFilter);
+            collector.Sort();
+            collideHits.assign(collector.mHits.begin(), collector.mHits.end());
+        }
+        break;
+    }
+
+    PhysicsQueryResult result{};
+    result.hits.reserve(collideHits.size());
+
+    const JPH::BodyLockInterface& lockInterface = m_physics->GetBodyLockInterface();
+
+    for (const auto& collideHit : collideHits)
+    {
+        const JPH::BodyLockRead lock(lockInterface, collideHit.mBodyID2);
+        if (!lock.Succeeded()) { continue; }
+
+        const auto entity = GetBodyEntity(lock.GetBody());
+        if (!entity) { continue; }
+
+        // A shape can overlap multiple sub shapes of the same body; only report the deepest
+        // (first, post-sort) overlap per entity
+        const bool alreadyReported = std::ranges::any_of(result.hits, [&](const PhysicsQueryHit& hit){
+            return hit.entity == *entity;
+        });
+        if (alreadyReported) { continue; }
+
+        result.hits.push_back(PhysicsQueryHit{
+            .entity = *entity,
+            .distance = 0.0f,
+            .point_worldSpace = FromJPH(baseOffset + collideHit.mContactPointOn2),
+            .normal_worldSpace = FromJPH(-collideHit.mPenetrationAxis.NormalizedOr(JPH::Vec3::sZero()))
+        });
+    }
+
+    return result;
+}
+
 }
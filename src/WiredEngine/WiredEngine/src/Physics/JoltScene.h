@@ -10,12 +10,15 @@
 #include "PhysicsInternal.h"
 
 #include <Wired/Engine/Physics/ICharacterController.h>
+#include <Wired/Engine/Physics/PhysicsQuery.h>
 
 #include <Wired/Engine/World/WorldCommon.h>
 
 #include <Jolt/Jolt.h>
 #include <Jolt/Core/Reference.h>
 #include <Jolt/Physics/Body/BodyID.h>
+#include <Jolt/Physics/Body/BodyCreationSettings.h>
+#include <Jolt/Physics/EActivation.h>
 #include <Jolt/Physics/Collision/ContactListener.h>
 
 #include <NEON/Common/IdSource.h>
@@ -24,9 +27,12 @@
 #include <optional>
 #include <unordered_map>
 #include <expected>
+#include <span>
+#include <vector>
 
 namespace JPH
 {
+    class Body;
     class PhysicsSystem;
     class TempAllocator;
     class JobSystem;
@@ -41,26 +47,28 @@ namespace NCommon
 
 namespace Wired::Engine
 {
-    class Resources;
+    class JoltShapeCache;
+    class JoltObjectLayers;
     class JoltCharacterController;
 
     class JoltScene : public JPH::ContactListener
     {
         public:
 
-            JoltScene(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, const Resources* pResources, std::unique_ptr<JPH::PhysicsSystem> physics);
+            JoltScene(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, JoltShapeCache* pShapeCache, JoltObjectLayers* pObjectLayers, std::unique_ptr<JPH::PhysicsSystem> physics);
             ~JoltScene();
 
             void Destroy();
 
             void Update(float inDeltaTime, int inCollisionSteps, JPH::JobSystem *inJobSystem);
 
-            [[nodiscard]] std::expected<PhysicsId, bool> CreateRigidBody(const RigidBodyData& data);
+            [[nodiscard]] std::vector<std::expected<PhysicsId, bool>> CreateRigidBodies(std::span<const RigidBodyData> data);
             void UpdateRigidBody(PhysicsId physicsId, const RigidBodyData& data);
             [[nodiscard]] std::optional<const RigidBody*> GetRigidBody(PhysicsId physicsId) const;
-            void DestroyRigidBody(PhysicsId physicsId);
+            void DestroyRigidBodies(std::span<const PhysicsId> physicsIds);
 
             void UpdateBodiesFromSimulation();
+            [[nodiscard]] std::span<const PhysicsId> GetDirtyBodies() const noexcept { return m_dirtyBodies; }
             void MarkBodiesSynced();
 
             [[nodiscard]] std::expected<ICharacterController*, bool> CreateCharacterController(const std::string& name, const CharacterControllerParams& params);
@@ -68,26 +76,58 @@ namespace Wired::Engine
 
             [[nodiscard]] std::vector<PhysicsContact> PopContacts();
 
+            //
+            // Queries
+            //
+            [[nodiscard]] std::vector<PhysicsQueryResult> RayCast(JPH::JobSystem* pJobSystem, std::span<const RayCastQuery> queries) const;
+            [[nodiscard]] std::vector<PhysicsQueryResult> ShapeCast(JPH::JobSystem* pJobSystem, std::span<const ShapeCastQuery> queries) const;
+            [[nodiscard]] std::vector<PhysicsQueryResult> Overlap(JPH::JobSystem* pJobSystem, std::span<const OverlapQuery> queries) const;
+
             //
             // ContactListener
             //
             void OnContactAdded(const JPH::Body& inBody1, const JPH::Body& inBody2, const JPH::ContactManifold&, JPH::ContactSettings&) override;
             void OnContactRemoved(const JPH::SubShapeIDPair& inSubShapePair) override;
 
+        private:
+
+            [[nodiscard]] std::expected<JPH::BodyCreationSettings, bool> GetBodyCreationSettings(const RigidBodyData& data) const;
+            [[nodiscard]] std::optional<JPH::BodyID> GetBodyId(PhysicsId physicsId) const;
+            [[nodiscard]] std::optional<PhysicsId> GetPhysicsId(const JPH::BodyID& bodyId) const;
+            void AddBodies(std::vector<JPH::BodyID>& bodyIds, JPH::EActivation activation);
+
+            [[nodiscard]] PhysicsQueryResult RunRayCast(const RayCastQuery& query) const;
+            [[nodiscard]] PhysicsQueryResult RunShapeCast(const ShapeCastQuery& query) const;
+            [[nodiscard]] PhysicsQueryResult RunOverlap(const OverlapQuery& query) const;
+            [[nodiscard]] std::optional<EntityId> GetBodyEntity(const JPH::Body& body) const;
+
         private:
 
             NCommon::ILogger* m_pLogger;
             NCommon::IMetrics* m_pMetrics;
-            const Resources* m_pResources;
+            JoltShapeCache* m_pShapeCache;
+            JoltObjectLayers* m_pObjectLayers;
             std::unique_ptr<JPH::TempAllocator> m_tempAllocator;
             std::unique_ptr<JPH::PhysicsSystem> m_physics;
 
             NCommon::IdSource<PhysicsId> m_ids;
 
-            std::unordered_map<JPH::BodyID, PhysicsId> m_bodyIdToPhysicsId;
-            std::unordered_map<PhysicsId, JPH::BodyID> m_physicsIdToBodyId;
+            // Indexed by physics id. (Body ids are mapped back to physics ids via body user data)
+            std::vector<JPH::BodyID> m_bodyIds;
             std::vector<RigidBody> m_rigidBodies;
 
+            // Jolt body index -> physics id. Needed for contact removal callbacks, which only provide body
+            // ids. Entries are cleared when a body is destroyed, so removals involving destroyed bodies are
+            // dropped (PhysicsSystem has forgotten their entities by then anyway).
+            std::vector<PhysicsId> m_bodyIndexToPhysicsId;
+
+            // Bodies marked dirty by the simulation since the last MarkBodiesSynced call
+            std::vector<PhysicsId> m_dirtyBodies;
+
+            // Scratch space re-used across batched body adds/removes
+            std::vector<JPH::BodyID> m_batchBodyIds;
+            std::vector<JPH::BodyID> m_batchActivateBodyIds;
+
             std::unordered_map<std::string, std::unique_ptr<JoltCharacterController>> m_characterControllers;
 
             std::vector<PhysicsContact> m_contacts;
@@ -0,0 +1,286 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "JoltShapeCache.h"
+#include "JoltCommon.h"
+#include "ModelCollision.h"
+
+#include "../Resources.h"
+
+#include <Wired/Engine/Metrics.h>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/Shape/BoxShape.h>
+#include <Jolt/Physics/Collision/Shape/SphereShape.h>
+#include <Jolt/Physics/Collision/Shape/HeightFieldShape.h>
+#include <Jolt/Physics/Collision/Shape/ScaledShape.h>
+
+#include <NEON/Common/Compare.h>
+#include <NEON/Common/Hash.h>
+#include <NEON/Common/Log/ILogger.h>
+#include <NEON/Common/Metrics/IMetrics.h>
+
+#include <algorithm>
+#include <cassert>
+
+namespace Wired::Engine
+{
+
+// Minimum number of cached shapes before unused shapes are purged from the cache
+static constexpr std::size_t MIN_PURGE_THRESHOLD = 256;
+
+std::size_t JoltShapeCache::ShapeKeyHash::operator()(const ShapeKey& key) const
+{
+    return NCommon::Hash(
+        static_cast<int>(key.kind),
+        key.pSource,
+        key.params.x, key.params.y, key.params.z,
+        key.scale.x, key.scale.y, key.scale.z
+    );
+}
+
+JoltShapeCache::JoltShapeCache(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, const Resources* pResources)
+    : m_pLogger(pLogger)
+    , m_pMetrics(pMetrics)
+    , m_pResources(pResources)
+    , m_purgeThreshold(MIN_PURGE_THRESHOLD)
+{
+
+}
+
+JoltShapeCache::~JoltShapeCache()
+{
+    m_pLogger = nullptr;
+    m_pMetrics = nullptr;
+    m_pResources = nullptr;
+}
+
+void JoltShapeCache::Clear()
+{
+    m_shapes.clear();
+    m_purgeThreshold = MIN_PURGE_THRESHOLD;
+
+    m_pMetrics->SetCounterValue(METRIC_PHYSICS_NUM_CACHED_SHAPES, 0);
+}
+
+std::expected<JPH::Ref<JPH::Shape>, bool> JoltShapeCache::GetShape(const PhysicsBoundsVariant& bounds,
+                                                                  const glm::vec3& scale,
+                                                                  RigidBodyType bodyType)
+{
+    ShapeKey key{};
+    std::shared_ptr<const void> source;
+
+    //
+    // Determine the key which identifies the shape that the bounds require. Primitive shapes have
+    // their scale baked into their dimensions, which maximizes sharing between differently scaled
+    // bodies which end up the same size.
+    //
+    if (std::holds_alternative<PhysicsBounds_Sphere>(bounds))
+    {
+        const auto& sphereBounds = std::get<PhysicsBounds_Sphere>(bounds);
+
+        // Spheres require uniform scaling
+        const bool scaleIsUniform = NCommon::AreEqual(scale.x, scale.y) && NCommon::AreEqual(scale.y, scale.z);
+        assert(scaleIsUniform); (void)scaleIsUniform;
+
+        key.kind = ShapeKind::Sphere;
+        key.params = {sphereBounds.radius * scale.x, 0.0f, 0.0f};
+    }
+    else if (std::holds_alternative<PhysicsBounds_Box>(bounds))
+    {
+        const auto& boxBounds = std::get<PhysicsBounds_Box>(bounds);
+
+        key.kind = ShapeKind::Box;
+        key.params = ((boxBounds.max - boxBounds.min) * scale) / 2.0f;
+    }
+    else if (std::holds_alternative<PhysicsBounds_HeightMap>(bounds))
+    {
+        const auto& heightMapBounds = std::get<PhysicsBounds_HeightMap>(bounds);
+
+        const auto pHeightMap = m_pResources->GetLoadedHeightMap(heightMapBounds.heightMapMeshId);
+        if (!pHeightMap)
+        {
+            m_pLogger->Error("JoltShapeCache::GetShape: No such height map mesh exists: {}", heightMapBounds.heightMapMeshId.id);
+            return std::unexpected(false);
+        }
+
+        source = (*pHeightMap)->heightMap;
+
+        key.kind = ShapeKind::HeightMap;
+        key.pSource = source.get();
+        key.params = {(*pHeightMap)->meshSize_worldSpace.w, (*pHeightMap)->meshSize_worldSpace.h, 0.0f};
+        key.scale = scale;
+    }
+    else if (std::holds_alternative<PhysicsBounds_ConvexHull>(bounds) ||
+             std::holds_alternative<PhysicsBounds_TriangleMesh>(bounds))
+    {
+        const bool isTriangleMesh = std::holds_alternative<PhysicsBounds_TriangleMesh>(bounds);
+
+        const ModelId modelId = isTriangleMesh ? std::get<PhysicsBounds_TriangleMesh>(bounds).modelId :
+                                                 std::get<PhysicsBounds_ConvexHull>(bounds).modelId;
+
+        // Jolt mesh shapes can't be used as dynamic bodies, as they have no volume to simulate
+        if (isTriangleMesh && bodyType == RigidBodyType::Dynamic)
+        {
+            m_pLogger->Error("JoltShapeCache::GetShape: Triangle mesh bounds can't be used for dynamic bodies: {}", modelId.id);
+            return std::unexpected(false);
+        }
+
+        const auto pLoadedModel = m_pResources->GetLoadedModel(modelId);
+        if (!pLoadedModel)
+        {
+            m_pLogger->Error("JoltShapeCache::GetShape: No such model exists: {}", modelId.id);
+            return std::unexpected(false);
+        }
+
+        source = (*pLoadedModel)->collision;
+
+        key.kind = isTriangleMesh ? ShapeKind::TriangleMesh : ShapeKind::ConvexHull;
+        key.pSource = source.get();
+        key.scale = scale;
+    }
+    else
+    {
+        m_pLogger->Error("JoltShapeCache::GetShape: Unsupported physics bounds type");
+        return std::unexpected(false);
+    }
+
+    //
+    // Return the cached shape, if there is one. If the entry refers to a resource which has since
+    // been destroyed then it's stale and the shape is re-created.
+    //
+    const auto it = m_shapes.find(key);
+    if (it != m_shapes.cend() && (source == nullptr || !it->second.source.expired()))
+    {
+        return it->second.shape;
+    }
+
+    //
+    // Otherwise, create and cache the shape
+    //
+    const auto shape = CreateShape(key, bounds);
+    if (!shape)
+    {
+        return std::unexpected(false);
+    }
+
+    if (m_shapes.size() >= m_purgeThreshold)
+    {
+        PurgeUnused();
+    }
+
+    m_shapes.insert_or_assign(key, ShapeEntry{.shape = *shape, .source = source});
+
+    m_pMetrics->SetCounterValue(METRIC_PHYSICS_NUM_CACHED_SHAPES, m_shapes.size());
+
+    return *shape;
+}
+
+std::expected<JPH::Ref<JPH::Shape>, bool> JoltShapeCache::CreateShape(const ShapeKey& key, const PhysicsBoundsVariant& bounds) const
+{
+    switch (key.kind)
+    {
+        case ShapeKind::Sphere:
+            return JPH::Ref<JPH::Shape>(new JPH::SphereShape(key.params.x));
+        case ShapeKind::Box:
+            return JPH::Ref<JPH::Shape>(new JPH::BoxShape(ToJPH(key.params)));
+        case ShapeKind::HeightMap:
+            return CreateHeightMapShape(key, std::get<PhysicsBounds_HeightMap>(bounds));
+        case ShapeKind::ConvexHull:
+            return CreateModelShape(key, std::get<PhysicsBounds_ConvexHull>(bounds).modelId);
+        case ShapeKind::TriangleMesh:
+            return CreateModelShape(key, std::get<PhysicsBounds_TriangleMesh>(bounds).modelId);
+    }
+
+    return std::unexpected(false);
+}
+
+std::expected<JPH::Ref<JPH::Shape>, bool> JoltShapeCache::CreateHeightMapShape(const ShapeKey& key, const PhysicsBounds_HeightMap& bounds) const
+{
+    const auto pHeightMap = *m_pResources->GetLoadedHeightMap(bounds.heightMapMeshId);
+
+    // Offset
+
+    // Offset by half the mesh's size so that the height field shape is centered around the center of the mesh; Jolt
+    // by default extends its shape in the +X and +Z directions whereas we create height fields meshes with points that
+    // are centered around the mesh's (local) origin
+    glm::vec3 joltOffset = {
+        pHeightMap->meshSize_worldSpace.w / -2.0f,
+        0.0f,
+        pHeightMap->meshSize_worldSpace.h / -2.0f,
+    };
+
+    // Scale the offsetting to account for shape scale
+    joltOffset *= key.scale;
+
+    // Scale
+
+    // Jolt uses the data point's dimensions as x/z world coordinates, so we need to scale those coordinates so that
+    // they match the mesh's world-space size
+    const float worldSpaceToDataSizeRatio = pHeightMap->meshSize_worldSpace.w / (float)(pHeightMap->heightMap->dataSize.w - 1);
+
+    glm::vec3 joltScale = {worldSpaceToDataSizeRatio, 1.0f, worldSpaceToDataSizeRatio};
+
+    // Also scale the jolt data coordinates by the shape's scale
+    joltScale *= key.scale;
+
+    auto settings = JPH::HeightFieldShapeSettings(
+        pHeightMap->heightMap->data.data(),
+        ToJPH(joltOffset),
+        ToJPH(joltScale),
+        pHeightMap->heightMap->dataSize.w
+    );
+    settings.mMinHeightValue = pHeightMap->heightMap->minValue;
+    settings.mMaxHeightValue = pHeightMap->heightMap->maxValue;
+
+    const auto result = settings.Create();
+    if (result.HasError())
+    {
+        m_pLogger->Error("JoltShapeCache::CreateHeightMapShape: Failed to create height field shape: {}", result.GetError().c_str());
+        return std::unexpected(false);
+    }
+
+    return result.Get();
+}
+
+std::expected<JPH::Ref<JPH::Shape>, bool> JoltShapeCache::CreateModelShape(const ShapeKey& key, ModelId modelId) const
+{
+    const auto pLoadedModel = *m_pResources->GetLoadedModel(modelId);
+
+    // Cooks the model's collision if this is the first time any world has used it
+    const auto collision = pLoadedModel->collision->Get();
+    if (!collision)
+    {
+        m_pLogger->Error("JoltShapeCache::CreateModelShape: Model has no collision: {}", modelId.id);
+        return std::unexpected(false);
+    }
+
+    JPH::Ref<JPH::Shape> baseShape = key.kind == ShapeKind::TriangleMesh ? (*collision)->triangleMesh :
+                                                                           (*collision)->convexHull;
+
+    // The cooked shapes are shared by all scales of the model; wrap them with the scale needed
+    if (NCommon::AreEqual(key.scale.x, 1.0f) && NCommon::AreEqual(key.scale.y, 1.0f) && NCommon::AreEqual(key.scale.z, 1.0f))
+    {
+        return baseShape;
+    }
+
+    return JPH::Ref<JPH::Shape>(new JPH::ScaledShape(baseShape, ToJPH(key.scale)));
+}
+
+void JoltShapeCache::PurgeUnused()
+{
+    // Drop shapes which no body is using any longer, as well as shapes for resources which have
+    // since been destroyed. A shape's only remaining reference being the cache's means it's unused.
+    std::erase_if(m_shapes, [](const auto& it){
+        const bool sourceDestroyed = it.first.pSource != nullptr && it.second.source.expired();
+        return sourceDestroyed || it.second.shape->GetRefCount() == 1;
+    });
+
+    // Amortize purging by not purging again until the cache has doubled in size
+    m_purgeThreshold = std::max(MIN_PURGE_THRESHOLD, m_shapes.size() * 2);
+}
+
+}
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTSHAPECACHE_H
+#define WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTSHAPECACHE_H
+
+#include <Wired/Engine/Physics/PhysicsCommon.h>
+#include <Wired/Engine/Physics/PhysicsBounds.h>
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include <glm/glm.hpp>
+
+#include <memory>
+#include <unordered_map>
+#include <expected>
+#include <cstddef>
+
+namespace NCommon
+{
+    class ILogger;
+    class IMetrics;
+}
+
+namespace Wired::Engine
+{
+    class Resources;
+
+    /**
+    * Cache of immutable Jolt shapes, keyed by their bounds and final scale, so that bodies with
+    * identical bounds share a single shape rather than each constructing their own. Each world's
+    * physics owns one, shared across that world's physics scenes. Not thread safe; only used by
+    * the world's physics system. The model collision that model shapes are built from is shared
+    * between worlds, see LazyModelCollision.
+    */
+    class JoltShapeCache
+    {
+        public:
+
+            JoltShapeCache(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, const Resources* pResources);
+            ~JoltShapeCache();
+
+            /**
+            * Returns a (possibly shared) shape for the given bounds at the given scale, creating
+            * it if needed.
+            */
+            [[nodiscard]] std::expected<JPH::Ref<JPH::Shape>, bool> GetShape(const PhysicsBoundsVariant& bounds,
+                                                                             const glm::vec3& scale,
+                                                                             RigidBodyType bodyType);
+
+            void Clear();
+
+        private:
+
+            enum class ShapeKind
+            {
+                Sphere,
+                Box,
+                HeightMap,
+                ConvexHull,
+                TriangleMesh
+            };
+
+            struct ShapeKey
+            {
+                ShapeKind kind{};
+                const void* pSource{nullptr}; // Resource the shape was built from, if any
+                glm::vec3 params{0.0f}; // Kind-specific shape dimensions
+                glm::vec3 scale{1.0f};
+
+                bool operator==(const ShapeKey&) const = default;
+            };
+
+            struct ShapeKeyHash
+            {
+                std::size_t operator()(const ShapeKey& key) const;
+            };
+
+            struct ShapeEntry
+            {
+                JPH::Ref<JPH::Shape> shape;
+
+                // Tracks the lifetime of the resource the shape was built from, if any, so that an
+                // entry isn't matched against a new resource which happens to re-use the old address
+                std::weak_ptr<const void> source;
+            };
+
+        private:
+
+            [[nodiscard]] std::expected<JPH::Ref<JPH::Shape>, bool> CreateShape(const ShapeKey& key, const PhysicsBoundsVariant& bounds) const;
+            [[nodiscard]] std::expected<JPH::Ref<JPH::Shape>, bool> CreateHeightMapShape(const ShapeKey& key, const PhysicsBounds_HeightMap& bounds) const;
+            [[nodiscard]] std::expected<JPH::Ref<JPH::Shape>, bool> CreateModelShape(const ShapeKey& key, ModelId modelId) const;
+
+            void PurgeUnused();
+
+        private:
+
+            NCommon::ILogger* m_pLogger;
+            NCommon::IMetrics* m_pMetrics;
+            const Resources* m_pResources;
+
+            std::unordered_map<ShapeKey, ShapeEntry, ShapeKeyHash> m_shapes;
+            std::size_t m_purgeThreshold{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_PHYSICS_JOLTSHAPECACHE_H
@@ -0,0 +1,371 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "ModelCollision.h"
+
+#include <Wired/Engine/Model/Model.h>
+#include <Wired/Engine/Package/PackageCommon.h>
+
+#include <NEON/Common/Log/ILogger.h>
+#include <NEON/Common/Hash.h>
+
+#include <Jolt/Core/StreamWrapper.h>
+#include <Jolt/Physics/Collision/Shape/ConvexHullShape.h>
+#include <Jolt/Physics/Collision/Shape/MeshShape.h>
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+namespace Wired::Engine
+{
+
+static constexpr std::array<char, 4> COLLISION_MAGIC = {'W', 'C', 'O', 'L'};
+static constexpr uint32_t COLLISION_FORMAT_VERSION = 1;
+static constexpr uint32_t COLLISION_JOLT_VERSION = (JPH_VERSION_MAJOR << 16) | (JPH_VERSION_MINOR << 8) | JPH_VERSION_PATCH;
+
+struct ModelGeometry
+{
+    JPH::VertexList vertices;
+    JPH::IndexedTriangleList triangles;
+};
+
+/**
+* Visits each mesh node of the model in a stable (node id) order, so that cooking and source
+* hashing are deterministic regardless of unordered container iteration order.
+*/
+template <typename Func>
+static void ForEachModelMesh(const Model* pModel, const Func& func)
+{
+    std::vector<unsigned int> nodeIds(pModel->nodesWithMeshes.cbegin(), pModel->nodesWithMeshes.cend());
+    std::ranges::sort(nodeIds);
+
+    for (const auto& nodeId : nodeIds)
+    {
+        const auto nodeIt = pModel->nodeMap.find(nodeId);
+        if (nodeIt == pModel->nodeMap.cend()) { continue; }
+
+        for (const auto& meshIndex : nodeIt->second->meshIndices)
+        {
+            const auto meshIt = pModel->meshes.find(meshIndex);
+            if (meshIt == pModel->meshes.cend()) { continue; }
+
+            func(nodeIt->second->bindGlobalTransform, meshIt->second);
+        }
+    }
+}
+
+template <typename Vertex>
+static void AppendMeshGeometry(ModelGeometry& geometry,
+                               const glm::mat4& transform,
+                               const std::vector<Vertex>& meshVertices,
+                               const std::vector<uint32_t>& meshIndices)
+{
+    const auto baseIndex = static_cast<uint32_t>(geometry.vertices.size());
+
+    for (const auto& vertex : meshVertices)
+    {
+        const auto position = glm::vec3(transform * glm::vec4(vertex.position, 1.0f));
+        geometry.vertices.emplace_back(position.x, position.y, position.z);
+    }
+
+    for (std::size_t x = 0; x + 2 < meshIndices.size(); x += 3)
+    {
+        geometry.triangles.emplace_back(
+            baseIndex + meshIndices[x],
+            baseIndex + meshIndices[x + 1],
+            baseIndex + meshIndices[x + 2]
+        );
+    }
+}
+
+static ModelGeometry GatherModelGeometry(const Model* pModel)
+{
+    ModelGeometry geometry{};
+
+    ForEachModelMesh(pModel, [&](const glm::mat4& transform, const ModelMesh& mesh){
+        if (mesh.staticVertices) { AppendMeshGeometry(geometry, transform, *mesh.staticVertices, mesh.indices); }
+        else if (mesh.boneVertices) { AppendMeshGeometry(geometry, transform, *mesh.boneVertices, mesh.indices); }
+    });
+
+    return geometry;
+}
+
+std::expected<ModelCollision, bool> CookModelCollision(NCommon::ILogger* pLogger, const Model* pModel)
+{
+    const auto geometry = GatherModelGeometry(pModel);
+
+    if (geometry.vertices.size() < 4 || geometry.triangles.empty())
+    {
+        pLogger->Error("CookModelCollision: Model has too little geometry to cook collision from");
+        return std::unexpected(false);
+    }
+
+    ModelCollision collision{};
+
+    //
+    // Convex Hull
+    //
+    JPH::Array<JPH::Vec3> hullPoints;
+    hullPoints.reserve(geometry.vertices.size());
+    for (const auto& vertex : geometry.vertices)
+    {
+        hullPoints.emplace_back(vertex.x, vertex.y, vertex.z);
+    }
+
+    const JPH::ConvexHullShapeSettings hullSettings(hullPoints);
+    const auto hullResult = hullSettings.Create();
+    if (hullResult.HasError())
+    {
+        pLogger->Error("CookModelCollision: Failed to cook convex hull: {}", hullResult.GetError().c_str());
+        return std::unexpected(false);
+    }
+    collision.convexHull = hullResult.Get();
+
+    //
+    // Triangle Mesh
+    //
+    const JPH::MeshShapeSettings meshSettings(geometry.vertices, geometry.triangles);
+    const auto meshResult = meshSettings.Create();
+    if (meshResult.HasError())
+    {
+        pLogger->Error("CookModelCollision: Failed to cook triangle mesh: {}", meshResult.GetError().c_str());
+        return std::unexpected(false);
+    }
+    collision.triangleMesh = meshResult.Get();
+
+    return collision;
+}
+
+uint64_t GetModelCollisionSourceHash(const Model* pModel)
+{
+    std::size_t hash = 0;
+
+    const auto hashMesh = [&](const glm::mat4& transform, const auto& vertices, const std::vector<uint32_t>& indices){
+        const float* pTransform = glm::value_ptr(transform);
+        for (unsigned int x = 0; x < 16; ++x)
+        {
+            NCommon::HashCombine(hash, std::bit_cast<uint32_t>(pTransform[x]));
+        }
+
+        NCommon::HashCombine(hash, vertices.size());
+        for (const auto& vertex : vertices)
+        {
+            NCommon::HashCombineVar(hash,
+                std::bit_cast<uint32_t>(vertex.position.x),
+                std::bit_cast<uint32_t>(vertex.position.y),
+                std::bit_cast<uint32_t>(vertex.position.z)
+            );
+        }
+
+        NCommon::HashCombine(hash, indices.size());
+        for (const auto& index : indices)
+        {
+            NCommon::HashCombine(hash, index);
+        }
+    };
+
+    ForEachModelMesh(pModel, [&](const glm::mat4& transform, const ModelMesh& mesh){
+        if (mesh.staticVertices) { hashMesh(transform, *mesh.staticVertices, mesh.indices); }
+        else if (mesh.boneVertices) { hashMesh(transform, *mesh.boneVertices, mesh.indices); }
+    });
+
+    return static_cast<uint64_t>(hash);
+}
+
+std::expected<std::vector<std::byte>, bool> SerializeModelCollision(const ModelCollision& collision, uint64_t sourceHash)
+{
+    if (collision.convexHull == nullptr || collision.triangleMesh == nullptr)
+    {
+        return std::unexpected(false);
+    }
+
+    std::stringstream ss(std::ios::out | std::ios::binary);
+    JPH::StreamOutWrapper stream(ss);
+
+    stream.Write(COLLISION_MAGIC);
+    stream.Write(COLLISION_FORMAT_VERSION);
+    stream.Write(COLLISION_JOLT_VERSION);
+    stream.Write(sourceHash);
+
+    JPH::Shape::ShapeToIDMap shapeMap;
+    JPH::Shape::MaterialToIDMap materialMap;
+    collision.convexHull->SaveWithChildren(stream, shapeMap, materialMap);
+    collision.triangleMesh->SaveWithChildren(stream, shapeMap, materialMap);
+
+    if (stream.IsFailed())
+    {
+        return std::unexpected(false);
+    }
+
+    const auto str = ss.str();
+
+    std::vector<std::byte> data(str.size());
+    std::memcpy(data.data(), str.data(), str.size());
+
+    return data;
+}
+
+std::expected<ModelCollision, bool> DeserializeModelCollision(std::span<const std::byte> data, uint64_t sourceHash)
+{
+    std::stringstream ss(std::string(reinterpret_cast<const char*>(data.data()), data.size()), std::ios::in | std::ios::binary);
+    JPH::StreamInWrapper stream(ss);
+
+    std::array<char, 4> magic{};
+    uint32_t formatVersion{0};
+    uint32_t joltVersion{0};
+    uint64_t dataSourceHash{0};
+
+    stream.Read(magic);
+    stream.Read(formatVersion);
+    stream.Read(joltVersion);
+    stream.Read(dataSourceHash);
+
+    if (stream.IsFailed() ||
+        magic != COLLISION_MAGIC ||
+        formatVersion != COLLISION_FORMAT_VERSION ||
+        joltVersion != COLLISION_JOLT_VERSION ||
+        dataSourceHash != sourceHash)
+    {
+        return std::unexpected(false);
+    }
+
+    JPH::Shape::IDToShapeMap shapeMap;
+    JPH::Shape::IDToMaterialMap materialMap;
+
+    const auto hullResult = JPH::Shape::sRestoreWithChildren(stream, shapeMap, materialMap);
+    if (hullResult.HasError()) { return std::unexpected(false); }
+
+    const auto meshResult = JPH::Shape::sRestoreWithChildren(stream, shapeMap, materialMap);
+    if (meshResult.HasError()) { return std::unexpected(false); }
+
+    return ModelCollision{
+        .convexHull = hullResult.Get(),
+        .triangleMesh = meshResult.Get()
+    };
+}
+
+static bool WriteCacheFile(const std::filesystem::path& filePath, std::span<const std::byte> bytes)
+{
+    std::error_code ec{};
+    std::filesystem::create_directories(filePath.parent_path(), ec);
+    if (ec)
+    {
+        return false;
+    }
+
+    // Write to a temp file and then rename it into place so that a partially written file is never
+    // seen by a subsequent run
+    auto tempFilePath = filePath;
+    tempFilePath += ".tmp";
+
+    {
+        std::ofstream file(tempFilePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char*>(bytes.data()), (std::streamsize)bytes.size());
+        if (!file.good())
+        {
+            return false;
+        }
+    }
+
+    std::filesystem::rename(tempFilePath, filePath, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempFilePath, ec);
+        return false;
+    }
+
+    return true;
+}
+
+LazyModelCollision::LazyModelCollision(NCommon::ILogger* pLogger,
+                                       const Model* pModel,
+                                       std::string modelTag,
+                                       std::optional<std::filesystem::path> cacheFilePath)
+    : m_pLogger(pLogger)
+    , m_pModel(pModel)
+    , m_modelTag(std::move(modelTag))
+    , m_cacheFilePath(std::move(cacheFilePath))
+{
+
+}
+
+std::expected<const ModelCollision*, bool> LazyModelCollision::Get() const
+{
+    std::call_once(m_cookOnce, [this](){
+        auto collision = RestoreOrCook();
+        if (collision)
+        {
+            m_collision = std::move(*collision);
+        }
+    });
+
+    if (!m_collision)
+    {
+        return std::unexpected(false);
+    }
+
+    return &*m_collision;
+}
+
+std::expected<ModelCollision, bool> LazyModelCollision::RestoreOrCook() const
+{
+    const auto sourceHash = GetModelCollisionSourceHash(m_pModel);
+
+    //
+    // If collision was previously cooked for the model, and it's still valid for the model's
+    // current geometry, use it
+    //
+    if (m_cacheFilePath)
+    {
+        const auto cachedBytes = GetFileContents(*m_cacheFilePath);
+        if (cachedBytes)
+        {
+            auto collision = DeserializeModelCollision(*cachedBytes, sourceHash);
+            if (collision)
+            {
+                return collision;
+            }
+
+            m_pLogger->Info("LazyModelCollision: Cached collision is stale, re-cooking: {}", m_cacheFilePath->string());
+        }
+    }
+
+    //
+    // Otherwise, cook the model's collision and cache it for next time
+    //
+    m_pLogger->Info("LazyModelCollision: Cooking collision for model: {}", m_modelTag);
+
+    auto collision = CookModelCollision(m_pLogger, m_pModel);
+    if (!collision)
+    {
+        m_pLogger->Warning("LazyModelCollision: Failed to cook collision for model: {}", m_modelTag);
+        return std::unexpected(false);
+    }
+
+    if (m_cacheFilePath)
+    {
+        const auto serialized = SerializeModelCollision(*collision, sourceHash);
+        if (!serialized || !WriteCacheFile(*m_cacheFilePath, *serialized))
+        {
+            m_pLogger->Info("LazyModelCollision: Failed to write collision cache file: {}", m_cacheFilePath->string());
+        }
+    }
+
+    return collision;
+}
+
+}
@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_PHYSICS_MODELCOLLISION_H
+#define WIREDENGINE_WIREDENGINE_SRC_PHYSICS_MODELCOLLISION_H
+
+#include <Jolt/Jolt.h>
+#include <Jolt/Physics/Collision/Shape/Shape.h>
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <span>
+#include <filesystem>
+#include <optional>
+#include <mutex>
+#include <string>
+
+namespace NCommon
+{
+    class ILogger;
+}
+
+namespace Wired::Engine
+{
+    struct Model;
+
+    /**
+    * Collision shapes cooked from a model's bind-pose geometry, shared by every body which uses
+    * the model as its bounds.
+    */
+    struct ModelCollision
+    {
+        JPH::Ref<JPH::Shape> convexHull;
+        JPH::Ref<JPH::Shape> triangleMesh;
+    };
+
+    /**
+    * A model's collision, cooked the first time a body uses the model as its bounds rather than when
+    * the model is created, as most models are never used for physics.
+    *
+    * If given a cache file, collision is restored from it when it's still valid for the model's
+    * geometry, and otherwise cooked and written to it for subsequent runs.
+    *
+    * Thread safe; worlds simulating concurrently can request the same model's collision.
+    */
+    class LazyModelCollision
+    {
+        public:
+
+            LazyModelCollision(NCommon::ILogger* pLogger,
+                               const Model* pModel,
+                               std::string modelTag,
+                               std::optional<std::filesystem::path> cacheFilePath);
+
+            /**
+            * Returns the model's collision, restoring or cooking it on the first call. Fails if the
+            * model's geometry can't be cooked; that failure is remembered rather than retried.
+            */
+            [[nodiscard]] std::expected<const ModelCollision*, bool> Get() const;
+
+        private:
+
+            [[nodiscard]] std::expected<ModelCollision, bool> RestoreOrCook() const;
+
+        private:
+
+            NCommon::ILogger* m_pLogger;
+            const Model* m_pModel;
+            std::string m_modelTag;
+            std::optional<std::filesystem::path> m_cacheFilePath;
+
+            mutable std::once_flag m_cookOnce;
+            mutable std::optional<ModelCollision> m_collision;
+    };
+
+    /**
+    * Cooks convex hull and triangle mesh shapes from the provided model's bind-pose geometry.
+    */
+    [[nodiscard]] std::expected<ModelCollision, bool> CookModelCollision(NCommon::ILogger* pLogger, const Model* pModel);
+
+    /**
+    * Returns a hash of the model geometry that collision is cooked from. Stored with serialized
+    * collision so that a stale cooked copy is detected when the model's source changes.
+    */
+    [[nodiscard]] uint64_t GetModelCollisionSourceHash(const Model* pModel);
+
+    /**
+    * Serializes cooked collision into Jolt's binary shape format, prefixed with a header
+    * that records the format, Jolt, and model geometry versions it was cooked with.
+    */
+    [[nodiscard]] std::expected<std::vector<std::byte>, bool> SerializeModelCollision(const ModelCollision& collision,
+                                                                                      uint64_t sourceHash);
+
+    /**
+    * Restores collision previously produced by SerializeModelCollision. Fails if the data is
+    * malformed or was cooked from different model geometry or a different version of Jolt.
+    */
+    [[nodiscard]] std::expected<ModelCollision, bool> DeserializeModelCollision(std::span<const std::byte> data,
+                                                                                uint64_t sourceHash);
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_PHYSICS_MODELCOLLISION_H
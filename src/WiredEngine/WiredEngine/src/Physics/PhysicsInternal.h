@@ -12,6 +12,8 @@
 #include <Wired/Engine/Physics/PhysicsCommon.h>
 #include <Wired/Engine/Physics/PhysicsBounds.h>
 
+#include <Wired/Engine/World/WorldCommon.h>
+
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
@@ -23,10 +25,16 @@ namespace Wired::Engine
 {
     struct RigidBodyData
     {
+        // The entity the body belongs to, if any
+        std::optional<EntityId> entity;
+
         RigidBodyType type{};
 
         PhysicsShape shape{};
 
+        PhysicsBodyCategory category{PhysicsBodyCategory::Default};
+        PhysicsCollisionFilter collisionFilter{};
+
         glm::vec3 scale{1.0f};
         glm::vec3 position{0.0f};
         glm::quat orientation{glm::identity<glm::quat>()};
@@ -6,9 +6,12 @@
  
 #include "Resources.h"
 #include "HeightMapUtil.h"
+#include "WorkThreadPool.h"
 
 #include "Audio/AudioManager.h"
+#include "Audio/AudioUtil.h"
 #include "Font/FontManager.h"
+#include "Physics/ModelCollision.h"
 
 #include <Wired/Platform/IPlatform.h>
 #include <Wired/Platform/IImage.h>
@@ -23,13 +26,22 @@
 #include <AudioFile/AudioFile.h>
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 
 namespace Wired::Engine
 {
 
-Resources::Resources(NCommon::ILogger* pLogger, Platform::IPlatform* pPlatform,  AudioManager* pAudioManager, FontManager* pFontManager, Render::IRenderer* pRenderer)
+Resources::Resources(NCommon::ILogger* pLogger,
+                     Platform::IPlatform* pPlatform,
+                     WorkThreadPool* pWorkThreadPool,
+                     AudioManager* pAudioManager,
+                     FontManager* pFontManager,
+                     Render::IRenderer* pRenderer)
     : m_pLogger(pLogger)
     , m_pPlatform(pPlatform)
+    , m_pWorkThreadPool(pWorkThreadPool)
     , m_pAudioManager(pAudioManager)
     , m_pFontManager(pFontManager)
     , m_pRenderer(pRenderer)
@@ -41,6 +53,7 @@ Resources::~Resources()
 {
     m_pLogger = nullptr;
     m_pPlatform = nullptr;
+    m_pWorkThreadPool = nullptr;
     m_pAudioManager = nullptr;
     m_pFontManager = nullptr;
     m_pRenderer = nullptr;
@@ -194,7 +207,6 @@ std::expected<Render::MeshId, bool> Resources::CreateHeightMapMeshFromImage(cons
         .isValid = true,
         .pMeshData = std::move(heightMapMeshData)
     };
-    // TODO Perf: Generate lower LOD with lowered data size(?)
 
     const auto result = CreateMesh(heightMapMesh.get(), userTag);
 
@@ -202,7 +214,6 @@ std::expected<Render::MeshId, bool> Resources::CreateHeightMapMeshFromImage(cons
     {
         m_loadedHeightMaps.insert({*result, LoadedHeightMap{
             .heightMap = std::move(heightMap),
-            .meshData = std::move(heightMapMesh->lodData.at(0).pMeshData), // Take ownership over and store the mesh data
             .meshSize_worldSpace = meshSize_worldSpace
         }});
     }
@@ -210,6 +221,126 @@ std::expected<Render::MeshId, bool> Resources::CreateHeightMapMeshFromImage(cons
     return result;
 }
 
+std::expected<HeightMapTerrain, bool> Resources::CreateHeightMapTerrainFromImage(const NCommon::ImageData* pImage,
+                                                                                 const NCommon::Size2DUInt& dataSize,
+                                                                                 const float& displacementFactor,
+                                                                                 const NCommon::Size2DReal& meshSize_worldSpace,
+                                                                                 const std::optional<float>& uvSpanWorldSize,
+                                                                                 const uint32_t& chunkQuads,
+                                                                                 const std::string& userTag)
+{
+    LogInfo("Resources: Creating height map terrain: {}", userTag);
+
+    if (pImage->GetPixelWidth() != pImage->GetPixelHeight())
+    {
+        LogError("Resources::CreateHeightMapTerrainFromImage: Height map image must be square: {}", userTag);
+        return std::unexpected(false);
+    }
+
+    if (dataSize.w != dataSize.h || dataSize.w < 2)
+    {
+        LogError("Resources::CreateHeightMapTerrainFromImage: Height maps currently only support square data sizes of at least 2x2: {}", userTag);
+        return std::unexpected(false);
+    }
+
+    if (chunkQuads == 0)
+    {
+        LogError("Resources::CreateHeightMapTerrainFromImage: Chunk size must be non-zero: {}", userTag);
+        return std::unexpected(false);
+    }
+
+    const std::shared_ptr<HeightMap> heightMap = GenerateHeightMapFromImage(pImage, dataSize, displacementFactor);
+    const auto chunks = GetHeightMapChunks(heightMap.get(), chunkQuads);
+
+    //
+    // Generate the chunk meshes in parallel; each chunk writes only to its own mesh. This thread generates chunks
+    // alongside the pool threads and only ever waits on chunks which a running thread has already claimed, so it
+    // never blocks on pool work which hasn't started, even when called from a pool thread.
+    //
+    struct ChunkGeneration
+    {
+        std::vector<std::unique_ptr<Render::Mesh>> chunkMeshes;
+        std::atomic<std::size_t> nextChunk{0};
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::size_t numGenerated{0};
+    };
+
+    auto generation = std::make_shared<ChunkGeneration>();
+    generation->chunkMeshes.resize(chunks.size());
+
+    const auto generateChunks = [=](ChunkGeneration& state){
+        for (auto chunkIndex = state.nextChunk++; chunkIndex < chunks.size(); chunkIndex = state.nextChunk++)
+        {
+            state.chunkMeshes[chunkIndex] = GenerateHeightMapChunkMesh(heightMap.get(), chunks[chunkIndex], meshSize_worldSpace, uvSpanWorldSize);
+
+            std::lock_guard<std::mutex> lock(state.mutex);
+            if (++state.numGenerated == chunks.size()) { state.cv.notify_all(); }
+        }
+    };
+
+    const auto numHelpers = std::min<std::size_t>(chunks.size() - 1, m_pWorkThreadPool->GetNumThreads());
+
+    for (std::size_t x = 0; x < numHelpers; ++x)
+    {
+        m_pWorkThreadPool->Submit([generation, generateChunks](bool const*){ generateChunks(*generation); });
+    }
+
+    generateChunks(*generation);
+
+    {
+        std::unique_lock<std::mutex> lock(generation->mutex);
+        generation->cv.wait(lock, [&](){ return generation->numGenerated == chunks.size(); });
+    }
+
+    std::vector<const Render::Mesh*> chunkMeshPtrs;
+    chunkMeshPtrs.reserve(chunks.size());
+
+    for (const auto& chunkMesh : generation->chunkMeshes)
+    {
+        chunkMeshPtrs.push_back(chunkMesh.get());
+    }
+
+    //
+    // Create all the chunk meshes in one renderer call
+    //
+    const auto result = m_pRenderer->CreateMeshes(chunkMeshPtrs).get();
+    if (!result || result->empty())
+    {
+        LogError("Resources::CreateHeightMapTerrainFromImage: Failed to create renderer meshes for {}", userTag);
+        return std::unexpected(false);
+    }
+
+    for (const auto& meshId : *result)
+    {
+        m_loadedMeshes.insert(meshId);
+    }
+
+    const auto terrain = HeightMapTerrain{
+        .heightMapMeshId = result->at(0),
+        .chunkMeshIds = *result
+    };
+
+    m_loadedHeightMaps.insert({terrain.heightMapMeshId, LoadedHeightMap{
+        .heightMap = heightMap,
+        .meshSize_worldSpace = meshSize_worldSpace
+    }});
+
+    return terrain;
+}
+
+void Resources::DestroyHeightMapTerrain(const HeightMapTerrain& terrain)
+{
+    for (const auto& meshId : terrain.chunkMeshIds)
+    {
+        if (m_loadedMeshes.contains(meshId))
+        {
+            DestroyMesh(meshId);
+        }
+    }
+}
+
 std::optional<NCommon::Size2DReal> Resources::GetHeightMapMeshWorldSize(const Render::MeshId& meshId) const
 {
     const auto it = m_loadedHeightMaps.find(meshId);
@@ -252,6 +383,15 @@ void Resources::DestroyMesh(Render::MeshId meshId)
 std::expected<ModelId, bool> Resources::CreateModel(std::unique_ptr<Model> model,
                                                     const std::unordered_map<std::string, NCommon::ImageData const*>& externalTextures,
                                                     const std::string& userTag)
+{
+    // Programmatically created models have no stable identity between runs, so their collision isn't cached
+    return CreateModel(std::move(model), externalTextures, std::nullopt, userTag);
+}
+
+std::expected<ModelId, bool> Resources::CreateModel(std::unique_ptr<Model> model,
+                                                    const std::unordered_map<std::string, NCommon::ImageData const*>& externalTextures,
+                                                    std::optional<std::filesystem::path> collisionCacheFilePath,
+                                                    const std::string& userTag)
 {
     LogInfo("Resources: creating model: {}", userTag);
 
@@ -301,6 +441,7 @@ std::expected<ModelId, bool> Resources::CreateModel(std::unique_ptr<Model> model
     const auto modelId = m_modelIds.GetId();
 
     loadedModel.model = std::move(model);
+    loadedModel.collision = std::make_shared<LazyModelCollision>(m_pLogger, loadedModel.model.get(), userTag, std::move(collisionCacheFilePath));
 
     m_loadedModels.insert({modelId, std::move(loadedModel)});
 
@@ -711,6 +852,32 @@ bool Resources::CreateResourceAudio(const ResourceIdentifier& resourceIdentifier
     return true;
 }
 
+bool Resources::CreateResourceStreamedAudio(const ResourceIdentifier& resourceIdentifier, std::vector<std::byte> encodedAudio)
+{
+    if (m_loadedResourceAudio.contains(resourceIdentifier))
+    {
+        LogWarning("Resources::CreateResourceStreamedAudio: Resource audio already exists: {}", resourceIdentifier.GetUniqueName());
+        return true;
+    }
+
+    auto streamedAudio = AudioUtil::StreamedAudioFromBytes(std::move(encodedAudio));
+    if (!streamedAudio)
+    {
+        LogError("Resources::CreateResourceStreamedAudio: Unsupported streamed audio data: {}", resourceIdentifier.GetUniqueName());
+        return false;
+    }
+
+    if (!m_pAudioManager->LoadResourceStreamedAudio(resourceIdentifier, std::move(*streamedAudio)))
+    {
+        LogError("Resources::CreateResourceStreamedAudio: Failed to create resource audio: {}", resourceIdentifier.GetUniqueName());
+        return false;
+    }
+
+    m_loadedResourceAudio.insert(resourceIdentifier);
+
+    return true;
+}
+
 void Resources::DestroyResourceAudio(const ResourceIdentifier& resourceIdentifier)
 {
     if (!m_loadedResourceAudio.contains(resourceIdentifier))
@@ -780,6 +947,20 @@ std::expected<RenderTextResult, bool> Resources::RenderText(const std::string& t
     };
 }
 
+std::expected<LayoutTextResult, bool> Resources::LayoutText(const std::string& text,
+                                                            const ResourceIdentifier& font,
+                                                            const Platform::TextProperties& textProperties)
+{
+    const auto result = m_pFontManager->LayoutText(text, font, textProperties);
+    if (!result)
+    {
+        LogError("Resources::LayoutText: Failed to lay out text");
+        return std::unexpected(false);
+    }
+
+    return result;
+}
+
 std::expected<Render::MaterialId, bool> Resources::CreateMaterial(const Render::Material* pMaterial, const std::string& userTag)
 {
     const auto result = m_pRenderer->CreateMaterials({pMaterial}, userTag).get();
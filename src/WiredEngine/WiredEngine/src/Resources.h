@@ -18,6 +18,8 @@
 #include <NEON/Common/IdSource.h>
 
 #include <unordered_set>
+#include <filesystem>
+#include <optional>
 
 namespace NCommon
 {
@@ -38,19 +40,24 @@ namespace Wired::Engine
 {
     struct LoadedHeightMap
     {
-        std::unique_ptr<HeightMap> heightMap;
-        std::unique_ptr<Render::MeshData> meshData;
+        std::shared_ptr<HeightMap> heightMap; // Shared so physics shape caches can tell when the height map is gone
         NCommon::Size2DReal meshSize_worldSpace;
     };
 
     class AudioManager;
     class FontManager;
+    class WorkThreadPool;
 
     class Resources : public IResources
     {
         public:
 
-            Resources(NCommon::ILogger* pLogger, Platform::IPlatform* pPlatform, AudioManager* pAudioManager, FontManager* pFontManager, Render::IRenderer* pRenderer);
+            Resources(NCommon::ILogger* pLogger,
+                      Platform::IPlatform* pPlatform,
+                      WorkThreadPool* pWorkThreadPool,
+                      AudioManager* pAudioManager,
+                      FontManager* pFontManager,
+                      Render::IRenderer* pRenderer);
             ~Resources() override;
 
             //
@@ -85,6 +92,15 @@ namespace Wired::Engine
                 const NCommon::Size2DReal& meshSize_worldSpace,
                 const std::optional<float>& uvSpanWorldSize,
                 const std::string& userTag) override;
+            [[nodiscard]] std::expected<HeightMapTerrain, bool> CreateHeightMapTerrainFromImage(
+                const NCommon::ImageData* pImage,
+                const NCommon::Size2DUInt& dataSize,
+                const float& displacementFactor,
+                const NCommon::Size2DReal& meshSize_worldSpace,
+                const std::optional<float>& uvSpanWorldSize,
+                const uint32_t& chunkQuads,
+                const std::string& userTag) override;
+            void DestroyHeightMapTerrain(const HeightMapTerrain& terrain) override;
             [[nodiscard]] std::optional<NCommon::Size2DReal> GetHeightMapMeshWorldSize(const Render::MeshId& meshId) const override;
             [[nodiscard]] std::optional<HeightMapQueryResult> QueryHeightMapMesh(const Render::MeshId& meshId,
                                                                                  const glm::vec2& point_modelSpace) const override;
@@ -104,6 +120,7 @@ namespace Wired::Engine
             // Audio
             //
             [[nodiscard]] bool CreateResourceAudio(const ResourceIdentifier& resourceIdentifier, const NCommon::AudioData* pAudioData) override;
+            [[nodiscard]] bool CreateResourceStreamedAudio(const ResourceIdentifier& resourceIdentifier, std::vector<std::byte> encodedAudio) override;
             void DestroyResourceAudio(const ResourceIdentifier& resourceIdentifier) override;
 
             //
@@ -114,6 +131,9 @@ namespace Wired::Engine
             [[nodiscard]] std::expected<RenderTextResult, bool> RenderText(const std::string& text,
                                                                            const ResourceIdentifier& font,
                                                                            const Platform::TextProperties& textProperties) override;
+            [[nodiscard]] std::expected<LayoutTextResult, bool> LayoutText(const std::string& text,
+                                                                           const ResourceIdentifier& font,
+                                                                           const Platform::TextProperties& textProperties) override;
 
             //
             // Materials
@@ -126,6 +146,11 @@ namespace Wired::Engine
             //
             // Internal
             //
+            // As CreateModel, but with a file the model's cooked collision is cached in between runs
+            [[nodiscard]] std::expected<ModelId, bool> CreateModel(std::unique_ptr<Model> model,
+                                                                   const std::unordered_map<std::string, NCommon::ImageData const*>& externalTextures,
+                                                                   std::optional<std::filesystem::path> collisionCacheFilePath,
+                                                                   const std::string& userTag);
             [[nodiscard]] std::optional<const LoadedHeightMap*> GetLoadedHeightMap(const Render::MeshId& meshId) const;
             [[nodiscard]] std::optional<const LoadedModel*> GetLoadedModel(const ModelId& modelId) const;
             void ShutDown();
@@ -167,6 +192,7 @@ namespace Wired::Engine
 
             NCommon::ILogger* m_pLogger;
             Platform::IPlatform* m_pPlatform;
+            WorkThreadPool* m_pWorkThreadPool;
             AudioManager* m_pAudioManager;
             FontManager* m_pFontManager;
             Render::IRenderer* m_pRenderer;
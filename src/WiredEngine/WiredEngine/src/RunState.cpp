@@ -16,6 +16,7 @@
 #include "Font/FontManager.h"
 
 #include "World/WorldState.h"
+#include "World/WorldSystemScheduler.h"
 
 #include <Wired/Engine/Client.h>
 
@@ -28,10 +29,11 @@ namespace Wired::Engine
 
 RunState::RunState(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, Render::IRenderer* pRenderer, Platform::IPlatform* pPlatform)
     : pWorkThreadPool(std::make_unique<WorkThreadPool>(std::thread::hardware_concurrency()))
-    , pAudioManager(std::make_unique<AudioManager>(pLogger, pMetrics))
-    , pFontManager(std::make_unique<FontManager>(pLogger, pMetrics, pPlatform->GetText()))
-    , pResources(std::make_unique<Resources>(pLogger, pPlatform, pAudioManager.get(), pFontManager.get(), pRenderer))
+    , pAudioManager(std::make_unique<AudioManager>(pLogger, pMetrics, pWorkThreadPool.get()))
+    , pFontManager(std::make_unique<FontManager>(pLogger, pMetrics, pPlatform->GetText(), pRenderer))
+    , pResources(std::make_unique<Resources>(pLogger, pPlatform, pWorkThreadPool.get(), pAudioManager.get(), pFontManager.get(), pRenderer))
     , pPackages(std::make_unique<Packages>(pLogger, pWorkThreadPool.get(), pResources.get(), pPlatform, pRenderer))
+    , pWorldSystemScheduler(std::make_unique<WorldSystemScheduler>(pLogger, pWorkThreadPool.get()))
     , m_pLogger(pLogger)
     , m_pMetrics(pMetrics)
     , m_pRenderer(pRenderer)
@@ -46,6 +48,7 @@ RunState::~RunState()
     pFontManager = nullptr;
     pResources = nullptr;
     pPackages = nullptr;
+    pWorldSystemScheduler = nullptr;
     pClient = nullptr;
     m_pLogger = nullptr;
     m_pMetrics = nullptr;
@@ -73,6 +76,7 @@ bool RunState::StartUp()
 
 void RunState::ShutDown()
 {
+    pWorldSystemScheduler = nullptr;
     pWorkThreadPool = nullptr;
 
     for (auto& world : worlds)
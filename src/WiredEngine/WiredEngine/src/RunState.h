@@ -48,6 +48,7 @@ namespace Wired::Engine
     class WorkThreadPool;
     class AudioManager;
     class FontManager;
+    class WorldSystemScheduler;
 
     /**
      * Holds all run-specific state for a given run of the engine
@@ -84,6 +85,9 @@ namespace Wired::Engine
                 std::chrono::high_resolution_clock::time_point lastTimeSync{std::chrono::high_resolution_clock::now()};
                 // Accumulated time to be consumed by simulation steps in simTimeStepMs-sized chunks
                 double accumulatedTimeMs{0.0};
+                // Whether frames rendered between simulation steps blend renderables between their last two
+                // simulation step states, rather than showing the latest simulation step state as-is
+                bool interpolateRenderState{true};
 
             //
             // Internal Systems
@@ -93,6 +97,7 @@ namespace Wired::Engine
                 std::unique_ptr<FontManager> pFontManager;
                 std::unique_ptr<Resources> pResources;
                 std::unique_ptr<Packages> pPackages;
+                std::unique_ptr<WorldSystemScheduler> pWorldSystemScheduler;
 
             //
             // Client/world state
@@ -37,6 +37,8 @@
 #include <NEON/Common/Metrics/IMetrics.h>
 #include <NEON/Common/Log/ILogger.h>
 
+#include <algorithm>
+
 #ifdef WIRED_IMGUI
     #include <implot.h>
 #endif
@@ -466,9 +468,23 @@ void WiredEngine::SimulationStep()
     SyncAudioListener();
 
     // Execute internal simulation step work
+    std::vector<WorldState*> worlds;
+    worlds.reserve(m_pRunState->worlds.size());
+
     for (const auto& worldIt : m_pRunState->worlds)
     {
-        worldIt.second->ExecuteSystems(m_pRunState.get());
+        worlds.push_back(worldIt.second.get());
+    }
+
+    m_pRunState->pWorldSystemScheduler->Execute(m_pRunState.get(), worlds);
+
+    // Update audio playback shared by all worlds, now that each world's audio system has synced its sources
+    UpdateAudio();
+
+    // Propagate transforms changed by the client or by systems down to attached entities
+    for (auto& pWorld : worlds)
+    {
+        pWorld->SyncWorldTransforms(m_pRunState.get());
     }
 
     // Pump the work thread to fulfill any finished tasks
@@ -849,15 +865,43 @@ void WiredEngine::EnqueueFrameRender()
         }
     }
 
+    NCommon::Timer stateCompileTimer(METRIC_RENDER_STATE_COMPILE_TIME);
     for (const auto& worldIt : m_pRunState->worlds)
     {
         auto stateUpdate = worldIt.second->CompileRenderStateUpdate(m_pRunState.get());
-        if (stateUpdate.IsEmpty()) { continue; }
+        if (stateUpdate->IsEmpty()) { continue; }
 
         renderFrameParams.stateUpdates.push_back(std::move(stateUpdate));
     }
+    stateCompileTimer.StopTimer(m_pMetrics);
     m_pMetrics->SetCounterValue(METRIC_RENDER_STATE_UPDATE_COUNT, renderFrameParams.stateUpdates.size());
 
+    // Renders are enqueued more often than simulation steps are run; let the renderer blend moving renderables
+    // by how far time has progressed towards the next simulation step, so frames between steps aren't duplicates
+    if (m_pRunState->interpolateRenderState && m_initState == InitState::Finished)
+    {
+        renderFrameParams.interpolation = Render::RenderInterpolation{
+            .simStepIndex = m_pRunState->simStepIndex,
+            .alpha = static_cast<float>(std::clamp(m_pRunState->accumulatedTimeMs / (double)m_pRunState->simTimeStepMs, 0.0, 1.0))
+        };
+    }
+
+    // In headless mode there's no surface to present to, so instead have the renderer read the
+    // offscreen color target back to us, and hand any finished readback to the client
+    if (!m_surfaceAccess && m_initState == InitState::Finished)
+    {
+        renderFrameParams.renderOutputRequest = Render::RenderOutputRequest{
+            .textureId = m_pRunState->offscreenColorTextureId
+        };
+
+        const auto renderOutput = m_pRenderer->PopRenderOutput();
+        if (renderOutput)
+        {
+            std::lock_guard<std::mutex> lock(m_pRunState->renderOutputMutex);
+            m_pRunState->renderOutput = *renderOutput;
+        }
+    }
+
     m_pRunState->enqueueFrameRenderFuture = m_pRenderer->RenderFrame(renderFrameParams);
 
     enqueueFrameRenderTimer.StopTimer(m_pMetrics);
@@ -980,6 +1024,18 @@ void WiredEngine::HandleRenderSurfaceLostError()
     (void)m_pRenderer->SurfaceDetailsChanged(std::move(*surfaceDetails)).get();
 }
 
+void WiredEngine::UpdateAudio()
+{
+    // Advance virtual sources, feed streamed resource audio, and re-assign real voices
+    m_pRunState->pAudioManager->UpdateVoices();
+
+    // Clean up any finished transient audio sources
+    m_pRunState->pAudioManager->DestroyFinishedTransientSources();
+
+    // Clean up played buffers for streamed audio sources
+    m_pRunState->pAudioManager->DestroyFinishedStreamedData();
+}
+
 void WiredEngine::SyncAudioListener()
 {
     // If the client has configured an explicit audio listener, sync the audio manager to it
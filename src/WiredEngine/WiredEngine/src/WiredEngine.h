@@ -96,6 +96,7 @@ namespace Wired::Engine
             void HandleRenderSurfaceLostError();
 
             void SyncAudioListener();
+            void UpdateAudio();
 
             void TryEnqueueFrameRender(const std::chrono::duration<double, std::milli>& maxWaitTimeMs);
             void EnqueueFrameRender();
@@ -34,6 +34,11 @@ namespace Wired::Engine
             explicit WorkThreadPool(unsigned int numThreads);
             ~WorkThreadPool();
 
+            /**
+             * @return The number of threads work is executed on
+             */
+            [[nodiscard]] unsigned int GetNumThreads() const noexcept { return m_threadPool->GetPoolSize(); }
+
             /**
              * Executes workFunc on a pool thread.
              */
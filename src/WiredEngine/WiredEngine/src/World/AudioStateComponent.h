@@ -9,13 +9,22 @@
 
 #include <Wired/Engine/Audio/AudioCommon.h>
 
+#include <glm/glm.hpp>
+
 #include <unordered_set>
+#include <optional>
 
 namespace Wired::Engine
 {
     struct AudioStateComponent
     {
         std::unordered_set<AudioSourceId> activeSources;
+
+        // Position last pushed to the entity's sources, used to derive source velocity
+        std::optional<glm::vec3> lastPosition_worldSpace;
+
+        // Whether a non-zero velocity was last pushed to the entity's sources
+        bool isMoving{false};
     };
 }
 
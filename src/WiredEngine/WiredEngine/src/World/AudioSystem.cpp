@@ -6,13 +6,27 @@
  
 #include "AudioSystem.h"
 
-#include "../Audio/AudioManager.h"
+#include "WorldTransformStateComponent.h"
+#include "TransformHierarchy.h"
+
+#include "../RunState.h"
 
 #include <NEON/Common/Log/ILogger.h>
 
+#include <utility>
+#include <optional>
+
 namespace Wired::Engine
 {
 
+// If more than this much sim time passed since the previous update (e.g. the world wasn't stepped for
+// a while), positions are too stale to derive a velocity from, and sources are given zero velocity
+static constexpr double MAX_VELOCITY_SAMPLE_INTERVAL_MS = 250.0;
+
+// Position changes implying a speed above this (world units per second) are treated as teleports rather
+// than motion, and give sources zero velocity, so that they don't produce a doppler spike
+static constexpr float MAX_SOURCE_SPEED = 200.0f;
+
 AudioSystem::AudioSystem(NCommon::ILogger* pLogger, AudioManager* pAudioManager)
     : m_pLogger(pLogger)
     , m_pAudioManager(pAudioManager)
@@ -26,92 +40,182 @@ AudioSystem::~AudioSystem()
     m_pAudioManager = nullptr;
 }
 
-void AudioSystem::Initialize(entt::basic_registry<EntityId>&)
+IWorldSystem::Access AudioSystem::GetAccess() const
 {
-
+    return {
+        .reads = TypesOf<TransformComponent, WorldTransformStateComponent>(),
+        .writes = TypesOf<AudioStateComponent>()
+    };
 }
 
-void AudioSystem::Execute(RunState*, WorldState*, entt::basic_registry<EntityId>& registry)
+void AudioSystem::Initialize(entt::basic_registry<EntityId>& registry)
 {
     //
-    // Update the audio properties of any entity with both an audio component and a
-    // transform component, so the audio source is attached to the entities' position
-    // in the world.
+    // Track which audio-emitting entities have had their transform or audio state touched, so
+    // that only their sources need to be updated, rather than every source every step
     //
-    for (auto&& [entity, audioStateComponent, transformComponent] :
-        registry.view<AudioStateComponent, TransformComponent>().each())
-    {
-        UpdateSourceProperties(audioStateComponent, transformComponent);
-    }
+    registry.on_construct<TransformComponent>().connect<&AudioSystem::OnAudioComponentTouched>(this);
+    registry.on_update<TransformComponent>().connect<&AudioSystem::OnAudioComponentTouched>(this);
+    registry.on_construct<WorldTransformStateComponent>().connect<&AudioSystem::OnAudioComponentTouched>(this);
+    registry.on_update<WorldTransformStateComponent>().connect<&AudioSystem::OnAudioComponentTouched>(this);
 
-    //
-    // For all entities with an audio component, destroy any static audio sources which have finished
-    // playing. (However, for streamed sources, we keep those around, even if they're temporarily "finished").
-    //
-    for (auto&& [entity, audioStateComponent] :
-        registry.view<AudioStateComponent>().each())
+    registry.on_construct<AudioStateComponent>().connect<&AudioSystem::OnAudioComponentTouched>(this);
+    registry.on_update<AudioStateComponent>().connect<&AudioSystem::OnAudioComponentTouched>(this);
+}
+
+void AudioSystem::OnAudioComponentTouched(entt::basic_registry<EntityId>& registry, EntityId entity)
+{
+    if (registry.all_of<AudioStateComponent>(entity))
     {
-        ProcessFinishedAudio(registry, (EntityId)entity, audioStateComponent);
+        m_invalidatedEntities.insert(entity);
     }
+}
 
+void AudioSystem::Execute(RunState* pRunState, WorldState*, entt::basic_registry<EntityId>& registry)
+{
     //
-    // Clean up any finished transient audio sources
+    // Update the position/velocity of the audio sources of any entity with both an audio component
+    // and a transform component, so the audio sources are attached to the entities' position
+    // in the world.
     //
-    m_pAudioManager->DestroyFinishedTransientSources();
+    UpdateSourceTransforms(pRunState, registry);
 
     //
-    // Clean up played buffers for streamed audio sources
+    // For all entities with an audio component, stop tracking any static audio sources which have finished
+    // playing. (However, for streamed sources, we keep those around, even if they're temporarily "finished").
     //
-    m_pAudioManager->DestroyFinishedStreamedData();
+    ProcessFinishedAudio(registry);
 }
 
-void AudioSystem::UpdateSourceProperties(AudioStateComponent& audioStateComponent, const TransformComponent& transformComponent) const
+void AudioSystem::UpdateSourceTransforms(RunState* pRunState, entt::basic_registry<EntityId>& registry)
 {
-    for (auto& activeSource : audioStateComponent.activeSources)
+    //
+    // Derive velocities over the sim time that actually elapsed since the previous update, which may be more
+    // than one step. Entities which weren't invalidated since then are known to not have moved in the meantime.
+    //
+    std::optional<float> elapsedSeconds;
+    if (m_lastUpdateTimeMs)
     {
-        (void)m_pAudioManager->UpdateLocalSourcePosition(activeSource, transformComponent.GetPosition());
+        const auto elapsedMs = pRunState->simStepTimeMs - *m_lastUpdateTimeMs;
+        if (elapsedMs > 0.0 && elapsedMs <= MAX_VELOCITY_SAMPLE_INTERVAL_MS)
+        {
+            elapsedSeconds = (float)(elapsedMs / 1000.0);
+        }
     }
-}
+    m_lastUpdateTimeMs = pRunState->simStepTimeMs;
 
-void AudioSystem::ProcessFinishedAudio(entt::basic_registry<EntityId>& registry, const EntityId& entity, AudioStateComponent& audioStateComponent)
-{
-    std::unordered_set<AudioSourceId> finishedSources;
+    m_sourceUpdates.clear();
+    m_stillMovingEntities.clear();
 
     //
-    // Look for any static (non-streamed) audio sources associated with the entity
+    // Push the new position, and velocity derived from the position change, of entities which have moved
     //
-    for (auto& sourceId : audioStateComponent.activeSources)
+    for (const auto& entity : m_invalidatedEntities)
     {
-        const auto sourceDataType = m_pAudioManager->GetSourceDataType(sourceId);
+        if (!registry.valid(entity)) { continue; }
+
+        auto* pAudioStateComponent = registry.try_get<AudioStateComponent>(entity);
+        if (pAudioStateComponent == nullptr || !registry.all_of<TransformComponent>(entity)) { continue; }
+
+        const auto position = TransformHierarchy::GetWorldTransform(registry, entity).position;
+
+        // No velocity on an entity's first update, or when there's no usable previous update to measure against
+        glm::vec3 velocity{0.0f};
+        if (pAudioStateComponent->lastPosition_worldSpace && elapsedSeconds)
+        {
+            velocity = (position - *pAudioStateComponent->lastPosition_worldSpace) / *elapsedSeconds;
+
+            if (glm::length(velocity) > MAX_SOURCE_SPEED)
+            {
+                velocity = glm::vec3(0.0f);
+            }
+        }
+
+        pAudioStateComponent->lastPosition_worldSpace = position;
+        pAudioStateComponent->isMoving = velocity != glm::vec3(0.0f);
 
-        if (!sourceDataType || *sourceDataType != SourceDataType::Static)
+        if (pAudioStateComponent->isMoving)
         {
-            continue;
+            m_stillMovingEntities.push_back(entity);
         }
 
-        const auto sourceState = m_pAudioManager->GetSourceState(sourceId);
-        if (!sourceState || (sourceState->playState == PlayState::Stopped))
+        for (const auto& sourceId : pAudioStateComponent->activeSources)
         {
-            finishedSources.insert(sourceId);
-            continue;
+            m_sourceUpdates.push_back(LocalSourceUpdate{.sourceId = sourceId, .worldPosition = position, .worldVelocity = velocity});
         }
     }
 
     //
-    // Remove the finished audio sources from the entity's audio component
+    // Entities which were moving last step but haven't moved this step have come to a stop; zero
+    // out their sources' velocity
     //
-    for (const auto& finishedSource : finishedSources)
+    for (const auto& entity : m_movingEntities)
     {
-        LogInfo("AudioSystem: Detected finished audio {} for entity {}", finishedSource, (uint64_t)entity);
-        audioStateComponent.activeSources.erase(finishedSource);
+        if (m_invalidatedEntities.contains(entity) || !registry.valid(entity)) { continue; }
+
+        auto* pAudioStateComponent = registry.try_get<AudioStateComponent>(entity);
+        if (pAudioStateComponent == nullptr || !pAudioStateComponent->lastPosition_worldSpace) { continue; }
+
+        pAudioStateComponent->isMoving = false;
+
+        for (const auto& sourceId : pAudioStateComponent->activeSources)
+        {
+            m_sourceUpdates.push_back(LocalSourceUpdate{
+                .sourceId = sourceId,
+                .worldPosition = *pAudioStateComponent->lastPosition_worldSpace,
+                .worldVelocity = glm::vec3(0.0f)
+            });
+        }
     }
 
+    std::swap(m_movingEntities, m_stillMovingEntities);
+    m_invalidatedEntities.clear();
+
+    m_pAudioManager->UpdateLocalSources(m_sourceUpdates);
+}
+
+void AudioSystem::ProcessFinishedAudio(entt::basic_registry<EntityId>& registry)
+{
+    m_watchedSources.clear();
+    m_watchedSourceEntities.clear();
+    m_finishedSourceIndices.clear();
+
+    for (auto&& [entity, audioStateComponent] : registry.view<AudioStateComponent>().each())
+    {
+        for (const auto& sourceId : audioStateComponent.activeSources)
+        {
+            m_watchedSources.push_back(sourceId);
+            m_watchedSourceEntities.push_back(entity);
+        }
+    }
+
+    //
+    // Query for which of the sources have finished, as a batch
     //
-    // If the audio component is no longer tracking any audio, destroy it
+    m_pAudioManager->GetFinishedSources(m_watchedSources, m_finishedSourceIndices);
+
     //
-    if (audioStateComponent.activeSources.empty())
+    // Remove the finished audio sources from their entity's audio component
+    //
+    for (const auto& finishedIndex : m_finishedSourceIndices)
     {
-        registry.erase<AudioStateComponent>(entity);
+        const auto entity = m_watchedSourceEntities[finishedIndex];
+        const auto sourceId = m_watchedSources[finishedIndex];
+
+        // Component may have already been erased due to a previous finished source
+        auto* pAudioStateComponent = registry.try_get<AudioStateComponent>(entity);
+        if (pAudioStateComponent == nullptr) { continue; }
+
+        LogDebug("AudioSystem: Detected finished audio {} for entity {}", sourceId, (uint64_t)entity);
+        pAudioStateComponent->activeSources.erase(sourceId);
+
+        //
+        // If the audio component is no longer tracking any audio, destroy it
+        //
+        if (pAudioStateComponent->activeSources.empty())
+        {
+            registry.erase<AudioStateComponent>(entity);
+        }
     }
 }
 
@@ -10,9 +10,14 @@
 #include "IWorldSystem.h"
 #include "AudioStateComponent.h"
 
-#include <Wired/Engine/Audio/AudioListener.h>
+#include "../Audio/AudioManager.h"
+
 #include <Wired/Engine/World/TransformComponent.h>
 
+#include <unordered_set>
+#include <vector>
+#include <optional>
+
 namespace NCommon
 {
     class ILogger;
@@ -20,8 +25,6 @@ namespace NCommon
 
 namespace Wired::Engine
 {
-    class AudioManager;
-
     class AudioSystem : public IWorldSystem
     {
         public:
@@ -30,6 +33,8 @@ namespace Wired::Engine
             ~AudioSystem() override;
 
             [[nodiscard]] Type GetType() const noexcept override { return Type::Audio; };
+            [[nodiscard]] Access GetAccess() const override;
+            [[nodiscard]] std::vector<Type> GetRunsAfter() const override { return {Type::Physics}; }
 
             void Initialize(entt::basic_registry<EntityId>& registry) override;
 
@@ -39,17 +44,33 @@ namespace Wired::Engine
 
         private:
 
-            void UpdateSourceProperties(AudioStateComponent& audioStateComponent,
-                                        const TransformComponent& transformComponent) const;
+            void OnAudioComponentTouched(entt::basic_registry<EntityId>& registry, EntityId entity);
 
-            void ProcessFinishedAudio(entt::basic_registry<EntityId>& registry,
-                                      const EntityId& entity,
-                                      AudioStateComponent& audioStateComponent);
+            void UpdateSourceTransforms(RunState* pRunState, entt::basic_registry<EntityId>& registry);
+            void ProcessFinishedAudio(entt::basic_registry<EntityId>& registry);
 
         private:
 
             NCommon::ILogger* m_pLogger;
             AudioManager* m_pAudioManager;
+
+            // Entities whose transform or audio state has changed since the last Execute
+            std::unordered_set<EntityId> m_invalidatedEntities;
+
+            // Entities which were last given a non-zero source velocity
+            std::vector<EntityId> m_movingEntities;
+
+            // Sim time of the previous source transform update
+            std::optional<double> m_lastUpdateTimeMs;
+
+            //
+            // Scratch space re-used across Execute calls
+            //
+            std::vector<EntityId> m_stillMovingEntities;
+            std::vector<LocalSourceUpdate> m_sourceUpdates;
+            std::vector<AudioSourceId> m_watchedSources;
+            std::vector<EntityId> m_watchedSourceEntities;
+            std::vector<std::size_t> m_finishedSourceIndices;
     };
 }
 
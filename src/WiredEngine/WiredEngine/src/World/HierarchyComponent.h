@@ -0,0 +1,29 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_WORLD_HIERARCHYCOMPONENT_H
+#define WIREDENGINE_WIREDENGINE_SRC_WORLD_HIERARCHYCOMPONENT_H
+
+#include <Wired/Engine/World/WorldCommon.h>
+
+#include <optional>
+
+namespace Wired::Engine
+{
+    /**
+     * Links an entity into a transform hierarchy. Children of an entity form an intrusive doubly linked
+     * list, starting at the parent's firstChild. Only present on entities which have a parent or children.
+     */
+    struct HierarchyComponent
+    {
+        std::optional<EntityId> parent;
+        std::optional<EntityId> firstChild;
+        std::optional<EntityId> prevSibling;
+        std::optional<EntityId> nextSibling;
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_WORLD_HIERARCHYCOMPONENT_H
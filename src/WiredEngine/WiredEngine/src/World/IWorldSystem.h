@@ -12,6 +12,8 @@
 #include <entt/entt.hpp>
 
 #include <string>
+#include <vector>
+#include <unordered_set>
 
 namespace Wired::Engine
 {
@@ -30,12 +32,48 @@ namespace Wired::Engine
                 Audio
             };
 
+            /**
+             * The components, or other shared state keyed by type, that a system reads and writes while executing.
+             * Systems whose accesses don't conflict are executed concurrently.
+             *
+             * Note that writing a component invokes any listeners registered for changes to that component, so a
+             * system which listens for changes to a component must declare it as read.
+             */
+            struct Access
+            {
+                std::unordered_set<entt::id_type> reads;
+                std::unordered_set<entt::id_type> writes;
+
+                [[nodiscard]] bool ConflictsWith(const Access& other) const
+                {
+                    const auto intersects = [](const std::unordered_set<entt::id_type>& a, const std::unordered_set<entt::id_type>& b){
+                        for (const auto& id : a) { if (b.contains(id)) { return true; } }
+                        return false;
+                    };
+
+                    return intersects(writes, other.writes) ||
+                           intersects(writes, other.reads) ||
+                           intersects(reads, other.writes);
+                }
+            };
+
+            template <typename... Ts>
+            [[nodiscard]] static std::unordered_set<entt::id_type> TypesOf() { return {entt::type_hash<Ts>::value()...}; }
+
         public:
 
             virtual ~IWorldSystem() = default;
 
             [[nodiscard]] virtual Type GetType() const noexcept = 0;
 
+            [[nodiscard]] virtual Access GetAccess() const = 0;
+
+            /**
+             * @return Systems which, if present, must finish executing before this system executes, regardless of
+             * whether their accesses conflict with this system's.
+             */
+            [[nodiscard]] virtual std::vector<Type> GetRunsAfter() const { return {}; }
+
             virtual void Initialize(entt::basic_registry<EntityId>& registry) { (void)registry; };
             virtual void Reset(entt::basic_registry<EntityId>& registry) { (void)registry; };
             virtual void Destroy(entt::basic_registry<EntityId>& registry) { (void)registry; };
@@ -29,6 +29,14 @@ ModelAnimatorSystem::~ModelAnimatorSystem()
     m_pResources = nullptr;
 }
 
+IWorldSystem::Access ModelAnimatorSystem::GetAccess() const
+{
+    return {
+        .reads = {},
+        .writes = TypesOf<ModelRenderableComponent>()
+    };
+}
+
 void ModelAnimatorSystem::Execute(RunState* pRunState, WorldState*, entt::basic_registry<EntityId>& registry)
 {
     std::vector<std::pair<EntityId, ModelRenderableComponent>> updatedEntities;
@@ -36,6 +36,7 @@ namespace Wired::Engine
             // IWorldSystem
             //
             [[nodiscard]] Type GetType() const noexcept override { return Type::ModelAnimator; };
+            [[nodiscard]] Access GetAccess() const override;
 
             void Execute(RunState* pRunState, WorldState* pWorld, entt::basic_registry<EntityId>& registry) override;
 
@@ -6,6 +6,7 @@
  
 #include "PhysicsSystem.h"
 #include "PhysicsStateComponent.h"
+#include "HierarchyComponent.h"
 
 #include "../RunState.h"
 
@@ -29,6 +30,14 @@ PhysicsSystem::PhysicsSystem(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetr
 
 }
 
+IWorldSystem::Access PhysicsSystem::GetAccess() const
+{
+    return {
+        .reads = TypesOf<PhysicsComponent>(),
+        .writes = TypesOf<TransformComponent, PhysicsStateComponent, IPhysics>()
+    };
+}
+
 void PhysicsSystem::Initialize(entt::basic_registry<EntityId>& registry)
 {
     registry.on_construct<TransformComponent>().connect<&PhysicsSystem::OnComponentTouched>(this);
@@ -59,7 +68,7 @@ void PhysicsSystem::OnComponentTouched(entt::basic_registry<EntityId>&, EntityId
 {
     // Ignore events while this very system is executing, as we don't want us syncing entities
     // to the latest physics system data to count as an entity being "invalidated"
-    if (dynamic_cast<WorldState*>(m_pWorldState)->GetExecutingSystem() == GetType())
+    if (m_pWorldState->GetExecutingSystem() == GetType())
     {
         return;
     }
@@ -74,11 +83,14 @@ void PhysicsSystem::OnPhysicsStateComponentDestroyed(entt::basic_registry<Entity
     m_toDeleteEntities.insert({entity, {physicsComponent.scene, physicsStateComponent.physicsId}});
 }
 
-static RigidBodyData RigidBodyDataFromEntity(const TransformComponent& transformComponent, const PhysicsComponent& physicsComponent)
+static RigidBodyData RigidBodyDataFromEntity(EntityId entity, const TransformComponent& transformComponent, const PhysicsComponent& physicsComponent)
 {
     RigidBodyData rigidBodyData{};
+    rigidBodyData.entity = entity;
     rigidBodyData.type = physicsComponent.bodyType;
     rigidBodyData.shape = physicsComponent.shape;
+    rigidBodyData.category = physicsComponent.category;
+    rigidBodyData.collisionFilter = physicsComponent.collisionFilter;
     rigidBodyData.scale = transformComponent.GetScale();
     rigidBodyData.position = transformComponent.GetPosition();
     rigidBodyData.orientation = transformComponent.GetOrientation();
@@ -109,38 +121,65 @@ void PhysicsSystem::Pre_SimulationStep(RunState* pRunState, WorldState* pWorldSt
     m_invalidedEntities.clear();
 
     //
-    // Remove entities from the physics system as needed
+    // Remove entities from the physics system as needed, batched per physics scene
     //
     for (const auto& toDeleteIt : m_toDeleteEntities)
     {
-        pWorldState->GetPhysicsInternal()->DestroyRigidBody(toDeleteIt.second.first, toDeleteIt.second.second);
-        m_physicsIdToEntityId.erase(toDeleteIt.second.second);
+        const auto& [scene, physicsId] = toDeleteIt.second;
+
+        m_sceneBatches[scene].toDeletePhysicsIds.push_back(physicsId);
+        SetPhysicsEntity(scene, physicsId, entt::null);
     }
     m_toDeleteEntities.clear();
 
+    for (auto& [scene, batch] : m_sceneBatches)
+    {
+        if (batch.toDeletePhysicsIds.empty()) { continue; }
+
+        pWorldState->GetPhysicsInternal()->DestroyRigidBodies(scene, batch.toDeletePhysicsIds);
+        batch.toDeletePhysicsIds.clear();
+    }
+
     //
-    // Add new physics entities to the physics system
+    // Add new physics entities to the physics system, batched per physics scene
     //
     for (const auto& toAddEntity : m_toAddEntities)
     {
         const auto [transformComponent, physicsComponent] = registry.get<TransformComponent, PhysicsComponent>(toAddEntity);
 
-        const auto rigidBodyData = RigidBodyDataFromEntity(transformComponent, physicsComponent);
+        auto& batch = m_sceneBatches[physicsComponent.scene];
+        batch.toAddEntities.push_back(toAddEntity);
+        batch.toAddBodyData.push_back(RigidBodyDataFromEntity(toAddEntity, transformComponent, physicsComponent));
+    }
+    m_toAddEntities.clear();
+
+    for (auto& [scene, batch] : m_sceneBatches)
+    {
+        if (batch.toAddEntities.empty()) { continue; }
+
+        const auto physicsIds = pWorldState->GetPhysicsInternal()->CreateRigidBodies(scene, batch.toAddBodyData);
 
-        const auto physicsId = pWorldState->GetPhysicsInternal()->CreateRigidBody(physicsComponent.scene, rigidBodyData);
-        if (!physicsId)
+        for (std::size_t x = 0; x < physicsIds.size(); ++x)
         {
-            m_pLogger->Error("PhysicsSystem::Pre_SimulationStep: Failed to create rigid body for entity: {}", (uint64_t)toAddEntity);
-            continue;
-        }
+            const auto& entity = batch.toAddEntities[x];
+            const auto& physicsId = physicsIds[x];
+
+            if (!physicsId)
+            {
+                m_pLogger->Error("PhysicsSystem::Pre_SimulationStep: Failed to create rigid body for entity: {}", (uint64_t)entity);
+                continue;
+            }
 
-        registry.emplace<PhysicsStateComponent>(toAddEntity, PhysicsStateComponent{
-            .physicsId = *physicsId
-        });
+            registry.emplace<PhysicsStateComponent>(entity, PhysicsStateComponent{
+                .physicsId = *physicsId
+            });
+
+            SetPhysicsEntity(scene, *physicsId, entity);
+        }
 
-        m_physicsIdToEntityId.insert({*physicsId, toAddEntity});
+        batch.toAddEntities.clear();
+        batch.toAddBodyData.clear();
     }
-    m_toAddEntities.clear();
 
     //
     // Update existing physics entities
@@ -150,7 +189,7 @@ void PhysicsSystem::Pre_SimulationStep(RunState* pRunState, WorldState* pWorldSt
         const auto [transformComponent, physicsComponent, physicsStateComponent] =
             registry.get<TransformComponent, PhysicsComponent, PhysicsStateComponent>(toUpdateEntity);
 
-        const auto rigidBodyData = RigidBodyDataFromEntity(transformComponent, physicsComponent);
+        const auto rigidBodyData = RigidBodyDataFromEntity(toUpdateEntity, transformComponent, physicsComponent);
 
         pWorldState->GetPhysicsInternal()->UpdateRigidBody(physicsComponent.scene, physicsStateComponent.physicsId, rigidBodyData);
     }
@@ -170,7 +209,22 @@ void PhysicsSystem::ProcessInvalidatedEntity(RunState*, entt::basic_registry<Ent
     }
 
     const bool hasPhysicsState = registry.all_of<PhysicsStateComponent>(entity);
-    const bool isCompletePhysicsEntity = registry.all_of<TransformComponent, PhysicsComponent>(entity);
+    bool isCompletePhysicsEntity = registry.all_of<TransformComponent, PhysicsComponent>(entity);
+
+    //
+    // An attached entity's TransformComponent is relative to its parent, while physics bodies are simulated
+    // in world space. SetEntityParent refuses to attach physics entities; this catches a physics component
+    // being added to an entity which is already attached.
+    //
+    if (isCompletePhysicsEntity)
+    {
+        const auto* pHierarchy = registry.try_get<HierarchyComponent>(entity);
+        if (pHierarchy != nullptr && pHierarchy->parent)
+        {
+            m_pLogger->Error("PhysicsSystem::ProcessInvalidatedEntity: Entity attached to a parent can't be a physics entity: {}", (uint64_t)entity);
+            isCompletePhysicsEntity = false;
+        }
+    }
 
     //
     // If the entity has physics state but no longer has enough components attached to be a
@@ -202,29 +256,39 @@ void PhysicsSystem::ProcessInvalidatedEntity(RunState*, entt::basic_registry<Ent
 
 void PhysicsSystem::Post_SimulationStep(RunState*, WorldState* pWorldState, entt::basic_registry<EntityId>& registry)
 {
-    pWorldState->GetPhysicsInternal()->UpdateBodiesFromSimulation();
+    auto pPhysics = pWorldState->GetPhysicsInternal();
+
+    pPhysics->UpdateBodiesFromSimulation();
 
-    for (auto&& [entity, transformComponent, physicsComponent, physicsStateComponent] :
-        registry.view<TransformComponent, PhysicsComponent, PhysicsStateComponent>().each())
+    //
+    // Sync only the bodies which the simulation actually modified back to their entities
+    //
+    for (const auto& sceneName : pPhysics->GetAllSceneNames())
     {
-        const auto rigidBody = pWorldState->GetPhysicsInternal()->GetRigidBody(physicsComponent.scene, physicsStateComponent.physicsId);
-        if (!rigidBody)
+        for (const auto& physicsId : pPhysics->GetDirtyBodies(sceneName))
         {
-            m_pLogger->Error("PhysicsSystem::Post_SimulationStep: Entity with physics state has no physics system body: {}", (uint64_t)entity);
-            continue;
-        }
+            const auto entity = GetPhysicsEntity(sceneName, physicsId);
+            if (!entity || !registry.all_of<TransformComponent, PhysicsComponent>(*entity))
+            {
+                continue;
+            }
 
-        if (!(*rigidBody)->isDirty)
-        {
-            continue;
-        }
+            const auto rigidBody = pPhysics->GetRigidBody(sceneName, physicsId);
+            if (!rigidBody)
+            {
+                m_pLogger->Error("PhysicsSystem::Post_SimulationStep: Entity with physics state has no physics system body: {}", (uint64_t)*entity);
+                continue;
+            }
+
+            auto [transformComponent, physicsComponent] = registry.get<TransformComponent, PhysicsComponent>(*entity);
 
-        SyncEntityToPhysicsData(transformComponent, physicsComponent, (*rigidBody)->data);
+            SyncEntityToPhysicsData(transformComponent, physicsComponent, (*rigidBody)->data);
 
-        registry.emplace_or_replace<TransformComponent>(entity, transformComponent);
+            registry.emplace_or_replace<TransformComponent>(*entity, transformComponent);
+        }
     }
 
-    pWorldState->GetPhysicsInternal()->MarkBodiesSynced();
+    pPhysics->MarkBodiesSynced();
 }
 
 void PhysicsSystem::FetchContacts(WorldState* pWorld)
@@ -241,21 +305,44 @@ void PhysicsSystem::FetchContacts(WorldState* pWorld)
 
         for (const auto& contact : contacts)
         {
-            const auto entityId1 = m_physicsIdToEntityId.find(contact.body1);
-            if (entityId1 == m_physicsIdToEntityId.cend()) { continue; }
+            const auto entityId1 = GetPhysicsEntity(sceneName, contact.body1);
+            if (!entityId1) { continue; }
 
-            const auto entityId2 = m_physicsIdToEntityId.find(contact.body2);
-            if (entityId2 == m_physicsIdToEntityId.cend()) { continue; }
+            const auto entityId2 = GetPhysicsEntity(sceneName, contact.body2);
+            if (!entityId2) { continue; }
 
             m_entityContacts.push_back(EntityContact{
-                .entity1 = entityId1->second,
-                .entity2 = entityId2->second,
+                .entity1 = *entityId1,
+                .entity2 = *entityId2,
                 .details = contact.details
             });
         }
     }
 }
 
+void PhysicsSystem::SetPhysicsEntity(const PhysicsSceneName& scene, PhysicsId physicsId, EntityId entity)
+{
+    auto& entities = m_physicsIdToEntityId[scene];
+
+    if (entities.size() < physicsId.id + 1)
+    {
+        entities.resize(physicsId.id + 1, entt::null);
+    }
+
+    entities[physicsId.id] = entity;
+}
+
+std::optional<EntityId> PhysicsSystem::GetPhysicsEntity(const PhysicsSceneName& scene, PhysicsId physicsId) const
+{
+    const auto it = m_physicsIdToEntityId.find(scene);
+    if (it == m_physicsIdToEntityId.cend() || physicsId.id >= it->second.size() || it->second[physicsId.id] == entt::null)
+    {
+        return std::nullopt;
+    }
+
+    return it->second[physicsId.id];
+}
+
 const std::vector<EntityContact>& PhysicsSystem::GetEntityContacts()
 {
     return m_entityContacts;
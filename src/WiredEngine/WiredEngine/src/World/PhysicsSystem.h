@@ -11,8 +11,15 @@
 
 #include "../InternalIds.h"
 
+#include "../Physics/PhysicsInternal.h"
+
 #include <Wired/Engine/Physics/PhysicsCommon.h>
 
+#include <optional>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace NCommon
 {
     class ILogger;
@@ -28,6 +35,7 @@ namespace Wired::Engine
             PhysicsSystem(NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, WorldState* pWorldState);
 
             [[nodiscard]] Type GetType() const noexcept override { return Type::Physics; }
+            [[nodiscard]] Access GetAccess() const override;
 
             void Initialize(entt::basic_registry<EntityId>& registry) override;
 
@@ -48,6 +56,20 @@ namespace Wired::Engine
 
             void FetchContacts(WorldState* pWorld);
 
+            void SetPhysicsEntity(const PhysicsSceneName& scene, PhysicsId physicsId, EntityId entity);
+            [[nodiscard]] std::optional<EntityId> GetPhysicsEntity(const PhysicsSceneName& scene, PhysicsId physicsId) const;
+
+        private:
+
+            // Pending body adds/removes for a physics scene, applied in batches. Kept around between
+            // steps so their memory is re-used.
+            struct SceneBatch
+            {
+                std::vector<EntityId> toAddEntities;
+                std::vector<RigidBodyData> toAddBodyData;
+                std::vector<PhysicsId> toDeletePhysicsIds;
+            };
+
         private:
 
             NCommon::ILogger* m_pLogger;
@@ -60,7 +82,10 @@ namespace Wired::Engine
             std::unordered_set<EntityId> m_toUpdateEntities;
             std::unordered_map<EntityId, std::pair<PhysicsSceneName, PhysicsId>> m_toDeleteEntities;
 
-            std::unordered_map<PhysicsId, EntityId> m_physicsIdToEntityId;
+            // Physics scene -> physics id (index) -> entity
+            std::unordered_map<PhysicsSceneName, std::vector<EntityId>> m_physicsIdToEntityId;
+
+            std::unordered_map<PhysicsSceneName, SceneBatch> m_sceneBatches;
 
             std::vector<EntityContact> m_entityContacts;
     };
@@ -6,6 +6,8 @@
  
 #include "RendererSyncer.h"
 #include "RenderableStateComponent.h"
+#include "WorldTransformStateComponent.h"
+#include "TransformHierarchy.h"
 
 #include "../Resources.h"
 #include "../RunState.h"
@@ -29,8 +31,10 @@ RendererSyncer::RendererSyncer(NCommon::ILogger* pLogger,
     , m_pResources(pResources)
     , m_pRenderer(pRenderer)
     , m_worldName(std::move(worldName))
+    , m_stateUpdatePool(Render::StateUpdatePool::Create())
 {
-    m_stateUpdate.groupName = m_worldName;
+    m_stateUpdate = m_stateUpdatePool->Acquire();
+    m_stateUpdate->groupName = m_worldName;
 }
 
 RendererSyncer::~RendererSyncer()
@@ -39,6 +43,8 @@ RendererSyncer::~RendererSyncer()
     m_pResources = nullptr;
     m_pRenderer = nullptr;
     m_worldName = {};
+    m_stateUpdate = nullptr;
+    m_stateUpdatePool = nullptr;
 }
 
 void RendererSyncer::Initialize(entt::basic_registry<EntityId>& registry)
@@ -51,9 +57,14 @@ void RendererSyncer::Initialize(entt::basic_registry<EntityId>& registry)
     // bring the renderer in sync with the current state of the entities.
     //
     registry.on_construct<TransformComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
-    registry.on_update<TransformComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
+    registry.on_update<TransformComponent>().connect<&RendererSyncer::OnTransformComponentUpdated>(this);
     registry.on_destroy<TransformComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
 
+    // Attached entities render at their world transform, which only changes when it's actually been moved
+    registry.on_construct<WorldTransformStateComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
+    registry.on_update<WorldTransformStateComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
+    registry.on_destroy<WorldTransformStateComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
+
     registry.on_construct<MeshRenderableComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
     registry.on_update<MeshRenderableComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
     registry.on_destroy<MeshRenderableComponent>().connect<&RendererSyncer::OnRenderableComponentTouched>(this);
@@ -80,23 +91,31 @@ void RendererSyncer::Destroy(entt::basic_registry<EntityId>&)
 
 void RendererSyncer::Execute(RunState* pRunState, const IWorldState*, entt::basic_registry<EntityId>& registry)
 {
+    std::unordered_set<EntityId> invalidatedEntities;
+    {
+        std::lock_guard<std::mutex> lock(m_invalidedEntitiesMutex);
+        std::swap(invalidatedEntities, m_invalidedEntities);
+    }
+
     // Process each registry entity that had a relevant component touched in some way
-    for (const auto& entity : m_invalidedEntities)
+    for (const auto& entity : invalidatedEntities)
     {
         ProcessInvalidatedEntity(pRunState, registry, entity);
     }
-    m_invalidedEntities.clear();
 
     // Process custom draw commands
     ProcessCustomDrawComponents(pRunState, registry);
 }
 
-Render::StateUpdate RendererSyncer::PopStateUpdate() noexcept
+std::shared_ptr<const Render::StateUpdate> RendererSyncer::PopStateUpdate()
 {
-    auto stateUpdate = m_stateUpdate;
+    // The renderer returns deleted ids to their pools, so it must only see each of them once
+    m_stateUpdate->RemoveDuplicateDeletes();
 
-    m_stateUpdate = {};
-    m_stateUpdate.groupName = m_worldName;
+    auto stateUpdate = m_stateUpdatePool->Share(std::move(m_stateUpdate));
+
+    m_stateUpdate = m_stateUpdatePool->Acquire();
+    m_stateUpdate->groupName = m_worldName;
 
     return stateUpdate;
 }
@@ -108,9 +127,27 @@ Render::StateUpdate RendererSyncer::PopStateUpdate() noexcept
 
 void RendererSyncer::OnRenderableComponentTouched(entt::basic_registry<EntityId>&, EntityId entity)
 {
+    std::lock_guard<std::mutex> lock(m_invalidedEntitiesMutex);
     m_invalidedEntities.insert(entity);
 }
 
+void RendererSyncer::OnTransformComponentUpdated(entt::basic_registry<EntityId>& registry, EntityId entity)
+{
+    // Transforms are updated on every entity that moves, most of which don't render anything
+    if (!registry.any_of<SpriteRenderableComponent, MeshRenderableComponent, ModelRenderableComponent, LightComponent>(entity))
+    {
+        return;
+    }
+
+    // Attached entities render at their world transform, which invalidates them itself if it actually changed
+    if (registry.all_of<WorldTransformStateComponent>(entity))
+    {
+        return;
+    }
+
+    OnRenderableComponentTouched(registry, entity);
+}
+
 void RendererSyncer::OnRenderableStateComponentDestroyed(entt::basic_registry<EntityId>& registry, EntityId entity)
 {
     const auto& renderableState = registry.get<RenderableStateComponent>(entity);
@@ -119,9 +156,9 @@ void RendererSyncer::OnRenderableStateComponentDestroyed(entt::basic_registry<En
     {
         switch (renderableState.renderableType)
         {
-            case Render::RenderableType::Sprite: { m_stateUpdate.toDeleteSpriteRenderables.insert(Render::SpriteId(renderableId.second.id)); } break;
-            case Render::RenderableType::Object: { m_stateUpdate.toDeleteObjectRenderables.insert(Render::ObjectId(renderableId.second.id)); } break;
-            case Render::RenderableType::Light: { m_stateUpdate.toDeleteLights.insert(Render::LightId(renderableId.second.id)); } break;
+            case Render::RenderableType::Sprite: { m_stateUpdate->toDeleteSpriteRenderables.push_back(Render::SpriteId(renderableId.second.id)); } break;
+            case Render::RenderableType::Object: { m_stateUpdate->toDeleteObjectRenderables.push_back(Render::ObjectId(renderableId.second.id)); } break;
+            case Render::RenderableType::Light: { m_stateUpdate->toDeleteLights.push_back(Render::LightId(renderableId.second.id)); } break;
         }
     }
 }
@@ -169,14 +206,14 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
             auto spriteRenderable = SpriteRenderableFrom(pRunState, registry, entity);
             spriteRenderable.id = Render::SpriteId(renderableState.renderableIds.at(0).id);
 
-            m_stateUpdate.toUpdateSpriteRenderables.push_back(spriteRenderable);
+            m_stateUpdate->toUpdateSpriteRenderables.push_back(spriteRenderable);
         }
         else if (isCompleteMeshRenderable)
         {
             auto objectRenderable = ObjectRenderableFromMeshRenderable(registry, entity);
             objectRenderable.id = Render::ObjectId(renderableState.renderableIds.at(0).id);
 
-            m_stateUpdate.toUpdateObjectRenderables.push_back(objectRenderable);
+            m_stateUpdate->toUpdateObjectRenderables.push_back(objectRenderable);
         }
         else if (isCompleteModelRenderable)
         {
@@ -191,7 +228,7 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
             {
                 for (const auto renderableId : renderableState.renderableIds)
                 {
-                    m_stateUpdate.toDeleteObjectRenderables.insert(Render::ObjectId(renderableId.second.id));
+                    m_stateUpdate->toDeleteObjectRenderables.push_back(Render::ObjectId(renderableId.second.id));
                 }
 
                 renderableState.renderableIds.clear();
@@ -215,11 +252,11 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
 
                 if (hasModelChanged)
                 {
-                    m_stateUpdate.toAddObjectRenderables.push_back(objectRenderableIt.second);
+                    m_stateUpdate->toAddObjectRenderables.push_back(objectRenderableIt.second);
                 }
                 else
                 {
-                    m_stateUpdate.toUpdateObjectRenderables.push_back(objectRenderableIt.second);
+                    m_stateUpdate->toUpdateObjectRenderables.push_back(objectRenderableIt.second);
                 }
             }
 
@@ -230,7 +267,7 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
             auto light = LightFrom(pRunState, registry, entity);
             light.id = Render::LightId(renderableState.renderableIds.at(0).id);
 
-            m_stateUpdate.toUpdateLights.push_back(light);
+            m_stateUpdate->toUpdateLights.push_back(light);
         }
 
         return;
@@ -246,7 +283,7 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
             spriteRenderable.id = {};
             spriteRenderable.id = m_pRenderer->CreateSpriteId();
 
-            m_stateUpdate.toAddSpriteRenderables.push_back(spriteRenderable);
+            m_stateUpdate->toAddSpriteRenderables.push_back(spriteRenderable);
 
             registry.emplace<RenderableStateComponent>(entity, RenderableStateComponent{
                 .renderableType = Render::RenderableType::Sprite,
@@ -259,7 +296,7 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
             objectRenderable.id = {};
             objectRenderable.id = m_pRenderer->CreateObjectId();
 
-            m_stateUpdate.toAddObjectRenderables.push_back(objectRenderable);
+            m_stateUpdate->toAddObjectRenderables.push_back(objectRenderable);
 
             registry.emplace<RenderableStateComponent>(entity, RenderableStateComponent{
                 .renderableType = Render::RenderableType::Object,
@@ -278,7 +315,7 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
                 objectRenderableIt.second.id = objectId;
                 renderableIds.insert({objectRenderableIt.first, Render::RenderableId(objectId.id)});
 
-                m_stateUpdate.toAddObjectRenderables.push_back(objectRenderableIt.second);
+                m_stateUpdate->toAddObjectRenderables.push_back(objectRenderableIt.second);
             }
 
             registry.emplace<RenderableStateComponent>(entity, RenderableStateComponent{
@@ -293,7 +330,7 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
             light.id = {};
             light.id = m_pRenderer->CreateLightId();
 
-            m_stateUpdate.toAddLights.push_back(light);
+            m_stateUpdate->toAddLights.push_back(light);
 
             registry.emplace<RenderableStateComponent>(entity, RenderableStateComponent{
                 .renderableType = Render::RenderableType::Light,
@@ -307,7 +344,8 @@ void RendererSyncer::ProcessInvalidatedEntity(RunState* pRunState, entt::basic_r
 
 Render::SpriteRenderable RendererSyncer::SpriteRenderableFrom(RunState* pRunState, entt::basic_registry<EntityId>& registry, EntityId entity) const
 {
-    const auto [transform, spriteComponent] = registry.get<TransformComponent, SpriteRenderableComponent>(entity);
+    const auto& spriteComponent = registry.get<SpriteRenderableComponent>(entity);
+    const auto transform = TransformHierarchy::GetWorldTransform(registry, entity);
 
     const auto virtualSurface = NCommon::Surface(pRunState->virtualResolution);
     const auto renderSurface = NCommon::Surface(m_pRenderer->GetRenderSettings().resolution);
@@ -324,7 +362,7 @@ Render::SpriteRenderable RendererSyncer::SpriteRenderableFrom(RunState* pRunStat
 
     // Convert the sprite's position from virtual space to render space
     const auto position_renderSpace = NCommon::Map3DPointBetweenSurfaces<VirtualSpacePoint, NCommon::Point3DReal >(
-        {transform.GetPosition().x, transform.GetPosition().y, transform.GetPosition().z},
+        {transform.position.x, transform.position.y, transform.position.z},
         virtualSurface,
         renderSurface
     );
@@ -333,8 +371,8 @@ Render::SpriteRenderable RendererSyncer::SpriteRenderableFrom(RunState* pRunStat
         .id = {},
         .textureId = spriteComponent.textureId,
         .position = position_renderSpace,
-        .orientation = transform.GetOrientation(),
-        .scale = transform.GetScale(),
+        .orientation = transform.orientation,
+        .scale = transform.scale,
         .srcPixelRect = spriteComponent.srcPixelRect,
         .dstSize = dstSize_renderSpace
     };
@@ -342,15 +380,16 @@ Render::SpriteRenderable RendererSyncer::SpriteRenderableFrom(RunState* pRunStat
 
 Render::ObjectRenderable RendererSyncer::ObjectRenderableFromMeshRenderable(entt::basic_registry<EntityId>& registry, EntityId entity)
 {
-    const auto [transform, meshComponent] = registry.get<TransformComponent, MeshRenderableComponent>(entity);
+    const auto& meshComponent = registry.get<MeshRenderableComponent>(entity);
+    const auto transform = TransformHierarchy::GetWorldTransform(registry, entity);
 
     return {
         .id = {},
         .meshId = meshComponent.meshId,
         .materialId = meshComponent.materialId,
         .castsShadows = meshComponent.castsShadows,
-        .modelTransform = transform.GetTransformMatrix(),
-        .boneTransforms = std::nullopt
+        .modelTransform = transform.transformMatrix,
+        .boneTransforms = {}
     };
 }
 
@@ -371,7 +410,8 @@ std::optional<ModelPose> RendererSyncer::GetModelCurrentPose(const ModelRenderab
 
 RendererSyncer::ModelObjectRenderables RendererSyncer::ObjectRenderablesFromModelRenderable(entt::basic_registry<EntityId>& registry, EntityId entity)
 {
-    const auto [transform, modelComponent] = registry.get<TransformComponent, ModelRenderableComponent>(entity);
+    const auto& modelComponent = registry.get<ModelRenderableComponent>(entity);
+    const auto transform = TransformHierarchy::GetWorldTransform(registry, entity);
 
     ModelObjectRenderables result{};
     result.modelId = modelComponent.modelId;
@@ -400,8 +440,8 @@ RendererSyncer::ModelObjectRenderables RendererSyncer::ObjectRenderablesFromMode
             .meshId = (*loadedModel)->loadedMeshes.at(meshPoseData.meshIndex),
             .materialId = (*loadedModel)->loadedMaterials.at(mesh.materialIndex),
             .castsShadows = modelComponent.castsShadows,
-            .modelTransform = transform.GetTransformMatrix() * meshPoseData.nodeTransform,
-            .boneTransforms = std::nullopt
+            .modelTransform = transform.transformMatrix * meshPoseData.nodeTransform,
+            .boneTransforms = {}
         }});
     }
 
@@ -415,8 +455,8 @@ RendererSyncer::ModelObjectRenderables RendererSyncer::ObjectRenderablesFromMode
             .meshId = (*loadedModel)->loadedMeshes.at(boneMesh.meshPoseData.meshIndex),
             .materialId = (*loadedModel)->loadedMaterials.at(mesh.materialIndex),
             .castsShadows = modelComponent.castsShadows,
-            .modelTransform = transform.GetTransformMatrix() * boneMesh.meshPoseData.nodeTransform,
-            .boneTransforms = boneMesh.boneTransforms
+            .modelTransform = transform.transformMatrix * boneMesh.meshPoseData.nodeTransform,
+            .boneTransforms = m_stateUpdate->boneTransforms.Copy(boneMesh.boneTransforms)
         }});
     }
 
@@ -425,12 +465,13 @@ RendererSyncer::ModelObjectRenderables RendererSyncer::ObjectRenderablesFromMode
 
 Render::Light RendererSyncer::LightFrom(RunState*, entt::basic_registry<EntityId>& registry, EntityId entity) const
 {
-    const auto [transform, lightComponent] = registry.get<TransformComponent, LightComponent>(entity);
+    const auto& lightComponent = registry.get<LightComponent>(entity);
+    const auto transform = TransformHierarchy::GetWorldTransform(registry, entity);
 
     Render::Light light{};
     light.type = lightComponent.type;
     light.castsShadows = lightComponent.castsShadows;
-    light.worldPos = transform.GetPosition();
+    light.worldPos = transform.position;
     light.color = lightComponent.color;
     light.attenuation = lightComponent.attenuationMode;
     light.directionUnit = lightComponent.directionUnit;
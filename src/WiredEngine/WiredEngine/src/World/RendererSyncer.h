@@ -13,11 +13,14 @@
 #include <Wired/Engine/World/ModelRenderableComponent.h>
 
 #include <Wired/Render/StateUpdate.h>
+#include <Wired/Render/StateUpdatePool.h>
 
 #include <entt/entt.hpp>
 
 #include <unordered_set>
 #include <optional>
+#include <memory>
+#include <mutex>
 
 namespace NCommon
 {
@@ -49,7 +52,11 @@ namespace Wired::Engine
             void Destroy(entt::basic_registry<EntityId>& registry);
             void Execute(RunState* pRunState, const IWorldState* pWorld, entt::basic_registry<EntityId>& registry);
 
-            [[nodiscard]] Render::StateUpdate PopStateUpdate() noexcept;
+            /**
+             * Hands off the state update accumulated by Execute calls since the last pop. The update is
+             * shared rather than copied, and is recycled once the renderer releases it.
+             */
+            [[nodiscard]] std::shared_ptr<const Render::StateUpdate> PopStateUpdate();
             //[[nodiscard]] const std::vector<Render::CustomDrawCommand>& GetCustomDrawCommands() const noexcept;
 
         private:
@@ -63,6 +70,7 @@ namespace Wired::Engine
         private:
 
             void OnRenderableComponentTouched(entt::basic_registry<EntityId>& registry, EntityId entity);
+            void OnTransformComponentUpdated(entt::basic_registry<EntityId>& registry, EntityId entity);
             void OnRenderableStateComponentDestroyed(entt::basic_registry<EntityId>& registry, EntityId entity);
 
             void ProcessInvalidatedEntity(RunState* pRunState, entt::basic_registry<EntityId>& registry, EntityId entity);
@@ -83,9 +91,12 @@ namespace Wired::Engine
             Render::IRenderer* m_pRenderer;
             std::string m_worldName;
 
+            // Touched listeners can fire concurrently from world systems executing on different threads
+            std::mutex m_invalidedEntitiesMutex;
             std::unordered_set<EntityId> m_invalidedEntities;
 
-            Render::StateUpdate m_stateUpdate{};
+            std::shared_ptr<Render::StateUpdatePool> m_stateUpdatePool;
+            std::unique_ptr<Render::StateUpdate> m_stateUpdate;
     };
 }
 
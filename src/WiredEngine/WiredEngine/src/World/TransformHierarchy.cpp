@@ -0,0 +1,343 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "TransformHierarchy.h"
+#include "HierarchyComponent.h"
+
+#include "../WorkThreadPool.h"
+
+#include <Wired/Engine/World/TransformComponent.h>
+
+#include <unordered_map>
+#include <algorithm>
+#include <future>
+
+namespace Wired::Engine
+{
+
+namespace
+{
+    [[nodiscard]] TransformComponent GetLocalTransform(const entt::basic_registry<EntityId>& registry, EntityId entity)
+    {
+        const auto* pTransform = registry.try_get<TransformComponent>(entity);
+        return pTransform != nullptr ? *pTransform : TransformComponent{};
+    }
+
+    /**
+     * The matrix composes exactly. The decomposed scale is composed per axis, which ignores the skew produced when
+     * a parent with non-uniform scale has a rotated child; in that case only the matrix is exact, and consumers of
+     * the decomposed values (sprites) render an approximation.
+     */
+    [[nodiscard]] WorldTransformStateComponent Compose(const WorldTransformStateComponent& parentWorld, const TransformComponent& local)
+    {
+        return {
+            .transformMatrix = parentWorld.transformMatrix * local.GetTransformMatrix(),
+            .position = glm::vec3(parentWorld.transformMatrix * glm::vec4(local.GetPosition(), 1.0f)),
+            .orientation = parentWorld.orientation * local.GetOrientation(),
+            .scale = parentWorld.scale * local.GetScale()
+        };
+    }
+}
+
+void TransformHierarchy::Initialize(entt::basic_registry<EntityId>& registry)
+{
+    registry.on_construct<TransformComponent>().connect<&TransformHierarchy::OnTransformComponentTouched>(this);
+    registry.on_update<TransformComponent>().connect<&TransformHierarchy::OnTransformComponentTouched>(this);
+    registry.on_destroy<TransformComponent>().connect<&TransformHierarchy::OnTransformComponentTouched>(this);
+}
+
+void TransformHierarchy::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_dirtyEntitiesMutex);
+    m_dirtyEntities.clear();
+}
+
+void TransformHierarchy::OnTransformComponentTouched(entt::basic_registry<EntityId>&, EntityId entity)
+{
+    MarkDirty(entity);
+}
+
+void TransformHierarchy::MarkDirty(EntityId entity)
+{
+    std::lock_guard<std::mutex> lock(m_dirtyEntitiesMutex);
+    m_dirtyEntities.insert(entity);
+}
+
+bool TransformHierarchy::SetParent(entt::basic_registry<EntityId>& registry, EntityId entity, const std::optional<EntityId>& parent)
+{
+    if (!registry.valid(entity)) { return false; }
+    if (parent && !registry.valid(*parent)) { return false; }
+
+    //
+    // Disallow attaching an entity to itself or to one of its own descendants
+    //
+    if (parent)
+    {
+        std::optional<EntityId> ancestor = parent;
+
+        while (ancestor)
+        {
+            if (*ancestor == entity) { return false; }
+
+            const auto* pAncestorHierarchy = registry.try_get<HierarchyComponent>(*ancestor);
+            ancestor = pAncestorHierarchy != nullptr ? pAncestorHierarchy->parent : std::nullopt;
+        }
+    }
+
+    // Nothing to do when detaching an entity which isn't attached to anything
+    if (!parent && !registry.all_of<HierarchyComponent>(entity)) { return true; }
+
+    auto& hierarchy = registry.get_or_emplace<HierarchyComponent>(entity);
+
+    if (hierarchy.parent == parent) { return true; }
+
+    // Removes the hierarchy component from entities which no longer link to anything
+    const auto pruneHierarchy = [&](EntityId e){
+        const auto& h = registry.get<HierarchyComponent>(e);
+        if (!h.parent && !h.firstChild)
+        {
+            registry.erase<HierarchyComponent>(e);
+        }
+    };
+
+    //
+    // Unlink the entity from its current parent's children
+    //
+    if (hierarchy.parent)
+    {
+        const auto oldParent = *hierarchy.parent;
+
+        if (hierarchy.prevSibling)
+        {
+            registry.get<HierarchyComponent>(*hierarchy.prevSibling).nextSibling = hierarchy.nextSibling;
+        }
+        else
+        {
+            registry.get<HierarchyComponent>(oldParent).firstChild = hierarchy.nextSibling;
+        }
+
+        if (hierarchy.nextSibling)
+        {
+            registry.get<HierarchyComponent>(*hierarchy.nextSibling).prevSibling = hierarchy.prevSibling;
+        }
+
+        hierarchy.parent = std::nullopt;
+        hierarchy.prevSibling = std::nullopt;
+        hierarchy.nextSibling = std::nullopt;
+
+        // Note: Invalidates the hierarchy reference, as erasing may relocate other entities' components
+        pruneHierarchy(oldParent);
+    }
+
+    //
+    // Link the entity in as the first of its new parent's children
+    //
+    if (parent)
+    {
+        auto& parentHierarchy = registry.get_or_emplace<HierarchyComponent>(*parent);
+
+        // Note: get_or_emplace may have relocated the entity's component
+        auto& entityHierarchy = registry.get<HierarchyComponent>(entity);
+        entityHierarchy.parent = parent;
+        entityHierarchy.nextSibling = parentHierarchy.firstChild;
+
+        if (parentHierarchy.firstChild)
+        {
+            registry.get<HierarchyComponent>(*parentHierarchy.firstChild).prevSibling = entity;
+        }
+
+        parentHierarchy.firstChild = entity;
+    }
+    else
+    {
+        // A detached entity's world transform is its local transform
+        registry.remove<WorldTransformStateComponent>(entity);
+
+        pruneHierarchy(entity);
+    }
+
+    MarkDirty(entity);
+
+    return true;
+}
+
+std::vector<EntityId> TransformHierarchy::GetSubtree(const entt::basic_registry<EntityId>& registry, EntityId entity)
+{
+    std::vector<EntityId> subtree{entity};
+
+    for (std::size_t x = 0; x < subtree.size(); ++x)
+    {
+        const auto* pHierarchy = registry.try_get<HierarchyComponent>(subtree[x]);
+        if (pHierarchy == nullptr) { continue; }
+
+        for (auto child = pHierarchy->firstChild; child; child = registry.get<HierarchyComponent>(*child).nextSibling)
+        {
+            subtree.push_back(*child);
+        }
+    }
+
+    return subtree;
+}
+
+WorldTransformStateComponent TransformHierarchy::GetWorldTransform(const entt::basic_registry<EntityId>& registry, EntityId entity)
+{
+    if (const auto* pWorldTransform = registry.try_get<WorldTransformStateComponent>(entity))
+    {
+        return *pWorldTransform;
+    }
+
+    return WorldTransformStateComponent::From(GetLocalTransform(registry, entity));
+}
+
+void TransformHierarchy::Execute(WorkThreadPool* pWorkThreadPool, entt::basic_registry<EntityId>& registry)
+{
+    std::unordered_set<EntityId> dirtyEntities;
+    {
+        std::lock_guard<std::mutex> lock(m_dirtyEntitiesMutex);
+        std::swap(dirtyEntities, m_dirtyEntities);
+    }
+
+    //
+    // Find the dirty entities within hierarchies which don't have a dirty ancestor; recomputing their
+    // subtrees covers every other dirty entity. Group them by hierarchy root, as separate hierarchies
+    // share no state and can be computed independently.
+    //
+    std::unordered_map<EntityId, std::vector<EntityId>> subtreeRootsByRoot;
+
+    for (const auto& entity : dirtyEntities)
+    {
+        if (!registry.valid(entity)) { continue; }
+
+        // Entities outside of any hierarchy have no world transform state to maintain
+        const auto* pHierarchy = registry.try_get<HierarchyComponent>(entity);
+        if (pHierarchy == nullptr) { continue; }
+
+        bool hasDirtyAncestor = false;
+        auto root = entity;
+
+        for (auto ancestor = pHierarchy->parent; ancestor; ancestor = registry.get<HierarchyComponent>(*ancestor).parent)
+        {
+            if (dirtyEntities.contains(*ancestor)) { hasDirtyAncestor = true; break; }
+            root = *ancestor;
+        }
+
+        if (hasDirtyAncestor) { continue; }
+
+        subtreeRootsByRoot[root].push_back(entity);
+    }
+
+    if (subtreeRootsByRoot.empty())
+    {
+        return;
+    }
+
+    //
+    // Split the hierarchies into batches and compute the batches in parallel; one batch per pool thread, plus
+    // one for this thread
+    //
+    const auto numBatches = std::min<std::size_t>(subtreeRootsByRoot.size(), pWorkThreadPool->GetNumThreads() + 1);
+
+    std::vector<std::vector<EntityId>> batches(numBatches);
+
+    std::size_t hierarchyIndex = 0;
+    for (auto& it : subtreeRootsByRoot)
+    {
+        auto& batch = batches[hierarchyIndex++ % numBatches];
+        batch.insert(batch.end(), it.second.cbegin(), it.second.cend());
+    }
+
+    // Note that workers only read from the registry; all writes happen below, on this thread, once they've finished
+    const auto& constRegistry = registry;
+
+    std::vector<std::future<std::vector<WorldTransformUpdate>>> batchFutures;
+
+    for (std::size_t x = 1; x < numBatches; ++x)
+    {
+        batchFutures.push_back(pWorkThreadPool->SubmitForResult<std::vector<WorldTransformUpdate>>(
+            [&constRegistry, &batches, x](bool const*){ return ComputeSubtrees(constRegistry, batches[x]); }
+        ));
+    }
+
+    std::vector<std::vector<WorldTransformUpdate>> batchUpdates;
+    batchUpdates.push_back(ComputeSubtrees(constRegistry, batches[0]));
+
+    for (auto& batchFuture : batchFutures)
+    {
+        batchUpdates.push_back(batchFuture.get());
+    }
+
+    //
+    // Apply the world transforms which changed
+    //
+    for (const auto& updates : batchUpdates)
+    {
+        for (const auto& update : updates)
+        {
+            registry.emplace_or_replace<WorldTransformStateComponent>(update.entity, update.worldTransform);
+        }
+    }
+}
+
+std::vector<TransformHierarchy::WorldTransformUpdate> TransformHierarchy::ComputeSubtrees(const entt::basic_registry<EntityId>& registry,
+                                                                                          const std::vector<EntityId>& subtreeRoots)
+{
+    std::vector<WorldTransformUpdate> updates;
+
+    struct Visit
+    {
+        EntityId entity{};
+        WorldTransformStateComponent parentWorld{};
+    };
+
+    std::vector<Visit> toVisit;
+
+    const auto pushChildren = [&](EntityId entity, const WorldTransformStateComponent& world){
+        for (auto child = registry.get<HierarchyComponent>(entity).firstChild; child; child = registry.get<HierarchyComponent>(*child).nextSibling)
+        {
+            toVisit.push_back(Visit{.entity = *child, .parentWorld = world});
+        }
+    };
+
+    for (const auto& subtreeRoot : subtreeRoots)
+    {
+        const auto& hierarchy = registry.get<HierarchyComponent>(subtreeRoot);
+
+        //
+        // A hierarchy root holds no world transform state; its children are relative to its local transform
+        //
+        if (hierarchy.parent)
+        {
+            toVisit.push_back(Visit{.entity = subtreeRoot, .parentWorld = GetWorldTransform(registry, *hierarchy.parent)});
+        }
+        else
+        {
+            pushChildren(subtreeRoot, WorldTransformStateComponent::From(GetLocalTransform(registry, subtreeRoot)));
+        }
+
+        //
+        // Walk the subtree depth first, so every entity's parent world transform is known before it's visited
+        //
+        while (!toVisit.empty())
+        {
+            const auto visit = toVisit.back();
+            toVisit.pop_back();
+
+            const auto world = Compose(visit.parentWorld, GetLocalTransform(registry, visit.entity));
+
+            const auto* pCurrentWorld = registry.try_get<WorldTransformStateComponent>(visit.entity);
+            if (pCurrentWorld == nullptr || *pCurrentWorld != world)
+            {
+                updates.push_back(WorldTransformUpdate{.entity = visit.entity, .worldTransform = world});
+            }
+
+            pushChildren(visit.entity, world);
+        }
+    }
+
+    return updates;
+}
+
+}
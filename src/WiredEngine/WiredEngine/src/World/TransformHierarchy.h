@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_WORLD_TRANSFORMHIERARCHY_H
+#define WIREDENGINE_WIREDENGINE_SRC_WORLD_TRANSFORMHIERARCHY_H
+
+#include "WorldTransformStateComponent.h"
+
+#include <Wired/Engine/World/WorldCommon.h>
+
+#include <entt/entt.hpp>
+
+#include <unordered_set>
+#include <vector>
+#include <optional>
+#include <mutex>
+
+namespace Wired::Engine
+{
+    class WorkThreadPool;
+
+    /**
+     * Maintains parent/child links between entities and the world transforms of attached entities.
+     *
+     * An attached entity's TransformComponent is relative to its parent. Touching an entity's TransformComponent
+     * marks it dirty; Execute then recomputes world transforms for only the dirty entities' subtrees, walking each
+     * subtree parent before child, and with independent hierarchies processed in parallel. An entity's
+     * WorldTransformStateComponent is only written when its world transform actually changed.
+     */
+    class TransformHierarchy
+    {
+        public:
+
+            void Initialize(entt::basic_registry<EntityId>& registry);
+            void Reset();
+
+            /**
+             * Attaches an entity to a parent, or detaches it from its current parent if parent is nullopt. The
+             * entity's TransformComponent is left as-is, and is thereafter relative to its new parent.
+             *
+             * @return False if either entity is invalid or if the attachment would create a cycle
+             */
+            [[nodiscard]] bool SetParent(entt::basic_registry<EntityId>& registry, EntityId entity, const std::optional<EntityId>& parent);
+
+            /**
+             * @return The entity followed by all of its descendants, parents before children
+             */
+            [[nodiscard]] static std::vector<EntityId> GetSubtree(const entt::basic_registry<EntityId>& registry, EntityId entity);
+
+            /**
+             * @return The entity's world transform; its local transform if it's not attached to a parent
+             */
+            [[nodiscard]] static WorldTransformStateComponent GetWorldTransform(const entt::basic_registry<EntityId>& registry, EntityId entity);
+
+            /**
+             * Recomputes the world transforms of dirty subtrees. Must be called from the engine thread, while no
+             * world systems are executing.
+             */
+            void Execute(WorkThreadPool* pWorkThreadPool, entt::basic_registry<EntityId>& registry);
+
+        private:
+
+            struct WorldTransformUpdate
+            {
+                EntityId entity{};
+                WorldTransformStateComponent worldTransform{};
+            };
+
+        private:
+
+            void OnTransformComponentTouched(entt::basic_registry<EntityId>& registry, EntityId entity);
+
+            void MarkDirty(EntityId entity);
+
+            [[nodiscard]] static std::vector<WorldTransformUpdate> ComputeSubtrees(const entt::basic_registry<EntityId>& registry,
+                                                                                   const std::vector<EntityId>& subtreeRoots);
+
+        private:
+
+            // Touched listeners can fire concurrently from world systems executing on different threads
+            std::mutex m_dirtyEntitiesMutex;
+            std::unordered_set<EntityId> m_dirtyEntities;
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_WORLD_TRANSFORMHIERARCHY_H
@@ -9,10 +9,13 @@
 #include "RendererSyncer.h"
 #include "PhysicsSystem.h"
 #include "AudioSystem.h"
+#include "TransformHierarchy.h"
+#include "HierarchyComponent.h"
 
 #include "../Audio/AudioManager.h"
 
 #include "../Physics/JoltPhysics.h"
+#include "../RunState.h"
 
 #include <Wired/Engine/IPackages.h>
 #include <Wired/Engine/World/Camera2D.h>
@@ -23,16 +26,35 @@
 #include <Wired/Engine/Package/IPackageSource.h>
 #include <Wired/Engine/Package/SceneNodeTransformComponent.h>
 #include <Wired/Engine/Package/SceneNodeRenderableSpriteComponent.h>
+#include <Wired/Engine/Package/SceneNodeRenderableModelComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsBoxComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsSphereComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsHeightMapComponent.h>
 
 #include <Wired/Render/IRenderer.h>
 
 #include <NEON/Common/Log/ILogger.h>
 
 #include <cassert>
+#include <algorithm>
+#include <limits>
 
 namespace Wired::Engine
 {
 
+namespace
+{
+    // The world system being executed by the current thread, if any. Systems of a world may be executed
+    // concurrently on different threads, so this is tracked per thread rather than per world.
+    struct ExecutingSystem
+    {
+        const WorldState* pWorld{nullptr};
+        IWorldSystem::Type type{};
+    };
+
+    thread_local std::optional<ExecutingSystem> tl_executingSystem;
+}
+
 WorldState::WorldState(std::string worldName,
                        NCommon::ILogger* pLogger,
                        NCommon::IMetrics* pMetrics,
@@ -63,6 +85,7 @@ WorldState::~WorldState()
     m_pRenderer = nullptr;
     m_pPhysics = nullptr;
     m_rendererSyncer = nullptr;
+    m_transformHierarchy = nullptr;
 }
 
 std::string WorldState::GetName() const
@@ -80,6 +103,9 @@ bool WorldState::StartUp()
 
     CreateWorldSystems();
 
+    m_transformHierarchy = std::make_unique<TransformHierarchy>();
+    m_transformHierarchy->Initialize(m_registry);
+
     // RendererSyncer is a fake/unique system which is stored here as a kind-of system, but it doesn't get executed with
     // the other systems; it only gets run when a new frame render needs to happen, so it isn't executed on sim steps
     // like other systems might
@@ -91,14 +117,20 @@ bool WorldState::StartUp()
 
 void WorldState::CreateWorldSystems()
 {
-    m_systems.insert({IWorldSystem::Type::ModelAnimator, std::make_unique<ModelAnimatorSystem>(m_pLogger, m_pResources)});
-    m_systems.insert({IWorldSystem::Type::Physics, std::make_unique<PhysicsSystem>(m_pLogger, m_pMetrics, this)});
-    m_systems.insert({IWorldSystem::Type::Audio, std::make_unique<AudioSystem>(m_pLogger, m_pAudioManager)});
+    // Note that registration order is the order conflicting systems are executed in
+    m_systems.push_back(std::make_unique<ModelAnimatorSystem>(m_pLogger, m_pResources));
+    m_systems.push_back(std::make_unique<PhysicsSystem>(m_pLogger, m_pMetrics, this));
+    m_systems.push_back(std::make_unique<AudioSystem>(m_pLogger, m_pAudioManager));
+
+    std::vector<IWorldSystem*> systems;
 
     for (auto& system: m_systems)
     {
-        system.second->Initialize(m_registry);
+        system->Initialize(m_registry);
+        systems.push_back(system.get());
     }
+
+    m_systemGraph = WorldSystemScheduler::BuildGraph(m_pLogger, systems);
 }
 
 void WorldState::Reset()
@@ -107,11 +139,13 @@ void WorldState::Reset()
 
     for (auto& system: m_systems)
     {
-        system.second->Reset(m_registry);
+        system->Reset(m_registry);
     }
 
     m_pPhysics->Reset();
 
+    m_transformHierarchy->Reset();
+
     m_cameraIds.Reset();
     m_defaultCamera3DId = {};
     m_defaultCamera2DId = {};
@@ -119,8 +153,6 @@ void WorldState::Reset()
 
     m_skyBoxTextureId = std::nullopt;
     m_skyBoxTransform = std::nullopt;
-
-    m_executingSystem = std::nullopt;
 }
 
 void WorldState::Destroy()
@@ -129,7 +161,7 @@ void WorldState::Destroy()
 
     for (auto& system: m_systems)
     {
-        system.second->Destroy(m_registry);
+        system->Destroy(m_registry);
     }
 
     m_pPhysics->ShutDown();
@@ -141,8 +173,6 @@ void WorldState::Destroy()
 
     m_skyBoxTextureId = std::nullopt;
     m_skyBoxTransform = std::nullopt;
-
-    m_executingSystem = std::nullopt;
 }
 
 CameraId WorldState::CreateCamera(CameraType type)
@@ -225,12 +255,62 @@ EntityId WorldState::CreateEntity()
 
 void WorldState::DestroyEntity(const EntityId& entityId)
 {
-    m_registry.destroy(entityId);
+    if (!m_registry.all_of<HierarchyComponent>(entityId))
+    {
+        m_registry.destroy(entityId);
+        return;
+    }
+
+    //
+    // Detach the entity from its parent, then destroy it along with all of its descendants, children first
+    //
+    const auto subtree = TransformHierarchy::GetSubtree(m_registry, entityId);
+
+    (void)m_transformHierarchy->SetParent(m_registry, entityId, std::nullopt);
+
+    std::for_each(subtree.crbegin(), subtree.crend(), [&](const auto& entity){
+        m_registry.destroy(entity);
+    });
+}
+
+bool WorldState::SetEntityParent(const EntityId& entityId, const std::optional<EntityId>& parentId)
+{
+    // Physics bodies are simulated in world space, which a parent-relative TransformComponent isn't
+    if (parentId && m_registry.valid(entityId) && m_registry.all_of<PhysicsComponent>(entityId))
+    {
+        LogError("WorldState::SetEntityParent: Entities with a physics component can't be attached to a parent: {}", (uint64_t)entityId);
+        return false;
+    }
+
+    if (!m_transformHierarchy->SetParent(m_registry, entityId, parentId))
+    {
+        LogError("WorldState::SetEntityParent: Failed to set parent of entity {}", (uint64_t)entityId);
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<TransformComponent> WorldState::GetEntityWorldTransform(const EntityId& entityId) const
+{
+    if (!m_registry.valid(entityId))
+    {
+        return std::nullopt;
+    }
+
+    const auto worldTransform = TransformHierarchy::GetWorldTransform(m_registry, entityId);
+
+    TransformComponent transform{};
+    transform.SetPosition(worldTransform.position);
+    transform.SetOrientation(worldTransform.orientation);
+    transform.SetScale(worldTransform.scale);
+
+    return transform;
 }
 
 const std::vector<EntityContact>& WorldState::GetPhysicsContacts()
 {
-    return dynamic_cast<PhysicsSystem*>(m_systems.at(IWorldSystem::Type::Physics).get())->GetEntityContacts();
+    return dynamic_cast<PhysicsSystem*>(GetWorldSystem(IWorldSystem::Type::Physics))->GetEntityContacts();
 }
 
 std::expected<AudioSourceId, bool> WorldState::PlayEntityResourceSound(const EntityId& entity,
@@ -244,7 +324,7 @@ std::expected<AudioSourceId, bool> WorldState::PlayEntityResourceSound(const Ent
 
     if (HasComponent<TransformComponent>(entity))
     {
-        entityPosition = GetComponent<TransformComponent>(entity)->GetPosition();
+        entityPosition = TransformHierarchy::GetWorldTransform(m_registry, entity).position;
     }
 
     //
@@ -333,125 +413,221 @@ std::optional<LoadedSceneEntities> WorldState::LoadPackageSceneEntities(const Pa
     //
     // Find and load the scene
     //
-    const auto it = std::ranges::find_if(package.scenes, [&](const auto& scene){
+    const auto it = std::ranges::find_if(package.compiledScenes, [&](const auto& scene){
         return scene->name == sceneName;
     });
-    if (it == package.scenes.cend())
+    if (it == package.compiledScenes.cend())
     {
         LogError("WorldState::LoadPackageSceneEntities: Scene doesnt exist: {}", sceneName);
         return std::nullopt;
     }
 
-    return LoadSceneEntities(it->get(), *packageResources, transform);
+    // Package scenes were compiled when the package was read, so they're loaded without being compiled again
+    return LoadCompiledSceneEntities(**it, *packageResources, transform);
 }
 
 std::optional<LoadedSceneEntities> WorldState::LoadSceneEntities(const Scene* pScene,
                                                                  const PackageResources& packageResources,
                                                                  const TransformComponent& transform)
+{
+    return LoadCompiledSceneEntities(CompileScene(*pScene), packageResources, transform);
+}
+
+namespace
+{
+    /**
+     * Gathers the components of one type for a batch of scene entities so they can be inserted into the registry
+     * together. An entity can only hold one component of a type, so a later component for the same entity replaces
+     * the earlier one, as emplace_or_replace would.
+     */
+    template <typename T>
+    struct ComponentBatch
+    {
+        static constexpr auto NO_SLOT = std::numeric_limits<std::size_t>::max();
+
+        explicit ComponentBatch(std::size_t entityCount)
+            : slots(entityCount, NO_SLOT)
+        { }
+
+        void Set(uint32_t entityIndex, EntityId entityId, const T& component)
+        {
+            if (slots[entityIndex] != NO_SLOT)
+            {
+                components[slots[entityIndex]] = component;
+                return;
+            }
+
+            slots[entityIndex] = entities.size();
+            entities.push_back(entityId);
+            components.push_back(component);
+        }
+
+        std::vector<std::size_t> slots;
+        std::vector<EntityId> entities;
+        std::vector<T> components;
+    };
+}
+
+std::optional<LoadedSceneEntities> WorldState::LoadCompiledSceneEntities(const CompiledScene& scene,
+                                                                         const PackageResources& packageResources,
+                                                                         const TransformComponent& transform)
 {
     LoadedSceneEntities loadedSceneEntities{};
 
+    const auto entityCount = scene.entityNames.size();
+    if (entityCount == 0)
+    {
+        return loadedSceneEntities;
+    }
+
+    const auto getEntityName = [&](uint32_t entityIndex) -> const std::string& {
+        return scene.strings[scene.entityNames[entityIndex]];
+    };
+
+    const auto getOptionalString = [&](uint32_t index) -> std::optional<std::string> {
+        if (index == CompiledScene::NO_STRING) { return std::nullopt; }
+        return scene.strings[index];
+    };
+
     //
-    // Load scene entities
+    // Create all the scene's entities at once
     //
-    auto sceneEntityNodes = pScene->nodes | std::ranges::views::filter([&](const auto& node){
-        return node->GetType() == Engine::SceneNode::Type::Entity;
-    });
+    std::vector<EntityId> entities(entityCount);
+    m_registry.create(entities.begin(), entities.end());
+
+    loadedSceneEntities.entities.reserve(entityCount);
+    for (uint32_t x = 0; x < entityCount; ++x)
+    {
+        loadedSceneEntities.entities.insert({getEntityName(x), entities[x]});
+    }
+
+    //
+    // Convert the scene's components, batched per engine component type
+    //
+    ComponentBatch<TransformComponent> transformComponents(entityCount);
+    ComponentBatch<SpriteRenderableComponent> spriteComponents(entityCount);
+    ComponentBatch<ModelRenderableComponent> modelComponents(entityCount);
+    ComponentBatch<PhysicsComponent> physicsComponents(entityCount);
+
+    for (std::size_t x = 0; x < scene.transforms.entities.size(); ++x)
+    {
+        const auto entityIndex = scene.transforms.entities[x];
+
+        SceneNodeTransformComponent nodeComponent{};
+        nodeComponent.position = scene.transforms.positions[x];
+        nodeComponent.scale = scene.transforms.scales[x];
+        nodeComponent.eulerRotations = scene.transforms.eulerRotations[x];
+
+        auto transformComponent = Convert(&nodeComponent);
+        transformComponent.SetPosition(transformComponent.GetPosition() + transform.GetPosition());
+        transformComponent.SetScale(transformComponent.GetScale() * transform.GetScale());
+        transformComponent.SetOrientation(transformComponent.GetOrientation() * transform.GetOrientation());
+
+        transformComponents.Set(entityIndex, entities[entityIndex], transformComponent);
+    }
 
-    for (const auto& node : sceneEntityNodes)
+    for (std::size_t x = 0; x < scene.sprites.entities.size(); ++x)
     {
-        const auto entityId = LoadEntitySceneNode(dynamic_cast<EntitySceneNode*>(node.get()), packageResources, transform);
-        if (!entityId)
+        const auto entityIndex = scene.sprites.entities[x];
+
+        SceneNodeRenderableSpriteComponent nodeComponent{};
+        nodeComponent.imageAssetName = getOptionalString(scene.sprites.imageAssetNames[x]);
+        nodeComponent.destVirtualSize = scene.sprites.destVirtualSizes[x];
+
+        const auto component = Convert(packageResources, &nodeComponent);
+        if (!component)
         {
+            LogError("WorldState::LoadCompiledSceneEntities: Failed to convert sprite renderable component for {}", getEntityName(entityIndex));
             continue;
         }
 
-        loadedSceneEntities.entities.insert({node->name, *entityId});
+        spriteComponents.Set(entityIndex, entities[entityIndex], *component);
     }
 
-    return loadedSceneEntities;
-}
+    for (std::size_t x = 0; x < scene.models.entities.size(); ++x)
+    {
+        const auto entityIndex = scene.models.entities[x];
 
-std::optional<EntityId> WorldState::LoadEntitySceneNode(EntitySceneNode const* pEntityNode,
-                                                        const PackageResources& packageResources,
-                                                        const TransformComponent& transform)
-{
-    // Create an entity for the node
-    const auto entityId = CreateEntity();
+        SceneNodeRenderableModelComponent nodeComponent{};
+        nodeComponent.modelAssetName = getOptionalString(scene.models.modelAssetNames[x]);
+
+        const auto component = Convert(packageResources, &nodeComponent);
+        if (!component)
+        {
+            LogError("WorldState::LoadCompiledSceneEntities: Failed to convert model renderable component for {}", getEntityName(entityIndex));
+            continue;
+        }
+
+        modelComponents.Set(entityIndex, entities[entityIndex], *component);
+    }
 
-    // Create entity components
-    for (const auto& component : pEntityNode->components)
+    for (std::size_t x = 0; x < scene.physicsBoxes.entities.size(); ++x)
     {
-        switch (component->GetType())
+        const auto entityIndex = scene.physicsBoxes.entities[x];
+
+        SceneNodePhysicsBoxComponent nodeComponent{};
+        nodeComponent.physicsScene = scene.strings[scene.physicsBoxes.physicsScenes[x]];
+        nodeComponent.localScale = scene.physicsBoxes.localScales[x];
+        nodeComponent.min = scene.physicsBoxes.mins[x];
+        nodeComponent.max = scene.physicsBoxes.maxs[x];
+
+        const auto component = Convert(packageResources, &nodeComponent);
+        if (!component)
         {
-            case SceneNodeComponent::Type::Transform:
-            {
-                auto transformComponent = Convert(dynamic_cast<Engine::SceneNodeTransformComponent*>(component.get()));
-                transformComponent.SetPosition(transformComponent.GetPosition() + transform.GetPosition());
-                transformComponent.SetScale(transformComponent.GetScale() * transform.GetScale());
-                transformComponent.SetOrientation(transformComponent.GetOrientation() * transform.GetOrientation());
-                AddOrUpdateComponent(entityId, transformComponent);
-            }
-            break;
-            case SceneNodeComponent::Type::RenderableSprite:
-            {
-                auto nodeComponent = Convert(packageResources, dynamic_cast<Engine::SceneNodeRenderableSpriteComponent*>(component.get()));
-                if (!nodeComponent)
-                {
-                    LogError("WorldState::LoadEntitySceneNode: Failed to convert sprite renderable component for {}", pEntityNode->name);
-                    continue;
-                }
-                AddOrUpdateComponent(entityId, *nodeComponent);
-            }
-            break;
-            case SceneNodeComponent::Type::RenderableModel:
-            {
-                auto nodeComponent = Convert(packageResources, dynamic_cast<Engine::SceneNodeRenderableModelComponent*>(component.get()));
-                if (!nodeComponent)
-                {
-                    LogError("WorldState::LoadEntitySceneNode: Failed to convert model renderable component for {}", pEntityNode->name);
-                    continue;
-                }
-                AddOrUpdateComponent(entityId, *nodeComponent);
-            }
-            break;
-            case SceneNodeComponent::Type::PhysicsBox:
-            {
-                auto nodeComponent = Convert(packageResources, dynamic_cast<Engine::SceneNodePhysicsBoxComponent*>(component.get()));
-                if (!nodeComponent)
-                {
-                    LogError("WorldState::LoadEntitySceneNode: Failed to convert physics box renderable component for {}", pEntityNode->name);
-                    continue;
-                }
-                AddOrUpdateComponent(entityId, *nodeComponent);
-            }
-            break;
-            case SceneNodeComponent::Type::PhysicsSphere:
-            {
-                auto nodeComponent = Convert(packageResources, dynamic_cast<Engine::SceneNodePhysicsSphereComponent*>(component.get()));
-                if (!nodeComponent)
-                {
-                    LogError("WorldState::LoadEntitySceneNode: Failed to convert physics sphere renderable component for {}", pEntityNode->name);
-                    continue;
-                }
-                AddOrUpdateComponent(entityId, *nodeComponent);
-            }
-            break;
-            case SceneNodeComponent::Type::PhysicsHeightMap:
-            {
-                auto nodeComponent = Convert(packageResources, dynamic_cast<Engine::SceneNodePhysicsHeightMapComponent*>(component.get()));
-                if (!nodeComponent)
-                {
-                    LogError("WorldState::LoadEntitySceneNode: Failed to convert physics height map renderable component for {}", pEntityNode->name);
-                    continue;
-                }
-                AddOrUpdateComponent(entityId, *nodeComponent);
-            }
-            break;
+            LogError("WorldState::LoadCompiledSceneEntities: Failed to convert physics box component for {}", getEntityName(entityIndex));
+            continue;
+        }
+
+        physicsComponents.Set(entityIndex, entities[entityIndex], *component);
+    }
+
+    for (std::size_t x = 0; x < scene.physicsSpheres.entities.size(); ++x)
+    {
+        const auto entityIndex = scene.physicsSpheres.entities[x];
+
+        SceneNodePhysicsSphereComponent nodeComponent{};
+        nodeComponent.physicsScene = scene.strings[scene.physicsSpheres.physicsScenes[x]];
+        nodeComponent.localScale = scene.physicsSpheres.localScales[x];
+        nodeComponent.radius = scene.physicsSpheres.radii[x];
+
+        const auto component = Convert(packageResources, &nodeComponent);
+        if (!component)
+        {
+            LogError("WorldState::LoadCompiledSceneEntities: Failed to convert physics sphere component for {}", getEntityName(entityIndex));
+            continue;
         }
+
+        physicsComponents.Set(entityIndex, entities[entityIndex], *component);
+    }
+
+    for (std::size_t x = 0; x < scene.physicsHeightMaps.entities.size(); ++x)
+    {
+        const auto entityIndex = scene.physicsHeightMaps.entities[x];
+
+        SceneNodePhysicsHeightMapComponent nodeComponent{};
+        nodeComponent.physicsScene = scene.strings[scene.physicsHeightMaps.physicsScenes[x]];
+        nodeComponent.localScale = scene.physicsHeightMaps.localScales[x];
+
+        const auto component = Convert(packageResources, &nodeComponent);
+        if (!component)
+        {
+            LogError("WorldState::LoadCompiledSceneEntities: Failed to convert physics height map component for {}", getEntityName(entityIndex));
+            continue;
+        }
+
+        physicsComponents.Set(entityIndex, entities[entityIndex], *component);
     }
 
-    return entityId;
+    //
+    // Insert each component type as one batch. Transforms go first so that they're present by the time systems
+    // process the entities that the other components' insertions mark as touched.
+    //
+    InsertComponents(transformComponents.entities, transformComponents.components);
+    InsertComponents(spriteComponents.entities, spriteComponents.components);
+    InsertComponents(modelComponents.entities, modelComponents.components);
+    InsertComponents(physicsComponents.entities, physicsComponents.components);
+
+    return loadedSceneEntities;
 }
 
 std::optional<glm::vec3> WorldState::GetPackageScenePlayerPosition(const PackageName& packageName,
@@ -473,10 +649,10 @@ std::optional<glm::vec3> WorldState::GetPackageScenePlayerPosition(const Package
     //
     // Find the scene
     //
-    const auto it = std::ranges::find_if(package.scenes, [&](const auto& scene){
+    const auto it = std::ranges::find_if(package.compiledScenes, [&](const auto& scene){
         return scene->name == sceneName;
     });
-    if (it == package.scenes.cend())
+    if (it == package.compiledScenes.cend())
     {
         LogError("WorldState::GetPackageScenePlayerPosition: Scene doesnt exist: {}", sceneName);
         return std::nullopt;
@@ -485,16 +661,18 @@ std::optional<glm::vec3> WorldState::GetPackageScenePlayerPosition(const Package
     //
     // Find the player
     //
-    const auto it2 = std::ranges::find_if((*it)->nodes, [&](const auto& pNode){
-        return pNode->GetType() == SceneNode::Type::Player && pNode->name == playerName;
+    const auto& players = (*it)->players;
+
+    const auto it2 = std::ranges::find_if(players.names, [&](const auto& nameIndex){
+        return nameIndex < (*it)->strings.size() && (*it)->strings[nameIndex] == playerName;
     });
-    if (it2 == (*it)->nodes.cend())
+    if (it2 == players.names.cend())
     {
         LogError("WorldState::GetPackageScenePlayerPosition: Player doesnt exist: {}", playerName);
         return std::nullopt;
     }
 
-    return std::dynamic_pointer_cast<PlayerSceneNode>(*it2)->position;
+    return players.positions[(std::size_t)std::distance(players.names.cbegin(), it2)];
 }
 
 void WorldState::AssertEntityValid(EntityId entityId) const
@@ -503,25 +681,43 @@ void WorldState::AssertEntityValid(EntityId entityId) const
     assert(m_registry.valid(entityId));
 }
 
-void WorldState::ExecuteSystems(RunState* pRunState)
+void WorldState::ExecuteSystem(RunState* pRunState, IWorldSystem* pSystem)
 {
-    for (const auto& systemIt : m_systems)
-    {
-        m_executingSystem = systemIt.second->GetType();
+    tl_executingSystem = ExecutingSystem{.pWorld = this, .type = pSystem->GetType()};
+
+    pSystem->Execute(pRunState, this, m_registry);
+
+    tl_executingSystem = std::nullopt;
+}
 
-        systemIt.second->Execute(pRunState, this, m_registry);
+std::optional<IWorldSystem::Type> WorldState::GetExecutingSystem() const noexcept
+{
+    if (!tl_executingSystem || tl_executingSystem->pWorld != this)
+    {
+        return std::nullopt;
     }
 
-    m_executingSystem = std::nullopt;
+    return tl_executingSystem->type;
 }
 
 IWorldSystem* WorldState::GetWorldSystem(const IWorldSystem::Type& type) const
 {
-    return m_systems.at(type).get();
+    const auto it = std::ranges::find_if(m_systems, [&](const auto& system){ return system->GetType() == type; });
+    assert(it != m_systems.cend());
+
+    return it->get();
+}
+
+void WorldState::SyncWorldTransforms(RunState* pRunState)
+{
+    m_transformHierarchy->Execute(pRunState->pWorkThreadPool.get(), m_registry);
 }
 
-Render::StateUpdate WorldState::CompileRenderStateUpdate(RunState* pRunState) noexcept
+std::shared_ptr<const Render::StateUpdate> WorldState::CompileRenderStateUpdate(RunState* pRunState)
 {
+    // Catch up on any transforms the client changed outside of a simulation step
+    SyncWorldTransforms(pRunState);
+
     m_rendererSyncer->Execute(pRunState, this, m_registry);
     return m_rendererSyncer->PopStateUpdate();
 }
@@ -8,13 +8,14 @@
 #define WIREDENGINE_WIREDENGINE_SRC_WORLD_WORLDSTATE_H
 
 #include "IWorldSystem.h"
+#include "WorldSystemScheduler.h"
 
 #include "../Physics/IPhysics.h"
 
 #include <Wired/Engine/IPackages.h>
 #include <Wired/Engine/World/IWorldState.h>
 #include <Wired/Engine/Package/Scene.h>
-#include <Wired/Engine/Package/EntitySceneNode.h>
+#include <Wired/Engine/Package/CompiledScene.h>
 
 #include <Wired/Render/StateUpdate.h>
 #include <Wired/Render/Renderable/Light.h>
@@ -24,6 +25,7 @@
 #include <entt/entt.hpp>
 
 #include <unordered_map>
+#include <vector>
 #include <memory>
 #include <string>
 
@@ -45,6 +47,7 @@ namespace Wired::Engine
     class Camera;
     class Resources;
     class RendererSyncer;
+    class TransformHierarchy;
     class AudioManager;
 
     class WorldState : public IWorldState
@@ -71,6 +74,8 @@ namespace Wired::Engine
             // Entities
             [[nodiscard]] EntityId CreateEntity() override;
             void DestroyEntity(const EntityId& entityId) override;
+            [[nodiscard]] bool SetEntityParent(const EntityId& entityId, const std::optional<EntityId>& parentId) override;
+            [[nodiscard]] std::optional<TransformComponent> GetEntityWorldTransform(const EntityId& entityId) const override;
 
             // Physics
             [[nodiscard]] IPhysicsAccess* GetPhysics() const override { return m_pPhysics.get(); }
@@ -103,6 +108,10 @@ namespace Wired::Engine
                                                                                const PackageResources& packageResources,
                                                                                const TransformComponent& transform) override;
 
+            [[nodiscard]] std::optional<LoadedSceneEntities> LoadCompiledSceneEntities(const CompiledScene& scene,
+                                                                                       const PackageResources& packageResources,
+                                                                                       const TransformComponent& transform) override;
+
             [[nodiscard]] std::optional<glm::vec3> GetPackageScenePlayerPosition(const PackageName& packageName,
                                                                                  const std::string& sceneName,
                                                                                  const std::string& playerName) const override;
@@ -114,18 +123,34 @@ namespace Wired::Engine
             //
             // Internal
             //
-            void ExecuteSystems(RunState* pRunState);
+            /**
+             * Executes a single system of this world. May be called concurrently for systems whose accesses don't
+             * conflict, as determined by the world's system graph.
+             */
+            void ExecuteSystem(RunState* pRunState, IWorldSystem* pSystem);
+
+            [[nodiscard]] const WorldSystemGraph& GetSystemGraph() const noexcept { return m_systemGraph; }
 
             [[nodiscard]] IPhysics* GetPhysicsInternal() const noexcept { return m_pPhysics.get(); }
 
             [[nodiscard]] IWorldSystem* GetWorldSystem(const IWorldSystem::Type& type) const;
-            [[nodiscard]] Render::StateUpdate CompileRenderStateUpdate(RunState* pRunState) noexcept;
+
+            /**
+             * Recomputes the world transforms of attached entities whose transforms, or whose ancestors'
+             * transforms, have changed. Run after the world's systems have executed.
+             */
+            void SyncWorldTransforms(RunState* pRunState);
+
+            [[nodiscard]] std::shared_ptr<const Render::StateUpdate> CompileRenderStateUpdate(RunState* pRunState);
             //[[nodiscard]] std::vector<Render::CustomDrawCommand> GetRenderCustomDrawCommands() const noexcept;
 
             [[nodiscard]] const std::optional<Render::TextureId>& GetSkyBoxTextureId() const noexcept { return m_skyBoxTextureId; };
             [[nodiscard]] const std::optional<glm::mat4>& GetSkyBoxTransform() const noexcept { return m_skyBoxTransform; };
 
-            [[nodiscard]] std::optional<IWorldSystem::Type> GetExecutingSystem() const noexcept { return m_executingSystem; }
+            /**
+             * @return The system of this world which the calling thread is currently executing, if any
+             */
+            [[nodiscard]] std::optional<IWorldSystem::Type> GetExecutingSystem() const noexcept;
 
             template <typename T>
             bool HasComponent(EntityId entityId)
@@ -165,9 +190,19 @@ namespace Wired::Engine
 
             void AssertEntityValid(EntityId entityId) const;
 
-            [[nodiscard]] std::optional<EntityId> LoadEntitySceneNode(EntitySceneNode const* pEntityNode,
-                                                                      const PackageResources& packageResources,
-                                                                      const TransformComponent& transform);
+            /**
+             * Inserts a batch of components into the registry in one go, rather than emplacing them one by one
+             */
+            template <typename T>
+            void InsertComponents(const std::vector<EntityId>& entities, const std::vector<T>& components)
+            {
+                if (entities.empty()) { return; }
+
+                auto& storage = m_registry.storage<T>();
+                storage.reserve(storage.size() + entities.size());
+
+                m_registry.insert<T>(entities.cbegin(), entities.cend(), components.cbegin());
+            }
 
         private:
 
@@ -190,10 +225,10 @@ namespace Wired::Engine
             std::optional<Render::TextureId> m_skyBoxTextureId;
             std::optional<glm::mat4> m_skyBoxTransform;
 
-            std::unordered_map<IWorldSystem::Type, std::unique_ptr<IWorldSystem>> m_systems;
+            std::vector<std::unique_ptr<IWorldSystem>> m_systems;
+            WorldSystemGraph m_systemGraph;
             std::unique_ptr<RendererSyncer> m_rendererSyncer;
-
-            std::optional<IWorldSystem::Type> m_executingSystem;
+            std::unique_ptr<TransformHierarchy> m_transformHierarchy;
     };
 }
 
@@ -0,0 +1,274 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "WorldSystemScheduler.h"
+#include "WorldState.h"
+
+#include "../WorkThreadPool.h"
+
+#include <NEON/Common/Log/ILogger.h>
+
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <algorithm>
+
+namespace Wired::Engine
+{
+
+struct WorldSystemScheduler::ExecutionState
+{
+    struct Node
+    {
+        WorldState* pWorld{nullptr};
+        IWorldSystem* pSystem{nullptr};
+        std::vector<std::size_t> dependents;
+        std::size_t numPendingDependencies{0};
+    };
+
+    std::vector<Node> nodes;
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::size_t> ready;
+    std::size_t numRemaining{0};
+
+    std::size_t maxHelpers{0};
+    std::size_t numActiveHelpers{0};
+};
+
+WorldSystemScheduler::WorldSystemScheduler(NCommon::ILogger* pLogger, WorkThreadPool* pWorkThreadPool)
+    : m_pLogger(pLogger)
+    , m_pWorkThreadPool(pWorkThreadPool)
+{
+
+}
+
+WorldSystemScheduler::~WorldSystemScheduler()
+{
+    m_pLogger = nullptr;
+    m_pWorkThreadPool = nullptr;
+}
+
+WorldSystemGraph WorldSystemScheduler::BuildGraph(NCommon::ILogger* pLogger, const std::vector<IWorldSystem*>& systems)
+{
+    const auto isPresent = [&](IWorldSystem::Type type){
+        return std::ranges::any_of(systems, [&](const auto& pSystem){ return pSystem->GetType() == type; });
+    };
+
+    //
+    // Order the systems so that each system comes after the systems it declares it runs after, otherwise
+    // preserving the order the systems were provided in
+    //
+    WorldSystemGraph graph{};
+
+    std::vector<bool> placed(systems.size(), false);
+
+    while (graph.systems.size() < systems.size())
+    {
+        bool placedSystem = false;
+
+        for (std::size_t x = 0; x < systems.size(); ++x)
+        {
+            if (placed[x]) { continue; }
+
+            const auto runsAfter = systems[x]->GetRunsAfter();
+
+            const bool dependenciesPlaced = std::ranges::all_of(runsAfter, [&](const auto& type){
+                return !isPresent(type) || std::ranges::any_of(graph.systems, [&](const auto& pSystem){ return pSystem->GetType() == type; });
+            });
+
+            if (dependenciesPlaced)
+            {
+                graph.systems.push_back(systems[x]);
+                placed[x] = true;
+                placedSystem = true;
+                break;
+            }
+        }
+
+        if (!placedSystem)
+        {
+            pLogger->Error("WorldSystemScheduler::BuildGraph: Cycle detected in system run after declarations, falling back to provided order");
+
+            for (std::size_t x = 0; x < systems.size(); ++x)
+            {
+                if (!placed[x]) { graph.systems.push_back(systems[x]); }
+            }
+            break;
+        }
+    }
+
+    //
+    // A later system depends on an earlier system if it declares it runs after it, or if their accesses conflict
+    //
+    std::vector<IWorldSystem::Access> accesses;
+    accesses.reserve(graph.systems.size());
+
+    for (const auto& pSystem : graph.systems)
+    {
+        accesses.push_back(pSystem->GetAccess());
+    }
+
+    graph.dependents.resize(graph.systems.size());
+
+    for (std::size_t later = 0; later < graph.systems.size(); ++later)
+    {
+        const auto runsAfter = graph.systems[later]->GetRunsAfter();
+
+        for (std::size_t earlier = 0; earlier < later; ++earlier)
+        {
+            const bool explicitDependency = std::ranges::contains(runsAfter, graph.systems[earlier]->GetType());
+
+            if (explicitDependency || accesses[later].ConflictsWith(accesses[earlier]))
+            {
+                graph.dependents[earlier].push_back(later);
+            }
+        }
+    }
+
+    return graph;
+}
+
+void WorldSystemScheduler::Execute(RunState* pRunState, const std::vector<WorldState*>& worlds)
+{
+    //
+    // Merge the graphs of all the worlds into one set of nodes
+    //
+    auto state = std::make_shared<ExecutionState>();
+
+    for (const auto& pWorld : worlds)
+    {
+        const auto& graph = pWorld->GetSystemGraph();
+        const auto nodeOffset = state->nodes.size();
+
+        for (std::size_t x = 0; x < graph.systems.size(); ++x)
+        {
+            ExecutionState::Node node{};
+            node.pWorld = pWorld;
+            node.pSystem = graph.systems[x];
+
+            for (const auto& dependent : graph.dependents[x])
+            {
+                node.dependents.push_back(nodeOffset + dependent);
+            }
+
+            state->nodes.push_back(node);
+        }
+    }
+
+    if (state->nodes.empty())
+    {
+        return;
+    }
+
+    const auto maxHelpers = std::min<std::size_t>(state->nodes.size() - 1, m_pWorkThreadPool->GetNumThreads());
+
+    //
+    // If there's no parallelism available, execute the systems serially; graph order is a valid serial order
+    //
+    if (maxHelpers == 0)
+    {
+        for (const auto& node : state->nodes)
+        {
+            node.pWorld->ExecuteSystem(pRunState, node.pSystem);
+        }
+        return;
+    }
+
+    state->maxHelpers = maxHelpers;
+
+    for (auto& node : state->nodes)
+    {
+        for (const auto& dependent : node.dependents)
+        {
+            state->nodes[dependent].numPendingDependencies++;
+        }
+    }
+
+    for (std::size_t x = 0; x < state->nodes.size(); ++x)
+    {
+        if (state->nodes[x].numPendingDependencies == 0)
+        {
+            state->ready.push_back(x);
+        }
+    }
+
+    state->numRemaining = state->nodes.size();
+
+    //
+    // Helpers execute ready systems until none are ready, and then exit rather than waiting for more systems to
+    // become ready, so that pool threads are never blocked waiting on other work. Whoever finishes a system and
+    // makes more systems ready starts more helpers as needed.
+    //
+    std::unique_lock<std::mutex> lock(state->mutex);
+
+    SpawnHelpers(pRunState, state);
+
+    while (true)
+    {
+        state->cv.wait(lock, [&](){ return !state->ready.empty() || state->numRemaining == 0; });
+
+        if (state->numRemaining == 0)
+        {
+            return;
+        }
+
+        ExecuteReadyNode(pRunState, state, lock);
+    }
+}
+
+void WorldSystemScheduler::SpawnHelpers(RunState* pRunState, const std::shared_ptr<ExecutionState>& state)
+{
+    // Note: called with state's mutex held. The engine thread picks up ready systems as well, so only start
+    // helpers for the systems beyond the first one ready.
+    while (state->numActiveHelpers < state->maxHelpers && state->numActiveHelpers + 1 < state->ready.size())
+    {
+        state->numActiveHelpers++;
+
+        m_pWorkThreadPool->Submit([this, pRunState, state](bool const*){
+            std::unique_lock<std::mutex> lock(state->mutex);
+
+            while (!state->ready.empty())
+            {
+                ExecuteReadyNode(pRunState, state, lock);
+            }
+
+            state->numActiveHelpers--;
+        });
+    }
+}
+
+void WorldSystemScheduler::ExecuteReadyNode(RunState* pRunState,
+                                            const std::shared_ptr<ExecutionState>& state,
+                                            std::unique_lock<std::mutex>& lock)
+{
+    const auto nodeIndex = state->ready.front();
+    state->ready.pop_front();
+
+    lock.unlock();
+    {
+        const auto& node = state->nodes[nodeIndex];
+        node.pWorld->ExecuteSystem(pRunState, node.pSystem);
+    }
+    lock.lock();
+
+    state->numRemaining--;
+
+    for (const auto& dependent : state->nodes[nodeIndex].dependents)
+    {
+        if (--state->nodes[dependent].numPendingDependencies == 0)
+        {
+            state->ready.push_back(dependent);
+        }
+    }
+
+    SpawnHelpers(pRunState, state);
+
+    state->cv.notify_all();
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_WORLD_WORLDSYSTEMSCHEDULER_H
+#define WIREDENGINE_WIREDENGINE_SRC_WORLD_WORLDSYSTEMSCHEDULER_H
+
+#include "IWorldSystem.h"
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <mutex>
+
+namespace NCommon
+{
+    class ILogger;
+}
+
+namespace Wired::Engine
+{
+    class RunState;
+    class WorldState;
+    class WorkThreadPool;
+
+    /**
+     * The order in which a world's systems must execute. Each system may only execute after all the systems
+     * which list it as a dependent have finished executing.
+     */
+    struct WorldSystemGraph
+    {
+        // Systems, in a valid serial execution order
+        std::vector<IWorldSystem*> systems;
+
+        // Per system, the indices of the systems which must wait for it to finish
+        std::vector<std::vector<std::size_t>> dependents;
+    };
+
+    /**
+     * Executes the systems of worlds for a simulation step, running systems which don't depend on each
+     * other concurrently.
+     *
+     * Systems depend on each other if one declares it must run after the other, or if their declared
+     * accesses conflict. Conflicting systems always run in a fixed order, so results are the same as if
+     * all systems were executed serially in that order. Systems of different worlds never depend on each
+     * other.
+     */
+    class WorldSystemScheduler
+    {
+        public:
+
+            WorldSystemScheduler(NCommon::ILogger* pLogger, WorkThreadPool* pWorkThreadPool);
+            ~WorldSystemScheduler();
+
+            /**
+             * Builds the execution graph for a set of systems. Systems listed earlier run first when
+             * not otherwise constrained.
+             */
+            [[nodiscard]] static WorldSystemGraph BuildGraph(NCommon::ILogger* pLogger, const std::vector<IWorldSystem*>& systems);
+
+            /**
+             * Executes the systems of all the provided worlds. Blocks until all systems have finished; the calling
+             * thread executes systems as well. Uses at most as many work pool threads as the pool has, and pool
+             * threads never block waiting on other systems.
+             */
+            void Execute(RunState* pRunState, const std::vector<WorldState*>& worlds);
+
+        private:
+
+            struct ExecutionState;
+
+        private:
+
+            void SpawnHelpers(RunState* pRunState, const std::shared_ptr<ExecutionState>& state);
+            void ExecuteReadyNode(RunState* pRunState,
+                                  const std::shared_ptr<ExecutionState>& state,
+                                  std::unique_lock<std::mutex>& lock);
+
+        private:
+
+            NCommon::ILogger* m_pLogger;
+            WorkThreadPool* m_pWorkThreadPool;
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_WORLD_WORLDSYSTEMSCHEDULER_H
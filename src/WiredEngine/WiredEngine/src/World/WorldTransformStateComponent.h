@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINE_SRC_WORLD_WORLDTRANSFORMSTATECOMPONENT_H
+#define WIREDENGINE_WIREDENGINE_SRC_WORLD_WORLDTRANSFORMSTATECOMPONENT_H
+
+#include <Wired/Engine/World/TransformComponent.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace Wired::Engine
+{
+    /**
+     * The world space transform of an entity which is attached to a parent, as maintained by TransformHierarchy.
+     *
+     * transformMatrix is the exact composition of the entity's ancestors' transforms. The position, orientation and
+     * scale are its decomposed equivalent, which is only exact when ancestors don't combine rotation with
+     * non-uniform scale.
+     */
+    struct WorldTransformStateComponent
+    {
+        [[nodiscard]] static WorldTransformStateComponent From(const TransformComponent& transform)
+        {
+            return {
+                .transformMatrix = transform.GetTransformMatrix(),
+                .position = transform.GetPosition(),
+                .orientation = transform.GetOrientation(),
+                .scale = transform.GetScale()
+            };
+        }
+
+        bool operator==(const WorldTransformStateComponent&) const = default;
+
+        glm::mat4 transformMatrix{1.0f};
+        glm::vec3 position{0.0f};
+        glm::quat orientation{glm::identity<glm::quat>()};
+        glm::vec3 scale{1.0f};
+    };
+}
+
+#endif //WIREDENGINE_WIREDENGINE_SRC_WORLD_WORLDTRANSFORMSTATECOMPONENT_H
@@ -0,0 +1,259 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_AUDIOUTILTESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_AUDIOUTILTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "Audio/AudioUtil.h"
+
+#include <cstring>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Wired::Engine
+{
+    static void AppendWavBytes(std::vector<std::byte>& bytes, const std::string& str)
+    {
+        for (const auto& c : str) { bytes.push_back(std::byte(c)); }
+    }
+
+    static void AppendWavUInt16(std::vector<std::byte>& bytes, uint16_t value)
+    {
+        bytes.push_back(std::byte(value & 0xFF));
+        bytes.push_back(std::byte((value >> 8) & 0xFF));
+    }
+
+    static void AppendWavUInt32(std::vector<std::byte>& bytes, uint32_t value)
+    {
+        AppendWavUInt16(bytes, (uint16_t)(value & 0xFFFF));
+        AppendWavUInt16(bytes, (uint16_t)((value >> 16) & 0xFFFF));
+    }
+
+    /**
+     * Appends a RIFF chunk, including its pad byte if its size is odd
+     */
+    static void AppendWavChunk(std::vector<std::byte>& bytes, const std::string& id, const std::vector<std::byte>& data)
+    {
+        AppendWavBytes(bytes, id);
+        AppendWavUInt32(bytes, (uint32_t)data.size());
+        bytes.insert(bytes.end(), data.cbegin(), data.cend());
+        if (data.size() % 2 != 0) { bytes.push_back(std::byte{0}); }
+    }
+
+    [[nodiscard]] static std::vector<std::byte> MakeWavFmtChunkData(uint16_t audioFormat, uint16_t numChannels, uint32_t sampleRate, uint16_t bitDepth)
+    {
+        const auto blockAlign = (uint16_t)(numChannels * (bitDepth / 8));
+
+        std::vector<std::byte> fmt;
+        AppendWavUInt16(fmt, audioFormat);
+        AppendWavUInt16(fmt, numChannels);
+        AppendWavUInt32(fmt, sampleRate);
+        AppendWavUInt32(fmt, sampleRate * blockAlign);
+        AppendWavUInt16(fmt, blockAlign);
+        AppendWavUInt16(fmt, bitDepth);
+        return fmt;
+    }
+
+    [[nodiscard]] static std::vector<std::byte> MakeWavPCM16Data(const std::vector<int16_t>& samples)
+    {
+        std::vector<std::byte> data;
+        for (const auto& sample : samples) { AppendWavUInt16(data, (uint16_t)sample); }
+        return data;
+    }
+
+    /**
+     * Wraps a sequence of already encoded chunks into a RIFF WAVE file
+     */
+    [[nodiscard]] static std::vector<std::byte> MakeWavFile(const std::vector<std::byte>& chunks)
+    {
+        std::vector<std::byte> bytes;
+        AppendWavBytes(bytes, "RIFF");
+        AppendWavUInt32(bytes, (uint32_t)(4 + chunks.size()));
+        AppendWavBytes(bytes, "WAVE");
+        bytes.insert(bytes.end(), chunks.cbegin(), chunks.cend());
+        return bytes;
+    }
+
+    [[nodiscard]] static int16_t DecodedSample16(const NCommon::AudioData& audioData, std::size_t sampleIndex)
+    {
+        int16_t sample{0};
+        std::memcpy(&sample, audioData.data.data() + (sampleIndex * 2), 2);
+        return sample;
+    }
+
+    TEST(AudioUtilTests, ParsesSimplePCM16)
+    {
+        std::vector<std::byte> chunks;
+        AppendWavChunk(chunks, "fmt ", MakeWavFmtChunkData(1, 2, 44100, 16));
+        AppendWavChunk(chunks, "data", MakeWavPCM16Data({100, -100, 200, -200, 300, -300}));
+
+        const auto streamedAudio = AudioUtil::StreamedAudioFromBytes(MakeWavFile(chunks));
+        ASSERT_TRUE(streamedAudio.has_value());
+
+        EXPECT_EQ((*streamedAudio)->format, NCommon::AudioDataFormat::Stereo16);
+        EXPECT_EQ((*streamedAudio)->sampleRate, 44100U);
+        EXPECT_EQ((*streamedAudio)->numChannels, 2U);
+        EXPECT_EQ((*streamedAudio)->numFrames, 3U);
+        EXPECT_EQ((*streamedAudio)->dataOffset, 12U + 8U + 16U + 8U);
+
+        const auto decoded = AudioUtil::DecodeStreamedAudio(**streamedAudio, 1, 10);
+        ASSERT_NE(decoded, nullptr);
+        ASSERT_EQ(decoded->data.size(), 8U);
+        EXPECT_EQ(DecodedSample16(*decoded, 0), 200);
+        EXPECT_EQ(DecodedSample16(*decoded, 1), -200);
+        EXPECT_EQ(DecodedSample16(*decoded, 2), 300);
+        EXPECT_EQ(DecodedSample16(*decoded, 3), -300);
+
+        EXPECT_EQ(AudioUtil::DecodeStreamedAudio(**streamedAudio, 3, 10), nullptr);
+    }
+
+    TEST(AudioUtilTests, SkipsUnknownChunks)
+    {
+        std::vector<std::byte> chunks;
+        AppendWavChunk(chunks, "LIST", std::vector<std::byte>(10, std::byte{0x7F}));
+        AppendWavChunk(chunks, "fmt ", MakeWavFmtChunkData(1, 1, 22050, 16));
+        AppendWavChunk(chunks, "junk", std::vector<std::byte>(4, std::byte{0x7F}));
+        AppendWavChunk(chunks, "data", MakeWavPCM16Data({1, 2, 3, 4}));
+
+        const auto streamedAudio = AudioUtil::StreamedAudioFromBytes(MakeWavFile(chunks));
+        ASSERT_TRUE(streamedAudio.has_value());
+
+        EXPECT_EQ((*streamedAudio)->format, NCommon::AudioDataFormat::Mono16);
+        EXPECT_EQ((*streamedAudio)->numFrames, 4U);
+        EXPECT_EQ((*streamedAudio)->dataOffset, 12U + 18U + 24U + 12U + 8U);
+
+        const auto decoded = AudioUtil::DecodeStreamedAudio(**streamedAudio, 0, 4);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(DecodedSample16(*decoded, 0), 1);
+        EXPECT_EQ(DecodedSample16(*decoded, 3), 4);
+    }
+
+    TEST(AudioUtilTests, SkipsPadByteOfOddSizedChunks)
+    {
+        std::vector<std::byte> chunks;
+        AppendWavChunk(chunks, "fmt ", MakeWavFmtChunkData(1, 1, 8000, 8));
+        // Odd sized chunk followed by a pad byte; if the pad byte weren't skipped the data chunk wouldn't be found
+        AppendWavChunk(chunks, "note", std::vector<std::byte>(5, std::byte{'d'}));
+        AppendWavChunk(chunks, "data", {std::byte{0}, std::byte{128}, std::byte{255}});
+
+        const auto streamedAudio = AudioUtil::StreamedAudioFromBytes(MakeWavFile(chunks));
+        ASSERT_TRUE(streamedAudio.has_value());
+
+        EXPECT_EQ((*streamedAudio)->format, NCommon::AudioDataFormat::Mono8);
+        EXPECT_EQ((*streamedAudio)->numFrames, 3U);
+        EXPECT_EQ((*streamedAudio)->dataOffset, 12U + 24U + 14U + 8U);
+
+        const auto decoded = AudioUtil::DecodeStreamedAudio(**streamedAudio, 0, 3);
+        ASSERT_NE(decoded, nullptr);
+        ASSERT_EQ(decoded->data.size(), 3U);
+        EXPECT_EQ(std::to_integer<uint8_t>(decoded->data[0]), 0U);
+        EXPECT_EQ(std::to_integer<uint8_t>(decoded->data[1]), 128U);
+        EXPECT_EQ(std::to_integer<uint8_t>(decoded->data[2]), 255U);
+    }
+
+    TEST(AudioUtilTests, ClampsTruncatedDataChunk)
+    {
+        std::vector<std::byte> chunks;
+        AppendWavChunk(chunks, "fmt ", MakeWavFmtChunkData(1, 2, 44100, 16));
+        AppendWavChunk(chunks, "data", MakeWavPCM16Data({1, 2, 3, 4, 5, 6}));
+
+        // Cut the file off part way through the third frame; the data chunk's size now claims more than is present
+        auto bytes = MakeWavFile(chunks);
+        bytes.resize(bytes.size() - 3);
+
+        const auto streamedAudio = AudioUtil::StreamedAudioFromBytes(bytes);
+        ASSERT_TRUE(streamedAudio.has_value());
+
+        // Only whole frames which are present are played
+        EXPECT_EQ((*streamedAudio)->numFrames, 2U);
+
+        const auto decoded = AudioUtil::DecodeStreamedAudio(**streamedAudio, 0, 10);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(decoded->data.size(), 8U);
+    }
+
+    TEST(AudioUtilTests, RejectsTruncatedFiles)
+    {
+        std::vector<std::byte> chunks;
+        AppendWavChunk(chunks, "fmt ", MakeWavFmtChunkData(1, 1, 44100, 16));
+        AppendWavChunk(chunks, "data", MakeWavPCM16Data({1, 2}));
+        const auto bytes = MakeWavFile(chunks);
+
+        // Truncated within the RIFF header, the fmt chunk, and the data chunk's header
+        for (const std::size_t size : {std::size_t{0}, std::size_t{11}, std::size_t{12 + 8 + 10}, std::size_t{12 + 24 + 4}})
+        {
+            const auto truncated = std::vector<std::byte>(bytes.cbegin(), bytes.cbegin() + (std::ptrdiff_t)size);
+            EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(truncated).has_value()) << "size: " << size;
+        }
+    }
+
+    TEST(AudioUtilTests, RejectsMissingChunks)
+    {
+        std::vector<std::byte> fmtOnly;
+        AppendWavChunk(fmtOnly, "fmt ", MakeWavFmtChunkData(1, 1, 44100, 16));
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(MakeWavFile(fmtOnly)).has_value());
+
+        std::vector<std::byte> dataOnly;
+        AppendWavChunk(dataOnly, "data", MakeWavPCM16Data({1, 2}));
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(MakeWavFile(dataOnly)).has_value());
+    }
+
+    TEST(AudioUtilTests, RejectsUnsupportedLayouts)
+    {
+        const auto makeFile = [](const std::vector<std::byte>& fmt){
+            std::vector<std::byte> chunks;
+            AppendWavChunk(chunks, "fmt ", fmt);
+            AppendWavChunk(chunks, "data", MakeWavPCM16Data({1, 2, 3, 4}));
+            return MakeWavFile(chunks);
+        };
+
+        // Compressed format
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(makeFile(MakeWavFmtChunkData(2, 1, 44100, 16))).has_value());
+        // More than two channels
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(makeFile(MakeWavFmtChunkData(1, 4, 44100, 16))).has_value());
+        // Unsupported bit depths
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(makeFile(MakeWavFmtChunkData(1, 1, 44100, 12))).has_value());
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(makeFile(MakeWavFmtChunkData(3, 1, 44100, 16))).has_value());
+        // Zero sample rate
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(makeFile(MakeWavFmtChunkData(1, 1, 0, 16))).has_value());
+
+        // Not a WAVE file
+        auto notWave = makeFile(MakeWavFmtChunkData(1, 1, 44100, 16));
+        std::memcpy(notWave.data() + 8, "AVI ", 4);
+        EXPECT_FALSE(AudioUtil::StreamedAudioFromBytes(notWave).has_value());
+    }
+
+    TEST(AudioUtilTests, DecodesFloatSamplesTo16Bit)
+    {
+        std::vector<std::byte> data;
+        for (const float sample : {0.5f, -1.0f, 2.0f})
+        {
+            uint32_t bits{0};
+            std::memcpy(&bits, &sample, 4);
+            AppendWavUInt32(data, bits);
+        }
+
+        std::vector<std::byte> chunks;
+        AppendWavChunk(chunks, "fmt ", MakeWavFmtChunkData(3, 1, 48000, 32));
+        AppendWavChunk(chunks, "data", data);
+
+        const auto streamedAudio = AudioUtil::StreamedAudioFromBytes(MakeWavFile(chunks));
+        ASSERT_TRUE(streamedAudio.has_value());
+        EXPECT_EQ((*streamedAudio)->format, NCommon::AudioDataFormat::Mono16);
+
+        const auto decoded = AudioUtil::DecodeStreamedAudio(**streamedAudio, 0, 3);
+        ASSERT_NE(decoded, nullptr);
+        EXPECT_EQ(DecodedSample16(*decoded, 0), INT16_MAX / 2);
+        EXPECT_EQ(DecodedSample16(*decoded, 1), -INT16_MAX);
+        // Out of range samples are clamped
+        EXPECT_EQ(DecodedSample16(*decoded, 2), INT16_MAX);
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_AUDIOUTILTESTS_H
@@ -0,0 +1,254 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_COMPILEDSCENETESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_COMPILEDSCENETESTS_H
+
+#include <gtest/gtest.h>
+
+#include <Wired/Engine/Package/CompiledScene.h>
+#include <Wired/Engine/Package/EntitySceneNode.h>
+#include <Wired/Engine/Package/PlayerSceneNode.h>
+#include <Wired/Engine/Package/SceneNodeTransformComponent.h>
+#include <Wired/Engine/Package/SceneNodeRenderableSpriteComponent.h>
+#include <Wired/Engine/Package/SceneNodeRenderableModelComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsBoxComponent.h>
+#include <Wired/Engine/Package/SceneNodePhysicsSphereComponent.h>
+#include <Wired/Engine/Package/PackageCommon.h>
+#include <Wired/Engine/Package/Serialization.h>
+
+#include <NEON/Common/Log/StubLogger.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+namespace Wired::Engine
+{
+    [[nodiscard]] static Scene CreateTestScene()
+    {
+        Scene scene{};
+        scene.name = "TestScene";
+
+        auto entity1 = std::make_shared<EntitySceneNode>();
+        entity1->name = "Entity1";
+        {
+            auto transform = std::make_shared<SceneNodeTransformComponent>();
+            transform->position = {1.0f, 2.0f, 3.0f};
+            transform->scale = {2.0f, 2.0f, 2.0f};
+            transform->eulerRotations = {0.0f, 90.0f, 0.0f};
+            entity1->components.push_back(transform);
+
+            auto model = std::make_shared<SceneNodeRenderableModelComponent>();
+            model->modelAssetName = "box.gltf";
+            entity1->components.push_back(model);
+
+            auto box = std::make_shared<SceneNodePhysicsBoxComponent>();
+            box->min = {-1.0f, -2.0f, -3.0f};
+            box->max = {1.0f, 2.0f, 3.0f};
+            entity1->components.push_back(box);
+        }
+        scene.nodes.push_back(entity1);
+
+        auto player = std::make_shared<PlayerSceneNode>();
+        player->name = "Player";
+        player->position = {5.0f, 0.0f, -5.0f};
+        player->height = 1.8f;
+        scene.nodes.push_back(player);
+
+        auto entity2 = std::make_shared<EntitySceneNode>();
+        entity2->name = "Entity2";
+        {
+            auto sprite = std::make_shared<SceneNodeRenderableSpriteComponent>();
+            sprite->destVirtualSize = {64.0f, 32.0f};
+            entity2->components.push_back(sprite);
+
+            auto sphere = std::make_shared<SceneNodePhysicsSphereComponent>();
+            sphere->localScale = 3.0f;
+            sphere->radius = 0.25f;
+            entity2->components.push_back(sphere);
+        }
+        scene.nodes.push_back(entity2);
+
+        return scene;
+    }
+
+    TEST(CompiledSceneTests, CompileInternsStrings)
+    {
+        const auto compiled = CompileScene(CreateTestScene());
+
+        ASSERT_EQ(compiled.entityNames.size(), 2U);
+        EXPECT_EQ(compiled.strings[compiled.entityNames[0]], "Entity1");
+        EXPECT_EQ(compiled.strings[compiled.entityNames[1]], "Entity2");
+
+        // Both physics components use the default physics scene, which is stored once
+        ASSERT_EQ(compiled.physicsBoxes.physicsScenes.size(), 1U);
+        ASSERT_EQ(compiled.physicsSpheres.physicsScenes.size(), 1U);
+        EXPECT_EQ(compiled.physicsBoxes.physicsScenes[0], compiled.physicsSpheres.physicsScenes[0]);
+
+        ASSERT_EQ(compiled.sprites.imageAssetNames.size(), 1U);
+        EXPECT_EQ(compiled.sprites.imageAssetNames[0], CompiledScene::NO_STRING);
+        EXPECT_EQ(compiled.sprites.entities[0], 1U);
+    }
+
+    TEST(CompiledSceneTests, BytesRoundTrip)
+    {
+        const auto compiled = CompileScene(CreateTestScene());
+
+        const auto bytes = CompiledSceneToBytes(compiled);
+        const auto decoded = CompiledSceneFromBytes(bytes);
+        ASSERT_TRUE(decoded.has_value());
+
+        // Re-encoding the decoded scene produces identical bytes
+        EXPECT_EQ(CompiledSceneToBytes(*decoded), bytes);
+
+        const auto scene = DecompileScene(*decoded);
+        EXPECT_EQ(scene->name, "TestScene");
+        ASSERT_EQ(scene->nodes.size(), 3U);
+
+        // Entity nodes are decompiled before player nodes
+        const auto pEntity1 = dynamic_cast<const EntitySceneNode*>(scene->nodes[0].get());
+        const auto pEntity2 = dynamic_cast<const EntitySceneNode*>(scene->nodes[1].get());
+        const auto pPlayer = dynamic_cast<const PlayerSceneNode*>(scene->nodes[2].get());
+        ASSERT_TRUE(pEntity1 != nullptr && pEntity2 != nullptr && pPlayer != nullptr);
+
+        EXPECT_EQ(pEntity1->name, "Entity1");
+        ASSERT_EQ(pEntity1->components.size(), 3U);
+
+        const auto pTransform = dynamic_cast<const SceneNodeTransformComponent*>(pEntity1->components[0].get());
+        ASSERT_TRUE(pTransform != nullptr);
+        EXPECT_EQ(pTransform->position, glm::vec3(1.0f, 2.0f, 3.0f));
+        EXPECT_EQ(pTransform->scale, glm::vec3(2.0f, 2.0f, 2.0f));
+        EXPECT_EQ(pTransform->eulerRotations, glm::vec3(0.0f, 90.0f, 0.0f));
+
+        const auto pModel = dynamic_cast<const SceneNodeRenderableModelComponent*>(pEntity1->components[1].get());
+        ASSERT_TRUE(pModel != nullptr);
+        EXPECT_EQ(pModel->modelAssetName, std::optional<std::string>("box.gltf"));
+
+        const auto pBox = dynamic_cast<const SceneNodePhysicsBoxComponent*>(pEntity1->components[2].get());
+        ASSERT_TRUE(pBox != nullptr);
+        EXPECT_EQ(pBox->physicsScene, DEFAULT_PHYSICS_SCENE.id);
+        EXPECT_EQ(pBox->min, glm::vec3(-1.0f, -2.0f, -3.0f));
+        EXPECT_EQ(pBox->max, glm::vec3(1.0f, 2.0f, 3.0f));
+
+        EXPECT_EQ(pEntity2->name, "Entity2");
+        ASSERT_EQ(pEntity2->components.size(), 2U);
+
+        const auto pSprite = dynamic_cast<const SceneNodeRenderableSpriteComponent*>(pEntity2->components[0].get());
+        ASSERT_TRUE(pSprite != nullptr);
+        EXPECT_FALSE(pSprite->imageAssetName.has_value());
+        EXPECT_EQ(pSprite->destVirtualSize, glm::vec2(64.0f, 32.0f));
+
+        const auto pSphere = dynamic_cast<const SceneNodePhysicsSphereComponent*>(pEntity2->components[1].get());
+        ASSERT_TRUE(pSphere != nullptr);
+        EXPECT_FLOAT_EQ(pSphere->localScale, 3.0f);
+        EXPECT_FLOAT_EQ(pSphere->radius, 0.25f);
+
+        EXPECT_EQ(pPlayer->name, "Player");
+        EXPECT_EQ(pPlayer->position, glm::vec3(5.0f, 0.0f, -5.0f));
+        EXPECT_FLOAT_EQ(pPlayer->height, 1.8f);
+        EXPECT_FLOAT_EQ(pPlayer->radius, 0.5f);
+    }
+
+    TEST(CompiledSceneTests, EmptySceneRoundTrip)
+    {
+        const auto bytes = CompiledSceneToBytes(CompileScene(Scene{}));
+
+        const auto decoded = CompiledSceneFromBytes(bytes);
+        ASSERT_TRUE(decoded.has_value());
+        EXPECT_TRUE(DecompileScene(*decoded)->nodes.empty());
+    }
+
+    TEST(CompiledSceneTests, RejectsTruncatedBytes)
+    {
+        const auto bytes = CompiledSceneToBytes(CompileScene(CreateTestScene()));
+
+        // Every strict prefix of a valid encoding is rejected
+        for (std::size_t byteSize = 0; byteSize < bytes.size(); ++byteSize)
+        {
+            EXPECT_FALSE(CompiledSceneFromBytes(std::span(bytes).subspan(0, byteSize)).has_value()) << "byteSize: " << byteSize;
+        }
+    }
+
+    TEST(CompiledSceneTests, RejectsBadMagicAndVersion)
+    {
+        auto bytes = CompiledSceneToBytes(CompileScene(CreateTestScene()));
+
+        auto badMagic = bytes;
+        badMagic[0] = std::byte{0};
+        EXPECT_FALSE(CompiledSceneFromBytes(badMagic).has_value());
+
+        auto badVersion = bytes;
+        badVersion[sizeof(uint32_t)] = std::byte{0xFF};
+        EXPECT_FALSE(CompiledSceneFromBytes(badVersion).has_value());
+    }
+
+    TEST(CompiledSceneTests, RejectsOutOfRangeIndices)
+    {
+        auto compiled = CompileScene(CreateTestScene());
+
+        auto badEntity = compiled;
+        badEntity.transforms.entities[0] = static_cast<uint32_t>(badEntity.entityNames.size());
+        EXPECT_FALSE(CompiledSceneFromBytes(CompiledSceneToBytes(badEntity)).has_value());
+
+        auto badString = compiled;
+        badString.models.modelAssetNames[0] = static_cast<uint32_t>(badString.strings.size());
+        EXPECT_FALSE(CompiledSceneFromBytes(CompiledSceneToBytes(badString)).has_value());
+
+        auto mismatchedArrays = compiled;
+        mismatchedArrays.transforms.scales.pop_back();
+        EXPECT_FALSE(CompiledSceneFromBytes(CompiledSceneToBytes(mismatchedArrays)).has_value());
+    }
+
+    TEST(CompiledSceneTests, PackageReadKeepsScenesCompiled)
+    {
+        NCommon::StubLogger logger;
+
+        const auto parentDirectoryPath = std::filesystem::temp_directory_path() / "WiredEngineTests";
+        const auto packageDirectoryPath = parentDirectoryPath / "PackageReadKeepsScenesCompiled";
+        std::filesystem::remove_all(packageDirectoryPath);
+
+        const auto writeFile = [](const std::filesystem::path& filePath, const std::vector<std::byte>& contents){
+            std::filesystem::create_directories(filePath.parent_path());
+            std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+        };
+
+        const auto manifestFilePath = GetPackageManifestPath(parentDirectoryPath, "PackageReadKeepsScenesCompiled");
+        writeFile(manifestFilePath, *ObjectToBytes(PackageManifest{.manifestVersion = 1, .packageName = "PackageReadKeepsScenesCompiled"}));
+
+        // One scene in editable form, and one only in binary form
+        const auto jsonScene = std::make_shared<Scene>(CreateTestScene());
+        writeFile(packageDirectoryPath / PACKAGE_SCENES_DIRECTORY / (std::string("JsonScene.") + SCENE_EXTENSION), *ObjectToBytes(jsonScene));
+
+        auto binaryScene = CreateTestScene();
+        binaryScene.name = "BinaryScene";
+        writeFile(packageDirectoryPath / PACKAGE_SCENES_DIRECTORY / (std::string("BinaryScene.") + SCENE_BINARY_EXTENSION),
+                  CompiledSceneToBytes(CompileScene(binaryScene)));
+
+        const auto package = ReadPackageMetadataFromDisk(&logger, manifestFilePath);
+        ASSERT_TRUE(package.has_value());
+
+        ASSERT_EQ(package->scenes.size(), 1U);
+        EXPECT_EQ(package->scenes[0]->name, "TestScene");
+
+        ASSERT_EQ(package->compiledScenes.size(), 2U);
+
+        for (const auto& compiledScene : package->compiledScenes)
+        {
+            const auto expected = CompileScene(compiledScene->name == "BinaryScene" ? binaryScene : CreateTestScene());
+
+            EXPECT_EQ(compiledScene->strings, expected.strings);
+            EXPECT_EQ(compiledScene->entityNames, expected.entityNames);
+            EXPECT_EQ(compiledScene->players.positions, expected.players.positions);
+        }
+
+        std::filesystem::remove_all(packageDirectoryPath);
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_COMPILEDSCENETESTS_H
@@ -0,0 +1,23 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "JoltLayersTests.h"
+#include "WorldSystemSchedulerTests.h"
+#include "PackageArchiveTests.h"
+#include "CompiledSceneTests.h"
+#include "TransformHierarchyTests.h"
+#include "HeightMapTests.h"
+#include "AudioUtilTests.h"
+#include "PhysicsQueryTests.h"
+#include "GlyphAtlasTests.h"
+
+#include <gtest/gtest.h>
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,216 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_GLYPHATLASTESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_GLYPHATLASTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "Font/ShelfPacker.h"
+#include "Font/TextLayout.h"
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Wired::Engine
+{
+    static constexpr int32_t TEST_GLYPH_ADVANCE = 10;
+    static constexpr int32_t TEST_LINE_SKIP = 20;
+
+    /**
+     * Lays out ASCII text in which every glyph has the same advance, spaces aren't drawn, and there's no kerning
+     */
+    [[nodiscard]] static std::vector<glm::vec2> LayoutTestText(const std::string& text, uint32_t wrapLength)
+    {
+        TextLayout layout(wrapLength, TEST_LINE_SKIP);
+
+        for (const auto& c : text)
+        {
+            if (c == '\n') { layout.NewLine(); continue; }
+
+            layout.AddGlyph((uint32_t)c, TEST_GLYPH_ADVANCE, 0, c != ' ');
+        }
+
+        return layout.GetGlyphOffsets();
+    }
+
+    //
+    // ShelfPacker
+    //
+    TEST(GlyphAtlasTests, ShelfPacker_RectsShareShelfWhileTheyFit)
+    {
+        ShelfPacker packer(100, 100);
+
+        EXPECT_EQ(packer.Allocate(10, 20), NCommon::RectUInt(0, 0, 10, 20));
+        EXPECT_EQ(packer.Allocate(10, 15), NCommon::RectUInt(10, 0, 10, 15));
+        EXPECT_EQ(packer.GetShelfCount(), 1U);
+    }
+
+    TEST(GlyphAtlasTests, ShelfPacker_TallerRectOpensNewShelf)
+    {
+        ShelfPacker packer(100, 100);
+
+        EXPECT_EQ(packer.Allocate(10, 20), NCommon::RectUInt(0, 0, 10, 20));
+        EXPECT_EQ(packer.Allocate(10, 30), NCommon::RectUInt(0, 20, 10, 30));
+        EXPECT_EQ(packer.GetShelfCount(), 2U);
+    }
+
+    TEST(GlyphAtlasTests, ShelfPacker_FullShelfOpensNewShelf)
+    {
+        ShelfPacker packer(100, 100);
+
+        EXPECT_EQ(packer.Allocate(60, 10), NCommon::RectUInt(0, 0, 60, 10));
+        EXPECT_EQ(packer.Allocate(60, 10), NCommon::RectUInt(0, 10, 60, 10));
+
+        // Fits in the space left on the first shelf
+        EXPECT_EQ(packer.Allocate(40, 10), NCommon::RectUInt(60, 0, 40, 10));
+        EXPECT_EQ(packer.GetShelfCount(), 2U);
+    }
+
+    TEST(GlyphAtlasTests, ShelfPacker_ShortestFittingShelfIsUsed)
+    {
+        ShelfPacker packer(100, 100);
+
+        ASSERT_EQ(packer.Allocate(10, 20), NCommon::RectUInt(0, 0, 10, 20));
+        ASSERT_EQ(packer.Allocate(10, 30), NCommon::RectUInt(0, 20, 10, 30));
+
+        // Fits on both shelves; goes on the shorter one
+        EXPECT_EQ(packer.Allocate(10, 15), NCommon::RectUInt(10, 0, 10, 15));
+
+        // Only fits on the taller one
+        EXPECT_EQ(packer.Allocate(10, 25), NCommon::RectUInt(10, 20, 10, 25));
+    }
+
+    TEST(GlyphAtlasTests, ShelfPacker_OverflowWhenNoRoomForShelf)
+    {
+        ShelfPacker packer(100, 50);
+
+        EXPECT_TRUE(packer.Allocate(100, 30));
+        EXPECT_FALSE(packer.Allocate(100, 30));
+
+        // A shorter shelf still fits in the remaining height
+        EXPECT_EQ(packer.Allocate(100, 20), NCommon::RectUInt(0, 30, 100, 20));
+        EXPECT_FALSE(packer.Allocate(1, 1));
+    }
+
+    TEST(GlyphAtlasTests, ShelfPacker_RectLargerThanAreaIsRejected)
+    {
+        ShelfPacker packer(100, 100);
+
+        EXPECT_FALSE(packer.Allocate(101, 10));
+        EXPECT_FALSE(packer.Allocate(10, 101));
+        EXPECT_EQ(packer.GetShelfCount(), 0U);
+    }
+
+    TEST(GlyphAtlasTests, ShelfPacker_ClearEmptiesArea)
+    {
+        ShelfPacker packer(100, 100);
+
+        ASSERT_TRUE(packer.Allocate(100, 100));
+        packer.Clear();
+
+        EXPECT_EQ(packer.GetShelfCount(), 0U);
+        EXPECT_EQ(packer.Allocate(100, 100), NCommon::RectUInt(0, 0, 100, 100));
+    }
+
+    //
+    // DecodeUTF8
+    //
+    TEST(GlyphAtlasTests, DecodeUTF8_ASCII)
+    {
+        EXPECT_EQ(DecodeUTF8("Hi!"), (std::vector<uint32_t>{'H', 'i', '!'}));
+        EXPECT_TRUE(DecodeUTF8("").empty());
+    }
+
+    TEST(GlyphAtlasTests, DecodeUTF8_MultiByte)
+    {
+        // é (2 bytes), € (3 bytes), 😀 (4 bytes)
+        EXPECT_EQ(DecodeUTF8("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80z"),
+                  (std::vector<uint32_t>{'a', 0xE9, 0x20AC, 0x1F600, 'z'}));
+    }
+
+    TEST(GlyphAtlasTests, DecodeUTF8_InvalidSequencesAreReplaced)
+    {
+        // Lone continuation byte, and a byte that can't start a sequence
+        EXPECT_EQ(DecodeUTF8("a\x80" "b\xFF" "c"), (std::vector<uint32_t>{'a', 0xFFFD, 'b', 0xFFFD, 'c'}));
+
+        // Sequence interrupted by ASCII; decoding resumes at the ASCII
+        EXPECT_EQ(DecodeUTF8("\xC3" "A"), (std::vector<uint32_t>{0xFFFD, 'A'}));
+
+        // Sequence truncated by the end of the text
+        EXPECT_EQ(DecodeUTF8("\xE2\x82"), (std::vector<uint32_t>{0xFFFD, 0xFFFD}));
+    }
+
+    //
+    // TextLayout
+    //
+    TEST(GlyphAtlasTests, TextLayout_NoWrapping)
+    {
+        EXPECT_EQ(LayoutTestText("abc", 0), (std::vector<glm::vec2>{{0, 0}, {10, 0}, {20, 0}}));
+    }
+
+    TEST(GlyphAtlasTests, TextLayout_Newlines)
+    {
+        EXPECT_EQ(LayoutTestText("ab\nc\n\nd", 0), (std::vector<glm::vec2>{{0, 0}, {10, 0}, {0, 20}, {0, 60}}));
+    }
+
+    TEST(GlyphAtlasTests, TextLayout_GlyphEndingAtWrapLengthDoesNotWrap)
+    {
+        EXPECT_EQ(LayoutTestText("abc", 30), (std::vector<glm::vec2>{{0, 0}, {10, 0}, {20, 0}}));
+    }
+
+    TEST(GlyphAtlasTests, TextLayout_WrapsAtLastSpace)
+    {
+        // "ab cd" is 50 wide; "cd" moves to the next line
+        EXPECT_EQ(LayoutTestText("ab cd", 40), (std::vector<glm::vec2>{{0, 0}, {10, 0}, {0, 20}, {10, 20}}));
+    }
+
+    TEST(GlyphAtlasTests, TextLayout_WrapsMidWordWithoutSpace)
+    {
+        EXPECT_EQ(LayoutTestText("abcde", 30), (std::vector<glm::vec2>{{0, 0}, {10, 0}, {20, 0}, {0, 20}, {10, 20}}));
+    }
+
+    TEST(GlyphAtlasTests, TextLayout_WrapsRepeatedly)
+    {
+        EXPECT_EQ(LayoutTestText("ab cd ef", 30),
+                  (std::vector<glm::vec2>{{0, 0}, {10, 0}, {0, 20}, {10, 20}, {0, 40}, {10, 40}}));
+    }
+
+    TEST(GlyphAtlasTests, TextLayout_GlyphWiderThanWrapLengthIsPlacedAlone)
+    {
+        TextLayout layout(30, TEST_LINE_SKIP);
+
+        layout.AddGlyph('W', 50, 0, true);
+        layout.AddGlyph('a', 10, 0, true);
+
+        EXPECT_EQ(layout.GetGlyphOffsets(), (std::vector<glm::vec2>{{0, 0}, {0, 20}}));
+    }
+
+    TEST(GlyphAtlasTests, TextLayout_KerningAppliesWithinLines)
+    {
+        TextLayout layout(0, TEST_LINE_SKIP);
+
+        EXPECT_FALSE(layout.GetPreviousCodepoint());
+
+        // Nothing to kern against at the start of a line
+        layout.AddGlyph('A', 10, -3, true);
+        EXPECT_EQ(layout.GetPreviousCodepoint(), (uint32_t)'A');
+
+        layout.AddGlyph('V', 10, -3, true);
+
+        layout.NewLine();
+        EXPECT_FALSE(layout.GetPreviousCodepoint());
+
+        layout.AddGlyph('A', 10, -3, true);
+
+        EXPECT_EQ(layout.GetGlyphOffsets(), (std::vector<glm::vec2>{{0, 0}, {7, 0}, {0, 20}}));
+        EXPECT_EQ(layout.GetLineTop(), 20);
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_GLYPHATLASTESTS_H
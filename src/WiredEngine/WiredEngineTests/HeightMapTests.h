@@ -0,0 +1,208 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_HEIGHTMAPTESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_HEIGHTMAPTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "HeightMap.h"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace Wired::Engine
+{
+    static const NCommon::Size2DReal TEST_HEIGHT_MAP_MESH_SIZE = {90.0f, 90.0f};
+
+    /**
+     * @return A 10x10 data point (9x9 quad) height map with uneven heights
+     */
+    [[nodiscard]] static HeightMap CreateTestHeightMap()
+    {
+        HeightMap heightMap{};
+        heightMap.dataSize = {10, 10};
+
+        for (uint32_t y = 0; y < heightMap.dataSize.h; ++y)
+        {
+            for (uint32_t x = 0; x < heightMap.dataSize.w; ++x)
+            {
+                heightMap.data.push_back((float)(((x * 7) + (y * 3)) % 5));
+            }
+        }
+
+        heightMap.minValue = *std::ranges::min_element(heightMap.data);
+        heightMap.maxValue = *std::ranges::max_element(heightMap.data);
+
+        return heightMap;
+    }
+
+    [[nodiscard]] static std::vector<Render::MeshVertex> GetChunkVerticesAtX(const Render::StaticMeshData& meshData, float x, std::size_t numSurfaceVertices)
+    {
+        std::vector<Render::MeshVertex> vertices;
+
+        for (std::size_t v = 0; v < numSurfaceVertices; ++v)
+        {
+            if (meshData.vertices[v].position.x == x) { vertices.push_back(meshData.vertices[v]); }
+        }
+
+        std::ranges::sort(vertices, [](const auto& a, const auto& b){ return a.position.z < b.position.z; });
+
+        return vertices;
+    }
+
+    TEST(HeightMapTests, ChunksCoverAllQuads)
+    {
+        const auto heightMap = CreateTestHeightMap();
+
+        const auto chunks = GetHeightMapChunks(&heightMap, 4);
+        ASSERT_EQ(chunks.size(), 9U);
+
+        uint32_t totalQuads = 0;
+
+        for (const auto& chunk : chunks)
+        {
+            EXPECT_LE(chunk.quadsX, 4U);
+            EXPECT_LE(chunk.quadsY, 4U);
+            EXPECT_LE(chunk.dataX + chunk.quadsX, heightMap.dataSize.w - 1);
+            EXPECT_LE(chunk.dataY + chunk.quadsY, heightMap.dataSize.h - 1);
+
+            totalQuads += chunk.quadsX * chunk.quadsY;
+        }
+
+        EXPECT_EQ(totalQuads, 9U * 9U);
+
+        // The last chunk in each direction holds the remainder
+        EXPECT_EQ(chunks.back().dataX, 8U);
+        EXPECT_EQ(chunks.back().quadsX, 1U);
+        EXPECT_EQ(chunks.back().quadsY, 1U);
+    }
+
+    TEST(HeightMapTests, NeighbouringChunksShareEdges)
+    {
+        const auto heightMap = CreateTestHeightMap();
+
+        const HeightMapChunk left{.dataX = 0, .dataY = 0, .quadsX = 4, .quadsY = 4};
+        const HeightMapChunk right{.dataX = 4, .dataY = 0, .quadsX = 4, .quadsY = 4};
+
+        // Data point x=4 is at world x=-45 + (4 * 10)
+        const float edgeX = -5.0f;
+
+        for (const uint32_t lodStride : {1U, 2U, 4U})
+        {
+            const auto leftMesh = GenerateHeightMapChunkMeshData(&heightMap, left, lodStride, TEST_HEIGHT_MAP_MESH_SIZE, std::nullopt);
+            const auto rightMesh = GenerateHeightMapChunkMeshData(&heightMap, right, lodStride, TEST_HEIGHT_MAP_MESH_SIZE, std::nullopt);
+
+            const auto numSurfaceVertices = (std::size_t)((4 / lodStride) + 1) * ((4 / lodStride) + 1);
+
+            const auto leftEdge = GetChunkVerticesAtX(*leftMesh, edgeX, numSurfaceVertices);
+            const auto rightEdge = GetChunkVerticesAtX(*rightMesh, edgeX, numSurfaceVertices);
+
+            ASSERT_EQ(leftEdge.size(), (4 / lodStride) + 1);
+            ASSERT_EQ(leftEdge.size(), rightEdge.size());
+
+            for (std::size_t x = 0; x < leftEdge.size(); ++x)
+            {
+                EXPECT_EQ(leftEdge[x].position, rightEdge[x].position);
+                EXPECT_EQ(leftEdge[x].normal, rightEdge[x].normal);
+            }
+        }
+    }
+
+    TEST(HeightMapTests, NormalsMatchAcrossLODs)
+    {
+        const auto heightMap = CreateTestHeightMap();
+
+        const HeightMapChunk chunk{.dataX = 0, .dataY = 0, .quadsX = 4, .quadsY = 4};
+
+        const auto fine = GenerateHeightMapChunkMeshData(&heightMap, chunk, 1, TEST_HEIGHT_MAP_MESH_SIZE, std::nullopt);
+        const auto coarse = GenerateHeightMapChunkMeshData(&heightMap, chunk, 2, TEST_HEIGHT_MAP_MESH_SIZE, std::nullopt);
+
+        // Every data point the coarse LOD samples is also sampled by the fine LOD, with the same normal
+        for (std::size_t c = 0; c < 9; ++c)
+        {
+            const auto& coarseVertex = coarse->vertices[c];
+
+            const auto it = std::ranges::find_if(fine->vertices.cbegin(), fine->vertices.cbegin() + 25, [&](const auto& fineVertex){
+                return fineVertex.position == coarseVertex.position;
+            });
+            ASSERT_NE(it, fine->vertices.cbegin() + 25);
+            EXPECT_EQ(it->normal, coarseVertex.normal);
+        }
+    }
+
+    TEST(HeightMapTests, ChunkSizesAndSkirts)
+    {
+        const auto heightMap = CreateTestHeightMap();
+
+        // A remainder chunk whose quad count isn't a multiple of the LOD stride still reaches its far edge
+        const HeightMapChunk chunk{.dataX = 0, .dataY = 0, .quadsX = 5, .quadsY = 5};
+
+        const auto meshData = GenerateHeightMapChunkMeshData(&heightMap, chunk, 2, TEST_HEIGHT_MAP_MESH_SIZE, std::nullopt);
+
+        // 4x4 sampled surface points (0, 2, 4, 5), plus a skirt vertex under each of the 4 edges' points
+        EXPECT_EQ(meshData->vertices.size(), (4U * 4U) + (4U * 4U));
+        EXPECT_EQ(meshData->indices.size(), (3U * 3U * 6U) + (4U * 3U * 6U));
+
+        const auto maxX = std::ranges::max_element(meshData->vertices, {}, [](const auto& v){ return v.position.x; })->position.x;
+        EXPECT_FLOAT_EQ(maxX, -45.0f + (5.0f * 10.0f));
+
+        // Skirts hang below their edge by at least the chunk's height range, so every skirt vertex is at or below
+        // the lowest surface point
+        float surfaceMinY = std::numeric_limits<float>::max();
+        for (std::size_t v = 0; v < 16; ++v)
+        {
+            surfaceMinY = std::min(surfaceMinY, meshData->vertices[v].position.y);
+        }
+
+        for (std::size_t v = 16; v < meshData->vertices.size(); ++v)
+        {
+            EXPECT_LE(meshData->vertices[v].position.y, surfaceMinY);
+        }
+
+        for (const auto& index : meshData->indices)
+        {
+            EXPECT_LT(index, meshData->vertices.size());
+        }
+    }
+
+    TEST(HeightMapTests, ChunkMeshLODs)
+    {
+        const auto heightMap = CreateTestHeightMap();
+
+        const HeightMapChunk chunk{.dataX = 0, .dataY = 0, .quadsX = 4, .quadsY = 4};
+
+        const auto mesh = GenerateHeightMapChunkMesh(&heightMap, chunk, TEST_HEIGHT_MAP_MESH_SIZE, std::nullopt);
+        ASSERT_NE(mesh, nullptr);
+
+        // The first LOD is used from any distance, and each following LOD from twice the previous distance,
+        // starting from the chunk's world space extent
+        EXPECT_EQ(mesh->lodData[0].renderDistance, 0.0f);
+
+        std::size_t previousVertexCount = std::numeric_limits<std::size_t>::max();
+
+        for (uint32_t lod = 0; lod < Render::MESH_MAX_LOD; ++lod)
+        {
+            const auto& meshLOD = mesh->lodData[lod];
+            ASSERT_TRUE(meshLOD.isValid);
+
+            if (lod > 0)
+            {
+                EXPECT_FLOAT_EQ(meshLOD.renderDistance, 40.0f * (float)(1U << lod));
+            }
+
+            const auto* pMeshData = dynamic_cast<const Render::StaticMeshData*>(meshLOD.pMeshData.get());
+            ASSERT_NE(pMeshData, nullptr);
+            EXPECT_LT(pMeshData->vertices.size(), previousVertexCount);
+            previousVertexCount = pMeshData->vertices.size();
+        }
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_HEIGHTMAPTESTS_H
@@ -0,0 +1,148 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_JOLTLAYERSTESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_JOLTLAYERSTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "Physics/JoltLayers.h"
+
+#include <array>
+#include <algorithm>
+
+namespace Wired::Engine
+{
+    static constexpr std::array<JPH::BroadPhaseLayer, BroadPhaseLayers::NUM_LAYERS> ALL_BROADPHASE_LAYERS = {
+        BroadPhaseLayers::NON_MOVING,
+        BroadPhaseLayers::MOVING,
+        BroadPhaseLayers::DEBRIS,
+        BroadPhaseLayers::SENSOR,
+        BroadPhaseLayers::CHARACTER
+    };
+
+    TEST(JoltLayersTests, BroadPhaseLayerForBody)
+    {
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Static, PhysicsBodyCategory::Default, ShapeUsage::Simulation), BroadPhaseLayers::NON_MOVING);
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Static, PhysicsBodyCategory::Debris, ShapeUsage::Simulation), BroadPhaseLayers::NON_MOVING);
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Dynamic, PhysicsBodyCategory::Default, ShapeUsage::Simulation), BroadPhaseLayers::MOVING);
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Kinematic, PhysicsBodyCategory::Default, ShapeUsage::Simulation), BroadPhaseLayers::MOVING);
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Dynamic, PhysicsBodyCategory::Debris, ShapeUsage::Simulation), BroadPhaseLayers::DEBRIS);
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Dynamic, PhysicsBodyCategory::Character, ShapeUsage::Simulation), BroadPhaseLayers::CHARACTER);
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Static, PhysicsBodyCategory::Default, ShapeUsage::Trigger), BroadPhaseLayers::SENSOR);
+        EXPECT_EQ(GetBroadPhaseLayer(RigidBodyType::Dynamic, PhysicsBodyCategory::Debris, ShapeUsage::Trigger), BroadPhaseLayers::SENSOR);
+    }
+
+    TEST(JoltLayersTests, ObjectLayerRegisteredOncePerCombination)
+    {
+        JoltObjectLayers layers;
+
+        const auto filterA = PhysicsCollisionFilter{.layer = 1, .mask = 0xFFFFFFFF};
+        const auto filterB = PhysicsCollisionFilter{.layer = 2, .mask = 0xFFFFFFFF};
+
+        const auto layer1 = layers.GetObjectLayer(BroadPhaseLayers::MOVING, filterA);
+        const auto layer2 = layers.GetObjectLayer(BroadPhaseLayers::MOVING, filterA);
+        const auto layer3 = layers.GetObjectLayer(BroadPhaseLayers::MOVING, filterB);
+        const auto layer4 = layers.GetObjectLayer(BroadPhaseLayers::NON_MOVING, filterA);
+
+        ASSERT_TRUE(layer1 && layer2 && layer3 && layer4);
+        EXPECT_EQ(*layer1, *layer2);
+        EXPECT_NE(*layer1, *layer3);
+        EXPECT_NE(*layer1, *layer4);
+        EXPECT_NE(*layer3, *layer4);
+        EXPECT_EQ(layers.GetNumObjectLayers(), 3U);
+
+        EXPECT_EQ(layers.GetObjectLayerInfo(*layer3).broadPhaseLayer, BroadPhaseLayers::MOVING);
+        EXPECT_EQ(layers.GetObjectLayerInfo(*layer3).collisionFilter, filterB);
+    }
+
+    TEST(JoltLayersTests, ObjectLayerRejectsOutOfRangeCollisionLayer)
+    {
+        JoltObjectLayers layers;
+
+        const auto result = layers.GetObjectLayer(BroadPhaseLayers::MOVING, PhysicsCollisionFilter{.layer = PHYSICS_NUM_COLLISION_LAYERS});
+
+        EXPECT_FALSE(result);
+        EXPECT_EQ(layers.GetNumObjectLayers(), 0U);
+    }
+
+    TEST(JoltLayersTests, BroadPhaseCollisionMatrix)
+    {
+        JoltObjectLayers layers;
+        const JoltObjectVsBroadPhaseLayerFilter objectVsBroadPhaseFilter(&layers);
+        const JoltObjectLayerPairFilter objectPairFilter(&layers);
+
+        std::array<JPH::ObjectLayer, BroadPhaseLayers::NUM_LAYERS> objectLayers{};
+        for (std::size_t x = 0; x < ALL_BROADPHASE_LAYERS.size(); ++x)
+        {
+            const auto objectLayer = layers.GetObjectLayer(ALL_BROADPHASE_LAYERS[x], PhysicsCollisionFilter{});
+            ASSERT_TRUE(objectLayer);
+            objectLayers[x] = *objectLayer;
+        }
+
+        const auto collides = [&](JPH::BroadPhaseLayer a, JPH::BroadPhaseLayer b){
+            const auto itA = std::ranges::find(ALL_BROADPHASE_LAYERS, a);
+            const auto itB = std::ranges::find(ALL_BROADPHASE_LAYERS, b);
+            return objectPairFilter.ShouldCollide(objectLayers[std::distance(ALL_BROADPHASE_LAYERS.begin(), itA)],
+                                                  objectLayers[std::distance(ALL_BROADPHASE_LAYERS.begin(), itB)]);
+        };
+
+        // Static bodies never collide with each other
+        EXPECT_FALSE(collides(BroadPhaseLayers::NON_MOVING, BroadPhaseLayers::NON_MOVING));
+        EXPECT_TRUE(collides(BroadPhaseLayers::NON_MOVING, BroadPhaseLayers::MOVING));
+        EXPECT_TRUE(collides(BroadPhaseLayers::NON_MOVING, BroadPhaseLayers::CHARACTER));
+        EXPECT_FALSE(collides(BroadPhaseLayers::NON_MOVING, BroadPhaseLayers::SENSOR));
+
+        // Debris only collides with static bodies
+        EXPECT_TRUE(collides(BroadPhaseLayers::DEBRIS, BroadPhaseLayers::NON_MOVING));
+        EXPECT_FALSE(collides(BroadPhaseLayers::DEBRIS, BroadPhaseLayers::DEBRIS));
+        EXPECT_FALSE(collides(BroadPhaseLayers::DEBRIS, BroadPhaseLayers::MOVING));
+        EXPECT_FALSE(collides(BroadPhaseLayers::DEBRIS, BroadPhaseLayers::CHARACTER));
+        EXPECT_FALSE(collides(BroadPhaseLayers::DEBRIS, BroadPhaseLayers::SENSOR));
+
+        // Sensors detect moving bodies and characters, but not other sensors
+        EXPECT_TRUE(collides(BroadPhaseLayers::SENSOR, BroadPhaseLayers::MOVING));
+        EXPECT_TRUE(collides(BroadPhaseLayers::SENSOR, BroadPhaseLayers::CHARACTER));
+        EXPECT_FALSE(collides(BroadPhaseLayers::SENSOR, BroadPhaseLayers::SENSOR));
+
+        EXPECT_TRUE(collides(BroadPhaseLayers::MOVING, BroadPhaseLayers::MOVING));
+        EXPECT_TRUE(collides(BroadPhaseLayers::CHARACTER, BroadPhaseLayers::CHARACTER));
+
+        // The matrix is symmetric, and the broadphase filter agrees with the object pair filter
+        for (std::size_t x = 0; x < ALL_BROADPHASE_LAYERS.size(); ++x)
+        {
+            for (std::size_t y = 0; y < ALL_BROADPHASE_LAYERS.size(); ++y)
+            {
+                EXPECT_EQ(objectPairFilter.ShouldCollide(objectLayers[x], objectLayers[y]),
+                          objectPairFilter.ShouldCollide(objectLayers[y], objectLayers[x]));
+                EXPECT_EQ(objectVsBroadPhaseFilter.ShouldCollide(objectLayers[x], ALL_BROADPHASE_LAYERS[y]),
+                          objectPairFilter.ShouldCollide(objectLayers[x], objectLayers[y]));
+            }
+        }
+    }
+
+    TEST(JoltLayersTests, UserMasksMustAllowCollisionBothWays)
+    {
+        JoltObjectLayers layers;
+        const JoltObjectLayerPairFilter objectPairFilter(&layers);
+
+        // Layer 1 collides with everything; layer 2 collides with everything but layer 1; layer 3 collides with nothing but layer 1
+        const auto layer1 = layers.GetObjectLayer(BroadPhaseLayers::MOVING, PhysicsCollisionFilter{.layer = 1, .mask = 0xFFFFFFFF});
+        const auto layer2 = layers.GetObjectLayer(BroadPhaseLayers::MOVING, PhysicsCollisionFilter{.layer = 2, .mask = ~(1U << 1)});
+        const auto layer3 = layers.GetObjectLayer(BroadPhaseLayers::MOVING, PhysicsCollisionFilter{.layer = 3, .mask = (1U << 1)});
+        ASSERT_TRUE(layer1 && layer2 && layer3);
+
+        EXPECT_TRUE(objectPairFilter.ShouldCollide(*layer1, *layer1));
+        EXPECT_FALSE(objectPairFilter.ShouldCollide(*layer1, *layer2));
+        EXPECT_FALSE(objectPairFilter.ShouldCollide(*layer2, *layer1));
+        EXPECT_TRUE(objectPairFilter.ShouldCollide(*layer1, *layer3));
+        EXPECT_TRUE(objectPairFilter.ShouldCollide(*layer3, *layer1));
+        EXPECT_FALSE(objectPairFilter.ShouldCollide(*layer2, *layer3));
+        EXPECT_FALSE(objectPairFilter.ShouldCollide(*layer3, *layer3));
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_JOLTLAYERSTESTS_H
@@ -0,0 +1,227 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_PACKAGEARCHIVETESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_PACKAGEARCHIVETESTS_H
+
+#include <gtest/gtest.h>
+
+#include <Wired/Engine/Package/PackageArchive.h>
+#include <Wired/Engine/Package/ArchivePackageSource.h>
+#include <Wired/Engine/Package/PackageCommon.h>
+#include <Wired/Engine/Package/Serialization.h>
+
+#include <NEON/Common/Log/StubLogger.h>
+
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace Wired::Engine
+{
+    static const std::vector<std::byte> TEST_IMAGE_CONTENTS = {std::byte{1}, std::byte{2}, std::byte{3}, std::byte{4}};
+    static const std::vector<std::byte> TEST_MODEL_CONTENTS = {std::byte{5}, std::byte{6}, std::byte{7}};
+    static const std::vector<std::byte> TEST_MODEL_BIN_CONTENTS = {std::byte{8}, std::byte{9}};
+
+    static void WriteTestFile(const std::filesystem::path& filePath, const std::vector<std::byte>& contents)
+    {
+        std::filesystem::create_directories(filePath.parent_path());
+
+        std::ofstream file(filePath, std::ios::out | std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+    }
+
+    /**
+     * Writes a small package directory (manifest, an image, and a model with a sub-asset) and archives it
+     *
+     * @return The path of the written archive
+     */
+    [[nodiscard]] static std::filesystem::path WriteTestPackageArchive(const std::string& packageName)
+    {
+        NCommon::StubLogger logger;
+
+        const auto parentDirectoryPath = std::filesystem::temp_directory_path() / "WiredEngineTests";
+        const auto packageDirectoryPath = parentDirectoryPath / packageName;
+        std::filesystem::remove_all(packageDirectoryPath);
+
+        const auto manifestBytes = ObjectToBytes(PackageManifest{.manifestVersion = 1, .packageName = packageName});
+        EXPECT_TRUE(manifestBytes.has_value());
+        WriteTestFile(GetPackageManifestPath(parentDirectoryPath, packageName), *manifestBytes);
+
+        WriteTestFile(GetDirectoryPathForAssetType(packageDirectoryPath, AssetType::Image) / "test.png", TEST_IMAGE_CONTENTS);
+
+        const auto modelDirectoryPath = GetDirectoryPathForAssetType(packageDirectoryPath, AssetType::Model) / "box";
+        WriteTestFile(modelDirectoryPath / "box.gltf", TEST_MODEL_CONTENTS);
+        WriteTestFile(modelDirectoryPath / "buffers" / "box.bin", TEST_MODEL_BIN_CONTENTS);
+
+        auto archiveFilePath = parentDirectoryPath / packageName;
+        archiveFilePath.replace_extension(PACKAGE_ARCHIVE_EXTENSION);
+
+        EXPECT_TRUE(WritePackageArchive(&logger, packageDirectoryPath, archiveFilePath).has_value());
+
+        std::filesystem::remove_all(packageDirectoryPath);
+
+        return archiveFilePath;
+    }
+
+    /**
+     * Rewrites an archive's header and index entries in place
+     */
+    static void ModifyTestPackageArchive(const std::filesystem::path& archiveFilePath,
+                                         const std::function<void(ArchiveHeader&, std::vector<ArchiveIndexEntry>&)>& modifyFunc)
+    {
+        auto archiveBytes = *GetFileContents(archiveFilePath);
+
+        ArchiveHeader header{};
+        std::memcpy(&header, archiveBytes.data(), sizeof(ArchiveHeader));
+
+        std::vector<ArchiveIndexEntry> index(header.entryCount);
+        std::memcpy(index.data(), archiveBytes.data() + header.indexOffset, index.size() * sizeof(ArchiveIndexEntry));
+
+        modifyFunc(header, index);
+
+        std::memcpy(archiveBytes.data(), &header, sizeof(ArchiveHeader));
+        std::memcpy(archiveBytes.data() + header.indexOffset, index.data(), index.size() * sizeof(ArchiveIndexEntry));
+
+        WriteTestFile(archiveFilePath, archiveBytes);
+    }
+
+    TEST(PackageArchiveTests, ArchiveRoundTrip)
+    {
+        NCommon::StubLogger logger;
+
+        const auto archiveFilePath = WriteTestPackageArchive("ArchiveRoundTrip");
+
+        ArchivePackageSource source(archiveFilePath);
+        ASSERT_TRUE(source.OpenBlocking(&logger).has_value());
+
+        EXPECT_EQ(source.GetPackageName().id, "ArchiveRoundTrip");
+
+        const auto package = source.GetMetadata();
+        EXPECT_EQ(package.assetNames.imageAssetNames, std::vector<std::string>{"test.png"});
+        EXPECT_EQ(package.assetNames.modelAssetNames, std::vector<std::string>{"box.gltf"});
+
+        EXPECT_EQ(source.GetAssetBytesBlocking(AssetType::Image, "test.png"), TEST_IMAGE_CONTENTS);
+        EXPECT_EQ(source.GetAssetBytesBlocking(AssetType::Model, "box.gltf"), TEST_MODEL_CONTENTS);
+        EXPECT_EQ(source.GetModelSubAssetBytesBlocking("box.gltf", "buffers/box.bin"), TEST_MODEL_BIN_CONTENTS);
+        EXPECT_EQ(source.GetModelSubAssetBytesBlocking("box.gltf", "buffers\\box.bin"), TEST_MODEL_BIN_CONTENTS);
+
+        EXPECT_FALSE(source.GetAssetBytesBlocking(AssetType::Image, "missing.png").has_value());
+        EXPECT_FALSE(source.GetAssetBytesBlocking(AssetType::Shader, "test.png").has_value());
+
+        std::filesystem::remove(archiveFilePath);
+    }
+
+    TEST(PackageArchiveTests, EntryDataIsAligned)
+    {
+        const auto archiveFilePath = WriteTestPackageArchive("EntryDataIsAligned");
+
+        ModifyTestPackageArchive(archiveFilePath, [](ArchiveHeader& header, std::vector<ArchiveIndexEntry>& index){
+            EXPECT_EQ(header.magic, PACKAGE_ARCHIVE_MAGIC);
+            EXPECT_EQ(header.version, PACKAGE_ARCHIVE_VERSION);
+
+            // Manifest, image, model, and the model's two files as sub-assets
+            EXPECT_EQ(index.size(), 5U);
+
+            for (const auto& entry : index)
+            {
+                EXPECT_EQ(entry.dataOffset % PACKAGE_ARCHIVE_DATA_ALIGNMENT, 0U);
+            }
+        });
+
+        std::filesystem::remove(archiveFilePath);
+    }
+
+    TEST(PackageArchiveTests, RejectsBadMagic)
+    {
+        NCommon::StubLogger logger;
+
+        const auto archiveFilePath = WriteTestPackageArchive("RejectsBadMagic");
+        ModifyTestPackageArchive(archiveFilePath, [](ArchiveHeader& header, std::vector<ArchiveIndexEntry>&){
+            header.magic = 0;
+        });
+
+        ArchivePackageSource source(archiveFilePath);
+        EXPECT_FALSE(source.OpenBlocking(&logger).has_value());
+
+        std::filesystem::remove(archiveFilePath);
+    }
+
+    TEST(PackageArchiveTests, RejectsOutOfBoundsIndex)
+    {
+        NCommon::StubLogger logger;
+
+        const auto archiveFilePath = WriteTestPackageArchive("RejectsOutOfBoundsIndex");
+        ModifyTestPackageArchive(archiveFilePath, [](ArchiveHeader& header, std::vector<ArchiveIndexEntry>&){
+            header.entryCount = 1000000;
+        });
+
+        ArchivePackageSource source(archiveFilePath);
+        EXPECT_FALSE(source.OpenBlocking(&logger).has_value());
+
+        std::filesystem::remove(archiveFilePath);
+    }
+
+    TEST(PackageArchiveTests, RejectsOutOfBoundsEntryData)
+    {
+        NCommon::StubLogger logger;
+
+        const auto archiveFilePath = WriteTestPackageArchive("RejectsOutOfBoundsEntryData");
+        ModifyTestPackageArchive(archiveFilePath, [](ArchiveHeader&, std::vector<ArchiveIndexEntry>& index){
+            ASSERT_FALSE(index.empty());
+            index.back().dataByteSize = std::numeric_limits<uint64_t>::max();
+        });
+
+        ArchivePackageSource source(archiveFilePath);
+        EXPECT_FALSE(source.OpenBlocking(&logger).has_value());
+
+        std::filesystem::remove(archiveFilePath);
+    }
+
+    TEST(PackageArchiveTests, RejectsOutOfBoundsEntryName)
+    {
+        NCommon::StubLogger logger;
+
+        const auto archiveFilePath = WriteTestPackageArchive("RejectsOutOfBoundsEntryName");
+        ModifyTestPackageArchive(archiveFilePath, [](ArchiveHeader& header, std::vector<ArchiveIndexEntry>& index){
+            ASSERT_FALSE(index.empty());
+            index.front().nameOffset = header.stringsByteSize;
+            index.front().nameByteSize = 1;
+        });
+
+        ArchivePackageSource source(archiveFilePath);
+        EXPECT_FALSE(source.OpenBlocking(&logger).has_value());
+
+        std::filesystem::remove(archiveFilePath);
+    }
+
+    TEST(PackageArchiveTests, RejectsMissingManifest)
+    {
+        NCommon::StubLogger logger;
+
+        const auto archiveFilePath = WriteTestPackageArchive("RejectsMissingManifest");
+        ModifyTestPackageArchive(archiveFilePath, [](ArchiveHeader&, std::vector<ArchiveIndexEntry>& index){
+            for (auto& entry : index)
+            {
+                if (entry.entryType == static_cast<uint32_t>(ArchiveEntryType::Manifest))
+                {
+                    entry.entryType = static_cast<uint32_t>(ArchiveEntryType::ModelSubAsset);
+                }
+            }
+        });
+
+        ArchivePackageSource source(archiveFilePath);
+        EXPECT_FALSE(source.OpenBlocking(&logger).has_value());
+
+        std::filesystem::remove(archiveFilePath);
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_PACKAGEARCHIVETESTS_H
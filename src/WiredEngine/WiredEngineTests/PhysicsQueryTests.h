@@ -0,0 +1,190 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_PHYSICSQUERYTESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_PHYSICSQUERYTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "Physics/JoltPhysics.h"
+
+#include <NEON/Common/Log/StubLogger.h>
+#include <NEON/Common/Metrics/StubMetrics.h>
+
+#include <glm/glm.hpp>
+
+#include <array>
+#include <limits>
+
+namespace Wired::Engine
+{
+    static const PhysicsSceneName TEST_PHYSICS_SCENE = PhysicsSceneName("Test");
+    static constexpr EntityId TEST_BOX_ENTITY = EntityId{1};
+    static constexpr float TEST_QUERY_EPSILON = 0.001f;
+
+    /**
+     * A physics scene containing a static 2x2x2 box, centered at the origin
+     */
+    class PhysicsQueryTests : public ::testing::Test
+    {
+        protected:
+
+            static void SetUpTestSuite() { JoltPhysics::StaticInit(); }
+            static void TearDownTestSuite() { JoltPhysics::StaticDestroy(); }
+
+            void SetUp() override
+            {
+                ASSERT_TRUE(m_physics.StartUp());
+                ASSERT_TRUE(m_physics.CreatePhysicsScene(TEST_PHYSICS_SCENE));
+
+                RigidBodyData boxBody{};
+                boxBody.entity = TEST_BOX_ENTITY;
+                boxBody.type = RigidBodyType::Static;
+                boxBody.shape.bounds = PhysicsBounds_Box{.min = glm::vec3(-1.0f), .max = glm::vec3(1.0f)};
+
+                const auto physicsIds = m_physics.CreateRigidBodies(TEST_PHYSICS_SCENE, std::span<const RigidBodyData>(&boxBody, 1));
+                ASSERT_EQ(physicsIds.size(), 1U);
+                ASSERT_TRUE(physicsIds[0]);
+            }
+
+            void TearDown() override
+            {
+                m_physics.ShutDown();
+            }
+
+            [[nodiscard]] std::vector<PhysicsQueryResult> Overlap(const PhysicsQueryShape& shape)
+            {
+                const auto query = OverlapQuery{.shape = shape};
+                return m_physics.Overlap(TEST_PHYSICS_SCENE, std::span<const OverlapQuery>(&query, 1));
+            }
+
+            // Casts the shape from outside the box, straight at it
+            [[nodiscard]] std::vector<PhysicsQueryResult> ShapeCast(const PhysicsQueryShape& shape)
+            {
+                const auto query = ShapeCastQuery{
+                    .shape = shape,
+                    .position_worldSpace = glm::vec3(0.0f, 0.0f, 5.0f),
+                    .direction_worldSpace = glm::vec3(0.0f, 0.0f, -1.0f),
+                    .distance = 10.0f
+                };
+                return m_physics.ShapeCast(TEST_PHYSICS_SCENE, std::span<const ShapeCastQuery>(&query, 1));
+            }
+
+        protected:
+
+            NCommon::StubLogger m_logger;
+            NCommon::StubMetrics m_metrics;
+            JoltPhysics m_physics{&m_logger, &m_metrics, nullptr};
+    };
+
+    TEST_F(PhysicsQueryTests, RayCastHitsBody)
+    {
+        const auto query = RayCastQuery{
+            .origin_worldSpace = glm::vec3(0.0f, 0.0f, 5.0f),
+            .direction_worldSpace = glm::vec3(0.0f, 0.0f, -1.0f),
+            .distance = 10.0f
+        };
+
+        const auto results = m_physics.RayCast(TEST_PHYSICS_SCENE, std::span<const RayCastQuery>(&query, 1));
+        ASSERT_EQ(results.size(), 1U);
+        ASSERT_EQ(results[0].hits.size(), 1U);
+
+        const auto& hit = results[0].hits[0];
+        EXPECT_EQ(hit.entity, TEST_BOX_ENTITY);
+        EXPECT_NEAR(hit.distance, 4.0f, TEST_QUERY_EPSILON);
+        EXPECT_NEAR(hit.point_worldSpace.z, 1.0f, TEST_QUERY_EPSILON);
+        EXPECT_NEAR(hit.normal_worldSpace.z, 1.0f, TEST_QUERY_EPSILON);
+    }
+
+    TEST_F(PhysicsQueryTests, RayCastOutOfRangeHitsNothing)
+    {
+        const auto query = RayCastQuery{
+            .origin_worldSpace = glm::vec3(0.0f, 0.0f, 5.0f),
+            .direction_worldSpace = glm::vec3(0.0f, 0.0f, -1.0f),
+            .distance = 3.0f
+        };
+
+        const auto results = m_physics.RayCast(TEST_PHYSICS_SCENE, std::span<const RayCastQuery>(&query, 1));
+        ASSERT_EQ(results.size(), 1U);
+        EXPECT_TRUE(results[0].hits.empty());
+    }
+
+    TEST_F(PhysicsQueryTests, IgnoredEntityIsNotHit)
+    {
+        const auto query = RayCastQuery{
+            .origin_worldSpace = glm::vec3(0.0f, 0.0f, 5.0f),
+            .direction_worldSpace = glm::vec3(0.0f, 0.0f, -1.0f),
+            .distance = 10.0f,
+            .filter = PhysicsQueryFilter{.ignoreEntity = TEST_BOX_ENTITY}
+        };
+
+        const auto results = m_physics.RayCast(TEST_PHYSICS_SCENE, std::span<const RayCastQuery>(&query, 1));
+        ASSERT_EQ(results.size(), 1U);
+        EXPECT_TRUE(results[0].hits.empty());
+    }
+
+    TEST_F(PhysicsQueryTests, ValidShapesHitBody)
+    {
+        const std::array<PhysicsQueryShape, 3> shapes = {
+            PhysicsQueryShape_Sphere{.radius = 0.5f},
+            PhysicsQueryShape_Box{.halfExtents = glm::vec3(0.5f)},
+            PhysicsQueryShape_Capsule{.height = 2.0f, .radius = 0.5f}
+        };
+
+        for (const auto& shape : shapes)
+        {
+            const auto overlapResults = Overlap(shape);
+            ASSERT_EQ(overlapResults.size(), 1U);
+            ASSERT_EQ(overlapResults[0].hits.size(), 1U);
+            EXPECT_EQ(overlapResults[0].hits[0].entity, TEST_BOX_ENTITY);
+
+            const auto castResults = ShapeCast(shape);
+            ASSERT_EQ(castResults.size(), 1U);
+            ASSERT_EQ(castResults[0].hits.size(), 1U);
+            EXPECT_EQ(castResults[0].hits[0].entity, TEST_BOX_ENTITY);
+        }
+    }
+
+    TEST_F(PhysicsQueryTests, InvalidShapesHitNothing)
+    {
+        const std::array<PhysicsQueryShape, 6> shapes = {
+            PhysicsQueryShape_Sphere{.radius = 0.0f},
+            PhysicsQueryShape_Sphere{.radius = std::numeric_limits<float>::quiet_NaN()},
+            PhysicsQueryShape_Box{.halfExtents = glm::vec3(0.0f)},
+            PhysicsQueryShape_Box{.halfExtents = glm::vec3(0.5f, 0.0f, 0.5f)},
+            PhysicsQueryShape_Capsule{.height = 2.0f, .radius = 0.0f},
+            PhysicsQueryShape_Capsule{.height = 1.0f, .radius = 0.5f}
+        };
+
+        for (const auto& shape : shapes)
+        {
+            const auto overlapResults = Overlap(shape);
+            ASSERT_EQ(overlapResults.size(), 1U);
+            EXPECT_TRUE(overlapResults[0].hits.empty());
+
+            const auto castResults = ShapeCast(shape);
+            ASSERT_EQ(castResults.size(), 1U);
+            EXPECT_TRUE(castResults[0].hits.empty());
+        }
+    }
+
+    TEST_F(PhysicsQueryTests, InvalidQueryDoesNotAffectRestOfBatch)
+    {
+        const std::array<OverlapQuery, 3> queries = {
+            OverlapQuery{.shape = PhysicsQueryShape_Sphere{.radius = 0.5f}},
+            OverlapQuery{.shape = PhysicsQueryShape_Sphere{.radius = 0.0f}},
+            OverlapQuery{.shape = PhysicsQueryShape_Sphere{.radius = 0.5f}, .position_worldSpace = glm::vec3(10.0f)}
+        };
+
+        const auto results = m_physics.Overlap(TEST_PHYSICS_SCENE, queries);
+        ASSERT_EQ(results.size(), 3U);
+        EXPECT_EQ(results[0].hits.size(), 1U);
+        EXPECT_TRUE(results[1].hits.empty());
+        EXPECT_TRUE(results[2].hits.empty());
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_PHYSICSQUERYTESTS_H
@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_TRANSFORMHIERARCHYTESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_TRANSFORMHIERARCHYTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "World/TransformHierarchy.h"
+#include "World/HierarchyComponent.h"
+#include "WorkThreadPool.h"
+
+#include <Wired/Engine/World/TransformComponent.h>
+
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+#include <vector>
+#include <algorithm>
+
+namespace Wired::Engine
+{
+    static void ExpectVec3Near(const glm::vec3& actual, const glm::vec3& expected)
+    {
+        EXPECT_NEAR(actual.x, expected.x, 0.0001f);
+        EXPECT_NEAR(actual.y, expected.y, 0.0001f);
+        EXPECT_NEAR(actual.z, expected.z, 0.0001f);
+    }
+
+    [[nodiscard]] static EntityId CreateTransformEntity(entt::basic_registry<EntityId>& registry,
+                                                        const glm::vec3& position,
+                                                        const glm::quat& orientation = glm::identity<glm::quat>(),
+                                                        const glm::vec3& scale = glm::vec3(1.0f))
+    {
+        const auto entity = registry.create();
+        registry.emplace<TransformComponent>(entity, TransformComponent(position, orientation, scale));
+        return entity;
+    }
+
+    TEST(TransformHierarchyTests, SetParentRejectsCycles)
+    {
+        entt::basic_registry<EntityId> registry;
+        TransformHierarchy hierarchy;
+        hierarchy.Initialize(registry);
+
+        const auto a = CreateTransformEntity(registry, glm::vec3(0.0f));
+        const auto b = CreateTransformEntity(registry, glm::vec3(0.0f));
+        const auto c = CreateTransformEntity(registry, glm::vec3(0.0f));
+
+        EXPECT_TRUE(hierarchy.SetParent(registry, b, a));
+        EXPECT_TRUE(hierarchy.SetParent(registry, c, b));
+
+        EXPECT_FALSE(hierarchy.SetParent(registry, a, a));
+        EXPECT_FALSE(hierarchy.SetParent(registry, a, b));
+        EXPECT_FALSE(hierarchy.SetParent(registry, a, c));
+
+        // The rejected attachments left the hierarchy as it was
+        EXPECT_FALSE(registry.get<HierarchyComponent>(a).parent.has_value());
+        EXPECT_EQ(registry.get<HierarchyComponent>(b).parent, std::optional<EntityId>(a));
+        EXPECT_EQ(registry.get<HierarchyComponent>(c).parent, std::optional<EntityId>(b));
+
+        // Invalid entities are rejected
+        const auto destroyed = registry.create();
+        registry.destroy(destroyed);
+        EXPECT_FALSE(hierarchy.SetParent(registry, destroyed, a));
+        EXPECT_FALSE(hierarchy.SetParent(registry, a, destroyed));
+    }
+
+    TEST(TransformHierarchyTests, ReparentingAndDetaching)
+    {
+        entt::basic_registry<EntityId> registry;
+        TransformHierarchy hierarchy;
+        hierarchy.Initialize(registry);
+
+        const auto a = CreateTransformEntity(registry, glm::vec3(0.0f));
+        const auto b = CreateTransformEntity(registry, glm::vec3(0.0f));
+        const auto c = CreateTransformEntity(registry, glm::vec3(0.0f));
+
+        EXPECT_TRUE(hierarchy.SetParent(registry, b, a));
+        EXPECT_TRUE(hierarchy.SetParent(registry, c, a));
+
+        auto subtree = TransformHierarchy::GetSubtree(registry, a);
+        ASSERT_EQ(subtree.size(), 3U);
+        EXPECT_EQ(subtree[0], a);
+        EXPECT_TRUE(std::ranges::find(subtree, b) != subtree.cend());
+        EXPECT_TRUE(std::ranges::find(subtree, c) != subtree.cend());
+
+        // Moving c under b; c is now a grandchild of a, visited after its parent
+        EXPECT_TRUE(hierarchy.SetParent(registry, c, b));
+        subtree = TransformHierarchy::GetSubtree(registry, a);
+        EXPECT_EQ(subtree, (std::vector<EntityId>{a, b, c}));
+
+        // Detaching c prunes its hierarchy state, and its former ancestor can then be attached beneath it
+        EXPECT_TRUE(hierarchy.SetParent(registry, c, std::nullopt));
+        EXPECT_FALSE(registry.all_of<HierarchyComponent>(c));
+        EXPECT_TRUE(hierarchy.SetParent(registry, a, c));
+
+        // Detaching the only child prunes hierarchy state from both entities
+        EXPECT_TRUE(hierarchy.SetParent(registry, b, std::nullopt));
+        EXPECT_TRUE(hierarchy.SetParent(registry, a, std::nullopt));
+        EXPECT_FALSE(registry.all_of<HierarchyComponent>(a));
+        EXPECT_FALSE(registry.all_of<HierarchyComponent>(b));
+        EXPECT_FALSE(registry.all_of<HierarchyComponent>(c));
+    }
+
+    TEST(TransformHierarchyTests, WorldTransformComposition)
+    {
+        WorkThreadPool workThreadPool(2);
+
+        entt::basic_registry<EntityId> registry;
+        TransformHierarchy hierarchy;
+        hierarchy.Initialize(registry);
+
+        const auto rotateY90 = glm::angleAxis(glm::radians(90.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        const auto parent = CreateTransformEntity(registry, glm::vec3(10.0f, 0.0f, 0.0f), rotateY90, glm::vec3(2.0f));
+        const auto child = CreateTransformEntity(registry, glm::vec3(1.0f, 0.0f, 0.0f));
+        const auto grandchild = CreateTransformEntity(registry, glm::vec3(0.0f, 0.0f, 1.0f), rotateY90);
+
+        ASSERT_TRUE(hierarchy.SetParent(registry, child, parent));
+        ASSERT_TRUE(hierarchy.SetParent(registry, grandchild, child));
+
+        hierarchy.Execute(&workThreadPool, registry);
+
+        // The root's world transform is its local transform
+        ExpectVec3Near(TransformHierarchy::GetWorldTransform(registry, parent).position, glm::vec3(10.0f, 0.0f, 0.0f));
+
+        // Scaled by 2, then rotated +90 degrees about y (+x to -z), then translated
+        const auto childWorld = TransformHierarchy::GetWorldTransform(registry, child);
+        ExpectVec3Near(childWorld.position, glm::vec3(10.0f, 0.0f, -2.0f));
+        ExpectVec3Near(childWorld.scale, glm::vec3(2.0f));
+        ExpectVec3Near(childWorld.orientation * glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(0.0f, 0.0f, -1.0f));
+
+        // +z rotated to +x, scaled by 2, relative to the child
+        const auto grandchildWorld = TransformHierarchy::GetWorldTransform(registry, grandchild);
+        ExpectVec3Near(grandchildWorld.position, glm::vec3(12.0f, 0.0f, -2.0f));
+        ExpectVec3Near(glm::vec3(grandchildWorld.transformMatrix[3]), grandchildWorld.position);
+
+        // Two 90 degree rotations about y; +x maps to -x
+        ExpectVec3Near(grandchildWorld.orientation * glm::vec3(1.0f, 0.0f, 0.0f), glm::vec3(-1.0f, 0.0f, 0.0f));
+
+        //
+        // Moving the parent updates its descendants' world transforms
+        //
+        registry.patch<TransformComponent>(parent, [](auto& transform){
+            transform.SetPosition(glm::vec3(0.0f, 5.0f, 0.0f));
+        });
+
+        hierarchy.Execute(&workThreadPool, registry);
+
+        ExpectVec3Near(TransformHierarchy::GetWorldTransform(registry, child).position, glm::vec3(0.0f, 5.0f, -2.0f));
+        ExpectVec3Near(TransformHierarchy::GetWorldTransform(registry, grandchild).position, glm::vec3(2.0f, 5.0f, -2.0f));
+
+        //
+        // A detached entity's world transform is its local transform
+        //
+        ASSERT_TRUE(hierarchy.SetParent(registry, child, std::nullopt));
+
+        hierarchy.Execute(&workThreadPool, registry);
+
+        ExpectVec3Near(TransformHierarchy::GetWorldTransform(registry, child).position, glm::vec3(1.0f, 0.0f, 0.0f));
+        ExpectVec3Near(TransformHierarchy::GetWorldTransform(registry, grandchild).position, glm::vec3(1.0f, 0.0f, 1.0f));
+    }
+
+    TEST(TransformHierarchyTests, IndependentHierarchiesComputedInParallel)
+    {
+        WorkThreadPool workThreadPool(4);
+
+        entt::basic_registry<EntityId> registry;
+        TransformHierarchy hierarchy;
+        hierarchy.Initialize(registry);
+
+        std::vector<EntityId> children;
+
+        for (unsigned int x = 0; x < 64; ++x)
+        {
+            const auto parent = CreateTransformEntity(registry, glm::vec3((float)x, 0.0f, 0.0f));
+            const auto child = CreateTransformEntity(registry, glm::vec3(0.0f, (float)x, 0.0f));
+            ASSERT_TRUE(hierarchy.SetParent(registry, child, parent));
+            children.push_back(child);
+        }
+
+        hierarchy.Execute(&workThreadPool, registry);
+
+        for (unsigned int x = 0; x < children.size(); ++x)
+        {
+            ExpectVec3Near(TransformHierarchy::GetWorldTransform(registry, children[x]).position, glm::vec3((float)x, (float)x, 0.0f));
+        }
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_TRANSFORMHIERARCHYTESTS_H
@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDENGINETESTS_WORLDSYSTEMSCHEDULERTESTS_H
+#define WIREDENGINE_WIREDENGINETESTS_WORLDSYSTEMSCHEDULERTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "World/WorldSystemScheduler.h"
+
+#include <NEON/Common/Log/StubLogger.h>
+
+#include <vector>
+
+namespace Wired::Engine
+{
+    struct TestComponentA {};
+    struct TestComponentB {};
+
+    class TestWorldSystem : public IWorldSystem
+    {
+        public:
+
+            TestWorldSystem(Type type, Access access, std::vector<Type> runsAfter = {})
+                : m_type(type)
+                , m_access(std::move(access))
+                , m_runsAfter(std::move(runsAfter))
+            { }
+
+            [[nodiscard]] Type GetType() const noexcept override { return m_type; }
+            [[nodiscard]] Access GetAccess() const override { return m_access; }
+            [[nodiscard]] std::vector<Type> GetRunsAfter() const override { return m_runsAfter; }
+
+            void Execute(RunState*, WorldState*, entt::basic_registry<EntityId>&) override { }
+
+        private:
+
+            Type m_type;
+            Access m_access;
+            std::vector<Type> m_runsAfter;
+    };
+
+    static IWorldSystem::Access ReadsA() { return {.reads = IWorldSystem::TypesOf<TestComponentA>(), .writes = {}}; }
+    static IWorldSystem::Access WritesA() { return {.reads = {}, .writes = IWorldSystem::TypesOf<TestComponentA>()}; }
+    static IWorldSystem::Access WritesB() { return {.reads = {}, .writes = IWorldSystem::TypesOf<TestComponentB>()}; }
+
+    TEST(WorldSystemSchedulerTests, AccessConflicts)
+    {
+        EXPECT_FALSE(ReadsA().ConflictsWith(ReadsA()));
+        EXPECT_TRUE(ReadsA().ConflictsWith(WritesA()));
+        EXPECT_TRUE(WritesA().ConflictsWith(ReadsA()));
+        EXPECT_TRUE(WritesA().ConflictsWith(WritesA()));
+        EXPECT_FALSE(WritesA().ConflictsWith(WritesB()));
+        EXPECT_FALSE(ReadsA().ConflictsWith(WritesB()));
+    }
+
+    TEST(WorldSystemSchedulerTests, NonConflictingSystemsAreIndependent)
+    {
+        NCommon::StubLogger logger;
+
+        TestWorldSystem system1(IWorldSystem::Type::ModelAnimator, ReadsA());
+        TestWorldSystem system2(IWorldSystem::Type::Physics, ReadsA());
+        TestWorldSystem system3(IWorldSystem::Type::Audio, WritesB());
+
+        const auto graph = WorldSystemScheduler::BuildGraph(&logger, {&system1, &system2, &system3});
+
+        ASSERT_EQ(graph.systems, (std::vector<IWorldSystem*>{&system1, &system2, &system3}));
+        ASSERT_EQ(graph.dependents.size(), 3U);
+        EXPECT_TRUE(graph.dependents[0].empty());
+        EXPECT_TRUE(graph.dependents[1].empty());
+        EXPECT_TRUE(graph.dependents[2].empty());
+    }
+
+    TEST(WorldSystemSchedulerTests, ConflictingSystemsRunInProvidedOrder)
+    {
+        NCommon::StubLogger logger;
+
+        TestWorldSystem system1(IWorldSystem::Type::ModelAnimator, WritesA());
+        TestWorldSystem system2(IWorldSystem::Type::Physics, WritesB());
+        TestWorldSystem system3(IWorldSystem::Type::Audio, ReadsA());
+
+        const auto graph = WorldSystemScheduler::BuildGraph(&logger, {&system1, &system2, &system3});
+
+        ASSERT_EQ(graph.systems, (std::vector<IWorldSystem*>{&system1, &system2, &system3}));
+        ASSERT_EQ(graph.dependents.size(), 3U);
+        EXPECT_EQ(graph.dependents[0], (std::vector<std::size_t>{2}));
+        EXPECT_TRUE(graph.dependents[1].empty());
+        EXPECT_TRUE(graph.dependents[2].empty());
+    }
+
+    TEST(WorldSystemSchedulerTests, RunsAfterReordersSystems)
+    {
+        NCommon::StubLogger logger;
+
+        // Physics declares it runs after ModelAnimator, despite being provided first and not conflicting with it
+        TestWorldSystem physics(IWorldSystem::Type::Physics, WritesB(), {IWorldSystem::Type::ModelAnimator});
+        TestWorldSystem animator(IWorldSystem::Type::ModelAnimator, ReadsA());
+        TestWorldSystem audio(IWorldSystem::Type::Audio, ReadsA());
+
+        const auto graph = WorldSystemScheduler::BuildGraph(&logger, {&physics, &animator, &audio});
+
+        ASSERT_EQ(graph.systems, (std::vector<IWorldSystem*>{&animator, &physics, &audio}));
+        ASSERT_EQ(graph.dependents.size(), 3U);
+        EXPECT_EQ(graph.dependents[0], (std::vector<std::size_t>{1}));
+        EXPECT_TRUE(graph.dependents[1].empty());
+        EXPECT_TRUE(graph.dependents[2].empty());
+    }
+
+    TEST(WorldSystemSchedulerTests, RunsAfterAbsentSystemIsIgnored)
+    {
+        NCommon::StubLogger logger;
+
+        TestWorldSystem physics(IWorldSystem::Type::Physics, ReadsA(), {IWorldSystem::Type::ImGui});
+        TestWorldSystem audio(IWorldSystem::Type::Audio, ReadsA());
+
+        const auto graph = WorldSystemScheduler::BuildGraph(&logger, {&physics, &audio});
+
+        ASSERT_EQ(graph.systems, (std::vector<IWorldSystem*>{&physics, &audio}));
+        EXPECT_TRUE(graph.dependents[0].empty());
+        EXPECT_TRUE(graph.dependents[1].empty());
+    }
+
+    TEST(WorldSystemSchedulerTests, RunsAfterCycleFallsBackToProvidedOrder)
+    {
+        NCommon::StubLogger logger;
+
+        TestWorldSystem physics(IWorldSystem::Type::Physics, ReadsA(), {IWorldSystem::Type::ModelAnimator});
+        TestWorldSystem animator(IWorldSystem::Type::ModelAnimator, ReadsA(), {IWorldSystem::Type::Physics});
+
+        const auto graph = WorldSystemScheduler::BuildGraph(&logger, {&physics, &animator});
+
+        // Still a valid serial order: every system is present exactly once, with the later one depending on the earlier
+        ASSERT_EQ(graph.systems, (std::vector<IWorldSystem*>{&physics, &animator}));
+        EXPECT_EQ(graph.dependents[0], (std::vector<std::size_t>{1}));
+        EXPECT_TRUE(graph.dependents[1].empty());
+    }
+}
+
+#endif //WIREDENGINE_WIREDENGINETESTS_WORLDSYSTEMSCHEDULERTESTS_H
@@ -19,6 +19,7 @@
 #include <vector>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <unordered_set>
 #include <variant>
 
@@ -193,6 +194,13 @@ namespace Wired::GPU
         bool sequentiallyWritten{false};
     };
 
+    struct BufferCopyRegion
+    {
+        std::size_t sourceByteOffset{0};
+        std::size_t destByteOffset{0};
+        std::size_t byteSize{0};
+    };
+
     struct BufferBinding
     {
         BufferId bufferId{};
@@ -253,6 +261,42 @@ namespace Wired::GPU
         Front,
         Back
     };
+
+    struct MemoryHeapStats
+    {
+        uint32_t heapIndex{0};
+        bool deviceLocal{false};
+
+        // Bytes the process can allocate from the heap before the driver starts paging or failing allocations
+        std::size_t budgetByteSize{0};
+
+        // Bytes the process currently has allocated from the heap
+        std::size_t usageByteSize{0};
+    };
+
+    /**
+     * Reported when a device local heap's usage approaches its budget. Receivers should release whatever
+     * memory they can do without, before further allocations spill into system memory.
+     */
+    struct MemoryPressure
+    {
+        MemoryHeapStats heapStats{};
+    };
+
+    using MemoryPressureCallback = std::function<void(const MemoryPressure&)>;
+
+    struct DescriptorSetStats
+    {
+        // Number of long-lived descriptor sets currently cached by their bindings
+        std::size_t cachedSetCount{0};
+
+        // Totals since init of cache lookups, and of those lookups which found a cached set
+        uint64_t cacheLookupCount{0};
+        uint64_t cacheHitCount{0};
+
+        // Total since init of transient descriptor sets allocated from per-frame arenas
+        uint64_t transientSetCount{0};
+    };
 }
 
 #endif //WIREDENGINE_WIREDGPU_INCLUDE_WIRED_GPU_GPUCOMMON_H
@@ -29,6 +29,9 @@
 #include <string>
 #include <expected>
 #include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
 
 namespace Wired::GPU
 {
@@ -97,6 +100,13 @@ namespace Wired::GPU
             virtual bool UnmapBuffer(BufferId bufferId) = 0;
             virtual void DestroyBuffer(BufferId bufferId) = 0;
 
+            /**
+             * Non-blocking check for whether submitted GPU work which references the buffer is still pending. Work
+             * is detected as finished as finished command buffers are cleaned up, which happens at the start of
+             * every frame.
+             */
+            [[nodiscard]] virtual bool IsBufferInUse(BufferId bufferId) = 0;
+
             //
             // Samplers
             //
@@ -107,6 +117,12 @@ namespace Wired::GPU
             // Commands
             //
             [[nodiscard]] virtual std::expected<CommandBufferId, bool> AcquireCommandBuffer(bool primary, const std::string& tag) = 0;
+            /**
+             * Submits primary command buffers for execution, in order. While a frame is active, submissions are
+             * queued and flushed to the GPU together, in one queue submit, when a command buffer configured for
+             * presentation is submitted or when the frame ends. Outside of a frame they're submitted immediately.
+             */
+            virtual std::expected<bool, SurfaceError> SubmitCommandBuffers(const std::vector<CommandBufferId>& commandBufferIds) = 0;
             virtual std::expected<bool, SurfaceError> SubmitCommandBuffer(CommandBufferId commandBufferId) = 0;
             virtual void CancelCommandBuffer(CommandBufferId commandBufferId) = 0;
 
@@ -114,9 +130,10 @@ namespace Wired::GPU
 
             virtual bool CmdClearColorImage(CopyPass copyPass, ImageId imageId, const ImageSubresourceRange& subresourceRange, const glm::vec4& color, bool cycle) = 0;
             virtual bool CmdBlitImage(CopyPass copyPass, ImageId sourceImage, const ImageRegion& sourceRegion, ImageId destImage, const ImageRegion& destRegion, Filter filter, bool cycle) = 0;
-            virtual bool CmdUploadDataToBuffer(CopyPass copyPass, BufferId sourceTransferBufferId, const std::size_t& sourceByteOffset, BufferId destBufferId, const std::size_t& destByteOffset, const std::size_t& copyByteSize, bool cycle) = 0;
+            virtual bool CmdUploadDataToBuffer(CopyPass copyPass, BufferId sourceTransferBufferId, BufferId destBufferId, const std::vector<BufferCopyRegion>& regions, bool cycle) = 0;
             virtual bool CmdUploadDataToImage(CopyPass copyPass, BufferId sourceTransferBufferId, const std::size_t& sourceByteOffset, ImageId destImageId, const ImageRegion& destRegion, const std::size_t& copyByteSize, bool cycle) = 0;
             virtual bool CmdCopyBufferToBuffer(CopyPass copyPass, BufferId sourceBufferId, const std::size_t& sourceByteOffset, BufferId destBufferId, const std::size_t& destByteOffset, const std::size_t& copyByteSize, bool cycle) = 0;
+            virtual bool CmdDownloadDataFromImage(CopyPass copyPass, ImageId sourceImageId, const ImageRegion& sourceRegion, BufferId destTransferBufferId, const std::size_t& destByteOffset) = 0;
 
             virtual bool CmdExecuteCommands(CommandBufferId primaryCommandBufferId, const std::vector<CommandBufferId>& secondaryCommandBufferIds) = 0;
             virtual bool CmdBindPipeline(RenderOrComputePass pass, PipelineId pipelineId) = 0;
@@ -153,6 +170,32 @@ namespace Wired::GPU
             virtual void CmdWriteTimestampFinish(CommandBufferId commandBufferId, const std::string& name) = 0;
             [[nodiscard]] virtual std::optional<float> GetTimestampDiffMs(const std::string& name, uint32_t offset) const = 0;
 
+            //
+            // Stats
+            //
+            // Total number of image/buffer barriers recorded into command buffers since init
+            [[nodiscard]] virtual uint64_t GetPipelineBarrierCount() const = 0;
+            // Total byte size of the extra copies buffers have been cycled into and still hold
+            [[nodiscard]] virtual std::size_t GetCycledBufferByteSize() const = 0;
+            // Total number of queue submits made since init
+            [[nodiscard]] virtual uint64_t GetQueueSubmitCount() const = 0;
+            // Per memory heap budget and usage, as most recently reported by the driver
+            [[nodiscard]] virtual std::vector<MemoryHeapStats> GetMemoryHeapStats() const = 0;
+            // Tag -> total byte size of the live buffer/image allocations which were created with that tag
+            [[nodiscard]] virtual std::unordered_map<std::string, std::size_t> GetAllocationByteSizesByTag() const = 0;
+            // Descriptor set cache size and lookup/allocation totals
+            [[nodiscard]] virtual DescriptorSetStats GetDescriptorSetStats() const = 0;
+
+            //
+            // Memory
+            //
+            /**
+             * Sets a callback which is invoked, from within StartFrame(), when a device local heap's usage
+             * approaches its budget. While the pressure persists it's re-invoked periodically, not every frame.
+             * Idle cycled buffer copies are released before the callback is invoked.
+             */
+            virtual void SetMemoryPressureCallback(MemoryPressureCallback callback) = 0;
+
             //
             // Rendering
             //
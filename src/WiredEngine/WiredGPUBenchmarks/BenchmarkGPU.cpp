@@ -0,0 +1,403 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "BenchmarkGPU.h"
+
+#include <Wired/GPU/WiredGPUVkBuilder.h>
+
+#include <array>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <algorithm>
+#include <cstring>
+#include <thread>
+
+namespace Wired::GPU
+{
+
+static BenchmarkGPU* g_pBenchmarkGPU{nullptr};
+
+// Byte size of each storage buffer; large enough to hold one sprite instance payload
+static constexpr std::size_t STORAGE_BUFFER_BYTE_SIZE = 256;
+
+static constexpr uint32_t SAMPLED_IMAGE_COUNT = 8;
+
+// Quad with position/normal/uv/tangent per vertex, matching the sprite vertex shader's inputs
+static constexpr std::array<float, 44> QUAD_VERTICES = {
+    -0.5f, -0.5f, 0.0f,     0.0f, 0.0f, 1.0f,   0.0f, 1.0f,     1.0f, 0.0f, 0.0f,
+     0.5f, -0.5f, 0.0f,     0.0f, 0.0f, 1.0f,   1.0f, 1.0f,     1.0f, 0.0f, 0.0f,
+     0.5f,  0.5f, 0.0f,     0.0f, 0.0f, 1.0f,   1.0f, 0.0f,     1.0f, 0.0f, 0.0f,
+    -0.5f,  0.5f, 0.0f,     0.0f, 0.0f, 1.0f,   0.0f, 0.0f,     1.0f, 0.0f, 0.0f
+};
+
+static constexpr std::array<uint32_t, 6> QUAD_INDICES = { 0, 1, 2, 0, 2, 3 };
+
+std::unique_ptr<BenchmarkGPU> BenchmarkGPU::Create(const NCommon::ILogger* pLogger,
+                                                   PFN_vkGetInstanceProcAddr pfnVkGetInstanceProcAddr,
+                                                   const std::optional<std::string>& physicalDeviceFilter)
+{
+    auto benchmarkGPU = std::make_unique<BenchmarkGPU>(pLogger);
+
+    if (!benchmarkGPU->StartUp(pfnVkGetInstanceProcAddr, physicalDeviceFilter))
+    {
+        benchmarkGPU->Destroy();
+        return nullptr;
+    }
+
+    return benchmarkGPU;
+}
+
+void BenchmarkGPU::SetInstance(BenchmarkGPU* pInstance)
+{
+    g_pBenchmarkGPU = pInstance;
+}
+
+BenchmarkGPU* BenchmarkGPU::Get()
+{
+    return g_pBenchmarkGPU;
+}
+
+BenchmarkGPU::BenchmarkGPU(const NCommon::ILogger* pLogger)
+    : m_pLogger(pLogger)
+{
+
+}
+
+BenchmarkGPU::~BenchmarkGPU()
+{
+    m_pLogger = nullptr;
+}
+
+bool BenchmarkGPU::StartUp(PFN_vkGetInstanceProcAddr pfnVkGetInstanceProcAddr, const std::optional<std::string>& physicalDeviceFilter)
+{
+    //
+    // Create a headless GPU
+    //
+    m_gpu = WiredGPUVkBuilder::Build(
+        m_pLogger,
+        {
+            .applicationName = "WiredGPUBenchmarks",
+            .applicationVersion = {0, 0, 1},
+            .requiredInstanceExtensions = {},
+            .supportSurfaceOutput = false,
+            .pfnVkGetInstanceProcAddr = pfnVkGetInstanceProcAddr
+        }
+    );
+
+    if (!m_gpu->Initialize())
+    {
+        m_pLogger->Fatal("BenchmarkGPU::StartUp: Failed to initialize GPU system");
+        return false;
+    }
+
+    //
+    // Choose a physical device
+    //
+    const auto physicalDeviceNames = m_gpu->GetSuitablePhysicalDeviceNames();
+    if (!physicalDeviceNames || physicalDeviceNames->empty())
+    {
+        m_pLogger->Fatal("BenchmarkGPU::StartUp: No suitable physical devices found");
+        return false;
+    }
+
+    const auto deviceFilter = physicalDeviceFilter.value_or("llvmpipe");
+
+    const auto it = std::ranges::find_if(*physicalDeviceNames, [&](const std::string& name){
+        return name.find(deviceFilter) != std::string::npos;
+    });
+
+    if (it != physicalDeviceNames->cend())
+    {
+        m_physicalDeviceName = *it;
+    }
+    else if (physicalDeviceFilter)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::StartUp: No suitable physical device matches: {}", *physicalDeviceFilter);
+        return false;
+    }
+    else
+    {
+        m_physicalDeviceName = physicalDeviceNames->front();
+    }
+
+    m_gpu->SetRequiredPhysicalDevice(m_physicalDeviceName);
+
+    if (!m_gpu->StartUp(std::nullopt, std::nullopt, GPUSettings{}))
+    {
+        m_pLogger->Fatal("BenchmarkGPU::StartUp: Failed to start up the GPU system");
+        return false;
+    }
+
+    if (!CreateShaders()) { return false; }
+    if (!CreateResources()) { return false; }
+
+    return true;
+}
+
+bool BenchmarkGPU::CreateShaders()
+{
+    const std::vector<std::pair<std::string, ShaderType>> shaders = {
+        {"sprite.vert.spv", ShaderType::Vertex},
+        {"sprite.frag.spv", ShaderType::Fragment}
+    };
+
+    for (const auto& shader : shaders)
+    {
+        const auto shaderPath = std::string(WIRED_BENCHMARK_SHADERS_DIR) + "/" + shader.first;
+
+        std::ifstream shaderFile(shaderPath, std::ios::binary);
+        if (!shaderFile)
+        {
+            m_pLogger->Fatal("BenchmarkGPU::CreateShaders: Failed to open shader file: {}", shaderPath);
+            return false;
+        }
+
+        std::vector<std::byte> shaderBinary;
+        std::ranges::transform(std::istreambuf_iterator<char>(shaderFile), std::istreambuf_iterator<char>(),
+                               std::back_inserter(shaderBinary), [](char c){ return static_cast<std::byte>(c); });
+
+        const auto shaderSpec = ShaderSpec{
+            .shaderName = shader.first,
+            .shaderType = shader.second,
+            .binaryType = ShaderBinaryType::SPIRV,
+            .shaderBinary = shaderBinary
+        };
+
+        if (!m_gpu->CreateShader(shaderSpec))
+        {
+            m_pLogger->Fatal("BenchmarkGPU::CreateShaders: Failed to create shader: {}", shader.first);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool BenchmarkGPU::CreateResources()
+{
+    const auto commandBufferId = m_gpu->AcquireCommandBuffer(true, "BenchmarkSetup");
+    if (!commandBufferId)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to acquire a command buffer");
+        return false;
+    }
+
+    //
+    // Images
+    //
+    const auto colorTargetId = m_gpu->CreateImage(*commandBufferId, ImageCreateParams{
+        .imageType = ImageType::Image2D,
+        .usageFlags = {ImageUsageFlag::ColorTarget},
+        .size = NCommon::Size3DUInt(RENDER_SIZE, RENDER_SIZE, 1),
+        .colorSpace = ColorSpace::Linear
+    }, "BenchmarkColorTarget");
+    if (!colorTargetId)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to create color target");
+        return false;
+    }
+    m_colorTargetId = *colorTargetId;
+
+    for (uint32_t x = 0; x < SAMPLED_IMAGE_COUNT; ++x)
+    {
+        const auto sampledImageId = m_gpu->CreateImage(*commandBufferId, ImageCreateParams{
+            .imageType = ImageType::Image2D,
+            .usageFlags = {ImageUsageFlag::GraphicsSampled},
+            .size = NCommon::Size3DUInt(4, 4, 1),
+            .colorSpace = ColorSpace::Linear
+        }, std::format("BenchmarkSampled-{}", x));
+        if (!sampledImageId)
+        {
+            m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to create sampled image");
+            return false;
+        }
+        m_sampledImageIds.push_back(*sampledImageId);
+    }
+
+    const auto samplerId = m_gpu->CreateSampler(SamplerInfo{}, "Benchmark");
+    if (!samplerId)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to create sampler");
+        return false;
+    }
+    m_samplerId = *samplerId;
+
+    //
+    // Buffers
+    //
+    const auto verticesByteSize = sizeof(QUAD_VERTICES);
+    const auto indicesByteSize = sizeof(QUAD_INDICES);
+    const auto storageByteSize = STORAGE_BUFFER_BYTE_SIZE * STORAGE_BUFFER_COUNT;
+
+    const auto verticesBufferId = m_gpu->CreateBuffer({.usageFlags = {BufferUsageFlag::Vertex, BufferUsageFlag::TransferDst}, .byteSize = verticesByteSize}, "BenchmarkVertices");
+    const auto indicesBufferId = m_gpu->CreateBuffer({.usageFlags = {BufferUsageFlag::Index, BufferUsageFlag::TransferDst}, .byteSize = indicesByteSize}, "BenchmarkIndices");
+    if (!verticesBufferId || !indicesBufferId)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to create vertex/index buffers");
+        return false;
+    }
+    m_verticesBufferId = *verticesBufferId;
+    m_indicesBufferId = *indicesBufferId;
+
+    for (uint32_t x = 0; x < STORAGE_BUFFER_COUNT; ++x)
+    {
+        const auto storageBufferId = m_gpu->CreateBuffer({
+            .usageFlags = {BufferUsageFlag::GraphicsStorageRead, BufferUsageFlag::TransferDst},
+            .byteSize = STORAGE_BUFFER_BYTE_SIZE
+        }, std::format("BenchmarkStorage-{}", x));
+        if (!storageBufferId)
+        {
+            m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to create storage buffer");
+            return false;
+        }
+        m_storageBufferIds.push_back(*storageBufferId);
+    }
+
+    //
+    // Upload buffer data. Storage buffers are zeroed, which gives every drawn sprite a zero transform, so
+    // draws are valid but rasterize nothing.
+    //
+    const auto transferBufferId = m_gpu->CreateTransferBuffer({
+        .usageFlags = {TransferBufferUsageFlag::Upload},
+        .byteSize = verticesByteSize + indicesByteSize + storageByteSize,
+        .sequentiallyWritten = true
+    }, "BenchmarkSetup");
+    if (!transferBufferId)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to create transfer buffer");
+        return false;
+    }
+
+    const auto pMapped = m_gpu->MapBuffer(*transferBufferId, false);
+    if (!pMapped)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to map transfer buffer");
+        return false;
+    }
+
+    auto* pBytes = static_cast<std::byte*>(*pMapped);
+    std::memcpy(pBytes, QUAD_VERTICES.data(), verticesByteSize);
+    std::memcpy(pBytes + verticesByteSize, QUAD_INDICES.data(), indicesByteSize);
+    std::memset(pBytes + verticesByteSize + indicesByteSize, 0, storageByteSize);
+    (void)m_gpu->UnmapBuffer(*transferBufferId);
+
+    const auto copyPass = m_gpu->BeginCopyPass(*commandBufferId, "BenchmarkSetup");
+    if (!copyPass)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to begin copy pass");
+        return false;
+    }
+
+    (void)m_gpu->CmdUploadDataToBuffer(*copyPass, *transferBufferId, m_verticesBufferId, {{0, 0, verticesByteSize}}, false);
+    (void)m_gpu->CmdUploadDataToBuffer(*copyPass, *transferBufferId, m_indicesBufferId, {{verticesByteSize, 0, indicesByteSize}}, false);
+    for (const auto& storageBufferId : m_storageBufferIds)
+    {
+        (void)m_gpu->CmdUploadDataToBuffer(*copyPass, *transferBufferId, storageBufferId, {{verticesByteSize + indicesByteSize, 0, STORAGE_BUFFER_BYTE_SIZE}}, false);
+    }
+
+    (void)m_gpu->EndCopyPass(*copyPass);
+
+    if (!m_gpu->SubmitCommandBuffer(*commandBufferId))
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to submit setup work");
+        return false;
+    }
+
+    WaitForBuffer(*transferBufferId);
+    m_gpu->DestroyBuffer(*transferBufferId);
+
+    //
+    // Pipeline
+    //
+    const auto spritePipelineId = m_gpu->CreateGraphicsPipeline(GetSpritePipelineParams());
+    if (!spritePipelineId)
+    {
+        m_pLogger->Fatal("BenchmarkGPU::CreateResources: Failed to create sprite pipeline");
+        return false;
+    }
+    m_spritePipelineId = *spritePipelineId;
+
+    return true;
+}
+
+void BenchmarkGPU::Destroy()
+{
+    if (!m_gpu) { return; }
+
+    if (m_spritePipelineId.IsValid()) { m_gpu->DestroyPipeline(m_spritePipelineId); }
+    for (const auto& storageBufferId : m_storageBufferIds) { m_gpu->DestroyBuffer(storageBufferId); }
+    if (m_indicesBufferId.IsValid()) { m_gpu->DestroyBuffer(m_indicesBufferId); }
+    if (m_verticesBufferId.IsValid()) { m_gpu->DestroyBuffer(m_verticesBufferId); }
+    if (m_samplerId.IsValid()) { m_gpu->DestroySampler(m_samplerId); }
+    for (const auto& sampledImageId : m_sampledImageIds) { m_gpu->DestroyImage(sampledImageId); }
+    if (m_colorTargetId.IsValid()) { m_gpu->DestroyImage(m_colorTargetId); }
+
+    m_storageBufferIds.clear();
+    m_sampledImageIds.clear();
+
+    m_gpu->ShutDown();
+    m_gpu->Destroy();
+    m_gpu = nullptr;
+}
+
+GraphicsPipelineParams BenchmarkGPU::GetSpritePipelineParams() const
+{
+    return GraphicsPipelineParams{
+        .vertexShaderName = "sprite.vert.spv",
+        .fragmentShaderName = "sprite.frag.spv",
+        .colorAttachments = {ColorRenderAttachment{.imageId = m_colorTargetId, .loadOp = LoadOp::DontCare, .storeOp = StoreOp::DontCare}},
+        .depthAttachment = std::nullopt,
+        .viewport = NCommon::RectUInt(0, 0, RENDER_SIZE, RENDER_SIZE),
+        .cullFace = CullFace::None,
+        .depthTestEnabled = false,
+        .depthWriteEnabled = false
+    };
+}
+
+std::expected<RenderPass, bool> BenchmarkGPU::BeginSpriteRenderPass(CommandBufferId commandBufferId) const
+{
+    const auto pipelineParams = GetSpritePipelineParams();
+
+    const auto renderPass = m_gpu->BeginRenderPass(
+        commandBufferId,
+        pipelineParams.colorAttachments,
+        std::nullopt,
+        NCommon::Point2DUInt(0, 0),
+        NCommon::Size2DUInt(RENDER_SIZE, RENDER_SIZE),
+        "Benchmark"
+    );
+    if (!renderPass)
+    {
+        return std::unexpected(false);
+    }
+
+    const auto viewProjectionPayload = ViewProjectionUniformPayload{};
+
+    (void)m_gpu->CmdBindPipeline(*renderPass, m_spritePipelineId);
+    (void)m_gpu->CmdBindVertexBuffers(*renderPass, 0, {BufferBinding{.bufferId = m_verticesBufferId}});
+    (void)m_gpu->CmdBindIndexBuffer(*renderPass, BufferBinding{.bufferId = m_indicesBufferId}, IndexType::Uint32);
+    (void)m_gpu->CmdBindUniformData(*renderPass, "u_viewProjectionData", &viewProjectionPayload, sizeof(ViewProjectionUniformPayload));
+    (void)m_gpu->CmdBindStorageReadBuffer(*renderPass, "i_spriteInstanceData", GetStorageBuffer(0));
+    (void)m_gpu->CmdBindStorageReadBuffer(*renderPass, "i_spriteSlots", GetStorageBuffer(0));
+    (void)m_gpu->CmdBindStorageReadBuffer(*renderPass, "i_drawData", GetStorageBuffer(0));
+    (void)m_gpu->CmdBindImageViewSampler(*renderPass, "i_spriteSampler", 0, GetSampledImage(0), m_samplerId);
+
+    return *renderPass;
+}
+
+void BenchmarkGPU::WaitForBuffer(BufferId bufferId) const
+{
+    // Finished work is only detected as command buffers are cleaned up. Idle clean up, so that waiting
+    // doesn't count as descriptor sets going unused.
+    while (m_gpu->IsBufferInUse(bufferId))
+    {
+        m_gpu->RunCleanUp(true);
+        std::this_thread::yield();
+    }
+}
+
+}
@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUBENCHMARKS_BENCHMARKGPU_H
+#define WIREDENGINE_WIREDGPUBENCHMARKS_BENCHMARKGPU_H
+
+#include <Wired/GPU/WiredGPUVk.h>
+
+#include <NEON/Common/Log/ILogger.h>
+
+#include <memory>
+#include <expected>
+#include <string>
+#include <optional>
+#include <vector>
+#include <cstdint>
+
+namespace Wired::GPU
+{
+    /**
+     * Headless WiredGPUVk instance, plus a small set of resources, shared by all GPU benchmarks.
+     *
+     * Renders into a tiny offscreen color target so that benchmarks measure the CPU side of recording and
+     * submitting work, rather than rasterization, which on software devices such as lavapipe would dominate.
+     */
+    class BenchmarkGPU
+    {
+        public:
+
+            static constexpr uint32_t RENDER_SIZE = 16;
+
+            // Number of distinct storage buffers which can be bound to vary descriptor set bindings
+            static constexpr uint32_t STORAGE_BUFFER_COUNT = 64;
+
+            // Matches the sprite vertex shader's u_viewProjectionData uniform
+            struct ViewProjectionUniformPayload
+            {
+                glm::mat4 viewTransform{1.0f};
+                glm::mat4 projectionTransform{1.0f};
+            };
+
+        public:
+
+            /**
+             * @param pLogger Logger for the GPU to log to
+             * @param pfnVkGetInstanceProcAddr Vulkan loader entry point
+             * @param physicalDeviceFilter If set, the first suitable physical device whose name contains this
+             * string is used. Otherwise, lavapipe is preferred if present.
+             */
+            [[nodiscard]] static std::unique_ptr<BenchmarkGPU> Create(const NCommon::ILogger* pLogger,
+                                                                      PFN_vkGetInstanceProcAddr pfnVkGetInstanceProcAddr,
+                                                                      const std::optional<std::string>& physicalDeviceFilter);
+
+            static void SetInstance(BenchmarkGPU* pInstance);
+            [[nodiscard]] static BenchmarkGPU* Get();
+
+        public:
+
+            explicit BenchmarkGPU(const NCommon::ILogger* pLogger);
+            ~BenchmarkGPU();
+
+            void Destroy();
+
+            [[nodiscard]] WiredGPU* GetGPU() const noexcept { return m_gpu.get(); }
+            [[nodiscard]] const std::string& GetPhysicalDeviceName() const noexcept { return m_physicalDeviceName; }
+
+            [[nodiscard]] GraphicsPipelineParams GetSpritePipelineParams() const;
+            [[nodiscard]] PipelineId GetSpritePipeline() const noexcept { return m_spritePipelineId; }
+
+            [[nodiscard]] ImageId GetColorTarget() const noexcept { return m_colorTargetId; }
+            [[nodiscard]] ImageId GetSampledImage(uint32_t index) const { return m_sampledImageIds.at(index % m_sampledImageIds.size()); }
+            [[nodiscard]] SamplerId GetSampler() const noexcept { return m_samplerId; }
+            [[nodiscard]] BufferId GetVerticesBuffer() const noexcept { return m_verticesBufferId; }
+            [[nodiscard]] BufferId GetIndicesBuffer() const noexcept { return m_indicesBufferId; }
+            [[nodiscard]] BufferId GetStorageBuffer(uint32_t index) const { return m_storageBufferIds.at(index % m_storageBufferIds.size()); }
+
+            /**
+             * Begins a render pass into the color target, with the sprite pipeline, vertex/index buffers, and
+             * every descriptor set binding needed to draw bound.
+             */
+            [[nodiscard]] std::expected<RenderPass, bool> BeginSpriteRenderPass(CommandBufferId commandBufferId) const;
+
+            /**
+             * Blocks until the GPU has finished all submitted work which references the buffer
+             */
+            void WaitForBuffer(BufferId bufferId) const;
+
+        private:
+
+            [[nodiscard]] bool StartUp(PFN_vkGetInstanceProcAddr pfnVkGetInstanceProcAddr, const std::optional<std::string>& physicalDeviceFilter);
+            [[nodiscard]] bool CreateShaders();
+            [[nodiscard]] bool CreateResources();
+
+        private:
+
+            const NCommon::ILogger* m_pLogger;
+
+            std::unique_ptr<WiredGPUVk> m_gpu;
+            std::string m_physicalDeviceName;
+
+            ImageId m_colorTargetId{};
+            std::vector<ImageId> m_sampledImageIds;
+            SamplerId m_samplerId{};
+            BufferId m_verticesBufferId{};
+            BufferId m_indicesBufferId{};
+            std::vector<BufferId> m_storageBufferIds;
+            PipelineId m_spritePipelineId{};
+    };
+}
+
+#endif //WIREDENGINE_WIREDGPUBENCHMARKS_BENCHMARKGPU_H
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "BenchmarkGPU.h"
+#include "RecordingBenchmarks.h"
+#include "TransferBenchmarks.h"
+#include "PipelineBenchmarks.h"
+
+#include <NEON/Common/Log/StdLogger.h>
+
+#include <benchmark/benchmark.h>
+
+#include <SDL3/SDL.h>
+#include <SDL3/SDL_vulkan.h>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * Runs the WiredGPUVk benchmarks against a headless GPU. Standard Google Benchmark flags apply; for
+ * machine-readable output, pass --benchmark_format=json, or --benchmark_out=<file> --benchmark_out_format=json.
+ *
+ * The physical device used is the first whose name contains the WIRED_BENCHMARK_DEVICE environment
+ * variable, if set, otherwise lavapipe if present, otherwise the first suitable device.
+ */
+int main(int argc, char **argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1;
+    }
+
+    // Benchmarks run without a display, so use SDL's offscreen video driver just to load Vulkan
+    SDL_SetHint(SDL_HINT_VIDEO_DRIVER, "offscreen");
+
+    if (!SDL_Init(SDL_INIT_VIDEO))
+    {
+        std::cerr << "Failed to init SDL Video system. Error: " << SDL_GetError() << std::endl;
+        return 1;
+    }
+
+    if (!SDL_Vulkan_LoadLibrary(nullptr))
+    {
+        std::cerr << "Failed to load Vulkan library. Error: " << SDL_GetError() << std::endl;
+        SDL_Quit();
+        return 1;
+    }
+
+    auto logger = std::make_unique<NCommon::StdLogger>(NCommon::LogLevel::Warning);
+
+    std::optional<std::string> physicalDeviceFilter;
+    if (const char* pDeviceFilter = std::getenv("WIRED_BENCHMARK_DEVICE"))
+    {
+        physicalDeviceFilter = std::string(pDeviceFilter);
+    }
+
+    auto benchmarkGPU = Wired::GPU::BenchmarkGPU::Create(
+        logger.get(),
+        (PFN_vkGetInstanceProcAddr)SDL_Vulkan_GetVkGetInstanceProcAddr(),
+        physicalDeviceFilter
+    );
+
+    int result = 1;
+
+    if (benchmarkGPU)
+    {
+        Wired::GPU::BenchmarkGPU::SetInstance(benchmarkGPU.get());
+        benchmark::AddCustomContext("physical_device", benchmarkGPU->GetPhysicalDeviceName());
+
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+
+        Wired::GPU::BenchmarkGPU::SetInstance(nullptr);
+        benchmarkGPU->Destroy();
+        benchmarkGPU = nullptr;
+
+        result = 0;
+    }
+
+    SDL_Vulkan_UnloadLibrary();
+    SDL_Quit();
+
+    return result;
+}
@@ -0,0 +1,51 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUBENCHMARKS_PIPELINEBENCHMARKS_H
+#define WIREDENGINE_WIREDGPUBENCHMARKS_PIPELINEBENCHMARKS_H
+
+#include "BenchmarkGPU.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+
+namespace Wired::GPU
+{
+    /**
+     * Cost of creating a graphics pipeline, including its descriptor set layouts and pipeline layout. Pipeline
+     * destruction, which is deferred to clean up, isn't timed.
+     */
+    static void BM_CreateGraphicsPipeline(benchmark::State& state)
+    {
+        auto* pBenchmarkGPU = BenchmarkGPU::Get();
+        auto* pGPU = pBenchmarkGPU->GetGPU();
+
+        const auto pipelineParams = pBenchmarkGPU->GetSpritePipelineParams();
+
+        for (auto _ : state)
+        {
+            const auto startTime = std::chrono::steady_clock::now();
+
+            const auto pipelineId = pGPU->CreateGraphicsPipeline(pipelineParams);
+
+            const auto endTime = std::chrono::steady_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(endTime - startTime).count());
+
+            if (!pipelineId)
+            {
+                state.SkipWithError("Failed to create graphics pipeline");
+                break;
+            }
+
+            pGPU->DestroyPipeline(*pipelineId);
+            pGPU->RunCleanUp(true);
+        }
+    }
+    BENCHMARK(BM_CreateGraphicsPipeline)->UseManualTime();
+}
+
+#endif //WIREDENGINE_WIREDGPUBENCHMARKS_PIPELINEBENCHMARKS_H
@@ -0,0 +1,143 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUBENCHMARKS_RECORDINGBENCHMARKS_H
+#define WIREDENGINE_WIREDGPUBENCHMARKS_RECORDINGBENCHMARKS_H
+
+#include "BenchmarkGPU.h"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <functional>
+
+namespace Wired::GPU
+{
+    /**
+     * Runs one frame per benchmark iteration, timing only the recording of draws into a sprite render pass;
+     * frame start/end and submission are excluded. recordDraw is invoked once per draw, and should bind
+     * whatever state is being measured and then issue the draw.
+     */
+    static void RunRecordingBenchmark(benchmark::State& state, const std::function<void(RenderPass, uint32_t)>& recordDraw)
+    {
+        auto* pBenchmarkGPU = BenchmarkGPU::Get();
+        auto* pGPU = pBenchmarkGPU->GetGPU();
+
+        const auto drawCount = static_cast<uint32_t>(state.range(0));
+
+        for (auto _ : state)
+        {
+            pGPU->StartFrame();
+
+            const auto commandBufferId = pGPU->AcquireCommandBuffer(true, "Benchmark");
+            if (!commandBufferId)
+            {
+                state.SkipWithError("Failed to acquire command buffer");
+                pGPU->EndFrame();
+                break;
+            }
+
+            const auto startTime = std::chrono::steady_clock::now();
+
+            const auto renderPass = pBenchmarkGPU->BeginSpriteRenderPass(*commandBufferId);
+            if (!renderPass)
+            {
+                state.SkipWithError("Failed to begin render pass");
+                pGPU->CancelCommandBuffer(*commandBufferId);
+                pGPU->EndFrame();
+                break;
+            }
+
+            for (uint32_t x = 0; x < drawCount; ++x)
+            {
+                recordDraw(*renderPass, x);
+            }
+
+            (void)pGPU->EndRenderPass(*renderPass);
+
+            const auto endTime = std::chrono::steady_clock::now();
+            state.SetIterationTime(std::chrono::duration<double>(endTime - startTime).count());
+
+            (void)pGPU->SubmitCommandBuffer(*commandBufferId);
+            pGPU->EndFrame();
+        }
+
+        state.SetItemsProcessed(state.iterations() * drawCount);
+    }
+
+    /**
+     * Draw recording throughput, with all state bound once up front
+     */
+    static void BM_RecordDraws(benchmark::State& state)
+    {
+        auto* pGPU = BenchmarkGPU::Get()->GetGPU();
+
+        RunRecordingBenchmark(state, [&](RenderPass renderPass, uint32_t){
+            (void)pGPU->CmdDrawIndexed(renderPass, 6, 1, 0, 0, 0);
+        });
+    }
+    BENCHMARK(BM_RecordDraws)->RangeMultiplier(4)->Range(16, 4096)->UseManualTime();
+
+    /**
+     * Cost of binding new uniform data before every draw
+     */
+    static void BM_BindUniformData(benchmark::State& state)
+    {
+        auto* pGPU = BenchmarkGPU::Get()->GetGPU();
+
+        RunRecordingBenchmark(state, [&](RenderPass renderPass, uint32_t drawIndex){
+            auto payload = BenchmarkGPU::ViewProjectionUniformPayload{};
+            payload.viewTransform[3][0] = static_cast<float>(drawIndex);
+
+            (void)pGPU->CmdBindUniformData(renderPass, "u_viewProjectionData", &payload, sizeof(BenchmarkGPU::ViewProjectionUniformPayload));
+            (void)pGPU->CmdDrawIndexed(renderPass, 6, 1, 0, 0, 0);
+        });
+    }
+    BENCHMARK(BM_BindUniformData)->RangeMultiplier(4)->Range(16, 4096)->UseManualTime();
+
+    /**
+     * Cost of creating a descriptor set for every draw; rebinding the sampled image changes the per-draw set,
+     * which is allocated and written fresh from the frame's descriptor arena
+     */
+    static void BM_CreateTransientDescriptorSets(benchmark::State& state)
+    {
+        auto* pBenchmarkGPU = BenchmarkGPU::Get();
+        auto* pGPU = pBenchmarkGPU->GetGPU();
+
+        RunRecordingBenchmark(state, [&](RenderPass renderPass, uint32_t drawIndex){
+            (void)pGPU->CmdBindImageViewSampler(renderPass, "i_spriteSampler", 0, pBenchmarkGPU->GetSampledImage(drawIndex), pBenchmarkGPU->GetSampler());
+            (void)pGPU->CmdDrawIndexed(renderPass, 6, 1, 0, 0, 0);
+        });
+    }
+    BENCHMARK(BM_CreateTransientDescriptorSets)->RangeMultiplier(4)->Range(16, 4096)->UseManualTime();
+
+    /**
+     * Cost of looking up cached descriptor sets; rebinding a storage buffer before every draw changes the
+     * per-pass set between a bounded number of binding combinations, which are found in the set cache
+     */
+    static void BM_LookupCachedDescriptorSets(benchmark::State& state)
+    {
+        auto* pBenchmarkGPU = BenchmarkGPU::Get();
+        auto* pGPU = pBenchmarkGPU->GetGPU();
+
+        const auto startStats = pGPU->GetDescriptorSetStats();
+
+        RunRecordingBenchmark(state, [&](RenderPass renderPass, uint32_t drawIndex){
+            (void)pGPU->CmdBindStorageReadBuffer(renderPass, "i_drawData", pBenchmarkGPU->GetStorageBuffer(drawIndex));
+            (void)pGPU->CmdDrawIndexed(renderPass, 6, 1, 0, 0, 0);
+        });
+
+        const auto endStats = pGPU->GetDescriptorSetStats();
+        const auto lookupCount = endStats.cacheLookupCount - startStats.cacheLookupCount;
+        const auto hitCount = endStats.cacheHitCount - startStats.cacheHitCount;
+
+        state.counters["cache_hit_rate"] = lookupCount == 0 ? 0.0 : (double)hitCount / (double)lookupCount;
+        state.counters["cache_size"] = (double)endStats.cachedSetCount;
+    }
+    BENCHMARK(BM_LookupCachedDescriptorSets)->RangeMultiplier(4)->Range(16, 4096)->UseManualTime();
+}
+
+#endif //WIREDENGINE_WIREDGPUBENCHMARKS_RECORDINGBENCHMARKS_H
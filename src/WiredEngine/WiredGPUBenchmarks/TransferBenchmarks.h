@@ -0,0 +1,127 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUBENCHMARKS_TRANSFERBENCHMARKS_H
+#define WIREDENGINE_WIREDGPUBENCHMARKS_TRANSFERBENCHMARKS_H
+
+#include "BenchmarkGPU.h"
+
+#include <benchmark/benchmark.h>
+
+#include <vector>
+#include <cstring>
+#include <cstddef>
+
+namespace Wired::GPU
+{
+    /**
+     * Buffer upload bandwidth through the transfer path: writing a mapped transfer buffer, recording the copy
+     * into a device local buffer, submitting, and waiting for the copy to finish
+     */
+    static void BM_UploadBuffer(benchmark::State& state)
+    {
+        auto* pBenchmarkGPU = BenchmarkGPU::Get();
+        auto* pGPU = pBenchmarkGPU->GetGPU();
+
+        const auto byteSize = static_cast<std::size_t>(state.range(0));
+
+        const auto transferBufferId = pGPU->CreateTransferBuffer({
+            .usageFlags = {TransferBufferUsageFlag::Upload},
+            .byteSize = byteSize,
+            .sequentiallyWritten = true
+        }, "BenchmarkUploadSource");
+        const auto bufferId = pGPU->CreateBuffer({
+            .usageFlags = {BufferUsageFlag::GraphicsStorageRead, BufferUsageFlag::TransferDst},
+            .byteSize = byteSize
+        }, "BenchmarkUploadDest");
+        if (!transferBufferId || !bufferId)
+        {
+            state.SkipWithError("Failed to create buffers");
+            return;
+        }
+
+        const std::vector<std::byte> sourceData(byteSize, std::byte{0xAB});
+
+        for (auto _ : state)
+        {
+            const auto pMapped = pGPU->MapBuffer(*transferBufferId, false);
+            if (!pMapped)
+            {
+                state.SkipWithError("Failed to map transfer buffer");
+                break;
+            }
+            std::memcpy(*pMapped, sourceData.data(), byteSize);
+            (void)pGPU->UnmapBuffer(*transferBufferId);
+
+            const auto commandBufferId = pGPU->AcquireCommandBuffer(true, "BenchmarkUpload");
+            if (!commandBufferId)
+            {
+                state.SkipWithError("Failed to acquire command buffer");
+                break;
+            }
+
+            const auto copyPass = pGPU->BeginCopyPass(*commandBufferId, "BenchmarkUpload");
+            if (!copyPass)
+            {
+                state.SkipWithError("Failed to begin copy pass");
+                pGPU->CancelCommandBuffer(*commandBufferId);
+                break;
+            }
+            (void)pGPU->CmdUploadDataToBuffer(*copyPass, *transferBufferId, *bufferId, {{0, 0, byteSize}}, false);
+            (void)pGPU->EndCopyPass(*copyPass);
+
+            (void)pGPU->SubmitCommandBuffer(*commandBufferId);
+
+            pBenchmarkGPU->WaitForBuffer(*bufferId);
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(byteSize));
+
+        pGPU->DestroyBuffer(*bufferId);
+        pGPU->DestroyBuffer(*transferBufferId);
+        pGPU->RunCleanUp(true);
+    }
+    BENCHMARK(BM_UploadBuffer)->RangeMultiplier(8)->Range(4 * 1024, 64 * 1024 * 1024)->UseRealTime();
+
+    /**
+     * Latency from submitting a minimal command buffer to detecting that the GPU has finished it
+     */
+    static void BM_SubmitAndWait(benchmark::State& state)
+    {
+        auto* pBenchmarkGPU = BenchmarkGPU::Get();
+        auto* pGPU = pBenchmarkGPU->GetGPU();
+
+        const auto sourceBufferId = pBenchmarkGPU->GetStorageBuffer(0);
+        const auto destBufferId = pBenchmarkGPU->GetStorageBuffer(1);
+
+        for (auto _ : state)
+        {
+            const auto commandBufferId = pGPU->AcquireCommandBuffer(true, "BenchmarkSubmit");
+            if (!commandBufferId)
+            {
+                state.SkipWithError("Failed to acquire command buffer");
+                break;
+            }
+
+            const auto copyPass = pGPU->BeginCopyPass(*commandBufferId, "BenchmarkSubmit");
+            if (!copyPass)
+            {
+                state.SkipWithError("Failed to begin copy pass");
+                pGPU->CancelCommandBuffer(*commandBufferId);
+                break;
+            }
+            (void)pGPU->CmdCopyBufferToBuffer(*copyPass, sourceBufferId, 0, destBufferId, 0, 4, false);
+            (void)pGPU->EndCopyPass(*copyPass);
+
+            (void)pGPU->SubmitCommandBuffer(*commandBufferId);
+
+            pBenchmarkGPU->WaitForBuffer(destBufferId);
+        }
+    }
+    BENCHMARK(BM_SubmitAndWait)->UseRealTime();
+}
+
+#endif //WIREDENGINE_WIREDGPUBENCHMARKS_TRANSFERBENCHMARKS_H
@@ -9,13 +9,16 @@
 
 #include "../Global.h"
 #include "../Usages.h"
+#include "../MemoryTracker.h"
 
 #include "../State/CommandBuffer.h"
+#include "../State/CommandBuffers.h"
 #include "../Vulkan/VulkanDebugUtil.h"
 
 #include <NEON/Common/Log/ILogger.h>
 
 #include <algorithm>
+#include <iterator>
 
 namespace Wired::GPU
 {
@@ -46,8 +49,13 @@ void Buffers::RunCleanUp()
     // Clean up buffers that are marked as deleted which no longer have any references/usages
     CleanUp_DeletedBuffers();
 
-    // Clean up buffers which aren't used; try to collapse buffers back to one GPU buffers
-    CleanUp_UnusedBuffers();
+    // Clean up buffers which haven't recently cycled; try to collapse buffers back to one GPU buffer
+    CleanUp_UnusedBuffers(false);
+}
+
+void Buffers::TrimCycledCopies()
+{
+    CleanUp_UnusedBuffers(true);
 }
 
 void Buffers::CleanUp_DeletedBuffers()
@@ -88,9 +96,44 @@ void Buffers::CleanUp_DeletedBuffers()
     }
 }
 
-void Buffers::CleanUp_UnusedBuffers()
+void Buffers::CleanUp_UnusedBuffers(bool ignoreQuietPeriod)
 {
-    // TODO Perf
+    std::lock_guard<std::recursive_mutex> lock(m_buffersMutex);
+
+    if (!ignoreQuietPeriod)
+    {
+        m_cleanUpCount++;
+    }
+
+    for (auto& it : m_buffers)
+    {
+        auto& buffer = it.second;
+
+        if (buffer.gpuBuffers.size() <= 1) { continue; }
+        if (!ignoreQuietPeriod && (m_cleanUpCount - buffer.lastCycleCleanUp < CYCLE_QUIET_CLEAN_UPS)) { continue; }
+
+        // Deleted buffers have all their copies destroyed together by CleanUp_DeletedBuffers
+        if (m_buffersMarkedForDeletion.contains(it.first)) { continue; }
+
+        const auto activeVkBuffer = buffer.gpuBuffers.at(buffer.activeBufferIndex).vkBuffer;
+
+        // Destroy every inactive copy that nothing is using anymore
+        std::erase_if(buffer.gpuBuffers, [&](const GPUBuffer& gpuBuffer){
+            if (gpuBuffer.vkBuffer == activeVkBuffer) { return false; }
+            if (!IsGPUBufferIdle(gpuBuffer)) { return false; }
+            if (m_pGlobal->pUsages->buffers.GetLockCount(gpuBuffer.vkBuffer) != 0) { return false; }
+
+            DestroyGPUBufferObjects(gpuBuffer, buffer.tag);
+            m_cycledByteSize -= gpuBuffer.bufferDef.byteSize;
+
+            return true;
+        });
+
+        buffer.activeBufferIndex = (uint32_t)std::distance(
+            buffer.gpuBuffers.cbegin(),
+            std::ranges::find(buffer.gpuBuffers, activeVkBuffer, &GPUBuffer::vkBuffer)
+        );
+    }
 }
 
 std::expected<BufferId, bool> Buffers::CreateTransferBuffer(const TransferBufferUsageFlags& transferBufferUsageFlags,
@@ -351,6 +394,8 @@ std::expected<GPUBuffer, bool> Buffers::CreateGPUBuffer(const BufferDef& bufferD
 
     SetDebugName(m_pGlobal->vk, m_pGlobal->device, VK_OBJECT_TYPE_BUFFER, (uint64_t)vkBuffer, std::format("Buffer-{}", tag));
 
+    m_pGlobal->pMemoryTracker->OnAllocated(tag, bufferAllocation.vmaAllocationInfo.size);
+
     return GPUBuffer{
         .vkBuffer = vkBuffer,
         .bufferDef = bufferDef,
@@ -413,25 +458,35 @@ std::optional<GPUBuffer> Buffers::GetBuffer(BufferId bufferId, bool cycled)
 bool Buffers::CycleBufferIfNeeded(Buffer& buffer)
 {
     // If the active GPU buffer is unused, return it
-    if (m_pGlobal->pUsages->buffers.GetGPUUsageCount(buffer.gpuBuffers.at(buffer.activeBufferIndex).vkBuffer) == 0)
+    if (IsGPUBufferIdle(buffer.gpuBuffers.at(buffer.activeBufferIndex)))
     {
         return true;
     }
 
-    // Otherwise, try to find an existing GPU buffer which is unused
-    for (uint32_t x = 0; x < buffer.gpuBuffers.size(); ++x)
+    buffer.lastCycleCleanUp = m_cleanUpCount;
+
+    // Otherwise, advance around the ring to the next GPU buffer which is unused. The copy after the active
+    // one is the least recently used, so the most likely to have been retired.
+    const auto ringSize = (uint32_t)buffer.gpuBuffers.size();
+
+    for (uint32_t x = 1; x < ringSize; ++x)
     {
-        // Already tested the active buffer above
-        if (x == buffer.activeBufferIndex) { continue; }
+        const auto index = (buffer.activeBufferIndex + x) % ringSize;
 
-        if (m_pGlobal->pUsages->buffers.GetGPUUsageCount(buffer.gpuBuffers.at(x).vkBuffer) == 0)
+        if (IsGPUBufferIdle(buffer.gpuBuffers.at(index)))
         {
-            buffer.activeBufferIndex = x;
+            buffer.activeBufferIndex = index;
             return true;
         }
     }
 
-    // Otherwise, create a new GPU buffer
+    // Otherwise, grow the ring with a new GPU buffer, up to its limit
+    const auto maxRingSize = (m_pGlobal->gpuSettings.framesInFlight + 1) * CYCLE_MAX_RING_SIZE_MULTIPLIER;
+    if (ringSize >= maxRingSize)
+    {
+        return ReuseOldestCopy(buffer);
+    }
+
     const auto copyGPUBuffer = buffer.gpuBuffers.at(0);
 
     const auto gpuBuffer = CreateGPUBuffer(copyGPUBuffer.bufferDef, buffer.tag);
@@ -441,12 +496,47 @@ bool Buffers::CycleBufferIfNeeded(Buffer& buffer)
         return false;
     }
 
-    buffer.gpuBuffers.push_back(*gpuBuffer);
-    buffer.activeBufferIndex = (uint32_t)buffer.gpuBuffers.size() - 1;
+    m_cycledByteSize += gpuBuffer->bufferDef.byteSize;
+
+    // Inserted directly after the active buffer, so that ring order stays least recently used first
+    buffer.activeBufferIndex++;
+    buffer.gpuBuffers.insert(buffer.gpuBuffers.begin() + buffer.activeBufferIndex, *gpuBuffer);
 
     return true;
 }
 
+bool Buffers::ReuseOldestCopy(Buffer& buffer)
+{
+    m_pGlobal->pLogger->Warning("Buffers::ReuseOldestCopy: Buffer has reached its max of {} in-use copies, waiting for the GPU: {}",
+                                buffer.gpuBuffers.size(), buffer.tag);
+
+    // Wait for the GPU to finish all the work submitted so far, and release the copies that work was using
+    m_pGlobal->commandQueue.WaitForTimelineValue(m_pGlobal->commandQueue.GetLastSubmittedTimelineValue());
+    m_pGlobal->pCommandBuffers->RunCleanUp();
+
+    const auto ringSize = (uint32_t)buffer.gpuBuffers.size();
+
+    for (uint32_t x = 1; x < ringSize; ++x)
+    {
+        const auto index = (buffer.activeBufferIndex + x) % ringSize;
+
+        if (IsGPUBufferIdle(buffer.gpuBuffers.at(index)))
+        {
+            buffer.activeBufferIndex = index;
+            return true;
+        }
+    }
+
+    // Every copy is referenced by command buffers which haven't been submitted yet, which waiting can't release
+    m_pGlobal->pLogger->Error("Buffers::ReuseOldestCopy: All copies are in use by unsubmitted work: {}", buffer.tag);
+    return false;
+}
+
+bool Buffers::IsGPUBufferIdle(const GPUBuffer& gpuBuffer) const
+{
+    return m_pGlobal->pUsages->buffers.GetGPUUsageCount(gpuBuffer.vkBuffer) == 0;
+}
+
 std::expected<void*, bool> Buffers::MapBuffer(BufferId bufferId, bool cycle)
 {
     const auto gpuBuffer = GetBuffer(bufferId, cycle);
@@ -473,9 +563,27 @@ std::expected<void*, bool> Buffers::MapBuffer(BufferId bufferId, bool cycle)
         return std::unexpected(false);
     }
 
+    // Download buffers are read by the host after the GPU writes to them; if the memory isn't host coherent
+    // the host's view of the memory needs to be invalidated first. (No-op for coherent memory)
+    if (gpuBuffer->bufferDef.isTransferBuffer && (gpuBuffer->bufferDef.vkBufferUsageFlags & VK_BUFFER_USAGE_TRANSFER_DST_BIT))
+    {
+        vmaInvalidateAllocation(m_pGlobal->vma, gpuBuffer->bufferAllocation.vmaAllocation, 0, VK_WHOLE_SIZE);
+    }
+
     return pMappedBuffer;
 }
 
+bool Buffers::IsBufferInUse(BufferId bufferId)
+{
+    const auto gpuBuffer = GetBuffer(bufferId, false);
+    if (!gpuBuffer)
+    {
+        return false;
+    }
+
+    return m_pGlobal->pUsages->buffers.GetGPUUsageCount(gpuBuffer->vkBuffer) > 0;
+}
+
 bool Buffers::UnmapBuffer(BufferId bufferId)
 {
     const auto gpuBuffer = GetBuffer(bufferId, false);
@@ -496,18 +604,7 @@ bool Buffers::BarrierBufferRangeForUsage(CommandBuffer* pCommandBuffer,
                                          const std::size_t& byteSize,
                                          BufferUsageMode destUsageMode)
 {
-    pCommandBuffer->CmdBufferPipelineBarrier(gpuBuffer, byteOffset, byteSize, gpuBuffer.bufferDef.defaultUsageMode, destUsageMode);
-
-    return true;
-}
-
-bool Buffers::BarrierBufferRangeToDefaultUsage(CommandBuffer* pCommandBuffer,
-                                               const GPUBuffer& gpuBuffer,
-                                               const std::size_t& byteOffset,
-                                               const std::size_t& byteSize,
-                                               BufferUsageMode sourceUsageMode)
-{
-    pCommandBuffer->CmdBufferPipelineBarrier(gpuBuffer, byteOffset, byteSize, sourceUsageMode, gpuBuffer.bufferDef.defaultUsageMode);
+    pCommandBuffer->BarrierBufferRangeForUsage(gpuBuffer, byteOffset, byteSize, destUsageMode);
 
     return true;
 }
@@ -518,14 +615,18 @@ void Buffers::DestroyBufferObjects(const Buffers::Buffer& buffer)
 
     for (const auto& gpuBuffer : buffer.gpuBuffers)
     {
-        DestroyGPUBufferObjects(gpuBuffer);
+        DestroyGPUBufferObjects(gpuBuffer, buffer.tag);
     }
+
+    m_cycledByteSize -= (buffer.gpuBuffers.size() - 1) * buffer.gpuBuffers.at(0).bufferDef.byteSize;
 }
 
-void Buffers::DestroyGPUBufferObjects(const GPUBuffer& gpuBuffer)
+void Buffers::DestroyGPUBufferObjects(const GPUBuffer& gpuBuffer, const std::string& tag)
 {
     RemoveDebugName(m_pGlobal->vk, m_pGlobal->device, VK_OBJECT_TYPE_BUFFER, (uint64_t)gpuBuffer.vkBuffer);
     vmaDestroyBuffer(m_pGlobal->vma, gpuBuffer.vkBuffer, gpuBuffer.bufferAllocation.vmaAllocation);
+
+    m_pGlobal->pMemoryTracker->OnFreed(tag, gpuBuffer.bufferAllocation.vmaAllocationInfo.size);
 }
 
 }
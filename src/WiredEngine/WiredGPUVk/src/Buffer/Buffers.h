@@ -20,14 +20,33 @@
 #include <unordered_set>
 #include <mutex>
 #include <optional>
+#include <atomic>
+#include <cstdint>
 
 namespace Wired::GPU
 {
     struct Global;
     class CommandBuffer;
 
+    /**
+     * Owns all non-uniform buffers.
+     *
+     * Writing to a buffer the GPU is still reading from cycles it: the buffer's GPU copies form a ring which is
+     * advanced to the next copy the GPU is finished with, growing when none are. The ring normally settles at
+     * frames in flight + 1 copies for a buffer written every frame; it may grow past that during load spikes,
+     * up to a hard limit. At the limit, cycling waits for the GPU to release the least recently used copy rather
+     * than growing further. Copies beyond the active one are trimmed once a buffer hasn't cycled for a while.
+     */
     class Buffers
     {
+        public:
+
+            // Number of clean ups (frames) a buffer must go without cycling before its extra copies are trimmed
+            static constexpr uint64_t CYCLE_QUIET_CLEAN_UPS = 120;
+
+            // Hard limit on a buffer's ring size, as a multiple of its steady-state (frames in flight + 1) size
+            static constexpr uint32_t CYCLE_MAX_RING_SIZE_MULTIPLIER = 4;
+
         public:
 
             explicit Buffers(Global* pGlobal);
@@ -53,8 +72,16 @@ namespace Wired::GPU
             [[nodiscard]] std::expected<void*, bool> MapBuffer(BufferId bufferId, bool cycle);
             bool UnmapBuffer(BufferId bufferId);
 
+            [[nodiscard]] bool IsBufferInUse(BufferId bufferId);
+
+            // Total byte size of all buffers' cycled copies; excludes each buffer's original copy
+            [[nodiscard]] std::size_t GetCycledByteSize() const noexcept { return m_cycledByteSize.load(); }
+
+            // Immediately destroys every buffer's idle cycled copies, without waiting for buffers to go quiet
+            void TrimCycledCopies();
+
+            // Queues a state tracked barrier; see CommandBuffer::BarrierBufferRangeForUsage
             bool BarrierBufferRangeForUsage(CommandBuffer* pCommandBuffer, const GPUBuffer& gpuBuffer, const std::size_t& byteOffset, const std::size_t& byteSize, BufferUsageMode destUsageMode);
-            bool BarrierBufferRangeToDefaultUsage(CommandBuffer* pCommandBuffer, const GPUBuffer& gpuBuffer, const std::size_t& byteOffset, const std::size_t& byteSize, BufferUsageMode sourceUsageMode);
 
         private:
 
@@ -63,8 +90,12 @@ namespace Wired::GPU
                 BufferId id{};
                 std::string tag;
 
+                // Ring of GPU copies of the buffer, cycled through in order
                 uint32_t activeBufferIndex{0};
                 std::vector<GPUBuffer> gpuBuffers;
+
+                // Value of m_cleanUpCount when the buffer last cycled
+                uint64_t lastCycleCleanUp{0};
             };
 
         private:
@@ -72,12 +103,14 @@ namespace Wired::GPU
             [[nodiscard]] std::expected<GPUBuffer, bool> CreateGPUBuffer(const BufferDef& bufferDef, const std::string& tag);
 
             [[nodiscard]] bool CycleBufferIfNeeded(Buffer& buffer);
+            [[nodiscard]] bool ReuseOldestCopy(Buffer& buffer);
+            [[nodiscard]] bool IsGPUBufferIdle(const GPUBuffer& gpuBuffer) const;
 
             void CleanUp_DeletedBuffers();
-            void CleanUp_UnusedBuffers();
+            void CleanUp_UnusedBuffers(bool ignoreQuietPeriod);
 
             void DestroyBufferObjects(const Buffer& buffer);
-            void DestroyGPUBufferObjects(const GPUBuffer& gpuBuffer);
+            void DestroyGPUBufferObjects(const GPUBuffer& gpuBuffer, const std::string& tag);
 
         private:
 
@@ -86,6 +119,9 @@ namespace Wired::GPU
             std::unordered_map<BufferId, Buffer> m_buffers;
             std::unordered_set<BufferId> m_buffersMarkedForDeletion;
             mutable std::recursive_mutex m_buffersMutex;
+
+            uint64_t m_cleanUpCount{0};
+            std::atomic<std::size_t> m_cycledByteSize{0};
     };
 }
 
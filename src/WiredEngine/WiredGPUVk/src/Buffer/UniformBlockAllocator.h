@@ -0,0 +1,63 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUVK_SRC_BUFFER_UNIFORMBLOCKALLOCATOR_H
+#define WIREDENGINE_WIREDGPUVK_SRC_BUFFER_UNIFORMBLOCKALLOCATOR_H
+
+#include <optional>
+#include <cstddef>
+
+namespace Wired::GPU
+{
+    /**
+     * Linearly sub-allocates aligned uniform payload offsets from a single uniform block.
+     *
+     * When a payload no longer fits, Allocate returns std::nullopt and the owner is expected to move on to
+     * a fresh block, re-initializing the allocator for it. Reset rewinds the allocator to the start of the
+     * block once the GPU is finished with the block's contents.
+     */
+    class UniformBlockAllocator
+    {
+        public:
+
+            UniformBlockAllocator() = default;
+
+            UniformBlockAllocator(std::size_t blockByteSize, std::size_t offsetAlignment)
+                : m_blockByteSize(blockByteSize)
+                , m_offsetAlignment(offsetAlignment > 0 ? offsetAlignment : 1)
+            { }
+
+            /**
+             * @return The aligned byte offset within the block to write the payload to, or std::nullopt if the
+             * block doesn't have room left for the payload
+             */
+            [[nodiscard]] std::optional<std::size_t> Allocate(std::size_t byteSize)
+            {
+                const auto byteOffset = (m_byteOffset + m_offsetAlignment - 1) / m_offsetAlignment * m_offsetAlignment;
+
+                if (byteOffset > m_blockByteSize || byteSize > m_blockByteSize - byteOffset)
+                {
+                    return std::nullopt;
+                }
+
+                m_byteOffset = byteOffset + byteSize;
+
+                return byteOffset;
+            }
+
+            void Reset() noexcept { m_byteOffset = 0; }
+
+            [[nodiscard]] std::size_t GetByteOffset() const noexcept { return m_byteOffset; }
+
+        private:
+
+            std::size_t m_blockByteSize{0};
+            std::size_t m_offsetAlignment{1};
+            std::size_t m_byteOffset{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDGPUVK_SRC_BUFFER_UNIFORMBLOCKALLOCATOR_H
@@ -11,11 +11,13 @@
 
 #include "Buffers.h"
 
+#include <NEON/Common/Log/ILogger.h>
+
+#include <algorithm>
+
 namespace Wired::GPU
 {
 
-static constexpr auto ENTRIES_PER_BUFFER = 1024U;
-
 UniformBuffers::UniformBuffers(Global* pGlobal)
     : m_pGlobal(pGlobal)
 {
@@ -31,25 +33,21 @@ bool UniformBuffers::Create()
 {
     m_pGlobal->pLogger->Info("UniformBuffers: Creating");
 
-    m_entryByteSize = UNIFORM_BUFFER_BYTE_SIZE;
-
-    // Modify entry byte size to be aligned to minUniformBufferOffsetAlignment
-    const auto minUniformBufferOffsetAlignment = m_pGlobal->physicalDevice.GetPhysicalDeviceProperties().properties.limits.minUniformBufferOffsetAlignment;
-    if (minUniformBufferOffsetAlignment > 0)
-    {
-        m_entryByteSize = (m_entryByteSize + minUniformBufferOffsetAlignment - 1) & ~(minUniformBufferOffsetAlignment - 1);
-    }
+    const auto& limits = m_pGlobal->physicalDevice.GetPhysicalDeviceProperties().properties.limits;
 
-    m_bufferByteSize = m_entryByteSize * ENTRIES_PER_BUFFER;
+    m_offsetAlignment = std::max<std::size_t>(limits.minUniformBufferOffsetAlignment, 1U);
+    m_maxPayloadByteSize = std::min<std::size_t>(limits.maxUniformBufferRange, UNIFORM_BLOCK_BYTE_SIZE);
 
-    const auto uniformBuffer = AllocateUniformBuffer();
-    if (!uniformBuffer)
+    // Prime the pool with one block
+    const auto uniformBlock = AcquireBlock();
+    if (!uniformBlock)
     {
-        m_pGlobal->pLogger->Error("UniformBuffers::Create: Failed to allocate initial uniform buffer");
+        m_pGlobal->pLogger->Error("UniformBuffers::Create: Failed to allocate initial uniform block");
         return false;
     }
 
-    m_activeBuffer = *uniformBuffer;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cachedBlocks.push_back(uniformBlock->bufferId);
 
     return true;
 }
@@ -58,103 +56,82 @@ void UniformBuffers::Destroy()
 {
     m_pGlobal->pLogger->Info("UniformBuffers: Destroying");
 
-    if (m_activeBuffer)
-    {
-        m_pGlobal->pBuffers->DestroyBuffer(m_activeBuffer->bufferId, true);
-        m_activeBuffer = std::nullopt;
-    }
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-    for (const auto& bufferId : m_cachedBuffers)
+    for (const auto& it : m_blocks)
     {
-        m_pGlobal->pBuffers->DestroyBuffer(bufferId, true);
+        (void)m_pGlobal->pBuffers->UnmapBuffer(it.first);
+        m_pGlobal->pBuffers->DestroyBuffer(it.first, true);
     }
-    m_cachedBuffers.clear();
 
-    for (const auto& bufferId : m_tappedBuffers)
-    {
-        m_pGlobal->pBuffers->DestroyBuffer(bufferId, true);
-    }
-    m_tappedBuffers.clear();
+    m_blocks.clear();
+    m_cachedBlocks.clear();
+    m_releasedBlocks.clear();
 }
 
-std::expected<DynamicUniformBuffer, bool> UniformBuffers::GetFreeUniformBuffer()
+std::expected<UniformBlock, bool> UniformBuffers::AcquireBlock()
 {
     std::lock_guard<std::mutex> lock(m_mutex);
 
-    assert(m_activeBuffer);
-    if (!m_activeBuffer)
+    //
+    // If a cached block exists, use it
+    //
+    if (!m_cachedBlocks.empty())
     {
-        m_pGlobal->pLogger->Error("UniformBuffers::GetFreeUniformBuffer: No active buffer exists");
-        return std::unexpected(false);
-    }
-
-    const auto dynamicUniformBuffer = DynamicUniformBuffer{
-        .bufferId = m_activeBuffer->bufferId,
-        .byteOffset = m_activeBuffer->entryOffset * m_entryByteSize
-    };
+        const auto bufferId = m_cachedBlocks.back();
+        m_cachedBlocks.pop_back();
 
-    m_activeBuffer->entryOffset++;
-
-    if (m_activeBuffer->entryOffset == ENTRIES_PER_BUFFER)
-    {
-        TapOutActiveBuffer();
+        return m_blocks.at(bufferId);
     }
 
-    return dynamicUniformBuffer;
+    //
+    // Otherwise, allocate a new block
+    //
+    return AllocateBlock();
 }
 
-void UniformBuffers::TapOutActiveBuffer()
+void UniformBuffers::ReleaseBlock(const UniformBlock& uniformBlock)
 {
-    m_tappedBuffers.insert(m_activeBuffer->bufferId);
-    m_activeBuffer = std::nullopt;
-
-    const auto newActiveBuffer = AllocateUniformBuffer();
-    if (!newActiveBuffer)
-    {
-        m_pGlobal->pLogger->Error("UniformBuffers::TapOutActiveBuffer: Failed to allocate a new active buffer");
-        return;
-    }
+    std::lock_guard<std::mutex> lock(m_mutex);
 
-    m_activeBuffer = *newActiveBuffer;
+    m_releasedBlocks.push_back(uniformBlock.bufferId);
 }
 
-std::expected<UniformBuffers::UniformBuffer, bool> UniformBuffers::AllocateUniformBuffer()
+std::expected<UniformBlock, bool> UniformBuffers::AllocateBlock()
 {
-    //
-    // If a cached buffer exists, use it
-    //
-    if (!m_cachedBuffers.empty())
-    {
-        BufferId cachedBufferId = *m_cachedBuffers.cbegin();
-        m_cachedBuffers.erase(cachedBufferId);
-
-        return UniformBuffer{
-            .bufferId = cachedBufferId,
-            .entryOffset = 0
-        };
-    }
-
-    //
-    // Otherwise, allocate a new buffer
-    //
-    m_pGlobal->pLogger->Debug("UniformBuffers: Allocating a new uniform buffer");
+    m_pGlobal->pLogger->Debug("UniformBuffers: Allocating a new uniform block");
 
     const auto bufferId = m_pGlobal->pBuffers->CreateBuffer(
         {BufferUsageFlag::GraphicsUniformRead},
-        m_bufferByteSize,
+        UNIFORM_BLOCK_BYTE_SIZE,
         false, // TODO Perf: dedicated? Perf seems better (atm) without dedicated
         "Uniform"
     );
     if (!bufferId)
     {
-        m_pGlobal->pLogger->Error("UniformBuffers::AllocateUniformBuffer: Buffers system failed to allocate new uniform buffer");
+        m_pGlobal->pLogger->Error("UniformBuffers::AllocateBlock: Buffers system failed to allocate new uniform buffer");
         return std::unexpected(false);
     }
 
-    return UniformBuffer{
+    const auto gpuBuffer = m_pGlobal->pBuffers->GetBuffer(*bufferId, false);
+    const auto pMappedData = m_pGlobal->pBuffers->MapBuffer(*bufferId, false);
+    if (!gpuBuffer || !pMappedData)
+    {
+        m_pGlobal->pLogger->Error("UniformBuffers::AllocateBlock: Failed to map new uniform buffer");
+        m_pGlobal->pBuffers->DestroyBuffer(*bufferId, true);
+        return std::unexpected(false);
+    }
+
+    // Blocks stay mapped for their entire lifetime
+    const auto uniformBlock = UniformBlock{
         .bufferId = *bufferId,
-        .entryOffset = 0
+        .gpuBuffer = *gpuBuffer,
+        .pMappedData = static_cast<std::byte*>(*pMappedData)
     };
+
+    m_blocks.insert({*bufferId, uniformBlock});
+
+    return uniformBlock;
 }
 
 void UniformBuffers::RunCleanUp()
@@ -162,31 +139,20 @@ void UniformBuffers::RunCleanUp()
     std::lock_guard<std::mutex> lock(m_mutex);
 
     //
-    // Move any tapped buffers with no GPU usages into the cached list for re-use
+    // Move any released blocks with no GPU usages into the cached list for re-use
     //
-    std::vector<BufferId> buffersToCache;
+    std::erase_if(m_releasedBlocks, [&](const BufferId& bufferId){
+        const auto& uniformBlock = m_blocks.at(bufferId);
 
-    for (const auto& tappedBuffer : m_tappedBuffers)
-    {
-        const auto gpuBuffer = m_pGlobal->pBuffers->GetBuffer(tappedBuffer, false);
-        if (!gpuBuffer)
+        const bool blockInUse = m_pGlobal->pUsages->buffers.GetGPUUsageCount(uniformBlock.gpuBuffer.vkBuffer) > 0;
+        if (blockInUse)
         {
-            m_pGlobal->pLogger->Error("UniformBuffers::RunCleanUp: No such buffer exists: {}", tappedBuffer.id);
-            continue;
+            return false;
         }
 
-        const bool bufferInUse = m_pGlobal->pUsages->buffers.GetGPUUsageCount(gpuBuffer->vkBuffer) > 0;
-        if (!bufferInUse)
-        {
-            buffersToCache.push_back(tappedBuffer);
-        }
-    }
-
-    for (const auto& bufferId : buffersToCache)
-    {
-        m_cachedBuffers.insert(bufferId);
-        m_tappedBuffers.erase(bufferId);
-    }
+        m_cachedBlocks.push_back(bufferId);
+        return true;
+    });
 }
 
 }
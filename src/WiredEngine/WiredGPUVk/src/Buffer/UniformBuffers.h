@@ -11,23 +11,38 @@
 
 #include <Wired/GPU/GPUId.h>
 
-#include <unordered_set>
+#include <unordered_map>
+#include <vector>
 #include <mutex>
 #include <expected>
-#include <optional>
+#include <cstddef>
 
 namespace Wired::GPU
-    {
-    static constexpr std::size_t UNIFORM_BUFFER_BYTE_SIZE = 1024U;
+{
+    // Byte size of each block of uniform memory handed out to command buffers
+    static constexpr std::size_t UNIFORM_BLOCK_BYTE_SIZE = 256U * 1024U;
 
     struct Global;
 
-    struct DynamicUniformBuffer
+    /**
+     * A persistently mapped block of uniform buffer memory, which a command buffer linearly sub-allocates
+     * its uniform payloads from.
+     */
+    struct UniformBlock
     {
         BufferId bufferId{};
-        std::size_t byteOffset{};
+        GPUBuffer gpuBuffer{};
+        std::byte* pMappedData{nullptr};
     };
 
+    /**
+     * Pool of uniform buffer blocks.
+     *
+     * The lock is only taken when a command buffer acquires or releases a whole block; the sub-allocation of
+     * individual uniform payloads from a block is done by the (single-threaded) command buffer that owns it.
+     *
+     * Released blocks are held until the GPU has finished with them, and then recycled.
+     */
     class UniformBuffers
     {
         public:
@@ -40,32 +55,33 @@ namespace Wired::GPU
 
             void RunCleanUp();
 
-            [[nodiscard]] std::expected<DynamicUniformBuffer, bool> GetFreeUniformBuffer();
+            /**
+             * @return The alignment that uniform payload offsets within a block must have
+             */
+            [[nodiscard]] std::size_t GetOffsetAlignment() const noexcept { return m_offsetAlignment; }
 
-        private:
+            /**
+             * @return The largest uniform payload that can be bound
+             */
+            [[nodiscard]] std::size_t GetMaxPayloadByteSize() const noexcept { return m_maxPayloadByteSize; }
 
-            struct UniformBuffer
-            {
-                BufferId bufferId{};
-                std::size_t entryOffset{0};
-            };
+            [[nodiscard]] std::expected<UniformBlock, bool> AcquireBlock();
+            void ReleaseBlock(const UniformBlock& uniformBlock);
 
         private:
 
-            [[nodiscard]] std::expected<UniformBuffer, bool> AllocateUniformBuffer();
-
-            void TapOutActiveBuffer();
+            [[nodiscard]] std::expected<UniformBlock, bool> AllocateBlock();
 
         private:
 
             Global* m_pGlobal{nullptr};
 
-            std::size_t m_entryByteSize{0};
-            std::size_t m_bufferByteSize{0};
+            std::size_t m_offsetAlignment{1};
+            std::size_t m_maxPayloadByteSize{0};
 
-            std::optional<UniformBuffer> m_activeBuffer;
-            std::unordered_set<BufferId> m_cachedBuffers;
-            std::unordered_set<BufferId> m_tappedBuffers;
+            std::unordered_map<BufferId, UniformBlock> m_blocks;
+            std::vector<BufferId> m_cachedBlocks;
+            std::vector<BufferId> m_releasedBlocks;
             std::mutex m_mutex;
     };
 }
@@ -0,0 +1,112 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "DescriptorArena.h"
+#include "DescriptorPools.h"
+
+#include "../Global.h"
+
+#include <NEON/Common/Log/ILogger.h>
+
+#include <format>
+#include <algorithm>
+
+namespace Wired::GPU
+{
+
+DescriptorArena::DescriptorArena(Global* pGlobal, std::string tag)
+    : m_pGlobal(pGlobal)
+    , m_tag(std::move(tag))
+{
+
+}
+
+DescriptorArena::~DescriptorArena()
+{
+    m_pGlobal = nullptr;
+}
+
+void DescriptorArena::Destroy()
+{
+    for (auto& pool : m_pools)
+    {
+        pool.Destroy();
+    }
+    m_pools.clear();
+    m_activePoolIndex = 0;
+}
+
+std::expected<VulkanDescriptorSet, bool> DescriptorArena::AllocateDescriptorSet(const VulkanDescriptorSetLayout& layout, const std::string& tag)
+{
+    //
+    // Try to allocate from the active pool and any (reset) pools after it
+    //
+    while (m_activePoolIndex < m_pools.size())
+    {
+        const auto descriptorSet = m_pools[m_activePoolIndex].AllocateDescriptorSet(layout, tag);
+        if (descriptorSet)
+        {
+            return *descriptorSet;
+        }
+
+        if (descriptorSet.error() == VulkanDescriptorPool::AllocateError::Other)
+        {
+            m_pGlobal->pLogger->Error("DescriptorArena::AllocateDescriptorSet: {} - Failed to allocate descriptor set", m_tag);
+            return std::unexpected(false);
+        }
+
+        // Pool is exhausted, move on to the next one
+        m_activePoolIndex++;
+    }
+
+    //
+    // If here, then every pool is exhausted, so create a new pool
+    //
+    const auto newVulkanDescriptorPool = VulkanDescriptorPool::Create(
+        m_pGlobal,
+        DescriptorPools::DESCRIPTOR_SET_LIMIT,
+        DescriptorPools::GetDescriptorLimits(),
+        0,
+        std::format("{}-{}", m_tag, m_pools.size())
+    );
+    if (!newVulkanDescriptorPool)
+    {
+        m_pGlobal->pLogger->Error("DescriptorArena::AllocateDescriptorSet: {} - Failed to create new descriptor pool", m_tag);
+        return std::unexpected(false);
+    }
+
+    m_pools.push_back(*newVulkanDescriptorPool);
+    m_activePoolIndex = m_pools.size() - 1;
+
+    const auto descriptorSet = m_pools[m_activePoolIndex].AllocateDescriptorSet(layout, tag);
+    if (!descriptorSet)
+    {
+        m_pGlobal->pLogger->Error("DescriptorArena::AllocateDescriptorSet: {} - Failed to allocate from fresh descriptor pool", m_tag);
+        return std::unexpected(false);
+    }
+
+    return *descriptorSet;
+}
+
+void DescriptorArena::Reset()
+{
+    if (m_pools.empty())
+    {
+        return;
+    }
+
+    // Only pools up to and including the active pool can have had sets allocated from them since the last reset
+    const auto usedPoolCount = std::min(m_activePoolIndex + 1, m_pools.size());
+
+    for (std::size_t x = 0; x < usedPoolCount; ++x)
+    {
+        m_pools[x].ResetPool();
+    }
+
+    m_activePoolIndex = 0;
+}
+
+}
@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUVK_SRC_DESCRIPTOR_DESCRIPTORARENA_H
+#define WIREDENGINE_WIREDGPUVK_SRC_DESCRIPTOR_DESCRIPTORARENA_H
+
+#include "../Vulkan/VulkanDescriptorSet.h"
+#include "../Vulkan/VulkanDescriptorSetLayout.h"
+#include "../Vulkan/VulkanDescriptorPool.h"
+
+#include <expected>
+#include <string>
+#include <vector>
+
+namespace Wired::GPU
+{
+    struct Global;
+
+    /**
+     * Linearly allocates transient descriptor sets from a list of pools which are never freed from
+     * individually. Pools are added as needed and are all reset at once when the arena is reset, which
+     * must only happen once the GPU has finished with every set allocated from it.
+     *
+     * Not thread safe; callers are expected to synchronize access.
+     */
+    class DescriptorArena
+    {
+        public:
+
+            DescriptorArena(Global* pGlobal, std::string tag);
+            ~DescriptorArena();
+
+            void Destroy();
+
+            [[nodiscard]] std::expected<VulkanDescriptorSet, bool> AllocateDescriptorSet(const VulkanDescriptorSetLayout& layout, const std::string& tag);
+
+            /**
+             * Releases every set allocated from the arena and resets its pools for re-use
+             */
+            void Reset();
+
+        private:
+
+            Global* m_pGlobal;
+            std::string m_tag;
+
+            std::vector<VulkanDescriptorPool> m_pools;
+
+            // Index of the pool currently being allocated from; pools past it are reset and unused
+            std::size_t m_activePoolIndex{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDGPUVK_SRC_DESCRIPTOR_DESCRIPTORARENA_H
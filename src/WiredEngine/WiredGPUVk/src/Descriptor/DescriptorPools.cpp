@@ -13,6 +13,17 @@
 namespace Wired::GPU
 {
 
+std::vector<VkDescriptorPoolSize> DescriptorPools::GetDescriptorLimits()
+{
+    // TODO Perf: Adjust limits
+    return {
+        { .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1000 },
+        { .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, .descriptorCount = 10 },
+        { .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 1000 },
+        { .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = 1000 }
+    };
+}
+
 DescriptorPools::DescriptorPools(Global* pGlobal)
     : m_pGlobal(pGlobal)
 {
@@ -78,19 +89,11 @@ DescriptorPools::AllocateDescriptorSet(const VulkanDescriptorSetLayout& layout,
 
     //
     // If here, then we have no pools that can allocate, so create a new pool
-    // TODO Perf: Adjust limits
     //
-    const std::vector<VkDescriptorPoolSize> descriptorLimits = {
-        { .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER, .descriptorCount = 1000 },
-        { .type = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC, .descriptorCount = 10 },
-        { .type = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER, .descriptorCount = 1000 },
-        { .type = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER, .descriptorCount = 1000 }
-    };
-
     const auto newVulkanDescriptorPool = VulkanDescriptorPool::Create(
         m_pGlobal,
-        1000,
-        descriptorLimits,
+        DESCRIPTOR_SET_LIMIT,
+        GetDescriptorLimits(),
         VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT,
         std::format("{}", layout.GetTag())
     );
@@ -141,12 +144,15 @@ std::expected<VulkanDescriptorSet, VulkanDescriptorPool::AllocateError> Descript
     }
 
     m_setToPool.insert({descriptorSet->GetVkDescriptorSet(), descriptorPool.pool.GetVkDescriptorPool()});
+    descriptorPool.allocatedSetCount++;
 
     return *descriptorSet;
 }
 
 void DescriptorPools::FreeDescriptorSet(const VkDescriptorSet& vkDescriptorSet)
 {
+    std::lock_guard<std::mutex> lock(m_poolsMutex);
+
     const auto it = m_setToPool.find(vkDescriptorSet);
     if (it == m_setToPool.cend())
     {
@@ -157,6 +163,16 @@ void DescriptorPools::FreeDescriptorSet(const VkDescriptorSet& vkDescriptorSet)
     auto& descriptorPool = m_pools.at(it->second);
 
     descriptorPool.pool.FreeDescriptorSet(vkDescriptorSet);
+    descriptorPool.allocatedSetCount--;
+
+    m_setToPool.erase(it);
+
+    // If the pool no longer has any sets allocated from it, reset it; this recycles the pool with none
+    // of the fragmentation that freeing individual sets builds up
+    if (descriptorPool.allocatedSetCount == 0)
+    {
+        descriptorPool.pool.ResetPool();
+    }
 
     // Since the pool had a descriptor set freed, moved it back to untapped, so we can try to
     // allocate from it again in the future
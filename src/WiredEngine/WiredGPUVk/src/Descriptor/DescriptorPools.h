@@ -14,15 +14,30 @@
 #include <expected>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <mutex>
 
 namespace Wired::GPU
 {
     struct Global;
 
-    // TODO: Clean up fragmented pools
+    /**
+     * Allocates long-lived descriptor sets from a growing list of pools which support freeing individual sets.
+     *
+     * A pool which has every one of its sets freed is reset, which recycles it and clears any fragmentation
+     * it had built up.
+     */
     class DescriptorPools
     {
+        public:
+
+            static constexpr uint32_t DESCRIPTOR_SET_LIMIT = 1000;
+
+            /**
+             * @return The per-type descriptor limits that new descriptor pools are created with
+             */
+            [[nodiscard]] static std::vector<VkDescriptorPoolSize> GetDescriptorLimits();
+
         public:
 
             explicit DescriptorPools(Global* pGlobal);
@@ -46,6 +61,7 @@ namespace Wired::GPU
             {
                 VulkanDescriptorPool pool;
                 PoolState state{PoolState::Untapped};
+                std::size_t allocatedSetCount{0};
             };
 
         private:
@@ -11,6 +11,8 @@
 
 #include <NEON/Common/Hash.h>
 
+#include <iterator>
+
 namespace Wired::GPU
 {
 
@@ -33,8 +35,18 @@ void DescriptorSets::Destroy()
 
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
+    for (auto& arena : m_frameArenas)
+    {
+        arena.Destroy();
+    }
+    m_frameArenas.clear();
+
     m_descriptorPools.Destroy();
+
+    m_pGlobal->cachedDescriptorSetCount -= m_descriptorSets.size();
     m_descriptorSets.clear();
+    m_lru.clear();
+    m_cached.clear();
 }
 
 std::expected<VulkanDescriptorSet, bool> DescriptorSets::GetVulkanDescriptorSet(const DescriptorSetRequest& request, const std::string& tag)
@@ -43,12 +55,17 @@ std::expected<VulkanDescriptorSet, bool> DescriptorSets::GetVulkanDescriptorSet(
 
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
+    m_pGlobal->descriptorSetCacheLookupCount++;
+
     // Try to find an active descriptor set with the layout and bindings as requested. If found, return it
     {
         const auto it = m_descriptorSets.find(requestHash);
         if (it != m_descriptorSets.cend())
         {
+            m_pGlobal->descriptorSetCacheHitCount++;
+
             it->second.cleanUpsWithoutUse = 0;
+            m_lru.splice(m_lru.begin(), m_lru, it->second.lruIt);
             return it->second.vulkanDescriptorSet;
         }
     }
@@ -87,15 +104,57 @@ std::expected<VulkanDescriptorSet, bool> DescriptorSets::GetVulkanDescriptorSet(
     LockDescriptorSetResources(*vulkanDescriptorSet);
 
     // Update internal state
+    m_lru.push_front(requestHash);
+
     m_descriptorSets.insert({requestHash, DescriptorSet{
         .cleanUpsWithoutUse = 0,
         .vkDescriptorSetLayout = request.descriptorSetLayout.GetVkDescriptorSetLayout(),
-        .vulkanDescriptorSet = *vulkanDescriptorSet
+        .vulkanDescriptorSet = *vulkanDescriptorSet,
+        .lruIt = m_lru.begin()
     }});
 
+    m_pGlobal->cachedDescriptorSetCount++;
+
     return *vulkanDescriptorSet;
 }
 
+std::expected<VulkanDescriptorSet, bool> DescriptorSets::GetTransientDescriptorSet(const DescriptorSetRequest& request,
+                                                                                  uint32_t frameIndex,
+                                                                                  const std::string& tag)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    while (m_frameArenas.size() <= frameIndex)
+    {
+        m_frameArenas.emplace_back(m_pGlobal, std::format("{}-Frame{}", m_tag, m_frameArenas.size()));
+    }
+
+    auto vulkanDescriptorSet = m_frameArenas[frameIndex].AllocateDescriptorSet(request.descriptorSetLayout, tag);
+    if (!vulkanDescriptorSet)
+    {
+        m_pGlobal->pLogger->Error("DescriptorSets::GetTransientDescriptorSet: Failed to allocate descriptor set from frame arena");
+        return std::unexpected(false);
+    }
+
+    // No resource locks are taken; the command buffer the set is bound into tracks usage of the set's
+    // resources, and the set itself doesn't outlive the frame
+    vulkanDescriptorSet->Write(request.bindings);
+
+    m_pGlobal->transientDescriptorSetCount++;
+
+    return *vulkanDescriptorSet;
+}
+
+void DescriptorSets::OnFrameStarted(uint32_t frameIndex)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+    if (frameIndex < m_frameArenas.size())
+    {
+        m_frameArenas[frameIndex].Reset();
+    }
+}
+
 void DescriptorSets::RunCleanUp(bool isIdleCleanUp)
 {
     std::lock_guard<std::recursive_mutex> lock(m_mutex);
@@ -109,17 +168,13 @@ void DescriptorSets::RunCleanUp(bool isIdleCleanUp)
         RunCleanUp_CacheUnusedSets();
     }
 
+    // Regardless, keep the number of active sets bounded
+    RunCleanUp_EvictLeastRecentlyUsedSets();
+
     //
     // Erase entries for layouts in the cached list which have no cached descriptor sets
     //
     std::erase_if(m_cached, [](const auto& it){ return it.second.empty(); });
-
-    /*std::size_t totalCached{0};
-    for (const auto& it : m_cached)
-    {
-        totalCached += it.second.size();
-    }
-    m_pGlobal->pLogger->Error("Total Active: {}, Total Cached: {}", m_descriptorSets.size(), totalCached);*/
 }
 
 void DescriptorSets::RunCleanUp_CacheUnusedSets()
@@ -143,13 +198,7 @@ void DescriptorSets::RunCleanUp_CacheUnusedSets()
             // Cache the descriptor set if it's gone for 10 clean up flows with no GPU usage of it
             if (it.second.cleanUpsWithoutUse++ >= 10)
             {
-                // Unlock the set's resources. If the set is ever used again it'll have new
-                // resources bound to it, so no use holds locks to resources just because the
-                // set is setting in the cache list with resources still associated with it.
-                UnlockDescriptorSetResources(it.second.vulkanDescriptorSet);
-
-                // Move the set to the cache list
-                m_cached[it.second.vkDescriptorSetLayout].push(it.second.vulkanDescriptorSet);
+                ReleaseActiveSet(it.second);
 
                 // Erase the set from the active list
                 toEraseHashes.push_back(it.first);
@@ -163,6 +212,59 @@ void DescriptorSets::RunCleanUp_CacheUnusedSets()
     }
 }
 
+void DescriptorSets::RunCleanUp_EvictLeastRecentlyUsedSets()
+{
+    //
+    // Walk active sets from least recently used, releasing sets until we're within the cache limit. Sets which
+    // the GPU is still using are skipped over.
+    //
+    auto lruIt = m_lru.end();
+
+    while ((m_descriptorSets.size() > MAX_CACHED_SETS) && (lruIt != m_lru.begin()))
+    {
+        --lruIt;
+
+        const auto it = m_descriptorSets.find(*lruIt);
+        if (it == m_descriptorSets.cend()) { continue; }
+
+        if (m_pGlobal->pUsages->descriptorSets.GetGPUUsageCount(it->second.vulkanDescriptorSet.GetVkDescriptorSet()) > 0)
+        {
+            continue;
+        }
+
+        // ReleaseActiveSet erases the set's LRU entry, so continue the walk from the entry after it
+        const auto nextLruIt = std::next(lruIt);
+
+        ReleaseActiveSet(it->second);
+        m_descriptorSets.erase(it);
+
+        lruIt = nextLruIt;
+    }
+}
+
+void DescriptorSets::ReleaseActiveSet(const DescriptorSet& descriptorSet)
+{
+    // Unlock the set's resources. If the set is ever used again it'll have new
+    // resources bound to it, so no use holds locks to resources just because the
+    // set is setting in the cache list with resources still associated with it.
+    UnlockDescriptorSetResources(descriptorSet.vulkanDescriptorSet);
+
+    // Move the set to the cache list, or, if the layout already has enough free sets cached, return it to its pool
+    auto& cachedSets = m_cached[descriptorSet.vkDescriptorSetLayout];
+    if (cachedSets.size() < MAX_FREE_SETS_PER_LAYOUT)
+    {
+        cachedSets.push(descriptorSet.vulkanDescriptorSet);
+    }
+    else
+    {
+        m_descriptorPools.FreeDescriptorSet(descriptorSet.vulkanDescriptorSet.GetVkDescriptorSet());
+    }
+
+    m_lru.erase(descriptorSet.lruIt);
+
+    m_pGlobal->cachedDescriptorSetCount--;
+}
+
 void DescriptorSets::LockDescriptorSetResources(const VulkanDescriptorSet& vulkanDescriptorSet)
 {
     const auto& setBindings = vulkanDescriptorSet.GetSetBindings();
@@ -8,6 +8,7 @@
 #define WIREDENGINE_WIREDGPUVK_SRC_DESCRIPTOR_DESCRIPTORSETS_H
 
 #include "DescriptorPools.h"
+#include "DescriptorArena.h"
 
 #include "../Vulkan/VulkanDescriptorPool.h"
 
@@ -19,6 +20,8 @@
 #include <optional>
 #include <string>
 #include <queue>
+#include <list>
+#include <vector>
 
 namespace Wired::GPU
 {
@@ -30,9 +33,22 @@ namespace Wired::GPU
         SetBindings bindings;
     };
 
-    // TODO Perf: Purge down cached/free sets at some point, no way to reduce cache size at the moment
+    /**
+     * Provides descriptor sets, either long-lived sets which are cached by their bindings, or transient sets which
+     * are allocated linearly from a per-frame arena and only live until that frame is next started.
+     *
+     * The cache of long-lived sets is bounded; past MAX_CACHED_SETS, the least recently used sets are evicted.
+     */
     class DescriptorSets
     {
+        public:
+
+            // Max number of active long-lived sets held before least recently used sets are evicted
+            static constexpr std::size_t MAX_CACHED_SETS = 4096;
+
+            // Max number of free sets held per layout before excess sets are freed back to their pool
+            static constexpr std::size_t MAX_FREE_SETS_PER_LAYOUT = 64;
+
         public:
 
             DescriptorSets(Global* pGlobal, std::string tag);
@@ -42,6 +58,19 @@ namespace Wired::GPU
 
             [[nodiscard]] std::expected<VulkanDescriptorSet, bool> GetVulkanDescriptorSet(const DescriptorSetRequest& request, const std::string& tag);
 
+            /**
+             * Allocates and writes a descriptor set from the specified frame's arena. The set is not cached and
+             * holds no locks on its resources; it's only valid until the frame is next started.
+             */
+            [[nodiscard]] std::expected<VulkanDescriptorSet, bool> GetTransientDescriptorSet(const DescriptorSetRequest& request,
+                                                                                             uint32_t frameIndex,
+                                                                                             const std::string& tag);
+
+            /**
+             * Must be called once the GPU has finished with the frame's previous work; resets the frame's arena
+             */
+            void OnFrameStarted(uint32_t frameIndex);
+
             void RunCleanUp(bool isIdleCleanUp);
 
         private:
@@ -53,6 +82,7 @@ namespace Wired::GPU
                 unsigned int cleanUpsWithoutUse{0};
                 VkDescriptorSetLayout vkDescriptorSetLayout{VK_NULL_HANDLE};
                 VulkanDescriptorSet vulkanDescriptorSet;
+                std::list<RequestHash>::iterator lruIt;
             };
 
         private:
@@ -60,6 +90,9 @@ namespace Wired::GPU
             [[nodiscard]] static RequestHash GetHash(const DescriptorSetRequest& request);
 
             void RunCleanUp_CacheUnusedSets();
+            void RunCleanUp_EvictLeastRecentlyUsedSets();
+
+            void ReleaseActiveSet(const DescriptorSet& descriptorSet);
 
             void LockDescriptorSetResources(const VulkanDescriptorSet& vulkanDescriptorSet);
             void UnlockDescriptorSetResources(const VulkanDescriptorSet& vulkanDescriptorSet);
@@ -74,8 +107,15 @@ namespace Wired::GPU
             // "Active" descriptor sets which have recently been used and have specific descriptors bound to them
             std::unordered_map<RequestHash, DescriptorSet> m_descriptorSets;
 
+            // Hashes of active descriptor sets, most recently used first
+            std::list<RequestHash> m_lru;
+
             // "Cached" descriptor sets which haven't recently been used and which no longer have specific descriptors bound
             std::unordered_map<VkDescriptorSetLayout, std::queue<VulkanDescriptorSet>> m_cached;
+
+            // Per frame index, arenas that transient descriptor sets are allocated from
+            std::vector<DescriptorArena> m_frameArenas;
+
             std::recursive_mutex m_mutex;
     };
 }
@@ -100,7 +100,7 @@ void Frame::Destroy()
     // Reset runtime state
     //
     m_swapChainPresentIndex = std::nullopt;
-    m_associatedCommandBufferIds.clear();
+    m_submitTimelineValue = 0;
     m_imGuiImageReferencesIncoming.clear();
     m_imGuiImageReferences.clear();
 }
@@ -115,40 +115,6 @@ void Frame::ResetSwapChainPresentIndex()
     m_swapChainPresentIndex = std::nullopt;
 }
 
-void Frame::AssociateCommandBuffer(CommandBufferId commandBufferId)
-{
-    m_associatedCommandBufferIds.insert(commandBufferId);
-
-    // Report a usage of the command buffer. We don't want the CommandBuffers system to destroy
-    // the command buffer until this frame has had a chance to wait for its work to finish. Note
-    // that before we didn't care if CommandBuffers cleaned it up, as we assumed that if a
-    // CommandBuffer was destroyed then it must have been finished, but that breaks when command
-    // buffer ids are re-used; this frame might then be associated with the wrong (but same id)
-    // command buffer.
-    m_pGlobal->pUsages->commandBuffers.IncrementGPUUsage(commandBufferId);
-}
-
-void Frame::UnAssociateCommandBuffer(CommandBufferId commandBufferId)
-{
-    if (!m_associatedCommandBufferIds.contains(commandBufferId))
-    {
-        return;
-    }
-
-    m_associatedCommandBufferIds.erase(commandBufferId);
-    m_pGlobal->pUsages->commandBuffers.DecrementGPUUsage(commandBufferId);
-}
-
-void Frame::ClearAssociatedCommandBuffers()
-{
-    // Release usages of the associated command buffers
-    for (const auto& associatedCommandBufferId : m_associatedCommandBufferIds)
-    {
-        m_pGlobal->pUsages->commandBuffers.DecrementGPUUsage(associatedCommandBufferId);
-    }
-    m_associatedCommandBufferIds.clear();
-}
-
 std::optional<Timestamps*> Frame::GetTimestamps() const
 {
     if (!m_timestamps)
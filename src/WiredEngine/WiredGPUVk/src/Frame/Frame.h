@@ -78,10 +78,8 @@ namespace Wired::GPU
             void ResetSwapChainPresentIndex();
             [[nodiscard]] uint32_t GetSwapChainPresentIndex() const noexcept { assert(m_swapChainPresentIndex); return *m_swapChainPresentIndex; }
 
-            void AssociateCommandBuffer(CommandBufferId commandBufferId);
-            void UnAssociateCommandBuffer(CommandBufferId commandBufferId);
-            [[nodiscard]] std::unordered_set<CommandBufferId> GetAssociatedCommandBuffers() const noexcept { return m_associatedCommandBufferIds; }
-            void ClearAssociatedCommandBuffers();
+            void SetSubmitTimelineValue(uint64_t timelineValue) { m_submitTimelineValue = timelineValue; }
+            [[nodiscard]] uint64_t GetSubmitTimelineValue() const noexcept { return m_submitTimelineValue; }
 
             [[nodiscard]] std::optional<Timestamps*> GetTimestamps() const;
 
@@ -114,7 +112,8 @@ namespace Wired::GPU
 
             std::optional<uint32_t> m_swapChainPresentIndex;
 
-            std::unordered_set<CommandBufferId> m_associatedCommandBufferIds;
+            // Command queue timeline value which signals that all of the frame's submitted work has finished
+            uint64_t m_submitTimelineValue{0};
 
             std::unordered_set<ImGuiImageReference, ImGuiImageReference::HashFunction> m_imGuiImageReferencesIncoming;
             std::unordered_set<ImGuiImageReference, ImGuiImageReference::HashFunction> m_imGuiImageReferences;
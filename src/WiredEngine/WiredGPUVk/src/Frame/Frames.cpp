@@ -8,8 +8,6 @@
 
 #include "../Global.h"
 
-#include "../State/CommandBuffers.h"
-
 #include <NEON/Common/Log/ILogger.h>
 
 #include <cassert>
@@ -76,35 +74,11 @@ void Frames::StartFrame()
     }
 
     //
-    // Wait for all primary command buffers previously associated with the frame to finish their work
+    // Wait for the work previously submitted for the frame to finish
     //
-    const auto commandBufferIds = frame.GetAssociatedCommandBuffers();
-
-    std::vector<VkFence> vkPrimaryFences;
-    vkPrimaryFences.reserve(commandBufferIds.size());
-
-    for (const auto& commandBufferId : commandBufferIds)
-    {
-        const auto commandBuffer = m_pGlobal->pCommandBuffers->GetCommandBuffer(commandBufferId);
-        if (!commandBuffer)
-        {
-            // Note that this isn't an error condition; the command buffer system destroys/erases
-            // command buffers in its CleanUp flow when it sees they've finished executing. If we
-            // can't find an associated command buffer that means it's finished (either that or
-            // we have a horrible bug and were tracking bogus command buffer ids).
-            continue;
-        }
-
-        // If a primary command buffer, note its fence to wait on it below
-        if ((*commandBuffer)->GetType() == CommandBufferType::Primary)
-        {
-            vkPrimaryFences.push_back((*commandBuffer)->GetVkFence());
-        }
-    }
-
-    if (!vkPrimaryFences.empty())
+    if (frame.GetSubmitTimelineValue() > 0)
     {
-        m_pGlobal->vk.vkWaitForFences(m_pGlobal->device.GetVkDevice(), (uint32_t)vkPrimaryFences.size(), vkPrimaryFences.data(), VK_TRUE, UINT64_MAX);
+        m_pGlobal->commandQueue.WaitForTimelineValue(frame.GetSubmitTimelineValue());
     }
 
     //////
@@ -115,9 +89,6 @@ void Frames::StartFrame()
     // Reset old frame state
     //
 
-    // Frame no longer has command buffers associated with it
-    frame.ClearAssociatedCommandBuffers();
-
     // Frame no longer has any swap chain present index associated with it
     frame.ResetSwapChainPresentIndex();
 
@@ -21,6 +21,7 @@
 #include <Wired/GPU/GPUSettings.h>
 
 #include <optional>
+#include <atomic>
 #include <string>
 
 namespace NCommon
@@ -38,6 +39,7 @@ namespace Wired::GPU
     class Layouts;
     class VkPipelines;
     class UniformBuffers;
+    class MemoryTracker;
     struct Usages;
 
     struct Global
@@ -57,6 +59,21 @@ namespace Wired::GPU
         VkPipelines* pPipelines{nullptr};
         UniformBuffers* pUniformBuffers{nullptr};
         Usages* pUsages{nullptr};
+        MemoryTracker* pMemoryTracker{nullptr};
+
+        // Total number of image/buffer pipeline barriers recorded
+        std::atomic<uint64_t> pipelineBarrierCount{0};
+
+        // Total number of vkQueueSubmit2 calls made
+        std::atomic<uint64_t> queueSubmitCount{0};
+
+        // Descriptor set cache state, across all threads
+        std::atomic<uint64_t> cachedDescriptorSetCount{0};
+        std::atomic<uint64_t> descriptorSetCacheLookupCount{0};
+        std::atomic<uint64_t> descriptorSetCacheHitCount{0};
+
+        // Total number of transient descriptor sets allocated from per-frame arenas
+        std::atomic<uint64_t> transientDescriptorSetCount{0};
 
         std::optional<std::string> requiredPhysicalDeviceName;
 
@@ -78,6 +95,7 @@ namespace Wired::GPU
         std::optional<VulkanQueue> presentQueue{};
         std::optional<VulkanSwapChain> swapChain{};
         VmaAllocator vma{VK_NULL_HANDLE};
+        bool memoryBudgetEnabled{false};
         bool imGuiActive{false};
     };
 }
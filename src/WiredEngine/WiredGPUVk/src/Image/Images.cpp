@@ -8,6 +8,7 @@
 
 #include "../Global.h"
 #include "../Usages.h"
+#include "../MemoryTracker.h"
 
 #include "../State/CommandBuffer.h"
 #include "../Vulkan/VulkanDebugUtil.h"
@@ -479,6 +480,8 @@ bool Images::CreateVkImage(GPUImage& gpuImage,
 
     SetDebugName(m_pGlobal->vk, m_pGlobal->device, VK_OBJECT_TYPE_IMAGE, (uint64_t)vkImage, std::format("Image-{}", tag));
 
+    m_pGlobal->pMemoryTracker->OnAllocated(tag, vmaAllocationInfo.size);
+
     gpuImage.imageData = {
         .vkImage = vkImage,
         .imageDef = imageDef,
@@ -618,31 +621,14 @@ bool Images::BarrierImageRangeForUsage(CommandBuffer* pCommandBuffer,
                                        const VkImageSubresourceRange& vkImageSubresourceRange,
                                        ImageUsageMode destUsageMode)
 {
-    pCommandBuffer->CmdImagePipelineBarrier(gpuImage, vkImageSubresourceRange, gpuImage.defaultUsageMode, destUsageMode);
-
-    return true;
-}
-
-bool Images::BarrierImageRangeToDefaultUsage(CommandBuffer* pCommandBuffer,
-                                             const GPUImage& gpuImage,
-                                             const VkImageSubresourceRange& vkImageSubresourceRange,
-                                             ImageUsageMode sourceUsageMode)
-{
-    pCommandBuffer->CmdImagePipelineBarrier(gpuImage, vkImageSubresourceRange, sourceUsageMode, gpuImage.defaultUsageMode);
+    pCommandBuffer->BarrierImageRangeForUsage(gpuImage, vkImageSubresourceRange, destUsageMode);
 
     return true;
 }
 
 bool Images::BarrierWholeImageForUsage(CommandBuffer* pCommandBuffer, const GPUImage& gpuImage, ImageUsageMode destUsageMode)
 {
-    pCommandBuffer->CmdImagePipelineBarrier(gpuImage, GetWholeImageSubresourceRange(gpuImage), gpuImage.defaultUsageMode, destUsageMode);
-
-    return true;
-}
-
-bool Images::BarrierWholeImageToDefaultUsage(CommandBuffer* pCommandBuffer, const GPUImage& gpuImage, ImageUsageMode sourceUsageMode)
-{
-    pCommandBuffer->CmdImagePipelineBarrier(gpuImage, GetWholeImageSubresourceRange(gpuImage), sourceUsageMode, gpuImage.defaultUsageMode);
+    pCommandBuffer->BarrierImageRangeForUsage(gpuImage, GetWholeImageSubresourceRange(gpuImage), destUsageMode);
 
     return true;
 }
@@ -677,11 +663,11 @@ void Images::DestroyImageObjects(const Image& image)
 
     for (const auto& gpuImage : image.gpuImages)
     {
-        DestroyGPUImageObjects(gpuImage, image.isSwapChainImage);
+        DestroyGPUImageObjects(gpuImage, image.isSwapChainImage, image.tag);
     }
 }
 
-void Images::DestroyGPUImageObjects(const GPUImage& gpuImage, bool isSwapChainImage)
+void Images::DestroyGPUImageObjects(const GPUImage& gpuImage, bool isSwapChainImage, const std::string& tag)
 {
     for (const auto& imageViewData: gpuImage.imageViewDatas)
     {
@@ -693,6 +679,8 @@ void Images::DestroyGPUImageObjects(const GPUImage& gpuImage, bool isSwapChainIm
     {
         RemoveDebugName(m_pGlobal->vk, m_pGlobal->device, VK_OBJECT_TYPE_IMAGE, (uint64_t) gpuImage.imageData.vkImage);
         vmaDestroyImage(m_pGlobal->vma, gpuImage.imageData.vkImage, gpuImage.imageData.imageAllocation.vmaAllocation);
+
+        m_pGlobal->pMemoryTracker->OnFreed(tag, gpuImage.imageData.imageAllocation.vmaAllocationInfo.size);
     }
 }
 
@@ -713,6 +701,25 @@ VkImageAspectFlags Images::GetImageAspectFlags(const GPUImage& gpuImage)
     return depthImage ? VK_IMAGE_ASPECT_DEPTH_BIT : VK_IMAGE_ASPECT_COLOR_BIT;
 }
 
+std::optional<std::size_t> Images::GetTexelByteSize(VkFormat vkFormat)
+{
+    switch (vkFormat)
+    {
+        case VK_FORMAT_R8G8B8A8_UNORM:
+        case VK_FORMAT_R8G8B8A8_SRGB:
+        case VK_FORMAT_B8G8R8A8_UNORM:
+        case VK_FORMAT_B8G8R8A8_SRGB:
+        case VK_FORMAT_D32_SFLOAT:
+            return 4;
+        case VK_FORMAT_D16_UNORM:
+            return 2;
+        case VK_FORMAT_R16G16B16A16_SFLOAT:
+            return 8;
+        default:
+            return std::nullopt;
+    }
+}
+
 void Images::RunCleanUp()
 {
     // Clean up images that are marked as deleted which no longer have any references/usages
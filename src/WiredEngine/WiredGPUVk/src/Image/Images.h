@@ -71,14 +71,18 @@ namespace Wired::GPU
 
             void DestroyImage(ImageId imageId, bool destroyImmediately);
 
+            // Queue state tracked barriers; see CommandBuffer::BarrierImageRangeForUsage
             bool BarrierImageRangeForUsage(CommandBuffer* pCommandBuffer, const GPUImage& gpuImage, const VkImageSubresourceRange& vkImageSubresourceRange, ImageUsageMode destUsageMode);
-            bool BarrierImageRangeToDefaultUsage(CommandBuffer* pCommandBuffer, const GPUImage& gpuImage, const VkImageSubresourceRange& vkImageSubresourceRange, ImageUsageMode sourceUsageMode);
-
             bool BarrierWholeImageForUsage(CommandBuffer* pCommandBuffer, const GPUImage& gpuImage, ImageUsageMode destUsageMode);
-            bool BarrierWholeImageToDefaultUsage(CommandBuffer* pCommandBuffer, const GPUImage& gpuImage, ImageUsageMode sourceUsageMode);
 
             [[nodiscard]] static VkImageAspectFlags GetImageAspectFlags(const GPUImage& gpuImage);
 
+            /**
+             * @return The byte size of one texel of the format, or std::nullopt for formats whose texels
+             * can't be copied to/from buffers one by one (compressed, or not used by the GPU layer)
+             */
+            [[nodiscard]] static std::optional<std::size_t> GetTexelByteSize(VkFormat vkFormat);
+
         private:
 
             struct Image
@@ -121,7 +125,7 @@ namespace Wired::GPU
                                                  const std::string& imageViewTag);
 
             void DestroyImageObjects(const Image& image);
-            void DestroyGPUImageObjects(const GPUImage& gpuImage, bool isSwapChainImage);
+            void DestroyGPUImageObjects(const GPUImage& gpuImage, bool isSwapChainImage, const std::string& tag);
 
             [[nodiscard]] static VkImageSubresourceRange GetWholeImageSubresourceRange(const GPUImage& gpuImage);
 
@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "MemoryTracker.h"
+#include "Global.h"
+
+#include <NEON/Common/Log/ILogger.h>
+
+#include <algorithm>
+#include <array>
+
+namespace Wired::GPU
+{
+
+MemoryTracker::MemoryTracker(Global* pGlobal)
+    : m_pGlobal(pGlobal)
+{
+
+}
+
+void MemoryTracker::Reset()
+{
+    std::lock_guard<std::mutex> lock(m_tagByteSizesMutex);
+
+    m_frameIndex = 0;
+    m_tagByteSizes.clear();
+}
+
+void MemoryTracker::OnFrameStarted()
+{
+    if (m_pGlobal->vma == VK_NULL_HANDLE) { return; }
+
+    vmaSetCurrentFrameIndex(m_pGlobal->vma, ++m_frameIndex);
+}
+
+void MemoryTracker::OnAllocated(const std::string& tag, const std::size_t& byteSize)
+{
+    std::lock_guard<std::mutex> lock(m_tagByteSizesMutex);
+
+    m_tagByteSizes[tag] += byteSize;
+}
+
+void MemoryTracker::OnFreed(const std::string& tag, const std::size_t& byteSize)
+{
+    std::lock_guard<std::mutex> lock(m_tagByteSizesMutex);
+
+    const auto it = m_tagByteSizes.find(tag);
+    if (it == m_tagByteSizes.cend())
+    {
+        m_pGlobal->pLogger->Error("MemoryTracker::OnFreed: No allocations are tracked for tag: {}", tag);
+        return;
+    }
+
+    it->second -= std::min(it->second, byteSize);
+
+    // Forget tags with no live allocations so that one-off tags don't accumulate
+    if (it->second == 0)
+    {
+        m_tagByteSizes.erase(it);
+    }
+}
+
+std::vector<MemoryHeapStats> MemoryTracker::GetHeapStats() const
+{
+    if (m_pGlobal->vma == VK_NULL_HANDLE) { return {}; }
+
+    const VkPhysicalDeviceMemoryProperties* pMemoryProperties{nullptr};
+    vmaGetMemoryProperties(m_pGlobal->vma, &pMemoryProperties);
+
+    std::array<VmaBudget, VK_MAX_MEMORY_HEAPS> budgets{};
+    vmaGetHeapBudgets(m_pGlobal->vma, budgets.data());
+
+    std::vector<MemoryHeapStats> heapStats;
+    heapStats.reserve(pMemoryProperties->memoryHeapCount);
+
+    for (uint32_t heapIndex = 0; heapIndex < pMemoryProperties->memoryHeapCount; ++heapIndex)
+    {
+        heapStats.push_back(MemoryHeapStats{
+            .heapIndex = heapIndex,
+            .deviceLocal = (pMemoryProperties->memoryHeaps[heapIndex].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0,
+            .budgetByteSize = (std::size_t)budgets.at(heapIndex).budget,
+            .usageByteSize = (std::size_t)budgets.at(heapIndex).usage
+        });
+    }
+
+    return heapStats;
+}
+
+std::unordered_map<std::string, std::size_t> MemoryTracker::GetByteSizesByTag() const
+{
+    std::lock_guard<std::mutex> lock(m_tagByteSizesMutex);
+
+    return m_tagByteSizes;
+}
+
+std::optional<MemoryHeapStats> MemoryTracker::GetPressuredHeap() const
+{
+    std::optional<MemoryHeapStats> pressuredHeap;
+    double pressuredHeapFraction = PRESSURE_BUDGET_FRACTION;
+
+    for (const auto& heapStats : GetHeapStats())
+    {
+        if (!heapStats.deviceLocal || heapStats.budgetByteSize == 0) { continue; }
+
+        const auto usedFraction = (double)heapStats.usageByteSize / (double)heapStats.budgetByteSize;
+
+        if (usedFraction >= pressuredHeapFraction)
+        {
+            pressuredHeap = heapStats;
+            pressuredHeapFraction = usedFraction;
+        }
+    }
+
+    return pressuredHeap;
+}
+
+}
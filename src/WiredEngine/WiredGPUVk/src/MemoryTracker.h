@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUVK_SRC_MEMORYTRACKER_H
+#define WIREDENGINE_WIREDGPUVK_SRC_MEMORYTRACKER_H
+
+#include <Wired/GPU/GPUCommon.h>
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <optional>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+
+namespace Wired::GPU
+{
+    struct Global;
+
+    /**
+     * Tracks the byte size of live buffer/image allocations per creation tag, and reports VMA's view of
+     * per-heap memory budget and usage. Budgets come from VK_EXT_memory_budget when the device supports it,
+     * otherwise they're VMA's estimate of a fixed fraction of each heap's size.
+     */
+    class MemoryTracker
+    {
+        public:
+
+            // Fraction of a device local heap's budget which, once used, counts as memory pressure
+            static constexpr float PRESSURE_BUDGET_FRACTION = 0.9f;
+
+        public:
+
+            explicit MemoryTracker(Global* pGlobal);
+
+            void Reset();
+
+            // Lets VMA refresh its cached budget values; call once per frame
+            void OnFrameStarted();
+
+            void OnAllocated(const std::string& tag, const std::size_t& byteSize);
+            void OnFreed(const std::string& tag, const std::size_t& byteSize);
+
+            [[nodiscard]] std::vector<MemoryHeapStats> GetHeapStats() const;
+            [[nodiscard]] std::unordered_map<std::string, std::size_t> GetByteSizesByTag() const;
+
+            // The most used, relative to its budget, device local heap which is past the pressure fraction, if any
+            [[nodiscard]] std::optional<MemoryHeapStats> GetPressuredHeap() const;
+
+        private:
+
+            Global* m_pGlobal;
+
+            uint32_t m_frameIndex{0};
+
+            mutable std::mutex m_tagByteSizesMutex;
+            std::unordered_map<std::string, std::size_t> m_tagByteSizes;
+    };
+}
+
+#endif //WIREDENGINE_WIREDGPUVK_SRC_MEMORYTRACKER_H
@@ -127,7 +127,7 @@ std::expected<VkPipelineLayout, bool> Layouts::GetOrCreatePipelineLayout(const s
             return std::unexpected(false);
         }
 
-        NCommon::HashCombine(hash, NCommon::Hash(hash, pushConstantRange.stageFlags, pushConstantRange.offset, pushConstantRange.stageFlags));
+        NCommon::HashCombine(hash, NCommon::Hash(pushConstantRange.stageFlags, pushConstantRange.offset, pushConstantRange.size));
     }
 
     std::vector<VkDescriptorSetLayout> vkDescriptorSetLayouts;
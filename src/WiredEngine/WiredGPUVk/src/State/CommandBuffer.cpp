@@ -9,12 +9,14 @@
 #include "../Global.h"
 #include "../Usages.h"
 #include "../Buffer/Buffers.h"
-
-#include "../Vulkan/VulkanDebugUtil.h"
+#include "../Buffer/UniformBuffers.h"
 
 #include <NEON/Common/Log/ILogger.h>
 
+#include <algorithm>
+#include <iterator>
 #include <cassert>
+#include <cstring>
 
 namespace Wired::GPU
 {
@@ -326,6 +328,37 @@ BufferBarrierFlags GetDestBufferUsageBarrierFlags(BufferUsageMode usageMode)
     return flags;
 }
 
+bool HasWriteAccess(VkAccessFlags2 accessMask)
+{
+    constexpr VkAccessFlags2 writeAccessMask =
+        VK_ACCESS_2_SHADER_WRITE_BIT |
+        VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT |
+        VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT |
+        VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+        VK_ACCESS_2_TRANSFER_WRITE_BIT |
+        VK_ACCESS_2_HOST_WRITE_BIT |
+        VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+    return (accessMask & writeAccessMask) != 0;
+}
+
+bool RangesOverlap(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b)
+{
+    const auto levelsOverlap = (a.baseMipLevel < b.baseMipLevel + b.levelCount) && (b.baseMipLevel < a.baseMipLevel + a.levelCount);
+    const auto layersOverlap = (a.baseArrayLayer < b.baseArrayLayer + b.layerCount) && (b.baseArrayLayer < a.baseArrayLayer + a.layerCount);
+
+    return ((a.aspectMask & b.aspectMask) != 0) && levelsOverlap && layersOverlap;
+}
+
+bool RangesEqual(const VkImageSubresourceRange& a, const VkImageSubresourceRange& b)
+{
+    return a.aspectMask == b.aspectMask &&
+           a.baseMipLevel == b.baseMipLevel &&
+           a.levelCount == b.levelCount &&
+           a.baseArrayLayer == b.baseArrayLayer &&
+           a.layerCount == b.layerCount;
+}
+
 std::expected<CommandBuffer, bool> CommandBuffer::Create(Global* pGlobal,
                                                          VulkanCommandPool* pVulkanCommandPool,
                                                          CommandBufferType type,
@@ -341,31 +374,12 @@ std::expected<CommandBuffer, bool> CommandBuffer::Create(Global* pGlobal,
         return std::unexpected(false);
     }
 
-    //
-    // Create a fence to track the command buffer's execution
-    //
-    VkFenceCreateInfo vkFenceCreateInfo{};
-    vkFenceCreateInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-
-    VkFence vkFence{VK_NULL_HANDLE};
-
-    if (type == CommandBufferType::Primary)
-    {
-        const auto result = pGlobal->vk.vkCreateFence(pGlobal->device.GetVkDevice(), &vkFenceCreateInfo, nullptr, &vkFence);
-        if (result != VK_SUCCESS)
-        {
-            pGlobal->pLogger->Error("CommandBufferState::Create: vkCreateFence() call failed, error code: {}", (uint32_t) result);
-            return std::unexpected(false);
-        }
-        SetDebugName(pGlobal->vk, pGlobal->device, VK_OBJECT_TYPE_FENCE, (uint64_t) vkFence, std::format("Fence-{}-Finished", tag));
-    }
-
     //
     // Obtain an id and return the created command buffer
     //
     const auto commandBufferId = pGlobal->ids.commandBufferIds.GetId();
 
-    return CommandBuffer(pGlobal, tag, type, commandBufferId, pVulkanCommandPool, *vulkanCommandBuffer, vkFence);
+    return CommandBuffer(pGlobal, tag, type, commandBufferId, pVulkanCommandPool, *vulkanCommandBuffer);
 }
 
 CommandBuffer::CommandBuffer(Global* pGlobal,
@@ -373,15 +387,13 @@ CommandBuffer::CommandBuffer(Global* pGlobal,
                              CommandBufferType type,
                              CommandBufferId commandBufferId,
                              VulkanCommandPool* pVulkanCommandPool,
-                             const VulkanCommandBuffer& vulkanCommandBuffer,
-                             VkFence vkFence)
+                             const VulkanCommandBuffer& vulkanCommandBuffer)
     : m_pGlobal(pGlobal)
     , m_tag(std::move(tag))
     , m_type(type)
     , m_id(commandBufferId)
     , m_pVulkanCommandPool(pVulkanCommandPool)
     , m_vulkanCommandBuffer(vulkanCommandBuffer)
-    , m_vkFence(vkFence)
 {
 
 }
@@ -393,18 +405,10 @@ CommandBuffer::~CommandBuffer()
     m_id = {};
     m_pVulkanCommandPool = nullptr;
     m_vulkanCommandBuffer = {};
-    m_vkFence = VK_NULL_HANDLE;
 }
 
 void CommandBuffer::Destroy()
 {
-    if (m_vkFence != VK_NULL_HANDLE)
-    {
-        RemoveDebugName(m_pGlobal->vk, m_pGlobal->device, VK_OBJECT_TYPE_FENCE, (uint64_t)m_vkFence);
-        m_pGlobal->vk.vkDestroyFence(m_pGlobal->device.GetVkDevice(), m_vkFence, nullptr);
-        m_vkFence = VK_NULL_HANDLE;
-    }
-
     if (m_vulkanCommandBuffer.IsValid())
     {
         m_pVulkanCommandPool->FreeCommandBuffer(m_vulkanCommandBuffer);
@@ -537,6 +541,8 @@ void CommandBuffer::CmdImagePipelineBarrier(const GPUImage& loadedImage,
     const auto sourceFlags = GetSourceImageUsageBarrierFlags(sourceUsageMode);
     const auto destFlags = GetDestImageUsageBarrierFlags(destUsageMode);
 
+    m_pGlobal->pipelineBarrierCount++;
+
     m_vulkanCommandBuffer.CmdPipelineBarrier2(Barrier{
         .imageBarriers = {
             ImageBarrier{
@@ -557,34 +563,284 @@ void CommandBuffer::CmdImagePipelineBarrier(const GPUImage& loadedImage,
     RecordImageUsage(loadedImage.imageData.vkImage);
 }
 
-void CommandBuffer::CmdBufferPipelineBarrier(const GPUBuffer& gpuBuffer,
-                                             const std::size_t& byteOffset,
-                                             const std::size_t& byteSize,
-                                             BufferUsageMode sourceUsageMode,
-                                             BufferUsageMode destUsageMode)
+void CommandBuffer::BarrierImageRangeForUsage(const GPUImage& gpuImage,
+                                              const VkImageSubresourceRange& vkImageSubresourceRange,
+                                              ImageUsageMode destUsageMode)
 {
-    if (sourceUsageMode == destUsageMode) { return; }
+    const auto vkImage = gpuImage.imageData.vkImage;
 
-    const auto sourceFlags = GetSourceBufferUsageBarrierFlags(sourceUsageMode);
-    const auto destFlags = GetDestBufferUsageBarrierFlags(destUsageMode);
+    auto trackedIt = m_trackedImages.find(vkImage);
 
-    m_vulkanCommandBuffer.CmdPipelineBarrier2(Barrier{
-        .imageBarriers = {},
-        .bufferBarriers = {
-            BufferBarrier{
-                .vkBuffer = gpuBuffer.vkBuffer,
-                .byteOffset = byteOffset,
-                .byteSize = byteSize,
-                .srcStageMask = sourceFlags.stageMask,
-                .srcAccessMask = sourceFlags.accessMask,
-                .dstStageMask = destFlags.stageMask,
-                .dstAccessMask = destFlags.accessMask
+    // Fast path for the common case of a resource in its default usage being used in its default usage
+    if ((trackedIt == m_trackedImages.cend() || trackedIt->second.empty()) && (destUsageMode == gpuImage.defaultUsageMode))
+    {
+        return;
+    }
+
+    auto& trackedRanges = m_trackedImages[vkImage];
+
+    //
+    // Any tracked range which partially overlaps the requested range is returned to default usage first, and
+    // flushed, as barriers for overlapping subresources can't be recorded in the same batch
+    //
+    const auto partialOverlap = [&](const TrackedImageRange& trackedRange){
+        return !RangesEqual(trackedRange.vkImageSubresourceRange, vkImageSubresourceRange) &&
+               RangesOverlap(trackedRange.vkImageSubresourceRange, vkImageSubresourceRange);
+    };
+
+    if (std::ranges::any_of(trackedRanges, partialOverlap))
+    {
+        for (const auto& trackedRange : trackedRanges)
+        {
+            if (partialOverlap(trackedRange))
+            {
+                QueueImageRangeBarrier(vkImage, trackedRange, trackedRange.defaultUsageMode);
             }
         }
+
+        std::erase_if(trackedRanges, partialOverlap);
+        FlushBarriers();
+    }
+
+    //
+    // Determine the range's current state; untracked ranges are in their default usage
+    //
+    auto it = std::ranges::find_if(trackedRanges, [&](const TrackedImageRange& trackedRange){
+        return RangesEqual(trackedRange.vkImageSubresourceRange, vkImageSubresourceRange);
     });
 
-    // Record usages
-    RecordBufferUsage(gpuBuffer.vkBuffer);
+    if (it == trackedRanges.end())
+    {
+        if (destUsageMode == gpuImage.defaultUsageMode) { return; }
+
+        const auto defaultFlags = GetSourceImageUsageBarrierFlags(gpuImage.defaultUsageMode);
+        const auto defaultVisibleFlags = GetDestImageUsageBarrierFlags(gpuImage.defaultUsageMode);
+
+        trackedRanges.push_back(TrackedImageRange{
+            .vkImageSubresourceRange = vkImageSubresourceRange,
+            .defaultUsageMode = gpuImage.defaultUsageMode,
+            .usageMode = gpuImage.defaultUsageMode,
+            .stageMask = defaultFlags.stageMask,
+            .accessMask = defaultFlags.accessMask,
+            .visibleStageMask = defaultVisibleFlags.stageMask,
+            .visibleAccessMask = defaultVisibleFlags.accessMask
+        });
+
+        it = std::prev(trackedRanges.end());
+    }
+
+    //
+    // Read-only usages in the same layout, which the range's contents are already visible to, don't need a
+    // barrier between them; just widen the range's scope
+    //
+    const auto destSourceFlags = GetSourceImageUsageBarrierFlags(destUsageMode);
+    const auto destFlags = GetDestImageUsageBarrierFlags(destUsageMode);
+    const auto currentFlags = GetSourceImageUsageBarrierFlags(it->usageMode);
+
+    const bool alreadyVisible =
+        ((destFlags.stageMask & ~it->visibleStageMask) == 0) &&
+        ((destFlags.accessMask & ~it->visibleAccessMask) == 0);
+
+    if ((currentFlags.layout == destFlags.layout) && alreadyVisible && !HasWriteAccess(it->accessMask) && !HasWriteAccess(destFlags.accessMask))
+    {
+        it->usageMode = destUsageMode;
+        it->stageMask |= destSourceFlags.stageMask;
+        it->accessMask |= destSourceFlags.accessMask;
+    }
+    else
+    {
+        QueueImageRangeBarrier(vkImage, *it, destUsageMode);
+
+        it->usageMode = destUsageMode;
+        it->stageMask = destSourceFlags.stageMask;
+        it->accessMask = destSourceFlags.accessMask;
+        it->visibleStageMask = destFlags.stageMask;
+        it->visibleAccessMask = destFlags.accessMask;
+
+        // Barriered back into its default usage, so no longer needs tracking
+        if (it->usageMode == it->defaultUsageMode)
+        {
+            trackedRanges.erase(it);
+        }
+    }
+
+    RecordImageUsage(vkImage);
+}
+
+void CommandBuffer::BarrierBufferRangeForUsage(const GPUBuffer& gpuBuffer,
+                                               const std::size_t& byteOffset,
+                                               const std::size_t& byteSize,
+                                               BufferUsageMode destUsageMode)
+{
+    const auto vkBuffer = gpuBuffer.vkBuffer;
+    const auto defaultUsageMode = gpuBuffer.bufferDef.defaultUsageMode;
+
+    auto trackedIt = m_trackedBuffers.find(vkBuffer);
+
+    // Fast path for the common case of a resource in its default usage being used in its default usage
+    if ((trackedIt == m_trackedBuffers.cend() || trackedIt->second.empty()) && (destUsageMode == defaultUsageMode))
+    {
+        return;
+    }
+
+    auto& trackedRanges = m_trackedBuffers[vkBuffer];
+
+    //
+    // Any tracked range which partially overlaps the requested range is returned to default usage first
+    //
+    const auto partialOverlap = [&](const TrackedBufferRange& trackedRange){
+        const bool sameRange = trackedRange.byteOffset == byteOffset && trackedRange.byteSize == byteSize;
+        const bool overlaps = (trackedRange.byteOffset < byteOffset + byteSize) && (byteOffset < trackedRange.byteOffset + trackedRange.byteSize);
+        return !sameRange && overlaps;
+    };
+
+    if (std::ranges::any_of(trackedRanges, partialOverlap))
+    {
+        for (const auto& trackedRange : trackedRanges)
+        {
+            if (partialOverlap(trackedRange))
+            {
+                QueueBufferRangeBarrier(vkBuffer, trackedRange, trackedRange.defaultUsageMode);
+            }
+        }
+
+        std::erase_if(trackedRanges, partialOverlap);
+        FlushBarriers();
+    }
+
+    //
+    // Determine the range's current state; untracked ranges are in their default usage
+    //
+    auto it = std::ranges::find_if(trackedRanges, [&](const TrackedBufferRange& trackedRange){
+        return trackedRange.byteOffset == byteOffset && trackedRange.byteSize == byteSize;
+    });
+
+    if (it == trackedRanges.end())
+    {
+        if (destUsageMode == defaultUsageMode) { return; }
+
+        const auto defaultFlags = GetSourceBufferUsageBarrierFlags(defaultUsageMode);
+        const auto defaultVisibleFlags = GetDestBufferUsageBarrierFlags(defaultUsageMode);
+
+        trackedRanges.push_back(TrackedBufferRange{
+            .byteOffset = byteOffset,
+            .byteSize = byteSize,
+            .defaultUsageMode = defaultUsageMode,
+            .usageMode = defaultUsageMode,
+            .stageMask = defaultFlags.stageMask,
+            .accessMask = defaultFlags.accessMask,
+            .visibleStageMask = defaultVisibleFlags.stageMask,
+            .visibleAccessMask = defaultVisibleFlags.accessMask
+        });
+
+        it = std::prev(trackedRanges.end());
+    }
+
+    //
+    // Read-only usages which the range's contents are already visible to don't need a barrier between them;
+    // just widen the range's scope
+    //
+    const auto destSourceFlags = GetSourceBufferUsageBarrierFlags(destUsageMode);
+    const auto destFlags = GetDestBufferUsageBarrierFlags(destUsageMode);
+
+    const bool alreadyVisible =
+        ((destFlags.stageMask & ~it->visibleStageMask) == 0) &&
+        ((destFlags.accessMask & ~it->visibleAccessMask) == 0);
+
+    if (alreadyVisible && !HasWriteAccess(it->accessMask) && !HasWriteAccess(destFlags.accessMask))
+    {
+        it->usageMode = destUsageMode;
+        it->stageMask |= destSourceFlags.stageMask;
+        it->accessMask |= destSourceFlags.accessMask;
+    }
+    else
+    {
+        QueueBufferRangeBarrier(vkBuffer, *it, destUsageMode);
+
+        it->usageMode = destUsageMode;
+        it->stageMask = destSourceFlags.stageMask;
+        it->accessMask = destSourceFlags.accessMask;
+        it->visibleStageMask = destFlags.stageMask;
+        it->visibleAccessMask = destFlags.accessMask;
+
+        // Barriered back into its default usage, so no longer needs tracking
+        if (it->usageMode == it->defaultUsageMode)
+        {
+            trackedRanges.erase(it);
+        }
+    }
+
+    RecordBufferUsage(vkBuffer);
+}
+
+void CommandBuffer::BarrierTrackedResourcesToDefaultUsage()
+{
+    for (const auto& it : m_trackedImages)
+    {
+        for (const auto& trackedRange : it.second)
+        {
+            QueueImageRangeBarrier(it.first, trackedRange, trackedRange.defaultUsageMode);
+        }
+    }
+    m_trackedImages.clear();
+
+    for (const auto& it : m_trackedBuffers)
+    {
+        for (const auto& trackedRange : it.second)
+        {
+            QueueBufferRangeBarrier(it.first, trackedRange, trackedRange.defaultUsageMode);
+        }
+    }
+    m_trackedBuffers.clear();
+
+    FlushBarriers();
+}
+
+void CommandBuffer::FlushBarriers()
+{
+    if (m_pendingBarrier.imageBarriers.empty() && m_pendingBarrier.bufferBarriers.empty())
+    {
+        return;
+    }
+
+    m_pGlobal->pipelineBarrierCount += m_pendingBarrier.imageBarriers.size() + m_pendingBarrier.bufferBarriers.size();
+
+    m_vulkanCommandBuffer.CmdPipelineBarrier2(m_pendingBarrier);
+
+    m_pendingBarrier.imageBarriers.clear();
+    m_pendingBarrier.bufferBarriers.clear();
+}
+
+void CommandBuffer::QueueImageRangeBarrier(VkImage vkImage, const TrackedImageRange& trackedRange, ImageUsageMode destUsageMode)
+{
+    const auto sourceFlags = GetSourceImageUsageBarrierFlags(trackedRange.usageMode);
+    const auto destFlags = GetDestImageUsageBarrierFlags(destUsageMode);
+
+    m_pendingBarrier.imageBarriers.push_back(ImageBarrier{
+        .vkImage = vkImage,
+        .subresourceRange = trackedRange.vkImageSubresourceRange,
+        .srcStageMask = trackedRange.stageMask,
+        .srcAccessMask = trackedRange.accessMask,
+        .dstStageMask = destFlags.stageMask,
+        .dstAccessMask = destFlags.accessMask,
+        .oldLayout = sourceFlags.layout,
+        .newLayout = destFlags.layout
+    });
+}
+
+void CommandBuffer::QueueBufferRangeBarrier(VkBuffer vkBuffer, const TrackedBufferRange& trackedRange, BufferUsageMode destUsageMode)
+{
+    const auto destFlags = GetDestBufferUsageBarrierFlags(destUsageMode);
+
+    m_pendingBarrier.bufferBarriers.push_back(BufferBarrier{
+        .vkBuffer = vkBuffer,
+        .byteOffset = trackedRange.byteOffset,
+        .byteSize = trackedRange.byteSize,
+        .srcStageMask = trackedRange.stageMask,
+        .srcAccessMask = trackedRange.accessMask,
+        .dstStageMask = destFlags.stageMask,
+        .dstAccessMask = destFlags.accessMask
+    });
 }
 
 void CommandBuffer::CmdClearColorImage(const GPUImage& loadedImage,
@@ -647,6 +903,15 @@ void CommandBuffer::CmdCopyBufferToImage2(const VkCopyBufferToImageInfo2* pCopyB
     RecordImageUsage(pCopyBufferToImageInfo->dstImage);
 }
 
+void CommandBuffer::CmdCopyImageToBuffer2(const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo)
+{
+    m_vulkanCommandBuffer.CmdCopyImageToBuffer2(pCopyImageToBufferInfo);
+
+    // Record usages
+    RecordImageUsage(pCopyImageToBufferInfo->srcImage);
+    RecordBufferUsage(pCopyImageToBufferInfo->dstBuffer);
+}
+
 void CommandBuffer::CmdBeginRendering(const VkRenderingInfo& vkRenderingInfo,
                                       const std::vector<RenderPassAttachment>& colorAttachments,
                                       const std::optional<RenderPassAttachment>& depthAttachment)
@@ -911,6 +1176,71 @@ bool CommandBuffer::BindImageViewSampler(const std::string& bindPoint, uint32_t
     return true;
 }
 
+std::expected<VkBufferBinding, bool> CommandBuffer::WriteUniformData(const void* pData, const std::size_t& byteSize)
+{
+    auto* pUniformBuffers = m_pGlobal->pUniformBuffers;
+
+    if (byteSize > pUniformBuffers->GetMaxPayloadByteSize())
+    {
+        m_pGlobal->pLogger->Error("CommandBuffer::WriteUniformData: Max uniform byte size is: {}", pUniformBuffers->GetMaxPayloadByteSize());
+        return std::unexpected(false);
+    }
+
+    std::optional<std::size_t> byteOffset;
+    if (m_uniformBlock)
+    {
+        byteOffset = m_uniformBlockAllocator.Allocate(byteSize);
+    }
+
+    //
+    // If the current block doesn't have room for the data, release it and move on to a fresh block. Note that
+    // only the lock-free bump of the block offset happens per uniform write; the uniform buffers system is
+    // only touched once per block.
+    //
+    if (!byteOffset)
+    {
+        if (m_uniformBlock)
+        {
+            pUniformBuffers->ReleaseBlock(*m_uniformBlock);
+            m_uniformBlock = std::nullopt;
+        }
+
+        const auto uniformBlock = pUniformBuffers->AcquireBlock();
+        if (!uniformBlock)
+        {
+            m_pGlobal->pLogger->Error("CommandBuffer::WriteUniformData: Failed to acquire a uniform block");
+            return std::unexpected(false);
+        }
+
+        m_uniformBlock = *uniformBlock;
+        m_uniformBlockAllocator = UniformBlockAllocator(UNIFORM_BLOCK_BYTE_SIZE, pUniformBuffers->GetOffsetAlignment());
+
+        byteOffset = m_uniformBlockAllocator.Allocate(byteSize);
+        if (!byteOffset)
+        {
+            m_pGlobal->pLogger->Error("CommandBuffer::WriteUniformData: Payload doesn't fit in a fresh uniform block");
+            return std::unexpected(false);
+        }
+    }
+
+    //
+    // Write the data into the block
+    //
+    memcpy(m_uniformBlock->pMappedData + *byteOffset, pData, byteSize);
+
+    // No-op for host coherent memory
+    vmaFlushAllocation(m_pGlobal->vma, m_uniformBlock->gpuBuffer.bufferAllocation.vmaAllocation, *byteOffset, byteSize);
+
+    return VkBufferBinding{
+        .gpuBuffer = m_uniformBlock->gpuBuffer,
+        .vkDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
+        .shaderWriteable = false,
+        .byteOffset = 0,
+        .byteSize = byteSize,
+        .dynamicByteOffset = (uint32_t)*byteOffset
+    };
+}
+
 void CommandBuffer::RecordImageUsage(VkImage vkImage)
 {
     if (!m_usedImages.contains(vkImage))
@@ -976,6 +1306,13 @@ void CommandBuffer::RecordSamplerUsage(VkSampler vkSampler)
 
 void CommandBuffer::ReleaseTrackedResources()
 {
+    if (m_uniformBlock)
+    {
+        m_pGlobal->pUniformBuffers->ReleaseBlock(*m_uniformBlock);
+        m_uniformBlock = std::nullopt;
+        m_uniformBlockAllocator.Reset();
+    }
+
     for (const auto& usedImage : m_usedImages)
     {
         m_pGlobal->pUsages->images.DecrementGPUUsage(usedImage);
@@ -1017,6 +1354,12 @@ void CommandBuffer::ReleaseTrackedResources()
         m_pGlobal->pUsages->samplers.DecrementGPUUsage(usedSampler);
     }
     m_usedSamplers.clear();
+
+    // Barrier state only has meaning while recording
+    m_trackedImages.clear();
+    m_trackedBuffers.clear();
+    m_pendingBarrier.imageBarriers.clear();
+    m_pendingBarrier.bufferBarriers.clear();
 }
 
 }
\ No newline at end of file
@@ -11,11 +11,14 @@
 
 #include "../Image/GPUImage.h"
 #include "../Buffer/GPUBuffer.h"
+#include "../Buffer/UniformBuffers.h"
+#include "../Buffer/UniformBlockAllocator.h"
 
 #include "../Vulkan/VulkanCommandPool.h"
 #include "../Vulkan/VulkanPipeline.h"
 
 #include "../Util/RenderPassAttachment.h"
+#include "../Util/SyncPrimitives.h"
 
 #include <Wired/GPU/GPUId.h>
 
@@ -26,6 +29,7 @@
 #include <optional>
 #include <cassert>
 #include <unordered_set>
+#include <unordered_map>
 
 namespace Wired::GPU
 {
@@ -55,8 +59,7 @@ namespace Wired::GPU
                           CommandBufferType type,
                           CommandBufferId commandBufferId,
                           VulkanCommandPool* pVulkanCommandPool,
-                          const VulkanCommandBuffer& vulkanCommandBuffer,
-                          VkFence vkFence);
+                          const VulkanCommandBuffer& vulkanCommandBuffer);
 
             ~CommandBuffer();
 
@@ -67,8 +70,12 @@ namespace Wired::GPU
             [[nodiscard]] CommandBufferId GetId() const noexcept { return m_id; }
             [[nodiscard]] VulkanCommandBuffer& GetVulkanCommandBuffer() { return m_vulkanCommandBuffer; }
 
+            // The command queue timeline value which signals that the command buffer's work has finished. Unset until
+            // the command buffer (or, for a secondary command buffer, the primary which executes it) is submitted.
+            [[nodiscard]] std::optional<uint64_t> GetSubmitTimelineValue() const noexcept { return m_submitTimelineValue; }
+            void SetSubmitTimelineValue(uint64_t timelineValue) { m_submitTimelineValue = timelineValue; }
+
             // Specific to primary command buffers
-            [[nodiscard]] VkFence GetVkFence() const noexcept { assert(m_type == CommandBufferType::Primary); return m_vkFence; }
             void ConfigureForPresentation(SemaphoreOp waitOn, SemaphoreOp signalOn);
             [[nodiscard]] bool IsConfiguredForPresentation() const noexcept { assert(m_type == CommandBufferType::Primary); return m_configuredForPresent; }
             [[nodiscard]] std::vector<SemaphoreOp> GetSignalSemaphores() const noexcept { assert(m_type == CommandBufferType::Primary); return m_signalSemaphores; }
@@ -91,12 +98,12 @@ namespace Wired::GPU
             [[nodiscard]] bool IsInComputePass();
 
             void CmdImagePipelineBarrier(const GPUImage& gpuImage, VkImageSubresourceRange vkImageSubresourceRange, ImageUsageMode sourceUsageMode, ImageUsageMode destUsageMode);
-            void CmdBufferPipelineBarrier(const GPUBuffer& gpuBuffer, const std::size_t& byteOffset, const std::size_t& byteSize, BufferUsageMode sourceUsageMode, BufferUsageMode destUsageMode);
             void CmdClearColorImage(const GPUImage& loadedImage, VkImageLayout imageLayout, const VkClearColorValue* pColor, uint32_t rangeCount, const VkImageSubresourceRange* pRanges);
             void CmdBlitImage(const GPUImage& sourceImage, VkImageLayout sourceImageLayout, const GPUImage& destImage, VkImageLayout destImageLayout, VkImageBlit vkImageBlit, VkFilter vkFilter);
             void CmdExecuteCommands(const std::vector<CommandBuffer*>& secondaryCommandBuffers);
             void CmdCopyBuffer2(const VkCopyBufferInfo2* pCopyBufferInfo);
             void CmdCopyBufferToImage2(const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo);
+            void CmdCopyImageToBuffer2(const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo);
             void CmdBeginRendering(const VkRenderingInfo& vkRenderingInfo, const std::vector<RenderPassAttachment>& colorAttachments, const std::optional<RenderPassAttachment>& depthAttachment);
             void CmdEndRendering();
             void CmdBindPipeline(const VulkanPipeline& vulkanPipeline);
@@ -110,15 +117,62 @@ namespace Wired::GPU
             bool CmdSetDepthTestEnable(bool enable);
             bool CmdSetDepthWriteEnable(bool enable);
 
+            // State tracked barriers. Usage barriers are queued, only issuing the transitions that are actually
+            // required given the resource's last known usage within this command buffer, and are recorded in one
+            // batch by FlushBarriers. Resources stay in their last usage until BarrierTrackedResourcesToDefaultUsage.
+            void BarrierImageRangeForUsage(const GPUImage& gpuImage, const VkImageSubresourceRange& vkImageSubresourceRange, ImageUsageMode destUsageMode);
+            void BarrierBufferRangeForUsage(const GPUBuffer& gpuBuffer, const std::size_t& byteOffset, const std::size_t& byteSize, BufferUsageMode destUsageMode);
+            void BarrierTrackedResourcesToDefaultUsage();
+            void FlushBarriers();
+
             bool BindBuffer(const std::string& bindPoint, const VkBufferBinding& vkBufferBinding);
             bool BindImageView(const std::string& bindPoint, const VkImageViewBinding& vkImageViewBinding);
             bool BindImageViewSampler(const std::string& bindPoint, uint32_t arrayIndex, const VkImageViewSamplerBinding& vkImageViewSamplerBinding);
 
+            // Uniform data
+            [[nodiscard]] std::expected<VkBufferBinding, bool> WriteUniformData(const void* pData, const std::size_t& byteSize);
+
             // Resource tracking
             void ReleaseTrackedResources();
 
         private:
 
+            struct TrackedImageRange
+            {
+                VkImageSubresourceRange vkImageSubresourceRange{};
+                ImageUsageMode defaultUsageMode{};
+                ImageUsageMode usageMode{};
+
+                // Scope of the usages the range has seen since it was last barriered
+                VkPipelineStageFlags2 stageMask{};
+                VkAccessFlags2 accessMask{};
+
+                // Scope that the range's last barrier made its contents visible to
+                VkPipelineStageFlags2 visibleStageMask{};
+                VkAccessFlags2 visibleAccessMask{};
+            };
+
+            struct TrackedBufferRange
+            {
+                std::size_t byteOffset{0};
+                std::size_t byteSize{0};
+                BufferUsageMode defaultUsageMode{};
+                BufferUsageMode usageMode{};
+
+                // Scope of the usages the range has seen since it was last barriered
+                VkPipelineStageFlags2 stageMask{};
+                VkAccessFlags2 accessMask{};
+
+                // Scope that the range's last barrier made its contents visible to
+                VkPipelineStageFlags2 visibleStageMask{};
+                VkAccessFlags2 visibleAccessMask{};
+            };
+
+        private:
+
+            void QueueImageRangeBarrier(VkImage vkImage, const TrackedImageRange& trackedRange, ImageUsageMode destUsageMode);
+            void QueueBufferRangeBarrier(VkBuffer vkBuffer, const TrackedBufferRange& trackedRange, BufferUsageMode destUsageMode);
+
             void RecordImageUsage(VkImage vkImage);
             void RecordImageViewUsage(VkImageView vkImageView);
             void RecordBufferUsage(VkBuffer vkBuffer);
@@ -136,8 +190,9 @@ namespace Wired::GPU
             VulkanCommandPool* m_pVulkanCommandPool;
             VulkanCommandBuffer m_vulkanCommandBuffer;
 
+            std::optional<uint64_t> m_submitTimelineValue;
+
             // Specific to primary command buffers
-            VkFence m_vkFence;
             std::vector<SemaphoreOp> m_signalSemaphores;
             std::vector<SemaphoreOp> m_waitSemaphores;
             bool m_configuredForPresent{false};
@@ -154,6 +209,15 @@ namespace Wired::GPU
             CommandBufferState m_state{CommandBufferState::Default};
 
             std::optional<PassState> m_passState;
+
+            // Resource ranges which aren't in their default usage
+            std::unordered_map<VkImage, std::vector<TrackedImageRange>> m_trackedImages;
+            std::unordered_map<VkBuffer, std::vector<TrackedBufferRange>> m_trackedBuffers;
+            Barrier m_pendingBarrier;
+
+            // The uniform block that uniform data is currently being linearly sub-allocated from
+            std::optional<UniformBlock> m_uniformBlock;
+            UniformBlockAllocator m_uniformBlockAllocator;
     };
 }
 
@@ -7,7 +7,6 @@
 #include "CommandBuffers.h"
 
 #include "../Global.h"
-#include "../Usages.h"
 
 #include "../Vulkan/VulkanCommandPool.h"
 
@@ -93,24 +92,19 @@ void CommandBuffers::RunCleanUp()
 {
     std::lock_guard<std::mutex> lock(m_commandBuffersMutex);
 
+    // One query covers every command buffer; any submitted at or below this value have finished
+    const auto completedTimelineValue = m_pGlobal->commandQueue.GetCompletedTimelineValue();
+
     //
-    // Destroy / clean up any command buffers that are no longer
-    // used and whose work has finished executing
+    // Destroy / clean up any command buffers whose work has finished executing
     //
     std::unordered_set<CommandBufferId> cleanedUpCommandBufferIds;
 
     for (const auto& it : m_commandBuffers)
     {
-        // If something is still using it (e.g. a Frame which has it listed
-        // as an associated command buffer), don't clean it up
-        if (m_pGlobal->pUsages->commandBuffers.GetGPUUsageCount(it.first) > 0)
-        {
-            continue;
-        }
-
-        // If its work hasn't finished executing, don't clean it up
-        const auto fenceStatus = m_pGlobal->vk.vkGetFenceStatus(m_pGlobal->device.GetVkDevice(), it.second->GetVkFence());
-        if (fenceStatus == VK_NOT_READY)
+        // If it hasn't been submitted, or its work hasn't finished executing, don't clean it up
+        const auto submitTimelineValue = it.second->GetSubmitTimelineValue();
+        if (!submitTimelineValue || *submitTimelineValue > completedTimelineValue)
         {
             continue;
         }
@@ -19,7 +19,6 @@ namespace Wired::GPU
         UsageTracker<VkImageView> imageViews;
         UsageTracker<VkBuffer> buffers;
         UsageTracker<VkSampler> samplers;
-        UsageTracker<CommandBufferId> commandBuffers;
         UsageTracker<VkPipeline> pipelines;
         UsageTracker<VkShaderModule> shaders;
         UsageTracker<VkDescriptorSet> descriptorSets;
@@ -30,7 +29,6 @@ namespace Wired::GPU
             imageViews.ForgetZeroCountEntries();
             buffers.ForgetZeroCountEntries();
             samplers.ForgetZeroCountEntries();
-            commandBuffers.ForgetZeroCountEntries();
             pipelines.ForgetZeroCountEntries();
             descriptorSets.ForgetZeroCountEntries();
         }
@@ -41,7 +39,6 @@ namespace Wired::GPU
             imageViews.Reset();
             buffers.Reset();
             samplers.Reset();
-            commandBuffers.Reset();
             pipelines.Reset();
             descriptorSets.Reset();
         }
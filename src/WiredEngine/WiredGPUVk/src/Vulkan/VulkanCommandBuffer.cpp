@@ -161,6 +161,11 @@ void VulkanCommandBuffer::CmdCopyBufferToImage2(const VkCopyBufferToImageInfo2*
     m_pGlobal->vk.vkCmdCopyBufferToImage2(m_vkCommandBuffer, pCopyBufferToImageInfo);
 }
 
+void VulkanCommandBuffer::CmdCopyImageToBuffer2(const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) const
+{
+    m_pGlobal->vk.vkCmdCopyImageToBuffer2(m_vkCommandBuffer, pCopyImageToBufferInfo);
+}
+
 void VulkanCommandBuffer::CmdBeginRendering(const VkRenderingInfo& vkRenderingInfo) const
 {
     m_pGlobal->vk.vkCmdBeginRendering(m_vkCommandBuffer, &vkRenderingInfo);
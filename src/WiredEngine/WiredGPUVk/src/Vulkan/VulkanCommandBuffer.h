@@ -55,6 +55,7 @@ namespace Wired::GPU
             void CmdExecuteCommands(const std::vector<VulkanCommandBuffer>& commands) const;
             void CmdCopyBuffer2(const VkCopyBufferInfo2* pCopyBufferInfo) const;
             void CmdCopyBufferToImage2(const VkCopyBufferToImageInfo2* pCopyBufferToImageInfo) const;
+            void CmdCopyImageToBuffer2(const VkCopyImageToBufferInfo2* pCopyImageToBufferInfo) const;
             void CmdBeginRendering(const VkRenderingInfo& vkRenderingInfo) const;
             void CmdEndRendering();
             void CmdBindPipeline(VkPipelineBindPoint pipelineBindPoint, VkPipeline pipeline) const;
@@ -107,6 +107,14 @@ std::expected<DeviceCreateResult, bool> VulkanDevice::Create(Global* pGlobal)
         extensions.emplace_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
     }
 
+    // If available, lets VMA report the driver's actual per-heap budgets and usage, rather than estimates
+    const bool memoryBudgetEnabled = physicalDevice.SupportsDeviceExtension(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME, 1);
+    if (memoryBudgetEnabled)
+    {
+        pGlobal->pLogger->Info("VulkanDevice::Create: Enabling optional {} device extension", VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+        extensions.emplace_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+    }
+
     std::vector<const char*> extensionsCStrs;
     std::ranges::transform(extensions, std::back_inserter(extensionsCStrs), std::mem_fn(&std::string::c_str));
 
@@ -151,10 +159,11 @@ std::expected<DeviceCreateResult, bool> VulkanDevice::Create(Global* pGlobal)
     synchronization2Features.synchronization2 = VK_TRUE;
     synchronization2Features.pNext = &dynamicRenderingFeatures;
 
-    // drawIndirectCount feature
+    // drawIndirectCount and timelineSemaphore features
     VkPhysicalDeviceVulkan12Features vulkan12Features{};
     vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
     vulkan12Features.drawIndirectCount = VK_TRUE;
+    vulkan12Features.timelineSemaphore = VK_TRUE;
     vulkan12Features.runtimeDescriptorArray = VK_TRUE;
     vulkan12Features.descriptorBindingVariableDescriptorCount = VK_TRUE;
     vulkan12Features.descriptorBindingPartiallyBound = VK_TRUE;
@@ -201,6 +210,7 @@ std::expected<DeviceCreateResult, bool> VulkanDevice::Create(Global* pGlobal)
 
     pGlobal->vk.vkGetDeviceQueue(vkDevice, *uberQueueFamilyIndex, 0, &result.vkCommandQueue);
     result.commandQueueFamilyIndex = *uberQueueFamilyIndex;
+    result.memoryBudgetEnabled = memoryBudgetEnabled;
 
     if (presentQueueFamilyIndex)
     {
@@ -28,6 +28,8 @@ namespace Wired::GPU
 
         std::optional<VkQueue> vkPresentQueue;
         std::optional<uint32_t> presentQueueFamilyIndex{0};
+
+        bool memoryBudgetEnabled{false};
     };
 
     class VulkanDevice
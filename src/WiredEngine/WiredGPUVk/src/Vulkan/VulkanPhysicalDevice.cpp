@@ -113,6 +113,12 @@ bool IsSuitableDevice(Global* pGlobal, const std::optional<VulkanSurface>& surfa
         return false;
     }
 
+    if (!vkPhysicalDeviceVulkan12Features.timelineSemaphore)
+    {
+        pGlobal->pLogger->Info("IsSuitableDevice: Rejecting device due to missing timelineSemaphore feature: {}", vkPhysicalDeviceProperties.deviceName);
+        return false;
+    }
+
     if (!vkPhysicalDeviceVulkan13Features.dynamicRendering)
     {
         pGlobal->pLogger->Info("IsSuitableDevice: Rejecting device due to missing dynamicRendering feature: {}", vkPhysicalDeviceProperties.deviceName);
@@ -16,18 +16,41 @@
 namespace Wired::GPU
 {
 
-VulkanQueue VulkanQueue::CreateFrom(Global* pGlobal, VkQueue vkQueue, uint32_t queueFamilyIndex, const std::string& tag)
+std::expected<VulkanQueue, bool> VulkanQueue::CreateFrom(Global* pGlobal, VkQueue vkQueue, uint32_t queueFamilyIndex, const std::string& tag)
 {
     SetDebugName(pGlobal->vk, pGlobal->device, VK_OBJECT_TYPE_QUEUE, (uint64_t)vkQueue, std::format("Queue-{}", tag));
 
-    return {pGlobal, vkQueue, queueFamilyIndex, tag};
+    //
+    // Create a timeline semaphore to track the completion of work submitted to the queue
+    //
+    VkSemaphoreTypeCreateInfo vkSemaphoreTypeCreateInfo{};
+    vkSemaphoreTypeCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    vkSemaphoreTypeCreateInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    vkSemaphoreTypeCreateInfo.initialValue = 0;
+
+    VkSemaphoreCreateInfo vkSemaphoreCreateInfo{};
+    vkSemaphoreCreateInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    vkSemaphoreCreateInfo.pNext = &vkSemaphoreTypeCreateInfo;
+
+    VkSemaphore vkTimelineSemaphore{VK_NULL_HANDLE};
+
+    const auto result = pGlobal->vk.vkCreateSemaphore(pGlobal->device.GetVkDevice(), &vkSemaphoreCreateInfo, nullptr, &vkTimelineSemaphore);
+    if (result != VK_SUCCESS)
+    {
+        pGlobal->pLogger->Error("VulkanQueue::CreateFrom: vkCreateSemaphore() call failed, error code: {}", (uint32_t)result);
+        return std::unexpected(false);
+    }
+    SetDebugName(pGlobal->vk, pGlobal->device, VK_OBJECT_TYPE_SEMAPHORE, (uint64_t)vkTimelineSemaphore, std::format("Semaphore-Queue-{}-Timeline", tag));
+
+    return VulkanQueue(pGlobal, vkQueue, queueFamilyIndex, tag, vkTimelineSemaphore);
 }
 
-VulkanQueue::VulkanQueue(Global* pGlobal, VkQueue vkQueue,  uint32_t queueFamilyIndex, std::string tag)
+VulkanQueue::VulkanQueue(Global* pGlobal, VkQueue vkQueue,  uint32_t queueFamilyIndex, std::string tag, VkSemaphore vkTimelineSemaphore)
     : m_pGlobal(pGlobal)
     , m_vkQueue(vkQueue)
     , m_queueFamilyIndex(queueFamilyIndex)
     , m_tag(std::move(tag))
+    , m_vkTimelineSemaphore(vkTimelineSemaphore)
 {
 
 }
@@ -38,67 +61,137 @@ VulkanQueue::~VulkanQueue()
     m_vkQueue = VK_NULL_HANDLE;
     m_queueFamilyIndex = 0;
     m_tag = {};
+    m_vkTimelineSemaphore = VK_NULL_HANDLE;
+    m_lastSubmittedTimelineValue = 0;
 }
 
 void VulkanQueue::Destroy()
 {
+    if (m_vkTimelineSemaphore != VK_NULL_HANDLE)
+    {
+        RemoveDebugName(m_pGlobal->vk, m_pGlobal->device, VK_OBJECT_TYPE_SEMAPHORE, (uint64_t)m_vkTimelineSemaphore);
+        m_pGlobal->vk.vkDestroySemaphore(m_pGlobal->device.GetVkDevice(), m_vkTimelineSemaphore, nullptr);
+        m_vkTimelineSemaphore = VK_NULL_HANDLE;
+    }
+
     if (m_vkQueue != VK_NULL_HANDLE)
     {
         RemoveDebugName(m_pGlobal->vk, m_pGlobal->device, VK_OBJECT_TYPE_QUEUE, (uint64_t) m_vkQueue);
     }
 }
 
-bool VulkanQueue::SubmitBatch(const std::vector<VulkanCommandBuffer>& commandBuffers,
-                              const WaitOn& waitOn,
-                              const SignalOn& signalOn,
-                              const std::optional<VkFence>& vkFence,
-                              const std::string& submitTag)
+static VkSemaphoreSubmitInfo ToSemaphoreSubmitInfo(const SemaphoreOp& semaphoreOp)
+{
+    VkSemaphoreSubmitInfo submitInfo{};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+    submitInfo.semaphore = semaphoreOp.semaphore;
+    submitInfo.stageMask = semaphoreOp.stageMask;
+    return submitInfo;
+}
+
+std::expected<uint64_t, bool> VulkanQueue::Submit(const std::vector<QueueSubmission>& submissions, const std::string& submitTag)
 {
     QueueSectionLabel submitSection(m_pGlobal, m_vkQueue, std::format("Submit-{}", submitTag));
 
-    std::vector<VkSemaphoreSubmitInfo> semaphoreWaits;
-    std::ranges::transform(waitOn.semaphores, std::back_inserter(semaphoreWaits), [](const SemaphoreOp& semaphoreOp){
-        VkSemaphoreSubmitInfo submitInfo{};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-        submitInfo.semaphore = semaphoreOp.semaphore;
-        submitInfo.stageMask = semaphoreOp.stageMask;
-        return submitInfo;
-    });
-
-    std::vector<VkSemaphoreSubmitInfo> semaphoreSignals;
-    std::ranges::transform(signalOn.semaphores, std::back_inserter(semaphoreSignals), [](const SemaphoreOp& semaphoreOp){
-        VkSemaphoreSubmitInfo submitInfo{};
-        submitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
-        submitInfo.semaphore = semaphoreOp.semaphore;
-        submitInfo.stageMask = semaphoreOp.stageMask;
-        return submitInfo;
-    });
-
-    std::vector<VkCommandBufferSubmitInfo> bufferSubmits;
-    std::ranges::transform(commandBuffers, std::back_inserter(bufferSubmits), [](const auto& commandBuffer){
+    //
+    // Group the submissions into batches. Waits apply to every command buffer in a batch, so a command buffer
+    // with waits starts a new batch, and signals fire after every command buffer in a batch, so a command
+    // buffer with signals ends its batch.
+    //
+    struct Batch
+    {
+        std::vector<VkSemaphoreSubmitInfo> semaphoreWaits;
+        std::vector<VkSemaphoreSubmitInfo> semaphoreSignals;
+        std::vector<VkCommandBufferSubmitInfo> bufferSubmits;
+    };
+
+    std::vector<Batch> batches;
+    bool batchClosed = true;
+
+    for (const auto& submission : submissions)
+    {
+        if (batchClosed || !submission.waitSemaphores.empty())
+        {
+            batches.emplace_back();
+            batchClosed = false;
+        }
+
+        auto& batch = batches.back();
+
+        std::ranges::transform(submission.waitSemaphores, std::back_inserter(batch.semaphoreWaits), ToSemaphoreSubmitInfo);
+        std::ranges::transform(submission.signalSemaphores, std::back_inserter(batch.semaphoreSignals), ToSemaphoreSubmitInfo);
+
         VkCommandBufferSubmitInfo bufferSubmit{};
         bufferSubmit.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
-        bufferSubmit.commandBuffer = commandBuffer.GetVkCommandBuffer();
-        return bufferSubmit;
-    });
-
-    VkSubmitInfo2 submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
-    submitInfo.waitSemaphoreInfoCount = (uint32_t)semaphoreWaits.size();
-    submitInfo.pWaitSemaphoreInfos = semaphoreWaits.data();
-    submitInfo.signalSemaphoreInfoCount = (uint32_t)semaphoreSignals.size();
-    submitInfo.pSignalSemaphoreInfos = semaphoreSignals.data();
-    submitInfo.commandBufferInfoCount = (uint32_t)bufferSubmits.size();
-    submitInfo.pCommandBufferInfos = bufferSubmits.data();
-
-    const auto result = m_pGlobal->vk.vkQueueSubmit2(m_vkQueue, 1U, &submitInfo, vkFence ? *vkFence : VK_NULL_HANDLE);
+        bufferSubmit.commandBuffer = submission.commandBuffer.GetVkCommandBuffer();
+        batch.bufferSubmits.push_back(bufferSubmit);
+
+        batchClosed = !submission.signalSemaphores.empty();
+    }
+
+    if (batches.empty())
+    {
+        batches.emplace_back();
+    }
+
+    //
+    // The last batch signals the timeline. Semaphore signals cover all work submitted earlier in
+    // submission order, so that one signal covers the work of every batch.
+    //
+    const uint64_t timelineValue = m_lastSubmittedTimelineValue + 1;
+
+    VkSemaphoreSubmitInfo timelineSignal{};
+    timelineSignal.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+    timelineSignal.semaphore = m_vkTimelineSemaphore;
+    timelineSignal.value = timelineValue;
+    timelineSignal.stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    batches.back().semaphoreSignals.push_back(timelineSignal);
+
+    std::vector<VkSubmitInfo2> submitInfos;
+    submitInfos.reserve(batches.size());
+
+    for (const auto& batch : batches)
+    {
+        VkSubmitInfo2 submitInfo{};
+        submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+        submitInfo.waitSemaphoreInfoCount = (uint32_t)batch.semaphoreWaits.size();
+        submitInfo.pWaitSemaphoreInfos = batch.semaphoreWaits.data();
+        submitInfo.signalSemaphoreInfoCount = (uint32_t)batch.semaphoreSignals.size();
+        submitInfo.pSignalSemaphoreInfos = batch.semaphoreSignals.data();
+        submitInfo.commandBufferInfoCount = (uint32_t)batch.bufferSubmits.size();
+        submitInfo.pCommandBufferInfos = batch.bufferSubmits.data();
+        submitInfos.push_back(submitInfo);
+    }
+
+    const auto result = m_pGlobal->vk.vkQueueSubmit2(m_vkQueue, (uint32_t)submitInfos.size(), submitInfos.data(), VK_NULL_HANDLE);
     if (result != VK_SUCCESS)
     {
         m_pGlobal->pLogger->Error("VulkanQueue::Submit: Failed to submit command buffer(s) to queue: {}, for submit: {}", m_tag, submitTag);
-        return false;
+        return std::unexpected(false);
     }
 
-    return true;
+    m_lastSubmittedTimelineValue = timelineValue;
+    m_pGlobal->queueSubmitCount++;
+
+    return timelineValue;
+}
+
+uint64_t VulkanQueue::GetCompletedTimelineValue() const
+{
+    uint64_t value{0};
+    (void)m_pGlobal->vk.vkGetSemaphoreCounterValue(m_pGlobal->device.GetVkDevice(), m_vkTimelineSemaphore, &value);
+    return value;
+}
+
+void VulkanQueue::WaitForTimelineValue(uint64_t timelineValue) const
+{
+    VkSemaphoreWaitInfo vkSemaphoreWaitInfo{};
+    vkSemaphoreWaitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    vkSemaphoreWaitInfo.semaphoreCount = 1;
+    vkSemaphoreWaitInfo.pSemaphores = &m_vkTimelineSemaphore;
+    vkSemaphoreWaitInfo.pValues = &timelineValue;
+
+    (void)m_pGlobal->vk.vkWaitSemaphores(m_pGlobal->device.GetVkDevice(), &vkSemaphoreWaitInfo, UINT64_MAX);
 }
 
 }
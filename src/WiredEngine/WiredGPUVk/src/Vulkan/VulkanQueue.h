@@ -14,26 +14,42 @@
 #include <vulkan/vulkan.h>
 
 #include <vector>
-#include <optional>
 #include <string>
+#include <expected>
+#include <cstdint>
 
 namespace Wired::GPU
 {
     struct Global;
 
+    /**
+     * A primary command buffer to be submitted, along with the semaphores its work waits on and signals
+     */
+    struct QueueSubmission
+    {
+        VulkanCommandBuffer commandBuffer{};
+        std::vector<SemaphoreOp> waitSemaphores;
+        std::vector<SemaphoreOp> signalSemaphores;
+    };
+
+    /**
+     * Wraps a VkQueue, along with a timeline semaphore which tracks the completion of the work
+     * submitted to it. Every submit signals the next value of the timeline, so a submit's work is
+     * finished once the timeline's counter has reached the value that the submit returned.
+     */
     class VulkanQueue
     {
         public:
 
-            [[nodiscard]] static VulkanQueue CreateFrom(Global* pGlobal,
-                                                        VkQueue vkQueue,
-                                                        uint32_t queueFamilyIndex,
-                                                        const std::string& tag);
+            [[nodiscard]] static std::expected<VulkanQueue, bool> CreateFrom(Global* pGlobal,
+                                                                              VkQueue vkQueue,
+                                                                              uint32_t queueFamilyIndex,
+                                                                              const std::string& tag);
 
         public:
 
             VulkanQueue() = default;
-            VulkanQueue(Global* pGlobal, VkQueue vkQueue, uint32_t queueFamilyIndex, std::string tag);
+            VulkanQueue(Global* pGlobal, VkQueue vkQueue, uint32_t queueFamilyIndex, std::string tag, VkSemaphore vkTimelineSemaphore);
             ~VulkanQueue();
 
             void Destroy();
@@ -41,11 +57,28 @@ namespace Wired::GPU
             [[nodiscard]] VkQueue GetVkQueue() const noexcept { return m_vkQueue; }
             [[nodiscard]] uint32_t GetQueueFamilyIndex() const noexcept { return m_queueFamilyIndex; }
 
-            [[nodiscard]] bool SubmitBatch(const std::vector<VulkanCommandBuffer>& commandBuffers,
-                                           const WaitOn& waitOn,
-                                           const SignalOn& signalOn,
-                                           const std::optional<VkFence>& vkFence,
-                                           const std::string& submitTag);
+            /**
+             * Submits the provided command buffers, in order, with one vkQueueSubmit2 call. Consecutive
+             * command buffers are coalesced into the same batch wherever their semaphores allow it.
+             *
+             * @return The timeline value that will be signaled once all the submitted work has finished
+             */
+            [[nodiscard]] std::expected<uint64_t, bool> Submit(const std::vector<QueueSubmission>& submissions, const std::string& submitTag);
+
+            /**
+             * @return The highest timeline value which the GPU has finished the work for
+             */
+            [[nodiscard]] uint64_t GetCompletedTimelineValue() const;
+
+            /**
+             * @return The timeline value which will be signaled once all the work submitted so far has finished
+             */
+            [[nodiscard]] uint64_t GetLastSubmittedTimelineValue() const noexcept { return m_lastSubmittedTimelineValue; }
+
+            /**
+             * Blocks until the GPU has finished the work for the provided timeline value
+             */
+            void WaitForTimelineValue(uint64_t timelineValue) const;
 
         private:
 
@@ -53,6 +86,9 @@ namespace Wired::GPU
             VkQueue m_vkQueue{VK_NULL_HANDLE};
             uint32_t m_queueFamilyIndex{0};
             std::string m_tag;
+
+            VkSemaphore m_vkTimelineSemaphore{VK_NULL_HANDLE};
+            uint64_t m_lastSubmittedTimelineValue{0};
     };
 }
 
@@ -105,8 +105,11 @@ namespace Wired::GPU
         PFN_vkCmdBeginDebugUtilsLabelEXT vkCmdBeginDebugUtilsLabelEXT{nullptr};
         PFN_vkCmdEndDebugUtilsLabelEXT vkCmdEndDebugUtilsLabelEXT{nullptr};
         PFN_vkGetFenceStatus vkGetFenceStatus{nullptr};
+        PFN_vkWaitSemaphores vkWaitSemaphores{nullptr};
+        PFN_vkGetSemaphoreCounterValue vkGetSemaphoreCounterValue{nullptr};
         PFN_vkCmdBlitImage vkCmdBlitImage{nullptr};
         PFN_vkCmdCopyBufferToImage2 vkCmdCopyBufferToImage2{nullptr};
+        PFN_vkCmdCopyImageToBuffer2 vkCmdCopyImageToBuffer2{nullptr};
         PFN_vkCreateShaderModule vkCreateShaderModule{nullptr};
         PFN_vkDestroyShaderModule vkDestroyShaderModule{nullptr};
         PFN_vkCmdBeginRendering vkCmdBeginRendering{nullptr};
@@ -122,8 +122,11 @@ bool ResolveDeviceCalls(VulkanCalls& vulkanCalls, VkDevice vkDevice)
     FIND_DEVICE_CALL_REQ(vkCmdPipelineBarrier2)
     FIND_DEVICE_CALL_REQ(vkCmdExecuteCommands)
     FIND_DEVICE_CALL_REQ(vkGetFenceStatus)
+    FIND_DEVICE_CALL_REQ(vkWaitSemaphores)
+    FIND_DEVICE_CALL_REQ(vkGetSemaphoreCounterValue)
     FIND_DEVICE_CALL_REQ(vkCmdBlitImage)
     FIND_DEVICE_CALL_REQ(vkCmdCopyBufferToImage2)
+    FIND_DEVICE_CALL_REQ(vkCmdCopyImageToBuffer2)
     FIND_DEVICE_CALL_REQ(vkCreateShaderModule)
     FIND_DEVICE_CALL_REQ(vkDestroyShaderModule)
     FIND_DEVICE_CALL_REQ(vkCmdBeginRendering)
@@ -9,6 +9,7 @@
 #include "VulkanCallsUtil.h"
 #include "Common.h"
 #include "Usages.h"
+#include "MemoryTracker.h"
 
 #include "Frame/Frames.h"
 #include "State/CommandBuffers.h"
@@ -36,6 +37,7 @@
 #endif
 
 #include <algorithm>
+#include <limits>
 
 namespace Wired::GPU
 {
@@ -53,6 +55,7 @@ WiredGPUVkImpl::WiredGPUVkImpl(const NCommon::ILogger* pLogger, WiredGPUVkInput
     , m_pipelines(std::make_unique<VkPipelines>(m_global.get()))
     , m_uniformBuffers(std::make_unique<UniformBuffers>(m_global.get()))
     , m_usages(std::make_unique<Usages>())
+    , m_memoryTracker(std::make_unique<MemoryTracker>(m_global.get()))
 {
     m_global->pLogger = pLogger;
     m_global->pCommandBuffers = m_commandBuffers.get();
@@ -64,6 +67,7 @@ WiredGPUVkImpl::WiredGPUVkImpl(const NCommon::ILogger* pLogger, WiredGPUVkInput
     m_global->pPipelines = m_pipelines.get();
     m_global->pUniformBuffers = m_uniformBuffers.get();
     m_global->pUsages = m_usages.get();
+    m_global->pMemoryTracker = m_memoryTracker.get();
 }
 
 WiredGPUVkImpl::~WiredGPUVkImpl() = default;
@@ -201,11 +205,25 @@ bool WiredGPUVkImpl::StartUp(const std::optional<const SurfaceDetails*>& surface
         return false;
     }
     m_global->device = VulkanDevice(m_global.get(), deviceResult->vkDevice);
+    m_global->memoryBudgetEnabled = deviceResult->memoryBudgetEnabled;
+
+    const auto commandQueue = VulkanQueue::CreateFrom(m_global.get(), deviceResult->vkCommandQueue, deviceResult->commandQueueFamilyIndex, "Commands");
+    if (!commandQueue)
+    {
+        m_global->pLogger->Fatal("WiredGPUVkImpl::StartUp: Failed to create the command queue");
+        return false;
+    }
+    m_global->commandQueue = *commandQueue;
 
-    m_global->commandQueue = VulkanQueue::CreateFrom(m_global.get(), deviceResult->vkCommandQueue, deviceResult->commandQueueFamilyIndex, "Commands");
     if (deviceResult->vkPresentQueue)
     {
-        m_global->presentQueue = VulkanQueue::CreateFrom(m_global.get(), *deviceResult->vkPresentQueue, *deviceResult->presentQueueFamilyIndex, "Present");
+        const auto presentQueue = VulkanQueue::CreateFrom(m_global.get(), *deviceResult->vkPresentQueue, *deviceResult->presentQueueFamilyIndex, "Present");
+        if (!presentQueue)
+        {
+            m_global->pLogger->Fatal("WiredGPUVkImpl::StartUp: Failed to create the present queue");
+            return false;
+        }
+        m_global->presentQueue = *presentQueue;
     }
 
     //
@@ -235,6 +253,11 @@ bool WiredGPUVkImpl::StartUp(const std::optional<const SurfaceDetails*>& surface
     vmaCreateInfo.pVulkanFunctions = &vmaFunctions;
     vmaCreateInfo.flags = 0;
 
+    if (m_global->memoryBudgetEnabled)
+    {
+        vmaCreateInfo.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    }
+
     VmaAllocator vmaAllocator{VK_NULL_HANDLE};
 
     auto result = vmaCreateAllocator(&vmaCreateInfo, &vmaAllocator);
@@ -323,6 +346,13 @@ void WiredGPUVkImpl::ShutDown()
     m_commandPools.clear();
 
     m_usages->Reset();
+    m_memoryTracker->Reset();
+
+    {
+        std::lock_guard<std::mutex> lock(m_memoryPressureMutex);
+        m_memoryPressureCallback = nullptr;
+        m_memoryPressureCooldown = 0;
+    }
 
     //
     // Destroy StartUp framework
@@ -488,10 +518,75 @@ void WiredGPUVkImpl::StartFrame()
     RunCleanUp(false);
 
     m_frames->StartFrame();
+
+    // The frame's previous work has finished, so its transient descriptor sets can be reclaimed
+    {
+        const auto frameIndex = m_frames->GetCurrentFrame().GetFrameIndex();
+
+        std::lock_guard<std::mutex> lock(m_descriptorSetsMutex);
+        for (auto& descriptorSets : m_descriptorSets)
+        {
+            descriptorSets.second->OnFrameStarted(frameIndex);
+        }
+    }
+
+    m_memoryTracker->OnFrameStarted();
+    CheckMemoryPressure();
+}
+
+void WiredGPUVkImpl::CheckMemoryPressure()
+{
+    MemoryPressureCallback callback;
+
+    {
+        std::lock_guard<std::mutex> lock(m_memoryPressureMutex);
+
+        if (m_memoryPressureCooldown > 0)
+        {
+            m_memoryPressureCooldown--;
+            return;
+        }
+
+        callback = m_memoryPressureCallback;
+    }
+
+    const auto pressuredHeap = m_memoryTracker->GetPressuredHeap();
+    if (!pressuredHeap)
+    {
+        return;
+    }
+
+    m_global->pLogger->Warning("WiredGPUVkImpl::CheckMemoryPressure: Heap {} is using {} of its {} byte budget",
+        pressuredHeap->heapIndex, pressuredHeap->usageByteSize, pressuredHeap->budgetByteSize);
+
+    // Release the memory we own that nothing needs, before asking the client to release theirs
+    m_buffers->TrimCycledCopies();
+
+    if (callback)
+    {
+        callback(MemoryPressure{.heapStats = *pressuredHeap});
+    }
+
+    // Give released memory a chance to be freed and reflected in the budget before reporting again
+    std::lock_guard<std::mutex> lock(m_memoryPressureMutex);
+    m_memoryPressureCooldown = MEMORY_PRESSURE_COOLDOWN_FRAMES;
+}
+
+void WiredGPUVkImpl::SetMemoryPressureCallback(MemoryPressureCallback callback)
+{
+    std::lock_guard<std::mutex> lock(m_memoryPressureMutex);
+
+    m_memoryPressureCallback = std::move(callback);
 }
 
 void WiredGPUVkImpl::EndFrame()
 {
+    // Submit any of the frame's work which hasn't been submitted yet
+    if (m_frames->GetCurrentFrame().IsActiveState())
+    {
+        (void)FlushQueuedSubmits();
+    }
+
     m_frames->EndFrame();
 }
 
@@ -523,6 +618,9 @@ bool WiredGPUVkImpl::EndCopyPass(CopyPass copyPass)
         return false;
     }
 
+    // Return resources the copy pass used to their default usage
+    (*commandBuffer)->BarrierTrackedResourcesToDefaultUsage();
+
     // Finish command buffer section for the copy pass
     EndCommandBufferSection(m_global.get(), (*commandBuffer)->GetVulkanCommandBuffer().GetVkCommandBuffer());
 
@@ -732,6 +830,8 @@ std::expected<RenderPass, bool> WiredGPUVkImpl::BeginRenderPass(CommandBufferId
         );
     }
 
+    (*commandBuffer)->FlushBarriers();
+
     //
     // Begin dynamic rendering
     //
@@ -769,34 +869,12 @@ bool WiredGPUVkImpl::EndRenderPass(RenderPass renderPass)
         return false;
     }
 
-    const auto& renderPassState = (*commandBuffer)->GetPassState();
-    const auto renderPassColorAttachments = renderPassState->renderPassColorAttachments;
-    const auto renderPassDepthAttachment = renderPassState->renderPassDepthAttachment;
-
     (*commandBuffer)->CmdEndRendering();
 
     //
-    // Barrier attachments to default usage
+    // Barrier attachments, and any resources the pass's draws used, back to default usage
     //
-    for (const auto& colorRenderPassAttachment : renderPassColorAttachments)
-    {
-        m_images->BarrierImageRangeToDefaultUsage(
-            *commandBuffer,
-            colorRenderPassAttachment.gpuImage,
-            colorRenderPassAttachment.vkImageSubresourceRange,
-            ImageUsageMode::ColorAttachment
-        );
-    }
-
-    if (renderPassDepthAttachment)
-    {
-        m_images->BarrierImageRangeToDefaultUsage(
-            *commandBuffer,
-            renderPassDepthAttachment->gpuImage,
-            renderPassDepthAttachment->vkImageSubresourceRange,
-            ImageUsageMode::DepthAttachment
-        );
-    }
+    (*commandBuffer)->BarrierTrackedResourcesToDefaultUsage();
 
     const auto result = (*commandBuffer)->EndRenderPass();
 
@@ -854,6 +932,9 @@ bool WiredGPUVkImpl::EndComputePass(ComputePass computePass)
         return false;
     }
 
+    // Return resources the compute pass's dispatches used to their default usage
+    (*commandBuffer)->BarrierTrackedResourcesToDefaultUsage();
+
     // Finish command buffer section for the compute pass
     EndCommandBufferSection(m_global.get(), (*commandBuffer)->GetVulkanCommandBuffer().GetVkCommandBuffer());
 
@@ -1076,6 +1157,11 @@ void WiredGPUVkImpl::DestroyBuffer(BufferId bufferId)
     m_buffers->DestroyBuffer(bufferId, false);
 }
 
+bool WiredGPUVkImpl::IsBufferInUse(BufferId bufferId)
+{
+    return m_buffers->IsBufferInUse(bufferId);
+}
+
 std::expected<SamplerId, bool> WiredGPUVkImpl::CreateSampler(const SamplerInfo& samplerInfo, const std::string& tag)
 {
     return m_samplers->CreateSampler(samplerInfo, tag);
@@ -1116,15 +1202,6 @@ std::expected<CommandBufferId, bool> WiredGPUVkImpl::AcquireCommandBuffer(bool p
     //
     (*commandBuffer)->GetVulkanCommandBuffer().Begin(VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT);
 
-    //
-    // If there's an active frame, associate the command buffer with it
-    //
-    auto& currentFrame = m_frames->GetCurrentFrame();
-    if (currentFrame.IsActiveState())
-    {
-        currentFrame.AssociateCommandBuffer(commandBufferId);
-    }
-
     return commandBufferId;
 }
 
@@ -1192,11 +1269,10 @@ bool WiredGPUVkImpl::CmdClearColorImage(CopyPass copyPass,
     };
 
     m_images->BarrierImageRangeForUsage(*commandBuffer, *gpuImage, vkImageSubresourceRange, ImageUsageMode::TransferDst);
+    (*commandBuffer)->FlushBarriers();
 
         (*commandBuffer)->CmdClearColorImage(*gpuImage, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, &vkClearColorValue, 1, &vkImageSubresourceRange);
 
-    m_images->BarrierImageRangeToDefaultUsage(*commandBuffer, *gpuImage, vkImageSubresourceRange, ImageUsageMode::TransferDst);
-
     return true;
 }
 
@@ -1301,6 +1377,7 @@ bool WiredGPUVkImpl::CmdBlitImage(CopyPass copyPass,
     //
     m_images->BarrierImageRangeForUsage(*commandBuffer, *sourceGpuImage, vkSourceSubresourceRange, ImageUsageMode::TransferSrc);
     m_images->BarrierImageRangeForUsage(*commandBuffer, *destGpuImage, vkDestSubresourceRange, ImageUsageMode::TransferDst);
+    (*commandBuffer)->FlushBarriers();
 
         const VkImageBlit vkImageBlit{
             .srcSubresource = {
@@ -1328,20 +1405,17 @@ bool WiredGPUVkImpl::CmdBlitImage(CopyPass copyPass,
             vkFilter
         );
 
-    m_images->BarrierImageRangeToDefaultUsage(*commandBuffer, *sourceGpuImage, vkSourceSubresourceRange, ImageUsageMode::TransferSrc);
-    m_images->BarrierImageRangeToDefaultUsage(*commandBuffer, *destGpuImage, vkDestSubresourceRange, ImageUsageMode::TransferDst);
-
     return true;
 }
 
 bool WiredGPUVkImpl::CmdUploadDataToBuffer(CopyPass copyPass,
                                            BufferId sourceTransferBufferId,
-                                           const std::size_t& sourceByteOffset,
                                            BufferId destBufferId,
-                                           const std::size_t& destByteOffset,
-                                           const std::size_t& copyByteSize,
+                                           const std::vector<BufferCopyRegion>& regions,
                                            bool cycle)
 {
+    if (regions.empty()) { return true; }
+
     //
     // Fetch Data
     //
@@ -1387,41 +1461,61 @@ bool WiredGPUVkImpl::CmdUploadDataToBuffer(CopyPass copyPass,
         return false;
     }
 
-    if (sourceByteOffset + copyByteSize > sourceBuffer->bufferDef.byteSize)
-    {
-        m_global->pLogger->Error("WiredGPUVkImpl::CmdUploadDataToBuffer: source region is out of bounds of the buffer's size");
-        return false;
-    }
+    // The source and dest byte ranges which together span all the regions
+    std::size_t sourceRangeStart = std::numeric_limits<std::size_t>::max();
+    std::size_t sourceRangeEnd = 0;
+    std::size_t destRangeStart = std::numeric_limits<std::size_t>::max();
+    std::size_t destRangeEnd = 0;
 
-    if (destByteOffset + copyByteSize > destBuffer->bufferDef.byteSize)
+    for (const auto& region : regions)
     {
-        m_global->pLogger->Error("WiredGPUVkImpl::CmdUploadDataToBuffer: dest region is out of bounds of the buffer's size");
-        return false;
+        if (region.sourceByteOffset + region.byteSize > sourceBuffer->bufferDef.byteSize)
+        {
+            m_global->pLogger->Error("WiredGPUVkImpl::CmdUploadDataToBuffer: source region is out of bounds of the buffer's size");
+            return false;
+        }
+
+        if (region.destByteOffset + region.byteSize > destBuffer->bufferDef.byteSize)
+        {
+            m_global->pLogger->Error("WiredGPUVkImpl::CmdUploadDataToBuffer: dest region is out of bounds of the buffer's size");
+            return false;
+        }
+
+        sourceRangeStart = std::min(sourceRangeStart, region.sourceByteOffset);
+        sourceRangeEnd = std::max(sourceRangeEnd, region.sourceByteOffset + region.byteSize);
+        destRangeStart = std::min(destRangeStart, region.destByteOffset);
+        destRangeEnd = std::max(destRangeEnd, region.destByteOffset + region.byteSize);
     }
 
     //
     // Execute
     //
-    m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *sourceBuffer, sourceByteOffset, copyByteSize, BufferUsageMode::TransferSrc);
-    m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *destBuffer, destByteOffset, copyByteSize, BufferUsageMode::TransferDst);
+    m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *sourceBuffer, sourceRangeStart, sourceRangeEnd - sourceRangeStart, BufferUsageMode::TransferSrc);
+    m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *destBuffer, destRangeStart, destRangeEnd - destRangeStart, BufferUsageMode::TransferDst);
+    (*commandBuffer)->FlushBarriers();
+
+    std::vector<VkBufferCopy2> vkCopyRegions;
+    vkCopyRegions.reserve(regions.size());
 
+    for (const auto& region : regions)
+    {
         VkBufferCopy2 vkCopyRegion{};
         vkCopyRegion.sType = VK_STRUCTURE_TYPE_BUFFER_COPY_2;
-        vkCopyRegion.srcOffset = sourceByteOffset;
-        vkCopyRegion.dstOffset = destByteOffset;
-        vkCopyRegion.size = copyByteSize;
+        vkCopyRegion.srcOffset = region.sourceByteOffset;
+        vkCopyRegion.dstOffset = region.destByteOffset;
+        vkCopyRegion.size = region.byteSize;
 
-        VkCopyBufferInfo2 vkCopyBufferInfo{};
-        vkCopyBufferInfo.sType = VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2;
-        vkCopyBufferInfo.srcBuffer = sourceBuffer->vkBuffer;
-        vkCopyBufferInfo.dstBuffer = destBuffer->vkBuffer;
-        vkCopyBufferInfo.regionCount = 1;
-        vkCopyBufferInfo.pRegions = &vkCopyRegion;
+        vkCopyRegions.push_back(vkCopyRegion);
+    }
 
-        (*commandBuffer)->CmdCopyBuffer2(&vkCopyBufferInfo);
+    VkCopyBufferInfo2 vkCopyBufferInfo{};
+    vkCopyBufferInfo.sType = VK_STRUCTURE_TYPE_COPY_BUFFER_INFO_2;
+    vkCopyBufferInfo.srcBuffer = sourceBuffer->vkBuffer;
+    vkCopyBufferInfo.dstBuffer = destBuffer->vkBuffer;
+    vkCopyBufferInfo.regionCount = (uint32_t)vkCopyRegions.size();
+    vkCopyBufferInfo.pRegions = vkCopyRegions.data();
 
-    m_buffers->BarrierBufferRangeToDefaultUsage(*commandBuffer, *sourceBuffer, sourceByteOffset, copyByteSize, BufferUsageMode::TransferSrc);
-    m_buffers->BarrierBufferRangeToDefaultUsage(*commandBuffer, *destBuffer, destByteOffset, copyByteSize, BufferUsageMode::TransferDst);
+    (*commandBuffer)->CmdCopyBuffer2(&vkCopyBufferInfo);
 
     return true;
 }
@@ -1488,10 +1582,11 @@ bool WiredGPUVkImpl::CmdUploadDataToImage(CopyPass copyPass,
     //
     m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *sourceBuffer, sourceByteOffset, copyByteSize, BufferUsageMode::TransferSrc);
     m_images->BarrierImageRangeForUsage(*commandBuffer, *destImage, vkDestSubresourceRange, ImageUsageMode::TransferDst);
+    (*commandBuffer)->FlushBarriers();
 
         VkBufferImageCopy2 vkCopyRegion{};
         vkCopyRegion.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2;
-        vkCopyRegion.bufferOffset = 0;
+        vkCopyRegion.bufferOffset = sourceByteOffset;
         vkCopyRegion.bufferRowLength = 0;
         vkCopyRegion.bufferImageHeight = 0;
         vkCopyRegion.imageSubresource = {
@@ -1525,9 +1620,6 @@ bool WiredGPUVkImpl::CmdUploadDataToImage(CopyPass copyPass,
 
         (*commandBuffer)->CmdCopyBufferToImage2(&vkCopyBufferToImageInfo);
 
-    m_images->BarrierImageRangeToDefaultUsage(*commandBuffer, *destImage, vkDestSubresourceRange, ImageUsageMode::TransferDst);
-    m_buffers->BarrierBufferRangeToDefaultUsage(*commandBuffer, *sourceBuffer, 0, copyByteSize, BufferUsageMode::TransferSrc);
-
     return true;
 }
 
@@ -1589,6 +1681,7 @@ bool WiredGPUVkImpl::CmdCopyBufferToBuffer(CopyPass copyPass,
     //
     m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *sourceBuffer, sourceByteOffset, copyByteSize, BufferUsageMode::TransferSrc);
     m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *destBuffer, destByteOffset, copyByteSize, BufferUsageMode::TransferDst);
+    (*commandBuffer)->FlushBarriers();
 
     VkBufferCopy2 vkCopyRegion{};
     vkCopyRegion.sType = VK_STRUCTURE_TYPE_BUFFER_COPY_2;
@@ -1605,8 +1698,136 @@ bool WiredGPUVkImpl::CmdCopyBufferToBuffer(CopyPass copyPass,
 
     (*commandBuffer)->CmdCopyBuffer2(&vkCopyBufferInfo);
 
-    m_buffers->BarrierBufferRangeToDefaultUsage(*commandBuffer, *sourceBuffer, sourceByteOffset, copyByteSize, BufferUsageMode::TransferSrc);
-    m_buffers->BarrierBufferRangeToDefaultUsage(*commandBuffer, *destBuffer, destByteOffset, copyByteSize, BufferUsageMode::TransferDst);
+    return true;
+}
+
+bool WiredGPUVkImpl::CmdDownloadDataFromImage(CopyPass copyPass,
+                                              ImageId sourceImageId,
+                                              const ImageRegion& sourceRegion,
+                                              BufferId destTransferBufferId,
+                                              const std::size_t& destByteOffset)
+{
+    //
+    // Fetch Data
+    //
+    const auto commandBuffer = m_commandBuffers->GetCommandBuffer(copyPass.commandBufferId);
+    if (!commandBuffer)
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: No such command buffer exists: {}", copyPass.commandBufferId.id);
+        return false;
+    }
+
+    const auto sourceImage = m_images->GetImage(sourceImageId, false);
+    if (!sourceImage)
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: No such image exists: {}", sourceImageId.id);
+        return false;
+    }
+
+    const auto destBuffer = m_buffers->GetBuffer(destTransferBufferId, false);
+    if (!destBuffer)
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: No such transfer buffer exists: {}", destTransferBufferId.id);
+        return false;
+    }
+
+    //
+    // Validate
+    //
+    if (!(*commandBuffer)->IsInCopyPass())
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: Command buffer has no copy pass started");
+        return false;
+    }
+
+    if (!destBuffer->bufferDef.isTransferBuffer || !(destBuffer->bufferDef.vkBufferUsageFlags & VK_BUFFER_USAGE_TRANSFER_DST_BIT))
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: Destination buffer is not a download transfer buffer: {}", destTransferBufferId.id);
+        return false;
+    }
+
+    if (destByteOffset >= destBuffer->bufferDef.byteSize)
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: Dest byte offset is outside of the dest buffer");
+        return false;
+    }
+
+    const auto texelByteSize = Images::GetTexelByteSize(sourceImage->imageData.imageDef.vkFormat);
+    if (!texelByteSize)
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: Unsupported source image format: {}",
+                                 (int)sourceImage->imageData.imageDef.vkFormat);
+        return false;
+    }
+
+    if (sourceRegion.offsets[1].x < sourceRegion.offsets[0].x ||
+        sourceRegion.offsets[1].y < sourceRegion.offsets[0].y ||
+        sourceRegion.offsets[1].z < sourceRegion.offsets[0].z)
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: Source region is inverted");
+        return false;
+    }
+
+    const std::size_t regionByteSize = (std::size_t)(sourceRegion.offsets[1].x - sourceRegion.offsets[0].x) *
+                                       (std::size_t)(sourceRegion.offsets[1].y - sourceRegion.offsets[0].y) *
+                                       (std::size_t)(sourceRegion.offsets[1].z - sourceRegion.offsets[0].z) *
+                                       *texelByteSize;
+
+    if (regionByteSize > destBuffer->bufferDef.byteSize - destByteOffset)
+    {
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdDownloadDataFromImage: Source region ({} bytes) doesn't fit in the dest buffer",
+                                 regionByteSize);
+        return false;
+    }
+
+    const VkImageSubresourceRange vkSourceSubresourceRange = {
+        .aspectMask = Images::GetImageAspectFlags(*sourceImage),
+        .baseMipLevel = sourceRegion.mipLevel,
+        .levelCount = 1,
+        .baseArrayLayer = sourceRegion.layerIndex,
+        .layerCount = 1
+    };
+
+    const std::size_t destByteSize = destBuffer->bufferDef.byteSize - destByteOffset;
+
+    //
+    // Execute
+    //
+    m_images->BarrierImageRangeForUsage(*commandBuffer, *sourceImage, vkSourceSubresourceRange, ImageUsageMode::TransferSrc);
+    m_buffers->BarrierBufferRangeForUsage(*commandBuffer, *destBuffer, destByteOffset, destByteSize, BufferUsageMode::TransferDst);
+    (*commandBuffer)->FlushBarriers();
+
+        VkBufferImageCopy2 vkCopyRegion{};
+        vkCopyRegion.sType = VK_STRUCTURE_TYPE_BUFFER_IMAGE_COPY_2;
+        vkCopyRegion.bufferOffset = destByteOffset;
+        vkCopyRegion.bufferRowLength = 0;
+        vkCopyRegion.bufferImageHeight = 0;
+        vkCopyRegion.imageSubresource = {
+            .aspectMask = Images::GetImageAspectFlags(*sourceImage),
+            .mipLevel = sourceRegion.mipLevel,
+            .baseArrayLayer = sourceRegion.layerIndex,
+            .layerCount = 1
+        };
+        vkCopyRegion.imageOffset = {
+            .x = (int32_t)sourceRegion.offsets[0].x,
+            .y = (int32_t)sourceRegion.offsets[0].y,
+            .z = (int32_t)sourceRegion.offsets[0].z
+        };
+        vkCopyRegion.imageExtent = VkExtent3D {
+            .width = sourceRegion.offsets[1].x - sourceRegion.offsets[0].x,
+            .height = sourceRegion.offsets[1].y - sourceRegion.offsets[0].y,
+            .depth = sourceRegion.offsets[1].z - sourceRegion.offsets[0].z
+        };
+
+        VkCopyImageToBufferInfo2 vkCopyImageToBufferInfo{};
+        vkCopyImageToBufferInfo.sType = VK_STRUCTURE_TYPE_COPY_IMAGE_TO_BUFFER_INFO_2;
+        vkCopyImageToBufferInfo.srcImage = sourceImage->imageData.vkImage;
+        vkCopyImageToBufferInfo.srcImageLayout = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+        vkCopyImageToBufferInfo.dstBuffer = destBuffer->vkBuffer;
+        vkCopyImageToBufferInfo.regionCount = 1;
+        vkCopyImageToBufferInfo.pRegions = &vkCopyRegion;
+
+        (*commandBuffer)->CmdCopyImageToBuffer2(&vkCopyImageToBufferInfo);
 
     return true;
 }
@@ -1654,6 +1875,7 @@ bool WiredGPUVkImpl::CmdExecuteCommands(CommandBufferId primaryCommandBufferId,
         //
         // End the recording of each secondary command buffer
         //
+        (*secondaryCommandBuffer)->BarrierTrackedResourcesToDefaultUsage();
         (*secondaryCommandBuffer)->GetVulkanCommandBuffer().End();
 
         // Keep track of the new secondary command buffer
@@ -1830,52 +2052,6 @@ void WiredGPUVkImpl::BarrierGraphicsSetResourcesForUsage(CommandBuffer* pCommand
     }
 }
 
-void WiredGPUVkImpl::BarrierGraphicsSetResourcesToDefaultUsage(CommandBuffer* pCommandBuffer, const SetBindings& setBindings)
-{
-    for (const auto& bufferBinding: setBindings.bufferBindings)
-    {
-        const auto bufferUsageMode = GetGraphicsBufferUsageMode(bufferBinding.second);
-        if (!bufferUsageMode)
-        {
-            m_global->pLogger->Error("WiredGPUVkImpl::BarrierGraphicsSetResourcesToDefaultUsage: Unsupported buffer descriptor type");
-            return;
-        }
-
-        m_buffers->BarrierBufferRangeToDefaultUsage(
-            pCommandBuffer,
-            bufferBinding.second.gpuBuffer,
-            bufferBinding.second.dynamicByteOffset ? *bufferBinding.second.dynamicByteOffset : bufferBinding.second.byteOffset,
-            bufferBinding.second.byteSize,
-            *bufferUsageMode
-        );
-    }
-    for (const auto& imageViewBinding: setBindings.imageViewBindings)
-    {
-        const auto& imageViewData = imageViewBinding.second.gpuImage.imageViewDatas.at(imageViewBinding.second.imageViewIndex);
-
-        m_images->BarrierImageRangeToDefaultUsage(
-            pCommandBuffer,
-            imageViewBinding.second.gpuImage,
-            imageViewData.imageViewDef.vkImageSubresourceRange,
-            ImageUsageMode::GraphicsStorageRead
-        );
-    }
-    for (const auto& imageViewSamplerBindings : setBindings.imageViewSamplerBindings)
-    {
-        for (const auto& imageViewSamplerBinding : imageViewSamplerBindings.second.arrayBindings)
-        {
-            const auto& imageViewData = imageViewSamplerBinding.second.gpuImage.imageViewDatas.at(imageViewSamplerBinding.second.imageViewIndex);
-
-            m_images->BarrierImageRangeToDefaultUsage(
-                pCommandBuffer,
-                imageViewSamplerBinding.second.gpuImage,
-                imageViewData.imageViewDef.vkImageSubresourceRange,
-                ImageUsageMode::GraphicsSampled
-            );
-        }
-    }
-}
-
 std::expected<BufferUsageMode, bool> GetComputeBufferUsageMode(const VkBufferBinding& bufferBinding)
 {
     switch (bufferBinding.vkDescriptorType)
@@ -1942,55 +2118,10 @@ void WiredGPUVkImpl::BarrierComputeSetResourcesForUsage(CommandBuffer* pCommandB
     }
 }
 
-void WiredGPUVkImpl::BarrierComputeSetResourcesToDefaultUsage(CommandBuffer* pCommandBuffer, const SetBindings& setBindings)
-{
-    for (const auto& bufferBinding: setBindings.bufferBindings)
-    {
-        const auto bufferUsageMode = GetComputeBufferUsageMode(bufferBinding.second);
-        if (!bufferUsageMode)
-        {
-            m_global->pLogger->Error("WiredGPUVkImpl::BarrierComputeSetResourcesToDefaultUsage: Unsupported buffer descriptor type");
-            return;
-        }
-
-        m_buffers->BarrierBufferRangeToDefaultUsage(
-            pCommandBuffer,
-            bufferBinding.second.gpuBuffer,
-            bufferBinding.second.byteOffset,
-            bufferBinding.second.byteSize,
-            *bufferUsageMode
-        );
-    }
-    for (const auto& imageViewBinding: setBindings.imageViewBindings)
-    {
-        const auto& imageViewData = imageViewBinding.second.gpuImage.imageViewDatas.at(imageViewBinding.second.imageViewIndex);
-
-        m_images->BarrierImageRangeToDefaultUsage(
-            pCommandBuffer,
-            imageViewBinding.second.gpuImage,
-            imageViewData.imageViewDef.vkImageSubresourceRange,
-            imageViewBinding.second.shaderWriteable ? ImageUsageMode::ComputeStorageReadWrite : ImageUsageMode::ComputeStorageRead
-        );
-    }
-    for (const auto& imageViewSamplerBindings : setBindings.imageViewSamplerBindings)
-    {
-        for (const auto& imageViewSamplerBinding : imageViewSamplerBindings.second.arrayBindings)
-        {
-            const auto& imageViewData = imageViewSamplerBinding.second.gpuImage.imageViewDatas.at(imageViewSamplerBinding.second.imageViewIndex);
-
-            m_images->BarrierImageRangeToDefaultUsage(
-                pCommandBuffer,
-                imageViewSamplerBinding.second.gpuImage,
-                imageViewData.imageViewDef.vkImageSubresourceRange,
-                ImageUsageMode::ComputeSampled
-            );
-        }
-    }
-}
-
 void WiredGPUVkImpl::BindDescriptorSetsNeedingRefresh(CommandBuffer* pCommandBuffer, PassState& passState)
 {
     const auto descriptorSets = *EnsureThreadDescriptorSets();
+    const auto& currentFrame = m_frames->GetCurrentFrame();
 
     // Note that we're relying on external logic being correct; if any set X needs refreshed, every set
     // after it should also have been marked as needing refresh, so we should have contiguous set indices
@@ -2006,16 +2137,29 @@ void WiredGPUVkImpl::BindDescriptorSetsNeedingRefresh(CommandBuffer* pCommandBuf
 
         const auto setBindings = passState.setBindings.at(set);
 
+        const auto descriptorSetRequest = DescriptorSetRequest{
+            .descriptorSetLayout =  passState.boundPipeline->GetDescriptorLayout(set),
+            .bindings = setBindings
+        };
+
         std::expected<VulkanDescriptorSet, bool> vulkanDescriptorSet;
 
-        // Obtain a descriptor set
-        vulkanDescriptorSet = descriptorSets->GetVulkanDescriptorSet(
-            DescriptorSetRequest{
-                .descriptorSetLayout =  passState.boundPipeline->GetDescriptorLayout(set),
-                .bindings = setBindings
-            },
-            std::format("DS{}", set)
-        );
+        // Obtain a descriptor set. Per-draw sets are rarely re-used with the same bindings, so within a frame
+        // they're allocated from the frame's arena rather than cached.
+        if ((set == PER_DRAW_DESCRIPTOR_SET) && currentFrame.IsActiveState())
+        {
+            vulkanDescriptorSet = descriptorSets->GetTransientDescriptorSet(descriptorSetRequest, currentFrame.GetFrameIndex(), std::format("DS{}", set));
+        }
+        else
+        {
+            vulkanDescriptorSet = descriptorSets->GetVulkanDescriptorSet(descriptorSetRequest, std::format("DS{}", set));
+        }
+
+        if (!vulkanDescriptorSet)
+        {
+            m_global->pLogger->Error("WiredGPUVkImpl::BindDescriptorSetsNeedingRefresh: Failed to obtain descriptor set for set: {}", set);
+            return;
+        }
 
         lowestSetWritten = std::min(set, lowestSetWritten);
         setsWritten.push_back(*vulkanDescriptorSet);
@@ -2099,16 +2243,11 @@ bool WiredGPUVkImpl::CmdDrawIndexed(RenderPass renderPass,
     {
         BarrierGraphicsSetResourcesForUsage(*commandBuffer, setBindings);
     }
+    (*commandBuffer)->FlushBarriers();
 
     // Draw
     (*commandBuffer)->CmdDrawIndexed(indexCount, instanceCount, firstIndex, vertexOffset, firstInstance);
 
-    // Barrier all resources back to their default usage
-    for (const auto& setBindings : renderPassState->setBindings)
-    {
-        BarrierGraphicsSetResourcesToDefaultUsage(*commandBuffer, setBindings);
-    }
-
     return true;
 }
 
@@ -2166,20 +2305,13 @@ bool WiredGPUVkImpl::CmdDrawIndexedIndirect(RenderPass renderPass,
     {
         BarrierGraphicsSetResourcesForUsage(*commandBuffer, setBindings);
     }
+    (*commandBuffer)->FlushBarriers();
 
     //
     // Draw
     //
     (*commandBuffer)->CmdDrawIndexedIndirect(buffer->vkBuffer, byteOffset, drawCount, stride);
 
-    //
-    // Barrier all resources back to their default usage
-    //
-    for (const auto& setBindings : renderPassState->setBindings)
-    {
-        BarrierGraphicsSetResourcesToDefaultUsage(*commandBuffer, setBindings);
-    }
-
     return true;
 }
 
@@ -2246,6 +2378,7 @@ bool WiredGPUVkImpl::CmdDrawIndexedIndirectCount(RenderPass renderPass,
     {
         BarrierGraphicsSetResourcesForUsage(*commandBuffer, setBindings);
     }
+    (*commandBuffer)->FlushBarriers();
 
     //
     // Draw
@@ -2259,14 +2392,6 @@ bool WiredGPUVkImpl::CmdDrawIndexedIndirectCount(RenderPass renderPass,
         stride
     );
 
-    //
-    // Barrier all resources back to their default usage
-    //
-    for (const auto& setBindings : renderPassState->setBindings)
-    {
-        BarrierGraphicsSetResourcesToDefaultUsage(*commandBuffer, setBindings);
-    }
-
     return true;
 }
 
@@ -2313,20 +2438,13 @@ bool WiredGPUVkImpl::CmdDispatch(ComputePass computePass, uint32_t groupCountX,
     {
         BarrierComputeSetResourcesForUsage(*commandBuffer, setBindings);
     }
+    (*commandBuffer)->FlushBarriers();
 
     //
     // Dispatch
     //
     (*commandBuffer)->CmdDispatch(groupCountX, groupCountY, groupCountZ);
 
-    //
-    // Barrier all resources back to their default usage
-    //
-    for (const auto& setBindings : computePassState->setBindings)
-    {
-        BarrierComputeSetResourcesToDefaultUsage(*commandBuffer, setBindings);
-    }
-
     return true;
 }
 
@@ -2370,16 +2488,11 @@ bool WiredGPUVkImpl::CmdRenderImGuiDrawData(RenderPass renderPass, ImDrawData* p
     {
         m_images->BarrierWholeImageForUsage(*commandBuffer, image, ImageUsageMode::GraphicsSampled);
     }
+    (*commandBuffer)->FlushBarriers();
 
     // Record the ImGui draw commands into the command buffer
     ImGui_ImplVulkan_RenderDrawData(pDrawData, (*commandBuffer)->GetVulkanCommandBuffer().GetVkCommandBuffer(), VK_NULL_HANDLE);
 
-    // Barrier all ImGui referenced images back to default usage
-    for (const auto& image : referencedImages)
-    {
-        m_images->BarrierWholeImageToDefaultUsage(*commandBuffer, image, ImageUsageMode::GraphicsSampled);
-    }
-
     return true;
 }
 
@@ -2414,12 +2527,6 @@ bool WiredGPUVkImpl::CmdBindUniformData(RenderOrComputePass pass, const std::str
         return false;
     }
 
-    if (byteSize > UNIFORM_BUFFER_BYTE_SIZE)
-    {
-        m_global->pLogger->Error("WiredGPUVkImpl::CmdBindUniformData: Max uniform byte size is: {}", UNIFORM_BUFFER_BYTE_SIZE);
-        return false;
-    }
-
     const auto& passState = (*commandBuffer)->GetPassState();
 
     if (!passState->boundPipeline)
@@ -2432,31 +2539,16 @@ bool WiredGPUVkImpl::CmdBindUniformData(RenderOrComputePass pass, const std::str
     // Execute
     //
 
-    // Ask uniform buffers system for an unused uniform buffer
-    const auto dynamicUniformBuffer = m_uniformBuffers->GetFreeUniformBuffer();
-    if (!dynamicUniformBuffer)
+    // Write the data into the command buffer's uniform block
+    const auto vkBufferBinding = (*commandBuffer)->WriteUniformData(pData, byteSize);
+    if (!vkBufferBinding)
     {
-        m_global->pLogger->Error("WiredGPUVkImpl::CmdBindUniformData: Failed to get free uniform buffer");
+        m_global->pLogger->Error("WiredGPUVkImpl::CmdBindUniformData: Failed to write uniform data");
         return false;
     }
 
-    // Write the uniform data to the buffer
-    const auto pBufferData = m_buffers->MapBuffer(dynamicUniformBuffer->bufferId, false);
-        memcpy((std::byte*)*pBufferData + (dynamicUniformBuffer->byteOffset), pData, byteSize);
-    m_buffers->UnmapBuffer(dynamicUniformBuffer->bufferId);
-
-    // Tell the active command buffer to bind the uniform buffer
-    return (*commandBuffer)->BindBuffer(
-        bindPoint,
-        VkBufferBinding{
-            .gpuBuffer = *m_buffers->GetBuffer(dynamicUniformBuffer->bufferId, false),
-            .vkDescriptorType = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC,
-            .shaderWriteable = false,
-            .byteOffset = 0,
-            .byteSize = byteSize,
-            .dynamicByteOffset = (uint32_t)dynamicUniformBuffer->byteOffset
-        }
-    );
+    // Tell the active command buffer to bind the uniform data
+    return (*commandBuffer)->BindBuffer(bindPoint, *vkBufferBinding);
 }
 
 bool WiredGPUVkImpl::CmdBindStorageReadBuffer(RenderOrComputePass pass, const std::string& bindPoint, BufferId bufferId)
@@ -2872,6 +2964,41 @@ std::optional<float> WiredGPUVkImpl::GetTimestampDiffMs(const std::string& name,
     return (*timestamps)->GetTimestampDiffMs(name, offset);
 }
 
+uint64_t WiredGPUVkImpl::GetPipelineBarrierCount() const
+{
+    return m_global->pipelineBarrierCount.load();
+}
+
+uint64_t WiredGPUVkImpl::GetQueueSubmitCount() const
+{
+    return m_global->queueSubmitCount.load();
+}
+
+std::size_t WiredGPUVkImpl::GetCycledBufferByteSize() const
+{
+    return m_buffers->GetCycledByteSize();
+}
+
+std::vector<MemoryHeapStats> WiredGPUVkImpl::GetMemoryHeapStats() const
+{
+    return m_memoryTracker->GetHeapStats();
+}
+
+std::unordered_map<std::string, std::size_t> WiredGPUVkImpl::GetAllocationByteSizesByTag() const
+{
+    return m_memoryTracker->GetByteSizesByTag();
+}
+
+DescriptorSetStats WiredGPUVkImpl::GetDescriptorSetStats() const
+{
+    return DescriptorSetStats{
+        .cachedSetCount = static_cast<std::size_t>(m_global->cachedDescriptorSetCount.load()),
+        .cacheLookupCount = m_global->descriptorSetCacheLookupCount.load(),
+        .cacheHitCount = m_global->descriptorSetCacheHitCount.load(),
+        .transientSetCount = m_global->transientDescriptorSetCount.load()
+    };
+}
+
 std::expected<ImageId, SurfaceError> WiredGPUVkImpl::AcquireSwapChainImage(CommandBufferId commandBufferId)
 {
     // Can't acquire a swap chain image if we're running in headless mode and don't have a swap chain
@@ -2991,88 +3118,191 @@ std::expected<ImageId, SurfaceError> WiredGPUVkImpl::AcquireSwapChainImage(Comma
 
 std::expected<bool, SurfaceError> WiredGPUVkImpl::SubmitCommandBuffer(CommandBufferId commandBufferId)
 {
+    return SubmitCommandBuffers({commandBufferId});
+}
+
+std::expected<bool, SurfaceError> WiredGPUVkImpl::SubmitCommandBuffers(const std::vector<CommandBufferId>& commandBufferIds)
+{
+    std::lock_guard<std::recursive_mutex> lock(m_submitMutex);
+
     auto& currentFrame = m_frames->GetCurrentFrame();
 
     //
-    // Find the specified command buffer
+    // Find and validate the specified command buffers
     //
-    auto commandBuffer = m_commandBuffers->GetCommandBuffer(commandBufferId);
-    if (!commandBuffer)
-    {
-        m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffer: No such command buffer exists: {}", commandBufferId.id);
-        return false;
-    }
+    std::vector<CommandBuffer*> commandBuffers;
+    std::optional<CommandBuffer*> presentCommandBuffer;
 
-    if ((*commandBuffer)->GetType() != CommandBufferType::Primary)
+    for (const auto& commandBufferId : commandBufferIds)
     {
-        m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffer: Can only submit primary command buffers: {}", commandBufferId.id);
-        return false;
+        auto commandBuffer = m_commandBuffers->GetCommandBuffer(commandBufferId);
+        if (!commandBuffer)
+        {
+            m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffers: No such command buffer exists: {}", commandBufferId.id);
+            return false;
+        }
+
+        if ((*commandBuffer)->GetType() != CommandBufferType::Primary)
+        {
+            m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffers: Can only submit primary command buffers: {}", commandBufferId.id);
+            return false;
+        }
+
+        if ((*commandBuffer)->IsInAnyPass())
+        {
+            m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffers: Command buffer is in an open pass: {}", commandBufferId.id);
+            return false;
+        }
+
+        if ((*commandBuffer)->IsConfiguredForPresentation())
+        {
+            if (!currentFrame.IsActiveState())
+            {
+                m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffers: Submitting for presentation requires an active frame");
+                return false;
+            }
+
+            if (presentCommandBuffer)
+            {
+                m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffers: Only one command buffer may be submitted for presentation");
+                return false;
+            }
+
+            presentCommandBuffer = *commandBuffer;
+        }
+
+        commandBuffers.push_back(*commandBuffer);
     }
 
-    if ((*commandBuffer)->IsInAnyPass())
+    //
+    // Finish recording each command buffer and queue it for submission
+    //
+    for (auto& commandBuffer : commandBuffers)
     {
-        m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffer: Command buffer is in an open pass: {}", commandBufferId.id);
-        return false;
+        // Passes return their resources to default usage when they end; catch anything used outside of one
+        commandBuffer->BarrierTrackedResourcesToDefaultUsage();
+
+        //
+        // If configured for presentation, transition the swap chain image to present src layout as the last
+        // command in the command buffer
+        //
+        if (commandBuffer->IsConfiguredForPresentation())
+        {
+            const auto swapChainImageId = m_global->swapChain->GetImageId(currentFrame.GetSwapChainPresentIndex());
+
+            const auto swapChainGPUImage = m_images->GetImage(swapChainImageId, false);
+            if (!swapChainGPUImage)
+            {
+                m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffers: Swap chain image doesn't exist: {}", swapChainImageId.id);
+                return false;
+            }
+
+            m_images->BarrierWholeImageForUsage(commandBuffer, *swapChainGPUImage, ImageUsageMode::PresentSrc);
+            commandBuffer->FlushBarriers();
+        }
+
+        //
+        // End the command buffer's recording
+        //
+        commandBuffer->GetVulkanCommandBuffer().End();
+
+        m_queuedSubmits.push_back(commandBuffer->GetId());
     }
 
-    if ((*commandBuffer)->IsConfiguredForPresentation() && !currentFrame.IsActiveState())
+    //
+    // Within a frame, work is held back so that all of the frame's command buffers are submitted together. The
+    // present command buffer is the frame's last work, so it and everything queued before it is submitted now.
+    //
+    if (!currentFrame.IsActiveState() || presentCommandBuffer)
     {
-        m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffer: Submitting for presentation requires an active frame");
-        return false;
+        if (!FlushQueuedSubmits())
+        {
+            return false;
+        }
     }
 
-    auto& vulkanCommandBuffer = (*commandBuffer)->GetVulkanCommandBuffer();
-
     //
-    // If configured for presentation, transition the swap chain image to present src layout as the last
-    // command in the command buffer
+    // If configured for presentation, present the swap chain image now that we've
+    // submitted all the work for the frame
     //
-    if ((*commandBuffer)->IsConfiguredForPresentation())
+    if (presentCommandBuffer)
     {
-        const auto swapChainImageId = m_global->swapChain->GetImageId(currentFrame.GetSwapChainPresentIndex());
+        const auto result = PresentSwapChainImage(currentFrame.GetSwapChainPresentIndex(), currentFrame.GetPresentWorkFinishedSemaphore());
+        if (!result)
+        {
+            return std::unexpected(result.error());
+        }
+    }
+
+    return true;
+}
 
-        const auto swapChainGPUImage = m_images->GetImage(swapChainImageId, false);
-        if (!swapChainGPUImage)
+bool WiredGPUVkImpl::FlushQueuedSubmits()
+{
+    std::lock_guard<std::recursive_mutex> lock(m_submitMutex);
+
+    if (m_queuedSubmits.empty()) { return true; }
+
+    std::vector<CommandBuffer*> commandBuffers;
+    std::vector<QueueSubmission> submissions;
+
+    for (const auto& commandBufferId : m_queuedSubmits)
+    {
+        const auto commandBuffer = m_commandBuffers->GetCommandBuffer(commandBufferId);
+        if (!commandBuffer)
         {
-            m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffer: Swap chain image doesn't exist: {}", swapChainImageId.id);
-            return false;
+            m_global->pLogger->Error("WiredGPUVkImpl::FlushQueuedSubmits: No such command buffer exists: {}", commandBufferId.id);
+            continue;
         }
 
-        m_images->BarrierWholeImageForUsage(*commandBuffer, *swapChainGPUImage, ImageUsageMode::PresentSrc);
+        commandBuffers.push_back(*commandBuffer);
+        submissions.push_back(QueueSubmission{
+            .commandBuffer = (*commandBuffer)->GetVulkanCommandBuffer(),
+            .waitSemaphores = (*commandBuffer)->GetWaitSemaphores(),
+            .signalSemaphores = (*commandBuffer)->GetSignalSemaphores()
+        });
     }
 
-    //
-    // End the command buffer's recording
-    //
-    vulkanCommandBuffer.End();
+    m_queuedSubmits.clear();
+
+    if (submissions.empty()) { return true; }
+
+    const auto submitTag = commandBuffers.size() == 1 ? commandBuffers.front()->GetTag() : std::format("Batch-{}", commandBuffers.size());
 
     //
-    // Submit the command buffer
+    // Submit all the command buffers together
     //
-    if (!m_global->commandQueue.SubmitBatch(
-        {vulkanCommandBuffer},
-        WaitOn((*commandBuffer)->GetWaitSemaphores()),
-        SignalOn((*commandBuffer)->GetSignalSemaphores()),
-        (*commandBuffer)->GetVkFence(),
-        (*commandBuffer)->GetTag()))
+    const auto timelineValue = m_global->commandQueue.Submit(submissions, submitTag);
+    if (!timelineValue)
     {
-        m_global->pLogger->Error("WiredGPUVkImpl::SubmitCommandBuffer: Failed to submit command buffer: {}", commandBufferId.id);
+        m_global->pLogger->Error("WiredGPUVkImpl::FlushQueuedSubmits: Failed to submit command buffers: {}", submitTag);
         return false;
     }
 
     //
-    // If configured for presentation, present the swap chain image now that we've
-    // submitted all the work for the frame
+    // Record the timeline value which signals the work has finished. Secondary command buffers finish along
+    // with the primary command buffers which executed them.
     //
-    if ((*commandBuffer)->IsConfiguredForPresentation())
+    for (const auto& commandBuffer : commandBuffers)
     {
-        const auto result = PresentSwapChainImage(currentFrame.GetSwapChainPresentIndex(), currentFrame.GetPresentWorkFinishedSemaphore());
-        if (!result)
+        commandBuffer->SetSubmitTimelineValue(*timelineValue);
+
+        for (const auto& secondaryCommandBufferId : commandBuffer->GetSecondaryCommandBufferIds())
         {
-            return std::unexpected(result.error());
+            const auto secondaryCommandBuffer = m_commandBuffers->GetCommandBuffer(secondaryCommandBufferId);
+            if (secondaryCommandBuffer)
+            {
+                (*secondaryCommandBuffer)->SetSubmitTimelineValue(*timelineValue);
+            }
         }
     }
 
+    auto& currentFrame = m_frames->GetCurrentFrame();
+    if (currentFrame.IsActiveState())
+    {
+        currentFrame.SetSubmitTimelineValue(*timelineValue);
+    }
+
     return true;
 }
 
@@ -3088,11 +3318,10 @@ void WiredGPUVkImpl::CancelCommandBuffer(CommandBufferId commandBufferId)
     // No longer have the command buffer reference its resources
     (*commandBuffer)->ReleaseTrackedResources();
 
-    // If the active frame is associated with the command buffer ... un-associate it
-    auto& currentFrame = m_frames->GetCurrentFrame();
-    if (currentFrame.IsActiveState())
+    // Make sure it's not sitting in the queue of work to be submitted
     {
-        currentFrame.UnAssociateCommandBuffer(commandBufferId);
+        std::lock_guard<std::recursive_mutex> lock(m_submitMutex);
+        std::erase(m_queuedSubmits, commandBufferId);
     }
 
     // Destroy the command buffer
@@ -14,6 +14,7 @@
 #include <Wired/GPU/WiredGPUVk.h>
 
 #include <memory>
+#include <vector>
 #include <unordered_map>
 #include <mutex>
 #include <thread>
@@ -36,6 +37,7 @@ namespace Wired::GPU
     class VkPipelines;
     class DescriptorSets;
     class UniformBuffers;
+    class MemoryTracker;
     struct Usages;
 
     class WiredGPUVkImpl : public WiredGPUVk
@@ -94,6 +96,7 @@ namespace Wired::GPU
             [[nodiscard]] std::expected<void*, bool> MapBuffer(BufferId bufferId, bool cycle) override;
             bool UnmapBuffer(BufferId bufferId) override;
             void DestroyBuffer(BufferId bufferId) override;
+            [[nodiscard]] bool IsBufferInUse(BufferId bufferId) override;
 
             // Samplers
             [[nodiscard]] std::expected<SamplerId, bool> CreateSampler(const SamplerInfo& samplerInfo, const std::string& tag) override;
@@ -101,6 +104,7 @@ namespace Wired::GPU
 
             // Commands
             [[nodiscard]] std::expected<CommandBufferId, bool> AcquireCommandBuffer(bool primary, const std::string& tag) override;
+            std::expected<bool, SurfaceError> SubmitCommandBuffers(const std::vector<CommandBufferId>& commandBufferIds) override;
             std::expected<bool, SurfaceError> SubmitCommandBuffer(CommandBufferId commandBufferId) override;
             void CancelCommandBuffer(CommandBufferId commandBufferId) override;
 
@@ -108,9 +112,10 @@ namespace Wired::GPU
 
             bool CmdClearColorImage(CopyPass copyPass, ImageId imageId, const ImageSubresourceRange& subresourceRange, const glm::vec4& color, bool cycle) override;
             bool CmdBlitImage(CopyPass copyPass, ImageId sourceImageId, const ImageRegion& sourceRegion, ImageId destImageId, const ImageRegion& destRegion, Filter filter, bool cycle) override;
-            bool CmdUploadDataToBuffer(CopyPass copyPass, BufferId sourceTransferBufferId, const std::size_t& sourceByteOffset, BufferId destBufferId, const std::size_t& destByteOffset, const std::size_t& copyByteSize, bool cycle) override;
+            bool CmdUploadDataToBuffer(CopyPass copyPass, BufferId sourceTransferBufferId, BufferId destBufferId, const std::vector<BufferCopyRegion>& regions, bool cycle) override;
             bool CmdUploadDataToImage(CopyPass copyPass, BufferId sourceTransferBufferId, const std::size_t& sourceByteOffset, ImageId destImageId, const ImageRegion& destRegion, const std::size_t& copyByteSize, bool cycle) override;
             bool CmdCopyBufferToBuffer(CopyPass copyPass, BufferId sourceBufferId, const std::size_t& sourceByteOffset, BufferId destBufferId, const std::size_t& destByteOffset, const std::size_t& copyByteSize, bool cycle) override;
+            bool CmdDownloadDataFromImage(CopyPass copyPass, ImageId sourceImageId, const ImageRegion& sourceRegion, BufferId destTransferBufferId, const std::size_t& destByteOffset) override;
 
             bool CmdExecuteCommands(CommandBufferId primaryCommandBufferId, const std::vector<CommandBufferId>& secondaryCommandBufferIds) override;
             bool CmdBindPipeline(RenderOrComputePass pass, PipelineId pipelineId) override;
@@ -145,6 +150,17 @@ namespace Wired::GPU
             void CmdWriteTimestampFinish(CommandBufferId commandBufferId, const std::string& name) override;
             [[nodiscard]] std::optional<float> GetTimestampDiffMs(const std::string& name, uint32_t offset) const override;
 
+            // Stats
+            [[nodiscard]] uint64_t GetPipelineBarrierCount() const override;
+            [[nodiscard]] std::size_t GetCycledBufferByteSize() const override;
+            [[nodiscard]] uint64_t GetQueueSubmitCount() const override;
+            [[nodiscard]] std::vector<MemoryHeapStats> GetMemoryHeapStats() const override;
+            [[nodiscard]] std::unordered_map<std::string, std::size_t> GetAllocationByteSizesByTag() const override;
+            [[nodiscard]] DescriptorSetStats GetDescriptorSetStats() const override;
+
+            // Memory
+            void SetMemoryPressureCallback(MemoryPressureCallback callback) override;
+
             // Rendering
             void StartFrame() override;
             void EndFrame() override;
@@ -178,15 +194,16 @@ namespace Wired::GPU
             [[nodiscard]] std::expected<DescriptorSets*, bool> EnsureThreadDescriptorSets();
 
             void BarrierGraphicsSetResourcesForUsage(CommandBuffer* pCommandBuffer, const SetBindings& setBindings);
-            void BarrierGraphicsSetResourcesToDefaultUsage(CommandBuffer* pCommandBuffer, const SetBindings& setBindings);
-
             void BarrierComputeSetResourcesForUsage(CommandBuffer* pCommandBuffer, const SetBindings& setBindings);
-            void BarrierComputeSetResourcesToDefaultUsage(CommandBuffer* pCommandBuffer, const SetBindings& setBindings);
 
             void BindDescriptorSetsNeedingRefresh(CommandBuffer* pCommandBuffer, PassState& passState);
 
             [[nodiscard]] std::expected<bool, SurfaceError> PresentSwapChainImage(uint32_t swapChainImageIndex, VkSemaphore waitSemaphore);
 
+            [[nodiscard]] bool FlushQueuedSubmits();
+
+            void CheckMemoryPressure();
+
         private:
 
             std::unique_ptr<Global> m_global;
@@ -202,11 +219,26 @@ namespace Wired::GPU
             std::unique_ptr<VkPipelines> m_pipelines;
             std::unique_ptr<UniformBuffers> m_uniformBuffers;
             std::unique_ptr<Usages> m_usages;
+            std::unique_ptr<MemoryTracker> m_memoryTracker;
 
             // Thread id -> commandsQueue command pool
             std::unordered_map<std::thread::id, std::unique_ptr<VulkanCommandPool>> m_commandPools;
             std::mutex m_commandPoolsMutex;
 
+            // Ended primary command buffers waiting to be submitted with the rest of the frame's work
+            std::vector<CommandBufferId> m_queuedSubmits;
+            std::recursive_mutex m_submitMutex;
+
+            // Minimum number of frames between memory pressure reports
+            static constexpr uint32_t MEMORY_PRESSURE_COOLDOWN_FRAMES = 60;
+
+            MemoryPressureCallback m_memoryPressureCallback;
+            uint32_t m_memoryPressureCooldown{0};
+            std::mutex m_memoryPressureMutex;
+
+            // By convention, the descriptor set holding per-draw resources; bound from per-frame arenas rather than cached
+            static constexpr unsigned int PER_DRAW_DESCRIPTOR_SET = 3;
+
             // Thread id -> DescriptorSets
             std::unordered_map<std::thread::id, std::unique_ptr<DescriptorSets>> m_descriptorSets;
             std::mutex m_descriptorSetsMutex;
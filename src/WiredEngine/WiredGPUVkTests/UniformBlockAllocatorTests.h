@@ -0,0 +1,106 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDGPUVKTESTS_UNIFORMBLOCKALLOCATORTESTS_H
+#define WIREDENGINE_WIREDGPUVKTESTS_UNIFORMBLOCKALLOCATORTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "Buffer/UniformBlockAllocator.h"
+
+namespace Wired::GPU
+{
+    TEST(UniformBlockAllocatorTests, OffsetsAreAligned)
+    {
+        UniformBlockAllocator allocator(4096, 256);
+
+        EXPECT_EQ(allocator.Allocate(64), 0U);
+        EXPECT_EQ(allocator.Allocate(1), 256U);
+        EXPECT_EQ(allocator.Allocate(257), 512U);
+        EXPECT_EQ(allocator.Allocate(16), 1024U);
+        EXPECT_EQ(allocator.GetByteOffset(), 1040U);
+    }
+
+    TEST(UniformBlockAllocatorTests, PayloadsCanExactlyFillBlock)
+    {
+        UniformBlockAllocator allocator(1024, 256);
+
+        EXPECT_EQ(allocator.Allocate(768), 0U);
+        EXPECT_EQ(allocator.Allocate(256), 768U);
+        EXPECT_EQ(allocator.GetByteOffset(), 1024U);
+        EXPECT_FALSE(allocator.Allocate(1));
+    }
+
+    TEST(UniformBlockAllocatorTests, FullBlockRequestsNewBlock)
+    {
+        UniformBlockAllocator allocator(1024, 256);
+
+        EXPECT_EQ(allocator.Allocate(600), 0U);
+
+        // The aligned offset (768) leaves no room for the payload, so the owner has to move to a new block, and
+        // the failed request mustn't consume any of the block
+        EXPECT_FALSE(allocator.Allocate(300));
+        EXPECT_EQ(allocator.GetByteOffset(), 600U);
+
+        // A smaller payload still fits in the remainder
+        EXPECT_EQ(allocator.Allocate(200), 768U);
+    }
+
+    TEST(UniformBlockAllocatorTests, WrapsToStartOfFreshBlock)
+    {
+        UniformBlockAllocator allocator(1024, 256);
+
+        EXPECT_EQ(allocator.Allocate(1000), 0U);
+        EXPECT_FALSE(allocator.Allocate(100));
+
+        // Moving on to a fresh block starts again from its beginning
+        allocator = UniformBlockAllocator(1024, 256);
+        EXPECT_EQ(allocator.Allocate(100), 0U);
+        EXPECT_EQ(allocator.Allocate(100), 256U);
+    }
+
+    TEST(UniformBlockAllocatorTests, ResetRewindsToStartOfBlock)
+    {
+        UniformBlockAllocator allocator(1024, 256);
+
+        for (unsigned int frame = 0; frame < 3; ++frame)
+        {
+            EXPECT_EQ(allocator.Allocate(100), 0U);
+            EXPECT_EQ(allocator.Allocate(100), 256U);
+            EXPECT_EQ(allocator.Allocate(100), 512U);
+            EXPECT_EQ(allocator.Allocate(100), 768U);
+            EXPECT_FALSE(allocator.Allocate(100));
+
+            allocator.Reset();
+            EXPECT_EQ(allocator.GetByteOffset(), 0U);
+        }
+    }
+
+    TEST(UniformBlockAllocatorTests, OversizedPayloadNeverFits)
+    {
+        UniformBlockAllocator allocator(1024, 256);
+
+        EXPECT_FALSE(allocator.Allocate(1025));
+        EXPECT_EQ(allocator.GetByteOffset(), 0U);
+    }
+
+    TEST(UniformBlockAllocatorTests, DefaultAllocatorHasNoRoom)
+    {
+        UniformBlockAllocator allocator;
+
+        EXPECT_FALSE(allocator.Allocate(1));
+    }
+
+    TEST(UniformBlockAllocatorTests, ZeroAlignmentIsTreatedAsUnaligned)
+    {
+        UniformBlockAllocator allocator(64, 0);
+
+        EXPECT_EQ(allocator.Allocate(3), 0U);
+        EXPECT_EQ(allocator.Allocate(5), 3U);
+    }
+}
+
+#endif //WIREDENGINE_WIREDGPUVKTESTS_UNIFORMBLOCKALLOCATORTESTS_H
@@ -17,6 +17,8 @@
 #include <cstddef>
 #include <string>
 #include <unordered_map>
+#include <filesystem>
+#include <optional>
 
 namespace Wired::Platform
 {
@@ -43,6 +45,12 @@ namespace Wired::Platform
              * @return The engine's required shader asset contents, shader asset name -> asset contents
              */
             [[nodiscard]] virtual std::expected<ShaderContentsMap, bool> GetEngineShaderContentsBlocking(GPU::ShaderBinaryType shaderBinaryType) const = 0;
+
+            /**
+             * @return A writable, per-user directory the engine can cache data it derives from packages in
+             * (e.g. cooked collision), or std::nullopt if the platform has none
+             */
+            [[nodiscard]] virtual std::optional<std::filesystem::path> GetCacheDirectoryPath() const = 0;
     };
 }
 
@@ -12,6 +12,7 @@
 #include <string>
 #include <span>
 #include <expected>
+#include <cstdint>
 
 namespace Wired::Platform
 {
@@ -31,6 +32,19 @@ namespace Wired::Platform
             [[nodiscard]] virtual std::expected<RenderedText, bool> RenderText(const std::string& text,
                                                                                const std::string& fontName,
                                                                                const TextProperties& properties) = 0;
+
+            //
+            // Glyphs, for callers which lay out text themselves
+            //
+            [[nodiscard]] virtual std::expected<FontMetrics, bool> GetFontMetrics(const std::string& fontName, FontSize fontSize) = 0;
+            [[nodiscard]] virtual std::expected<RenderedGlyph, bool> RenderGlyph(const std::string& fontName,
+                                                                                 FontSize fontSize,
+                                                                                 uint32_t codepoint,
+                                                                                 const Color& fgColor) = 0;
+            [[nodiscard]] virtual int32_t GetGlyphKerning(const std::string& fontName,
+                                                          FontSize fontSize,
+                                                          uint32_t previousCodepoint,
+                                                          uint32_t codepoint) = 0;
     };
 }
 
@@ -22,6 +22,20 @@ namespace Wired::Platform
         uint32_t textPixelHeight{0}; // Pixel height of the text, within the rendered image
     };
 
+    struct RenderedGlyph
+    {
+        // The rendered glyph's image data, on a transparent background. A full line height tall, with the
+        // glyph placed relative to the line's top. Null for glyphs with nothing to draw, such as spaces.
+        std::unique_ptr<NCommon::ImageData> imageData;
+        int32_t advance{0}; // Pixels to advance the pen by after the glyph
+    };
+
+    struct FontMetrics
+    {
+        int32_t height{0}; // Pixel height of a line of text
+        int32_t lineSkip{0}; // Pixel distance between the tops of consecutive lines
+    };
+
     using FontSize = uint16_t;
 
     struct TextProperties
@@ -44,6 +44,16 @@ namespace Wired::Platform
 
             [[nodiscard]] std::expected<RenderedText, bool> RenderText(const std::string& text,  const std::string& fontName, const TextProperties& properties) override;
 
+            [[nodiscard]] std::expected<FontMetrics, bool> GetFontMetrics(const std::string& fontName, FontSize fontSize) override;
+            [[nodiscard]] std::expected<RenderedGlyph, bool> RenderGlyph(const std::string& fontName,
+                                                                         FontSize fontSize,
+                                                                         uint32_t codepoint,
+                                                                         const Color& fgColor) override;
+            [[nodiscard]] int32_t GetGlyphKerning(const std::string& fontName,
+                                                  FontSize fontSize,
+                                                  uint32_t previousCodepoint,
+                                                  uint32_t codepoint) override;
+
         private:
 
             struct Font
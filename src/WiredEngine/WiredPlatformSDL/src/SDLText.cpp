@@ -126,6 +126,83 @@ std::expected<RenderedText, bool> SDLText::RenderText(const std::string& text,
     return renderedText;
 }
 
+std::expected<FontMetrics, bool> SDLText::GetFontMetrics(const std::string& fontName, FontSize fontSize)
+{
+    const auto pFont = EnsureFontSize(fontName, fontSize);
+    if (!pFont)
+    {
+        LogError("SDLText::GetFontMetrics: Failed to ensure font size: {}", fontName);
+        return std::unexpected(false);
+    }
+
+    return FontMetrics{
+        .height = TTF_GetFontHeight(*pFont),
+        .lineSkip = TTF_GetFontLineSkip(*pFont)
+    };
+}
+
+std::expected<RenderedGlyph, bool> SDLText::RenderGlyph(const std::string& fontName, FontSize fontSize, uint32_t codepoint, const Color& fgColor)
+{
+    const auto pFont = EnsureFontSize(fontName, fontSize);
+    if (!pFont)
+    {
+        LogError("SDLText::RenderGlyph: Failed to ensure font size: {}", fontName);
+        return std::unexpected(false);
+    }
+
+    RenderedGlyph renderedGlyph{};
+
+    int minX = 0, maxX = 0, minY = 0, maxY = 0, advance = 0;
+    if (!TTF_GetGlyphMetrics(*pFont, codepoint, &minX, &maxX, &minY, &maxY, &advance))
+    {
+        LogError("SDLText::RenderGlyph: Failed to get metrics for glyph {}, error: {}", codepoint, SDL_GetError());
+        return std::unexpected(false);
+    }
+
+    renderedGlyph.advance = advance;
+
+    // Nothing to draw
+    if (maxX <= minX || maxY <= minY)
+    {
+        return renderedGlyph;
+    }
+
+    SDL_Surface* pGlyphSurface = TTF_RenderGlyph_Blended(*pFont, codepoint, ToSDLColor(fgColor));
+    if (pGlyphSurface == nullptr)
+    {
+        LogError("SDLText::RenderGlyph: Failed to render glyph {}, error: {}", codepoint, SDL_GetError());
+        return std::unexpected(false);
+    }
+
+    renderedGlyph.imageData = SDLSurfaceToImageData(m_pLogger, pGlyphSurface, false);
+    SDL_DestroySurface(pGlyphSurface);
+
+    if (renderedGlyph.imageData == nullptr)
+    {
+        LogError("SDLText::RenderGlyph: Failed to convert glyph surface for glyph {}", codepoint);
+        return std::unexpected(false);
+    }
+
+    return renderedGlyph;
+}
+
+int32_t SDLText::GetGlyphKerning(const std::string& fontName, FontSize fontSize, uint32_t previousCodepoint, uint32_t codepoint)
+{
+    const auto pFont = EnsureFontSize(fontName, fontSize);
+    if (!pFont)
+    {
+        return 0;
+    }
+
+    int kerning = 0;
+    if (!TTF_GetGlyphKerning(*pFont, previousCodepoint, codepoint, &kerning))
+    {
+        return 0;
+    }
+
+    return kerning;
+}
+
 std::expected<TTF_Font*, bool> SDLText::EnsureFontSize(const std::string& fontName, FontSize fontSize)
 {
     std::lock_guard<std::mutex> lock(m_fontsMutex);
@@ -0,0 +1,124 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_FRAMEARENA_H
+#define WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_FRAMEARENA_H
+
+#include <vector>
+#include <memory>
+#include <span>
+#include <algorithm>
+#include <type_traits>
+#include <cstddef>
+
+namespace Wired::Render
+{
+    /**
+     * Bump allocator for trivially copyable items which live for one frame's worth of work.
+     *
+     * Items are allocated out of fixed blocks, so previously returned spans stay valid as more items are allocated.
+     * Reset() makes all of the arena's memory available for reuse without freeing it, so an arena that's reused
+     * frame after frame stops allocating once it has grown to fit a frame's worth of items.
+     */
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    class FrameArena
+    {
+        public:
+
+            static constexpr std::size_t DEFAULT_BLOCK_ITEM_COUNT = 1024;
+
+        public:
+
+            explicit FrameArena(std::size_t blockItemCount = DEFAULT_BLOCK_ITEM_COUNT)
+                : m_blockItemCount(std::max<std::size_t>(blockItemCount, 1))
+            { }
+
+            FrameArena(const FrameArena&) = delete;
+            FrameArena& operator=(const FrameArena&) = delete;
+            FrameArena(FrameArena&&) noexcept = default;
+            FrameArena& operator=(FrameArena&&) noexcept = default;
+
+            /**
+             * @return Contiguous, uninitialized space for count items, valid until the arena is reset or destroyed
+             */
+            [[nodiscard]] std::span<T> Allocate(std::size_t count)
+            {
+                if (count == 0) { return {}; }
+
+                // Advance through previously allocated blocks, which are kept across resets, looking for room
+                while (m_blockIndex < m_blocks.size())
+                {
+                    auto& block = m_blocks[m_blockIndex];
+
+                    if (block.capacity - block.used >= count)
+                    {
+                        const auto allocation = std::span<T>(block.pItems.get() + block.used, count);
+                        block.used += count;
+                        return allocation;
+                    }
+
+                    m_blockIndex++;
+                }
+
+                // Requests larger than a block get a dedicated block of their own size
+                const auto capacity = std::max(count, m_blockItemCount);
+
+                m_blocks.push_back(Block{
+                    .pItems = std::make_unique_for_overwrite<T[]>(capacity),
+                    .capacity = capacity,
+                    .used = count
+                });
+
+                return {m_blocks.back().pItems.get(), count};
+            }
+
+            /**
+             * @return A copy of the provided items, valid until the arena is reset or destroyed
+             */
+            [[nodiscard]] std::span<const T> Copy(std::span<const T> items)
+            {
+                const auto allocation = Allocate(items.size());
+                std::ranges::copy(items, allocation.begin());
+                return allocation;
+            }
+
+            /**
+             * Invalidates all previous allocations, keeping the arena's memory for reuse
+             */
+            void Reset() noexcept
+            {
+                for (auto& block : m_blocks)
+                {
+                    block.used = 0;
+                }
+
+                m_blockIndex = 0;
+            }
+
+            [[nodiscard]] bool IsEmpty() const noexcept
+            {
+                return std::ranges::all_of(m_blocks, [](const Block& block){ return block.used == 0; });
+            }
+
+        private:
+
+            struct Block
+            {
+                std::unique_ptr<T[]> pItems;
+                std::size_t capacity{0};
+                std::size_t used{0};
+            };
+
+        private:
+
+            std::size_t m_blockItemCount;
+            std::vector<Block> m_blocks;
+            std::size_t m_blockIndex{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_FRAMEARENA_H
@@ -25,6 +25,7 @@
 
 #include <future>
 #include <vector>
+#include <unordered_set>
 #include <string>
 #include <optional>
 #include <memory>
@@ -66,6 +67,11 @@ namespace Wired::Render
                 const std::unordered_set<Render::TextureUsageFlag>& usages,
                 const std::string& tag) = 0;
             [[nodiscard]] virtual std::optional<NCommon::Size3DUInt> GetTextureSize(TextureId textureId) = 0;
+            /**
+             * Applies all the updates to the texture in one transfer. Regions of the texture not covered by the
+             * updates keep their contents. The update images must stay valid until the returned future is ready.
+             */
+            [[nodiscard]] virtual std::future<bool> UpdateTexture(TextureId textureId, const std::vector<TextureUpdate>& updates) = 0;
             virtual std::future<bool> DestroyTexture(TextureId textureId) = 0;
 
             //
@@ -95,6 +101,12 @@ namespace Wired::Render
             //
             [[nodiscard]] virtual std::future<std::expected<bool, GPU::SurfaceError>> RenderFrame(const RenderFrameParams& renderFrameParams) = 0;
 
+            /**
+             * Non-blocking. Returns the most recently finished render output readback, as requested via
+             * RenderFrameParams::renderOutputRequest, if one has finished since the last call.
+             */
+            [[nodiscard]] virtual std::optional<std::shared_ptr<NCommon::ImageData>> PopRenderOutput() = 0;
+
             //
             // Events
             //
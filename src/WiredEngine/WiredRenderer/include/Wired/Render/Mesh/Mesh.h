@@ -26,6 +26,9 @@ namespace Wired::Render
     struct MeshLOD
     {
         bool isValid{false};
+
+        // World space distance from the camera at which this LOD starts being used. Compared against the distance
+        // to the instance's transformed cull volume, so it isn't scaled by the instance's transform.
         float renderDistance{0.0f};
         std::unique_ptr<MeshData> pMeshData{nullptr};
     };
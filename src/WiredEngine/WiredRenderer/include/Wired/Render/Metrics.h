@@ -15,6 +15,30 @@ namespace Wired::Render
     // GPU metrics
     static constexpr auto METRIC_RENDERER_GPU_ALL_FRAME_WORK = "renderer_gpu_all_frame_work";
     static constexpr auto METRIC_RENDERER_GPU_ALL_SHADOW_MAP_RENDER_WORK = "renderer_gpu_all_shadow_map_render_work";
+    static constexpr auto METRIC_RENDERER_GPU_PIPELINE_BARRIER_COUNT = "renderer_gpu_pipeline_barrier_count";
+    static constexpr auto METRIC_RENDERER_GPU_CYCLED_BUFFER_BYTES = "renderer_gpu_cycled_buffer_bytes";
+    static constexpr auto METRIC_RENDERER_GPU_QUEUE_SUBMIT_COUNT = "renderer_gpu_queue_submit_count";
+
+    // GPU memory metrics
+    static constexpr auto METRIC_RENDERER_GPU_MEMORY_BUDGET_BYTES = "renderer_gpu_memory_budget_bytes"; // All device local heaps
+    static constexpr auto METRIC_RENDERER_GPU_MEMORY_USAGE_BYTES = "renderer_gpu_memory_usage_bytes"; // All device local heaps
+    static constexpr auto METRIC_RENDERER_GPU_MEMORY_PRESSURE_COUNT = "renderer_gpu_memory_pressure_count";
+    static constexpr auto METRIC_RENDERER_GPU_HEAP_BUDGET_BYTES_PREFIX = "renderer_gpu_heap_budget_bytes_"; // + heap index
+    static constexpr auto METRIC_RENDERER_GPU_HEAP_USAGE_BYTES_PREFIX = "renderer_gpu_heap_usage_bytes_"; // + heap index
+    static constexpr auto METRIC_RENDERER_GPU_TAG_BYTES_PREFIX = "renderer_gpu_tag_bytes_"; // + allocation tag
+
+    // Descriptor set metrics
+    static constexpr auto METRIC_RENDERER_GPU_DESCRIPTOR_CACHE_SIZE = "renderer_gpu_descriptor_cache_size";
+    static constexpr auto METRIC_RENDERER_GPU_DESCRIPTOR_CACHE_HIT_RATE = "renderer_gpu_descriptor_cache_hit_rate"; // 0..1, this frame
+    static constexpr auto METRIC_RENDERER_GPU_TRANSIENT_DESCRIPTOR_COUNT = "renderer_gpu_transient_descriptor_count";
+
+    // Staging metrics
+    static constexpr auto METRIC_RENDERER_STAGING_RING_BYTES = "renderer_staging_ring_bytes";
+    static constexpr auto METRIC_RENDERER_STAGING_POOL_BYTES = "renderer_staging_pool_bytes";
+
+    // Readback metrics
+    static constexpr auto METRIC_RENDERER_READBACK_LATENCY_FRAMES = "renderer_readback_latency_frames";
+    static constexpr auto METRIC_RENDERER_READBACK_SKIPPED_COUNT = "renderer_readback_skipped_count";
 }
 
 #endif //WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_METRICS_H
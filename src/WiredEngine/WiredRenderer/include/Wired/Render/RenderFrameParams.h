@@ -7,23 +7,65 @@
 #ifndef WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_RENDERFRAMEPARAMS_H
 #define WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_RENDERFRAMEPARAMS_H
 
+#include "Id.h"
 #include "StateUpdate.h"
 
 #include "Task/RenderTask.h"
 
+#include <Wired/GPU/GPUCommon.h>
+
+#include <NEON/Common/Space/Size2D.h>
+
 #include <vector>
 #include <memory>
 #include <optional>
+#include <cstdint>
 
 struct ImDrawData;
 
 namespace Wired::Render
 {
+    /**
+     * Requests that a color texture be read back to the CPU once the frame's render tasks have finished. The
+     * readback is asynchronous; finished readbacks are retrieved via IRenderer::PopRenderOutput.
+     *
+     * Output is always read back as 8 bit per channel B8G8R8A8 data. Render targets (ColorTarget / PostProcess
+     * textures) are 16 bit float; they're blitted into that format with no tonemapping, so values are clamped to
+     * [0..1]. This matches what presentation shows for the same texture, but HDR values above 1 aren't preserved;
+     * to read back tonemapped output, request the texture that HDR effects tonemapped into.
+     */
+    struct RenderOutputRequest
+    {
+        TextureId textureId{};
+
+        // If set, the texture is downscaled on the GPU to this size before being read back
+        std::optional<NCommon::Size2DUInt> downscaleSize;
+
+        // The color space of the read back data. If it differs from the texture's color space, the
+        // data is converted on the GPU before being read back.
+        GPU::ColorSpace colorSpace{GPU::ColorSpace::SRGB};
+    };
+
+    /**
+     * Allows frames rendered between simulation steps to blend renderable transforms from their previous simulation
+     * step's state towards their latest simulation step's state, rather than showing the latest state as-is.
+     */
+    struct RenderInterpolation
+    {
+        // Index of the latest simulation step whose state is reflected by the frame's state updates
+        std::uintmax_t simStepIndex{0};
+
+        // How far, [0..1], time has progressed from the latest simulation step towards the next one
+        float alpha{1.0f};
+    };
+
     struct RenderFrameParams
     {
-        std::vector<StateUpdate> stateUpdates;
+        std::vector<std::shared_ptr<const StateUpdate>> stateUpdates;
         std::vector<std::shared_ptr<RenderTask>> renderTasks;
         std::optional<ImDrawData*> imDrawData;
+        std::optional<RenderOutputRequest> renderOutputRequest;
+        std::optional<RenderInterpolation> interpolation;
     };
 }
 
@@ -11,8 +11,7 @@
 
 #include <glm/glm.hpp>
 
-#include <vector>
-#include <optional>
+#include <span>
 
 namespace Wired::Render
 {
@@ -24,7 +23,10 @@ namespace Wired::Render
         MaterialId materialId{};
         bool castsShadows{true};
         glm::mat4 modelTransform{1.0f};
-        std::optional<std::vector<glm::mat4>> boneTransforms;
+
+        // Empty for objects without bones. References the bone transform storage of the StateUpdate which carries
+        // the renderable, so is only valid while that update is being applied.
+        std::span<const glm::mat4> boneTransforms;
     };
 }
 
@@ -7,16 +7,26 @@
 #ifndef WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_STATEUPDATE_H
 #define WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_STATEUPDATE_H
 
+#include "FrameArena.h"
+
 #include "Renderable/SpriteRenderable.h"
 #include "Renderable/ObjectRenderable.h"
 #include "Renderable/Light.h"
 
-#include <unordered_set>
+#include <glm/glm.hpp>
+
 #include <vector>
 #include <string>
+#include <algorithm>
 
 namespace Wired::Render
 {
+    /**
+     * A batch of renderable changes for one render group.
+     *
+     * Made up of flat arrays which are cleared, rather than freed, between uses; see StateUpdatePool. Not copyable;
+     * state updates are handed to the renderer by pointer.
+     */
     struct StateUpdate
     {
         std::string groupName;
@@ -29,12 +39,17 @@ namespace Wired::Render
         std::vector<ObjectRenderable> toUpdateObjectRenderables;
         std::vector<Light> toUpdateLights;
 
-        std::unordered_set<SpriteId> toDeleteSpriteRenderables;
-        std::unordered_set<ObjectId> toDeleteObjectRenderables;
-        std::unordered_set<LightId> toDeleteLights;
+        // Note: The renderer returns each deleted id to its pool once per appearance, so these must be free of
+        // duplicates by the time the update is handed to the renderer; see RemoveDuplicateDeletes()
+        std::vector<SpriteId> toDeleteSpriteRenderables;
+        std::vector<ObjectId> toDeleteObjectRenderables;
+        std::vector<LightId> toDeleteLights;
         // Note: If adding more toDeletes, make sure the renderer
         // returns their ids to the pool when processing the update
 
+        // Backing storage for the bone transforms of this update's object renderables
+        FrameArena<glm::mat4> boneTransforms;
+
         [[nodiscard]] bool IsEmpty() const noexcept
         {
             return
@@ -48,6 +63,44 @@ namespace Wired::Render
                 toDeleteObjectRenderables.empty() &&
                 toDeleteLights.empty();
         }
+
+        /**
+         * Removes repeated ids from the to-delete lists. Doesn't preserve the lists' order.
+         */
+        void RemoveDuplicateDeletes()
+        {
+            const auto removeDuplicates = [](auto& ids){
+                std::ranges::sort(ids);
+                const auto duplicates = std::ranges::unique(ids);
+                ids.erase(duplicates.begin(), duplicates.end());
+            };
+
+            removeDuplicates(toDeleteSpriteRenderables);
+            removeDuplicates(toDeleteObjectRenderables);
+            removeDuplicates(toDeleteLights);
+        }
+
+        /**
+         * Empties the update while keeping its memory for reuse
+         */
+        void Clear() noexcept
+        {
+            groupName.clear();
+
+            toAddSpriteRenderables.clear();
+            toAddObjectRenderables.clear();
+            toAddLights.clear();
+
+            toUpdateSpriteRenderables.clear();
+            toUpdateObjectRenderables.clear();
+            toUpdateLights.clear();
+
+            toDeleteSpriteRenderables.clear();
+            toDeleteObjectRenderables.clear();
+            toDeleteLights.clear();
+
+            boneTransforms.Reset();
+        }
     };
 }
 
@@ -0,0 +1,64 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_STATEUPDATEPOOL_H
+#define WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_STATEUPDATEPOOL_H
+
+#include "StateUpdate.h"
+
+#include <NEON/Common/SharedLib.h>
+
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <cstddef>
+
+namespace Wired::Render
+{
+    /**
+     * Recycles StateUpdates between the thread which produces them and the render thread which consumes them.
+     *
+     * A producer acquires an update, fills it, and then shares it into a RenderFrameParams. No copy is made; when
+     * the last reference to the shared update is released, typically by the render thread once the frame's state
+     * updates have been applied, the update is cleared and returned to the pool with its memory intact.
+     *
+     * Must be created via Create(), as shared updates keep their pool alive.
+     */
+    class NEON_PUBLIC StateUpdatePool : public std::enable_shared_from_this<StateUpdatePool>
+    {
+        public:
+
+            // Enough for an update being filled, one in flight to the renderer, and one being applied
+            static constexpr std::size_t MAX_POOLED_UPDATES = 3;
+
+        public:
+
+            [[nodiscard]] static std::shared_ptr<StateUpdatePool> Create();
+
+            /**
+             * @return An empty state update, recycled if possible
+             */
+            [[nodiscard]] std::unique_ptr<StateUpdate> Acquire();
+
+            /**
+             * Converts a state update into a shared, read-only update which returns to this pool once released
+             */
+            [[nodiscard]] std::shared_ptr<const StateUpdate> Share(std::unique_ptr<StateUpdate> stateUpdate);
+
+        private:
+
+            StateUpdatePool() = default;
+
+            void Release(StateUpdate* pStateUpdate);
+
+        private:
+
+            std::mutex m_pooledMutex;
+            std::vector<std::unique_ptr<StateUpdate>> m_pooled;
+    };
+}
+
+#endif //WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_STATEUPDATEPOOL_H
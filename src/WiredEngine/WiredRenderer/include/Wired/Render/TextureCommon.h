@@ -9,6 +9,7 @@
 
 #include <Wired/GPU/GPUCommon.h>
 
+#include <NEON/Common/ImageData.h>
 #include <NEON/Common/Space/Size3D.h>
 
 #include <cstdint>
@@ -50,6 +51,16 @@ namespace Wired::Render
         uint32_t numLayers{1};
         uint32_t numMipLevels{1};
     };
+
+    /**
+     * Replaces a region of a texture's first layer/mip level with the contents of an image
+     */
+    struct TextureUpdate
+    {
+        NCommon::ImageData const* pImageData{nullptr}; // Source image; its size is the size of the updated region
+        uint32_t x{0}; // Pixel x offset of the updated region within the texture
+        uint32_t y{0}; // Pixel y offset of the updated region within the texture
+    };
 }
 
 #endif //WIREDENGINE_WIREDRENDERER_INCLUDE_WIRED_RENDER_TEXTURECOMMON_H
@@ -53,11 +53,25 @@ void DataStores::ShutDown()
     lights.ShutDown();
 }
 
-void DataStores::ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate)
+void DataStores::ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate)
 {
-    objects.ApplyStateUpdate(commandBufferId, stateUpdate);
-    sprites.ApplyStateUpdate(commandBufferId, stateUpdate);
-    lights.ApplyStateUpdate(commandBufferId, stateUpdate);
+    objects.ApplyStateUpdate(copyPass, stateUpdate);
+    sprites.ApplyStateUpdate(copyPass, stateUpdate);
+    lights.ApplyStateUpdate(copyPass, stateUpdate);
+}
+
+void DataStores::ApplyInterpolation(GPU::CommandBufferId commandBufferId, const std::optional<RenderInterpolation>& interpolation)
+{
+    // Note: Lights aren't interpolated, as their positions are also consumed on the CPU for shadow rendering
+    objects.ApplyInterpolation(commandBufferId, interpolation);
+    sprites.ApplyInterpolation(commandBufferId, interpolation);
+}
+
+void DataStores::TrimMemory(GPU::CopyPass copyPass)
+{
+    objects.TrimMemory(copyPass);
+    sprites.TrimMemory(copyPass);
+    lights.TrimMemory(copyPass);
 }
 
 }
@@ -12,6 +12,7 @@
 #include "LightDataStore.h"
 
 #include <Wired/Render/StateUpdate.h>
+#include <Wired/Render/RenderFrameParams.h>
 #include <Wired/Render/Id.h>
 
 namespace Wired::Render
@@ -28,7 +29,9 @@ namespace Wired::Render
             [[nodiscard]] bool StartUp();
             void ShutDown();
 
-            void ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate);
+            void ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate);
+            void ApplyInterpolation(GPU::CommandBufferId commandBufferId, const std::optional<RenderInterpolation>& interpolation);
+            void TrimMemory(GPU::CopyPass copyPass);
 
         public:
 
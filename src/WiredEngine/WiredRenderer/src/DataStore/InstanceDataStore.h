@@ -12,11 +12,16 @@
 
 #include <Wired/Render/Id.h>
 #include <Wired/Render/StateUpdate.h>
+#include <Wired/Render/RenderFrameParams.h>
 #include "Wired/GPU/WiredGPU.h"
 
 #include <NEON/Common/Log/ILogger.h>
 
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
+#include <optional>
+#include <limits>
 
 namespace NCommon
 {
@@ -25,16 +30,19 @@ namespace NCommon
 
 namespace Wired::Render
 {
+    /**
+     * Stores renderable instances, and their GPU payloads, in dense slots. Removing an instance moves the
+     * last slot's instance into its place, so the slots stay compacted and can be iterated over by live
+     * instance count rather than by the highest id ever handed out.
+     *
+     * Shaders which look up an instance by id go through the instance slots buffer, which maps id -> slot.
+     */
     template <typename RenderableType, typename PayloadType>
     class InstanceDataStore
     {
         public:
 
-            struct InstanceData
-            {
-                bool isValid{false};
-                RenderableType instance{};
-            };
+            static constexpr uint32_t INVALID_SLOT = std::numeric_limits<uint32_t>::max();
 
         public:
 
@@ -45,12 +53,30 @@ namespace Wired::Render
             [[nodiscard]] virtual bool StartUp();
             virtual void ShutDown();
 
-            void ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate);
+            void ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate);
+
+            /**
+             * Blends the payloads of instances which were updated by the latest simulation step between their
+             * previous and latest states. Instances whose latest update is from an older simulation step, or all
+             * instances if no interpolation is provided, are settled back to their latest state.
+             */
+            void ApplyInterpolation(GPU::CommandBufferId commandBufferId, const std::optional<RenderInterpolation>& interpolation);
+
+            /**
+             * Releases unused capacity from the instance payloads and slots buffers
+             */
+            void TrimMemory(GPU::CopyPass copyPass);
 
-            [[nodiscard]] std::size_t GetInstanceCount() const noexcept;
+            [[nodiscard]] std::size_t GetInstanceCount() const noexcept { return m_instances.size(); }
+
+            // Slot -> instance payload
             [[nodiscard]] GPU::BufferId GetInstancePayloadsBuffer() const noexcept { return m_instancePayloadsBuffer.GetBufferId(); }
 
-            [[nodiscard]] const std::vector<InstanceData>& GetInstances() const noexcept { return m_instances; }
+            // Instance id -> slot, or INVALID_SLOT
+            [[nodiscard]] GPU::BufferId GetInstanceSlotsBuffer() const noexcept { return m_instanceSlotsBuffer.GetBufferId(); }
+
+            // Slot -> instance
+            [[nodiscard]] const std::vector<RenderableType>& GetInstances() const noexcept { return m_instances; }
 
         protected:
 
@@ -60,6 +86,18 @@ namespace Wired::Render
 
             [[nodiscard]] virtual std::expected<PayloadType, bool> PayloadFrom(const RenderableType& renderableType) const = 0;
 
+            /**
+             * @return The renderable blended alpha of the way from previous to current, or std::nullopt if the
+             * renderable type doesn't support interpolation
+             */
+            [[nodiscard]] virtual std::optional<RenderableType> InterpolateInstance(const RenderableType&, const RenderableType&, float) const { return std::nullopt; }
+
+            /**
+             * Clears anything the store's copy of an instance references within the StateUpdate it arrived in,
+             * as state updates are recycled once they've been applied
+             */
+            virtual void ReleaseStateUpdateReferences(RenderableType&) const { }
+
             void AddOrUpdate(GPU::CopyPass copyPass, const std::vector<RenderableType>& instances);
             void Remove(GPU::CopyPass copyPass, const std::vector<RenderableId>& ids);
 
@@ -69,13 +107,32 @@ namespace Wired::Render
 
         private:
 
-            void AddOrUpdateInstancePayloadsBuffer(GPU::CopyPass copyPass, const std::vector<PayloadType>& payloads);
+            struct InterpolatingInstance
+            {
+                RenderableType previous{};
+
+                // The simulation step the instance's latest update came from; unset until the next interpolation
+                std::optional<std::uintmax_t> simStepIndex;
+
+                // Whether a blended payload, rather than the latest payload, is currently in the GPU buffer
+                bool blended{false};
+            };
+
+        private:
+
+            void UpdateInstancePayloadsBuffer(GPU::CopyPass copyPass, const std::vector<PayloadType>& payloads);
+            void UpdateInstanceSlotsBuffer(GPU::CopyPass copyPass, std::vector<ItemUpdate<uint32_t>> slotUpdates);
 
         private:
 
             ItemBuffer<PayloadType> m_instancePayloadsBuffer;
+            ItemBuffer<uint32_t> m_instanceSlotsBuffer;
+
+            std::vector<RenderableType> m_instances;
+            std::vector<uint32_t> m_idToSlot;
 
-            std::vector<InstanceData> m_instances;
+            // Instance id -> interpolation state, for instances which were updated since they were last settled
+            std::unordered_map<NCommon::IdTypeIntegral, InterpolatingInstance> m_interpolating;
     };
 
     template <typename RenderableType, typename PayloadType>
@@ -90,6 +147,16 @@ namespace Wired::Render
             return false;
         }
 
+        if (!m_instanceSlotsBuffer.Create(m_pGlobal,
+                                          {GPU::BufferUsageFlag::GraphicsStorageRead},
+                                          64,
+                                          false,
+                                          std::format("{}Slots", GetTag())))
+        {
+            m_instancePayloadsBuffer.Destroy();
+            return false;
+        }
+
         return true;
     }
 
@@ -97,38 +164,98 @@ namespace Wired::Render
     void InstanceDataStore<RenderableType, PayloadType>::ShutDown()
     {
         m_instancePayloadsBuffer.Destroy();
+        m_instanceSlotsBuffer.Destroy();
+
+        m_instances.clear();
+        m_idToSlot.clear();
+        m_interpolating.clear();
     }
 
     template <typename RenderableType, typename PayloadType>
-    void InstanceDataStore<RenderableType, PayloadType>::ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate)
+    void InstanceDataStore<RenderableType, PayloadType>::TrimMemory(GPU::CopyPass copyPass)
     {
-        const auto copyPass = m_pGlobal->pGPU->BeginCopyPass(commandBufferId, std::format("InstanceStateUpdate-{}", GetTag()));
-        if (!copyPass)
+        if (!m_instancePayloadsBuffer.ShrinkToFit(copyPass))
         {
-            m_pGlobal->pLogger->Error("InstanceDataStore::ApplyStateUpdate: Failed to begin copy pass");
-            return;
+            m_pGlobal->pLogger->Error("InstanceDataStore::TrimMemory: Failed to shrink instances buffer for: {}", GetTag());
         }
 
-        //
-        // Apply state updates
-        //
-        ApplyStateUpdateInternal(*copyPass, stateUpdate);
+        // Ids past the highest live id no longer need an entry in the id -> slot table
+        while (!m_idToSlot.empty() && m_idToSlot.back() == INVALID_SLOT)
+        {
+            m_idToSlot.pop_back();
+        }
 
-        //
-        // Finish
-        //
-        m_pGlobal->pGPU->EndCopyPass(*copyPass);
+        if (!m_instanceSlotsBuffer.Resize(copyPass, m_idToSlot.size()) || !m_instanceSlotsBuffer.ShrinkToFit(copyPass))
+        {
+            m_pGlobal->pLogger->Error("InstanceDataStore::TrimMemory: Failed to shrink instance slots buffer for: {}", GetTag());
+        }
+    }
+
+    template <typename RenderableType, typename PayloadType>
+    void InstanceDataStore<RenderableType, PayloadType>::ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate)
+    {
+        ApplyStateUpdateInternal(copyPass, stateUpdate);
     }
 
     template <typename RenderableType, typename PayloadType>
-    std::size_t InstanceDataStore<RenderableType, PayloadType>::GetInstanceCount() const noexcept
+    void InstanceDataStore<RenderableType, PayloadType>::ApplyInterpolation(GPU::CommandBufferId commandBufferId,
+                                                                            const std::optional<RenderInterpolation>& interpolation)
     {
-        const auto itemSize = m_instancePayloadsBuffer.GetItemSize();
+        if (m_interpolating.empty()) { return; }
+
+        std::vector<PayloadType> payloads;
+        payloads.reserve(m_interpolating.size());
+
+        for (auto it = m_interpolating.begin(); it != m_interpolating.end();)
+        {
+            auto& interpolating = it->second;
+            const auto& current = m_instances.at(m_idToSlot.at(it->first));
+
+            if (interpolation && !interpolating.simStepIndex)
+            {
+                interpolating.simStepIndex = interpolation->simStepIndex;
+            }
 
-        // Any item at index 0 is the default/invalid renderable id, ignore it
-        if (itemSize <= 1) { return 0; }
+            //
+            // If the instance hasn't been updated by the latest simulation step, it's no longer moving; settle
+            // it back to its latest state (which is already in the GPU buffer unless we'd blended it)
+            //
+            if (!interpolation || *interpolating.simStepIndex != interpolation->simStepIndex)
+            {
+                if (interpolating.blended)
+                {
+                    if (const auto payload = PayloadFrom(current)) { payloads.push_back(*payload); }
+                }
+
+                it = m_interpolating.erase(it);
+                continue;
+            }
 
-        return itemSize - 1;
+            const auto blendedInstance = InterpolateInstance(interpolating.previous, current, std::clamp(interpolation->alpha, 0.0f, 1.0f));
+            if (blendedInstance)
+            {
+                if (const auto payload = PayloadFrom(*blendedInstance))
+                {
+                    payloads.push_back(*payload);
+                    interpolating.blended = true;
+                }
+            }
+
+            ++it;
+        }
+
+        if (payloads.empty()) { return; }
+
+        const auto copyPass = m_pGlobal->pGPU->BeginCopyPass(commandBufferId, std::format("InstanceInterpolation-{}", GetTag()));
+        if (!copyPass)
+        {
+            m_pGlobal->pLogger->Error("InstanceDataStore::ApplyInterpolation: Failed to begin copy pass");
+            return;
+        }
+
+        UpdateInstancePayloadsBuffer(*copyPass, payloads);
+
+        m_pGlobal->pGPU->EndCopyPass(*copyPass);
     }
 
     template <typename RenderableType, typename PayloadType>
@@ -136,56 +263,69 @@ namespace Wired::Render
     {
         if (instances.empty()) { return; }
 
-        NCommon::IdTypeIntegral highestId{};
-
         std::vector<PayloadType> payloads;
+        std::vector<ItemUpdate<uint32_t>> slotUpdates;
 
         for (const auto& instance : instances)
         {
             auto payload = PayloadFrom(instance);
             if (!payload) { continue; }
 
-            highestId = std::max(highestId, payload->id);
+            const auto id = instance.id.id;
 
-            payloads.push_back(std::move(*payload));
-        }
+            if (m_idToSlot.size() < id + 1)
+            {
+                m_idToSlot.resize(id + 1, INVALID_SLOT);
+            }
 
-        AddOrUpdateInstancePayloadsBuffer(copyPass, payloads);
+            auto& slot = m_idToSlot.at(id);
 
-        //
-        // Upload local state with new data
-        //
-        if (m_instances.size() < highestId + 1)
-        {
-            m_instances.resize(highestId + 1);
-        }
+            // New instances are appended to the end of the slots
+            if (slot == INVALID_SLOT)
+            {
+                slot = (uint32_t)m_instances.size();
+                ReleaseStateUpdateReferences(m_instances.emplace_back(instance));
 
-        for (const auto& instance : instances)
-        {
-            auto& instanceData = m_instances.at(instance.id.id);
-            instanceData.isValid = true;
-            instanceData.instance = instance;
+                slotUpdates.push_back(ItemUpdate<uint32_t>{.item = slot, .index = id});
+            }
+            else
+            {
+                auto& existing = m_instances.at(slot);
+
+                // Updates to existing instances can be interpolated from the instance's previous state. Note that if
+                // an instance is updated multiple times before being interpolated, it interpolates from its state
+                // before the first of those updates.
+                const auto it = m_interpolating.find(id);
+                if (it == m_interpolating.cend() || it->second.simStepIndex)
+                {
+                    m_interpolating.insert_or_assign(id, InterpolatingInstance{.previous = existing});
+                }
+
+                existing = instance;
+                ReleaseStateUpdateReferences(existing);
+            }
+
+            payloads.push_back(std::move(*payload));
         }
+
+        UpdateInstanceSlotsBuffer(copyPass, slotUpdates);
+        UpdateInstancePayloadsBuffer(copyPass, payloads);
     }
 
     template <typename RenderableType, typename PayloadType>
-    void InstanceDataStore<RenderableType, PayloadType>::AddOrUpdateInstancePayloadsBuffer(GPU::CopyPass copyPass, const std::vector<PayloadType>& payloads)
+    void InstanceDataStore<RenderableType, PayloadType>::UpdateInstancePayloadsBuffer(GPU::CopyPass copyPass, const std::vector<PayloadType>& payloads)
     {
         if (payloads.empty()) { return; }
 
         std::vector<ItemUpdate<PayloadType>> updates;
         updates.reserve(payloads.size());
 
-        NCommon::IdTypeIntegral highestId{};
-
         for (const auto& payload : payloads)
         {
             updates.push_back(ItemUpdate<PayloadType>{
                 .item = payload,
-                .index = payload.id
+                .index = m_idToSlot.at(payload.id)
             });
-
-            highestId = std::max(highestId, payload.id);
         }
 
         // Sort the items by index so that ItemBuffer can efficiently batch neighboring updates together
@@ -196,19 +336,37 @@ namespace Wired::Render
         //
         // Update GPU buffer with new data
         //
-        const auto currentInstancesSize = m_instancePayloadsBuffer.GetItemSize();
-        if (currentInstancesSize < highestId + 1)
+        if (!m_instancePayloadsBuffer.ResizeAtLeast(copyPass, m_instances.size()))
         {
-            if (!m_instancePayloadsBuffer.Resize(copyPass, highestId + 1))
-            {
-                m_pGlobal->pLogger->Error("InstanceDataStore::AddOrUpdate: Failed to resize instances buffer for: {}", GetTag());
-                return;
-            }
+            m_pGlobal->pLogger->Error("InstanceDataStore::UpdateInstancePayloadsBuffer: Failed to resize instances buffer for: {}", GetTag());
+            return;
+        }
+
+        if (!m_instancePayloadsBuffer.Update(copyPass, updates))
+        {
+            m_pGlobal->pLogger->Error("InstanceDataStore::UpdateInstancePayloadsBuffer: Failed to update instances buffer for: {}", GetTag());
+            return;
+        }
+    }
+
+    template <typename RenderableType, typename PayloadType>
+    void InstanceDataStore<RenderableType, PayloadType>::UpdateInstanceSlotsBuffer(GPU::CopyPass copyPass, std::vector<ItemUpdate<uint32_t>> slotUpdates)
+    {
+        if (slotUpdates.empty()) { return; }
+
+        std::ranges::sort(slotUpdates, [](const ItemUpdate<uint32_t>& a, const ItemUpdate<uint32_t>& b){
+            return a.index < b.index;
+        });
+
+        if (!m_instanceSlotsBuffer.ResizeAtLeast(copyPass, m_idToSlot.size()))
+        {
+            m_pGlobal->pLogger->Error("InstanceDataStore::UpdateInstanceSlotsBuffer: Failed to resize instance slots buffer for: {}", GetTag());
+            return;
         }
 
-        if (!m_instancePayloadsBuffer.Update(std::format("InstancesSync:{}", GetTag()), copyPass, updates))
+        if (!m_instanceSlotsBuffer.Update(copyPass, slotUpdates))
         {
-            m_pGlobal->pLogger->Error("InstanceDataStore::AddOrUpdate: Failed to update instances buffer for: {}", GetTag());
+            m_pGlobal->pLogger->Error("InstanceDataStore::UpdateInstanceSlotsBuffer: Failed to update instance slots buffer for: {}", GetTag());
             return;
         }
     }
@@ -216,20 +374,78 @@ namespace Wired::Render
     template <typename RenderableType, typename PayloadType>
     void InstanceDataStore<RenderableType, PayloadType>::Remove(GPU::CopyPass copyPass, const std::vector<RenderableId>& ids)
     {
-        std::vector<PayloadType> removePayloads;
+        std::vector<ItemUpdate<uint32_t>> slotUpdates;
+
+        // Ids of instances which were moved into a vacated slot
+        std::unordered_set<NCommon::IdTypeIntegral> movedIds;
 
         for (const auto& id : ids)
         {
-            PayloadType removePayload{};
-            removePayload.isValid = false;
-            removePayload.id = id.id;
+            if (id.id >= m_idToSlot.size() || m_idToSlot.at(id.id) == INVALID_SLOT) { continue; }
+
+            const auto slot = m_idToSlot.at(id.id);
+            const auto lastSlot = (uint32_t)m_instances.size() - 1;
+
+            // Fill the vacated slot with the last slot's instance, to keep the slots dense
+            if (slot != lastSlot)
+            {
+                m_instances.at(slot) = std::move(m_instances.at(lastSlot));
+
+                const auto movedId = m_instances.at(slot).id.id;
+                m_idToSlot.at(movedId) = slot;
+                movedIds.insert(movedId);
+            }
+
+            m_instances.pop_back();
 
-            removePayloads.push_back(removePayload);
+            m_idToSlot.at(id.id) = INVALID_SLOT;
+            movedIds.erase(id.id);
+            m_interpolating.erase(id.id);
 
-            m_instances.at(id.id).isValid = false;
+            slotUpdates.push_back(ItemUpdate<uint32_t>{.item = INVALID_SLOT, .index = id.id});
         }
 
-        AddOrUpdateInstancePayloadsBuffer(copyPass, removePayloads);
+        //
+        // Moved instances need their slot mapping and their payload re-written at their new slot
+        //
+        std::vector<PayloadType> movedPayloads;
+
+        for (const auto& movedId : movedIds)
+        {
+            const auto slot = m_idToSlot.at(movedId);
+
+            slotUpdates.push_back(ItemUpdate<uint32_t>{.item = slot, .index = movedId});
+
+            if (const auto payload = PayloadFrom(m_instances.at(slot)))
+            {
+                movedPayloads.push_back(*payload);
+            }
+            else
+            {
+                // Don't leave the removed instance's payload in the slot
+                PayloadType invalidPayload{};
+                invalidPayload.isValid = false;
+                invalidPayload.id = movedId;
+
+                movedPayloads.push_back(invalidPayload);
+            }
+
+            // The latest, rather than any blended, payload is what's now in the GPU buffer
+            const auto it = m_interpolating.find(movedId);
+            if (it != m_interpolating.cend())
+            {
+                it->second.blended = false;
+            }
+        }
+
+        UpdateInstanceSlotsBuffer(copyPass, slotUpdates);
+        UpdateInstancePayloadsBuffer(copyPass, movedPayloads);
+
+        // Shrink only after the moved payloads were written, so that they're retained by any buffer re-allocation
+        if (!m_instancePayloadsBuffer.Resize(copyPass, m_instances.size()))
+        {
+            m_pGlobal->pLogger->Error("InstanceDataStore::Remove: Failed to resize instances buffer for: {}", GetTag());
+        }
     }
 }
 
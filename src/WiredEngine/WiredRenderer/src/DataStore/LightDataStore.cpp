@@ -38,7 +38,7 @@ void LightDataStore::Update(GPU::CopyPass copyPass, const std::vector<Light>& li
     AddOrUpdate(copyPass, lights);
 }
 
-void LightDataStore::Remove(GPU::CopyPass copyPass, const std::unordered_set<LightId>& lightIds)
+void LightDataStore::Remove(GPU::CopyPass copyPass, const std::vector<LightId>& lightIds)
 {
     if (lightIds.empty()) { return; }
 
@@ -12,6 +12,7 @@
 #include "../Renderer/RendererCommon.h"
 
 #include <unordered_map>
+#include <vector>
 
 namespace Wired::Render
 {
@@ -34,7 +35,7 @@ namespace Wired::Render
 
             void Add(GPU::CopyPass copyPass, const std::vector<Light>& lights);
             void Update(GPU::CopyPass copyPass, const std::vector<Light>& lights);
-            void Remove(GPU::CopyPass copyPass, const std::unordered_set<LightId>& lightIds);
+            void Remove(GPU::CopyPass copyPass, const std::vector<LightId>& lightIds);
     };
 }
 
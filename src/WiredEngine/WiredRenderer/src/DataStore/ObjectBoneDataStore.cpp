@@ -47,8 +47,8 @@ void ObjectBoneDataStore::ShutDown()
 
 void ObjectBoneDataStore::Add(GPU::CopyPass copyPass, const ObjectRenderable& objectRenderable)
 {
-    assert(objectRenderable.boneTransforms);
-    if (!objectRenderable.boneTransforms) { return; }
+    assert(!objectRenderable.boneTransforms.empty());
+    if (objectRenderable.boneTransforms.empty()) { return; }
 
     //
     // Get or create the bone transforms buffer for the object's mesh
@@ -123,23 +123,23 @@ void ObjectBoneDataStore::Add(GPU::CopyPass copyPass, const ObjectRenderable& ob
     if (placeIndex)
     {
         std::vector<ItemUpdate<glm::mat4>> itemUpdates;
-        itemUpdates.reserve(objectRenderable.boneTransforms->size());
+        itemUpdates.reserve(objectRenderable.boneTransforms.size());
 
-        for (unsigned int x = 0; x < objectRenderable.boneTransforms->size(); ++x)
+        for (unsigned int x = 0; x < objectRenderable.boneTransforms.size(); ++x)
         {
             itemUpdates.push_back(ItemUpdate<glm::mat4>{
-                .item = objectRenderable.boneTransforms->at(x),
+                .item = objectRenderable.boneTransforms[x],
                 .index = *placeIndex + x
             });
         }
 
-        if (!boneTransformsBufferIt->second.Update("ObjectBonesTransfer", copyPass, itemUpdates))
+        if (!boneTransformsBufferIt->second.Update(copyPass, itemUpdates))
         {
             m_pGlobal->pLogger->Error("ObjectBoneDataStore::Add: Failed to update bone transforms");
             return;
         }
 
-        if (!boneMappingsBufferIt->second.Update("ObjectBonesMapping", copyPass, {ItemUpdate<uint32_t>{
+        if (!boneMappingsBufferIt->second.Update(copyPass, {ItemUpdate<uint32_t>{
             .item = (uint32_t)*placeIndex,
             .index = objectRenderable.id.id
         }}))
@@ -154,13 +154,13 @@ void ObjectBoneDataStore::Add(GPU::CopyPass copyPass, const ObjectRenderable& ob
     {
         const auto currentBoneTransformsItemSize = boneTransformsBufferIt->second.GetItemSize();
 
-        if (!boneTransformsBufferIt->second.PushBack("ObjectBonesTransfer", copyPass, *objectRenderable.boneTransforms))
+        if (!boneTransformsBufferIt->second.PushBack(copyPass, objectRenderable.boneTransforms))
         {
             m_pGlobal->pLogger->Error("ObjectBoneDataStore::Add: Failed to push bone transforms");
             return;
         }
 
-        if (!boneMappingsBufferIt->second.Update("ObjectBonesMapping", copyPass, {ItemUpdate<uint32_t>{
+        if (!boneMappingsBufferIt->second.Update(copyPass, {ItemUpdate<uint32_t>{
             .item = (uint32_t)currentBoneTransformsItemSize,
             .index = objectRenderable.id.id
         }}))
@@ -194,7 +194,7 @@ void ObjectBoneDataStore::Erase(GPU::CopyPass, ObjectId objectId)
 
     // Technically don't need to zero out the bone data, just leave it there to be overwritten later; nothing
     // should ever use the old data after mappings are updated
-    /*if (!boneMappingsBufferIt->second.Update("ObjectBonesMapping", pCopyPass, {ItemUpdate<uint32_t>{
+    /*if (!boneMappingsBufferIt->second.Update(pCopyPass, {ItemUpdate<uint32_t>{
         .item = (uint32_t)0,
         .index = objectId.id
     }}))
@@ -6,9 +6,46 @@
  
 #include "ObjectDataStore.h"
 
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
 namespace Wired::Render
 {
 
+struct TransformComponents
+{
+    glm::vec3 translation{0.0f};
+    glm::quat rotation{glm::identity<glm::quat>()};
+    glm::vec3 scale{1.0f};
+};
+
+// Note: Assumes the transform is composed only of translation, rotation, and scale (no shear/projection)
+static TransformComponents DecomposeTransform(const glm::mat4& transform)
+{
+    TransformComponents components{};
+
+    components.translation = glm::vec3(transform[3]);
+
+    glm::mat3 rotation(transform);
+
+    components.scale = glm::vec3(glm::length(rotation[0]), glm::length(rotation[1]), glm::length(rotation[2]));
+
+    // A mirroring transform; move the reflection into the scale so that what's left is a proper rotation
+    if (glm::determinant(rotation) < 0.0f)
+    {
+        components.scale.x = -components.scale.x;
+    }
+
+    for (glm::length_t x = 0; x < 3; ++x)
+    {
+        if (components.scale[x] != 0.0f) { rotation[x] /= components.scale[x]; }
+    }
+
+    components.rotation = glm::quat_cast(rotation);
+
+    return components;
+}
+
 void ObjectDataStore::ShutDown()
 {
     InstanceDataStore<ObjectRenderable, ObjectInstanceDataPayload>::ShutDown();
@@ -51,7 +88,7 @@ void ObjectDataStore::Update(GPU::CopyPass copyPass, const std::vector<ObjectRen
     AddOrUpdate(copyPass, objectRenderables);
 }
 
-void ObjectDataStore::Remove(GPU::CopyPass copyPass, const std::unordered_set<ObjectId>& objectIds)
+void ObjectDataStore::Remove(GPU::CopyPass copyPass, const std::vector<ObjectId>& objectIds)
 {
     if (objectIds.empty()) { return; }
 
@@ -72,7 +109,7 @@ void ObjectDataStore::Remove(GPU::CopyPass copyPass, const std::unordered_set<Ob
 
 void ObjectDataStore::RecordObject(GPU::CopyPass copyPass, const ObjectRenderable& renderable)
 {
-    if (renderable.boneTransforms.has_value())
+    if (!renderable.boneTransforms.empty())
     {
         m_objectBoneDataStore.Add(copyPass, renderable);
     }
@@ -94,4 +131,28 @@ std::expected<ObjectInstanceDataPayload, bool> ObjectDataStore::PayloadFrom(cons
     };
 }
 
+std::optional<ObjectRenderable> ObjectDataStore::InterpolateInstance(const ObjectRenderable& previous, const ObjectRenderable& current, float alpha) const
+{
+    // Only blend between states of the same object; if what's being drawn changed, show the latest state as-is
+    if (previous.meshId != current.meshId) { return std::nullopt; }
+
+    const auto previousComponents = DecomposeTransform(previous.modelTransform);
+    const auto currentComponents = DecomposeTransform(current.modelTransform);
+
+    const glm::mat4 translation = glm::translate(glm::mat4(1), glm::mix(previousComponents.translation, currentComponents.translation, alpha));
+    const glm::mat4 rotation = glm::mat4_cast(glm::slerp(previousComponents.rotation, currentComponents.rotation, alpha));
+    const glm::mat4 scale = glm::scale(glm::mat4(1), glm::mix(previousComponents.scale, currentComponents.scale, alpha));
+
+    auto interpolated = current;
+    interpolated.modelTransform = translation * rotation * scale;
+
+    return interpolated;
+}
+
+void ObjectDataStore::ReleaseStateUpdateReferences(ObjectRenderable& renderable) const
+{
+    // Bone transforms were copied into the bone data store by RecordObject; the span points into the update's arena
+    renderable.boneTransforms = {};
+}
+
 }
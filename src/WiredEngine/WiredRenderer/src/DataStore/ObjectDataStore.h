@@ -14,7 +14,7 @@
 
 #include <Wired/Render/Renderable/ObjectRenderable.h>
 
-#include <unordered_set>
+#include <vector>
 #include <unordered_map>
 #include <utility>
 
@@ -53,11 +53,15 @@ namespace Wired::Render
 
             [[nodiscard]] std::expected<ObjectInstanceDataPayload, bool> PayloadFrom(const ObjectRenderable& renderable) const override;
 
+            [[nodiscard]] std::optional<ObjectRenderable> InterpolateInstance(const ObjectRenderable& previous, const ObjectRenderable& current, float alpha) const override;
+
+            void ReleaseStateUpdateReferences(ObjectRenderable& renderable) const override;
+
         private:
 
             void Add(GPU::CopyPass copyPass, const std::vector<ObjectRenderable>& objectRenderables);
             void Update(GPU::CopyPass copyPass, const std::vector<ObjectRenderable>& objectRenderables);
-            void Remove(GPU::CopyPass copyPass, const std::unordered_set<ObjectId>& objectIds);
+            void Remove(GPU::CopyPass copyPass, const std::vector<ObjectId>& objectIds);
 
             void RecordObject(GPU::CopyPass copyPass, const ObjectRenderable& renderable);
             void ForgetObject(GPU::CopyPass copyPass, const ObjectId& objectId);
@@ -8,6 +8,8 @@
 
 #include <Wired/Render/RenderCommon.h>
 
+#include <cmath>
+
 namespace Wired::Render
 {
 
@@ -37,7 +39,7 @@ void SpriteDataStore::Update(GPU::CopyPass copyPass, const std::vector<SpriteRen
     AddOrUpdate(copyPass, spriteRenderables);
 }
 
-void SpriteDataStore::Remove(GPU::CopyPass copyPass, const std::unordered_set<SpriteId>& spriteIds)
+void SpriteDataStore::Remove(GPU::CopyPass copyPass, const std::vector<SpriteId>& spriteIds)
 {
     if (spriteIds.empty()) { return; }
 
@@ -115,4 +117,18 @@ std::expected<SpriteInstanceDataPayload, bool> SpriteDataStore::PayloadFrom(cons
     return payload;
 }
 
+std::optional<SpriteRenderable> SpriteDataStore::InterpolateInstance(const SpriteRenderable& previous, const SpriteRenderable& current, float alpha) const
+{
+    auto interpolated = current;
+    interpolated.position = NCommon::Point3DReal(
+        std::lerp(previous.position.x, current.position.x, alpha),
+        std::lerp(previous.position.y, current.position.y, alpha),
+        std::lerp(previous.position.z, current.position.z, alpha)
+    );
+    interpolated.orientation = glm::slerp(previous.orientation, current.orientation, alpha);
+    interpolated.scale = glm::mix(previous.scale, current.scale, alpha);
+
+    return interpolated;
+}
+
 }
@@ -11,7 +11,7 @@
 
 #include "../Textures.h"
 
-#include <unordered_set>
+#include <vector>
 #include <unordered_map>
 #include <utility>
 
@@ -47,11 +47,13 @@ namespace Wired::Render
 
             [[nodiscard]] std::expected<SpriteInstanceDataPayload, bool> PayloadFrom(const SpriteRenderable& renderable) const override;
 
+            [[nodiscard]] std::optional<SpriteRenderable> InterpolateInstance(const SpriteRenderable& previous, const SpriteRenderable& current, float alpha) const override;
+
         private:
 
             void Add(GPU::CopyPass copyPass, const std::vector<SpriteRenderable>& spriteRenderables);
             void Update(GPU::CopyPass copyPass, const std::vector<SpriteRenderable>& spriteRenderables);
-            void Remove(GPU::CopyPass copyPass, const std::unordered_set<SpriteId>& spriteIds);
+            void Remove(GPU::CopyPass copyPass, const std::vector<SpriteId>& spriteIds);
     };
 }
 
@@ -63,6 +63,11 @@ namespace Wired::Render
 
             virtual void OnRenderSettingsChanged() {};
 
+            /**
+             * Releases unused capacity from the draw pass's GPU buffers
+             */
+            virtual void TrimMemory(GPU::CopyPass) {};
+
         protected:
 
             virtual void ComputeDrawCalls(GPU::CommandBufferId commandBufferId) = 0;
@@ -82,30 +82,12 @@ void DrawPasses::DestroyDrawPass(const std::string& name)
     m_drawPasses.erase(name);
 }
 
-void DrawPasses::ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate)
+void DrawPasses::ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate)
 {
-    //
-    // Start a copy pass for updating GPU state
-    //
-    const auto copyPass = m_pGlobal->pGPU->BeginCopyPass(commandBufferId, "DrawPassesStateUpdate");
-    if (!copyPass)
-    {
-        m_pGlobal->pLogger->Error("RendererSDL::ApplyStateUpdate: Failed to begin copy pass");
-        return;
-    }
-
-    //
-    // Apply state updates
-    //
     for (const auto& drawPass : m_drawPasses)
     {
-        drawPass.second->ApplyStateUpdate(*copyPass, stateUpdate);
+        drawPass.second->ApplyStateUpdate(copyPass, stateUpdate);
     }
-
-    //
-    // Finish
-    //
-    m_pGlobal->pGPU->EndCopyPass(*copyPass);
 }
 
 void DrawPasses::ComputeDrawCallsIfNeeded(GPU::CommandBufferId commandBufferId)
@@ -132,6 +114,14 @@ void DrawPasses::OnRenderSettingsChanged()
     }
 }
 
+void DrawPasses::TrimMemory(GPU::CopyPass copyPass)
+{
+    for (const auto& drawPass : m_drawPasses)
+    {
+        drawPass.second->TrimMemory(copyPass);
+    }
+}
+
 std::optional<DrawPass*> DrawPasses::GetDrawPass(const std::string& name) const noexcept
 {
     const auto it = m_drawPasses.find(name);
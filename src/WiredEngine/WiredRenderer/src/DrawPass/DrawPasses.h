@@ -42,11 +42,12 @@ namespace Wired::Render
                              const std::optional<GPU::CommandBufferId>& commandBufferId);
             void DestroyDrawPass(const std::string& name);
 
-            void ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate);
+            void ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate);
             void ComputeDrawCallsIfNeeded(GPU::CommandBufferId commandBufferId);
 
             void MarkAllDrawCallsInvalidated();
             void OnRenderSettingsChanged();
+            void TrimMemory(GPU::CopyPass copyPass);
 
             [[nodiscard]] std::optional<DrawPass*> GetDrawPass(const std::string& name) const noexcept;
 
@@ -95,18 +95,7 @@ void ObjectDrawPass::ShutDown()
 
 void ObjectDrawPass::ApplyInitialUpdate(GPU::CopyPass copyPass)
 {
-    std::vector<ObjectRenderable> objects;
-    objects.reserve(m_pDataStores->objects.GetInstances().size());
-
-    for (const auto& instance : m_pDataStores->objects.GetInstances())
-    {
-        if (instance.isValid)
-        {
-            objects.push_back(instance.instance);
-        }
-    }
-
-    ProcessAddedObjects(copyPass, objects);
+    ProcessAddedObjects(copyPass, m_pDataStores->objects.GetInstances());
 }
 
 void ObjectDrawPass::ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate)
@@ -208,7 +197,7 @@ void ObjectDrawPass::ProcessAddedObjects(GPU::CopyPass copyPass, const std::vect
             m_pGlobal->pLogger->Error("ObjectDrawPass::ProcessAddedObjects: Failed to increase membership buffer size");
         }
 
-        if (!m_membershipBuffer.Update("ObjectMembershipUpdate", copyPass, membershipUpdates))
+        if (!m_membershipBuffer.Update(copyPass, membershipUpdates))
         {
             m_pGlobal->pLogger->Error("ObjectDrawPass::ProcessAddedObjects: Failed to update membership buffer");
         }
@@ -315,7 +304,7 @@ void ObjectDrawPass::ProcessUpdatedObjects(GPU::CopyPass copyPass, const std::ve
     //
     if (!membershipUpdates.empty())
     {
-        if (!m_membershipBuffer.Update("ObjectMembershipUpdate", copyPass, membershipUpdates))
+        if (!m_membershipBuffer.Update(copyPass, membershipUpdates))
         {
             m_pGlobal->pLogger->Error("ObjectDrawPass::ProcessUpdatedObjects: Failed to update membership buffer");
         }
@@ -330,7 +319,7 @@ void ObjectDrawPass::ProcessUpdatedObjects(GPU::CopyPass copyPass, const std::ve
     }
 }
 
-void ObjectDrawPass::ProcessRemovedObjects(GPU::CopyPass copyPass, const std::unordered_set<ObjectId>& objectIds)
+void ObjectDrawPass::ProcessRemovedObjects(GPU::CopyPass copyPass, const std::vector<ObjectId>& objectIds)
 {
     if (objectIds.empty()) { return; }
 
@@ -392,7 +381,7 @@ void ObjectDrawPass::ProcessRemovedObjects(GPU::CopyPass copyPass, const std::un
     //
     if (!membershipUpdates.empty())
     {
-        if (!m_membershipBuffer.Update("ObjectMembershipUpdate", copyPass, membershipUpdates))
+        if (!m_membershipBuffer.Update(copyPass, membershipUpdates))
         {
             m_pGlobal->pLogger->Error("ObjectDrawPass::ProcessRemovedObjects: Failed to update membership buffer");
         }
@@ -492,7 +481,7 @@ bool ObjectDrawPass::SyncObjectBatchPayloads(GPU::CopyPass copyPass, BatchId sta
         }
     }
 
-    if (!m_objectBatchBuffer.Update("ObjectBatchDataUpdate", copyPass, batchPayloadUpdates))
+    if (!m_objectBatchBuffer.Update(copyPass, batchPayloadUpdates))
     {
         m_pGlobal->pLogger->Error("ObjectDrawPass::ResyncObjectBatchPayloads: Failed to update batch buffer");
     }
@@ -652,6 +641,22 @@ void ObjectDrawPass::OnRenderSettingsChanged()
     MarkDrawCallsInvalidated();
 }
 
+void ObjectDrawPass::TrimMemory(GPU::CopyPass copyPass)
+{
+    bool allSuccessful = true;
+
+    allSuccessful &= m_objectBatchBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_membershipBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_drawDataBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_drawCommandsBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_drawCountsBuffer.ShrinkToFit(copyPass);
+
+    if (!allSuccessful)
+    {
+        m_pGlobal->pLogger->Error("ObjectDrawPass::TrimMemory: Failed to shrink one or more buffers for: {}", GetTag());
+    }
+}
+
 std::string ObjectDrawPass::GetTag() const noexcept
 {
     switch (m_objectDrawPassType)
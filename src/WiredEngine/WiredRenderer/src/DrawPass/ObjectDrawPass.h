@@ -53,6 +53,7 @@ namespace Wired::Render
             void ComputeDrawCalls(GPU::CommandBufferId commandBufferId) override;
 
             void OnRenderSettingsChanged() override;
+            void TrimMemory(GPU::CopyPass copyPass) override;
 
             [[nodiscard]] std::string GetName() const noexcept { return m_name; }
             [[nodiscard]] ObjectDrawPassType GetObjectDrawPassType() const noexcept { return m_objectDrawPassType; };
@@ -83,7 +84,7 @@ namespace Wired::Render
 
             void ProcessAddedObjects(GPU::CopyPass copyPass, const std::vector<ObjectRenderable>& objects);
             void ProcessUpdatedObjects(GPU::CopyPass copyPass, const std::vector<ObjectRenderable>& objects);
-            void ProcessRemovedObjects(GPU::CopyPass copyPass, const std::unordered_set<ObjectId>& objects);
+            void ProcessRemovedObjects(GPU::CopyPass copyPass, const std::vector<ObjectId>& objects);
 
             [[nodiscard]] BatchId CreateBatchCPUSide(MaterialId materialId, MeshId meshId);
 
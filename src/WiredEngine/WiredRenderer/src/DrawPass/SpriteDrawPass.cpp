@@ -93,18 +93,7 @@ void SpriteDrawPass::ShutDown()
 
 void SpriteDrawPass::ApplyInitialUpdate(GPU::CopyPass copyPass)
 {
-    std::vector<SpriteRenderable> sprites;
-    sprites.reserve(m_pDataStores->sprites.GetInstances().size());
-
-    for (const auto& instance : m_pDataStores->sprites.GetInstances())
-    {
-        if (instance.isValid)
-        {
-            sprites.push_back(instance.instance);
-        }
-    }
-
-    ProcessAddedSprites(copyPass, sprites);
+    ProcessAddedSprites(copyPass, m_pDataStores->sprites.GetInstances());
 }
 
 void SpriteDrawPass::ApplyStateUpdate(GPU::CopyPass copyPass, const StateUpdate& stateUpdate)
@@ -206,7 +195,7 @@ void SpriteDrawPass::ProcessAddedSprites(GPU::CopyPass copyPass, const std::vect
             m_pGlobal->pLogger->Error("SpriteDrawPass::ProcessAddedSprites: Failed to increase membership buffer size");
         }
 
-        if (!m_membershipBuffer.Update("SpriteMembershipUpdate", copyPass, membershipUpdates))
+        if (!m_membershipBuffer.Update(copyPass, membershipUpdates))
         {
             m_pGlobal->pLogger->Error("SpriteDrawPass::ProcessAddedSprites: Failed to update membership buffer");
         }
@@ -313,7 +302,7 @@ void SpriteDrawPass::ProcessUpdatedSprites(GPU::CopyPass copyPass, const std::ve
     //
     if (!membershipUpdates.empty())
     {
-        if (!m_membershipBuffer.Update("SpriteMembershipUpdate", copyPass, membershipUpdates))
+        if (!m_membershipBuffer.Update(copyPass, membershipUpdates))
         {
             m_pGlobal->pLogger->Error("SpriteDrawPass::ProcessUpdatedSprites: Failed to update membership buffer");
         }
@@ -328,7 +317,7 @@ void SpriteDrawPass::ProcessUpdatedSprites(GPU::CopyPass copyPass, const std::ve
     }
 }
 
-void SpriteDrawPass::ProcessRemovedSprites(GPU::CopyPass copyPass, const std::unordered_set<SpriteId>& spriteIds)
+void SpriteDrawPass::ProcessRemovedSprites(GPU::CopyPass copyPass, const std::vector<SpriteId>& spriteIds)
 {
     if (spriteIds.empty()) { return; }
 
@@ -390,7 +379,7 @@ void SpriteDrawPass::ProcessRemovedSprites(GPU::CopyPass copyPass, const std::un
     //
     if (!membershipUpdates.empty())
     {
-        if (!m_membershipBuffer.Update("SpriteMembershipUpdate", copyPass, membershipUpdates))
+        if (!m_membershipBuffer.Update(copyPass, membershipUpdates))
         {
             m_pGlobal->pLogger->Error("SpriteDrawPass::ProcessRemovedSprites: Failed to update membership buffer");
         }
@@ -488,7 +477,7 @@ bool SpriteDrawPass::SyncSpriteBatchPayloads(GPU::CopyPass copyPass, BatchId sta
         }
     }
 
-    if (!m_spriteBatchBuffer.Update("SpriteBatchDataUpdate", copyPass, batchPayloadUpdates))
+    if (!m_spriteBatchBuffer.Update(copyPass, batchPayloadUpdates))
     {
         m_pGlobal->pLogger->Error("SpriteDrawPass::ResyncSpriteBatchPayloads: Failed to update batch buffer");
     }
@@ -622,6 +611,22 @@ void SpriteDrawPass::OnRenderSettingsChanged()
     MarkDrawCallsInvalidated();
 }
 
+void SpriteDrawPass::TrimMemory(GPU::CopyPass copyPass)
+{
+    bool allSuccessful = true;
+
+    allSuccessful &= m_spriteBatchBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_membershipBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_drawDataBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_drawCommandsBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_drawCountsBuffer.ShrinkToFit(copyPass);
+
+    if (!allSuccessful)
+    {
+        m_pGlobal->pLogger->Error("SpriteDrawPass::TrimMemory: Failed to shrink one or more buffers for: {}", GetTag());
+    }
+}
+
 std::string SpriteDrawPass::GetTag() const noexcept
 {
     return std::format("{}:{}", m_groupName, m_name);
@@ -687,7 +692,7 @@ void SpriteDrawPass::SyncBatchDataBuffer(GPU::CopyPass copyPass, BatchId lowestC
         }
     }
 
-    if (!m_spriteBatchBuffer.Update("SpriteBatchDataUpdate", copyPass, batchDataUpdates))
+    if (!m_spriteBatchBuffer.Update(copyPass, batchDataUpdates))
     {
         m_pGlobal->pLogger->Error("SpriteDrawPass::SyncBatchDataBuffer: Failed to update batch data buffer");
     }
@@ -709,7 +714,7 @@ void SpriteDrawPass::ProcessUpdatedSprites(GPU::CopyPass, const std::vector<Spri
     }
 }
 
-void SpriteDrawPass::ProcessRemovedSprites(GPU::CopyPass copyPass, const std::unordered_set<SpriteId>& spriteIds)
+void SpriteDrawPass::ProcessRemovedSprites(GPU::CopyPass copyPass, const std::vector<SpriteId>& spriteIds)
 {
     if (spriteIds.empty()) { return; }
 
@@ -751,7 +756,7 @@ void SpriteDrawPass::ProcessRemovedSprites(GPU::CopyPass copyPass, const std::un
         return;
     }
 
-    if (!m_membershipBuffer.Update("SpriteMembershipUpdate", copyPass, membershipUpdates))
+    if (!m_membershipBuffer.Update(copyPass, membershipUpdates))
     {
         m_pGlobal->pLogger->Error("SpriteDrawPass::ProcessRemovedSprites: Failed to update sprite membership buffer");
     }
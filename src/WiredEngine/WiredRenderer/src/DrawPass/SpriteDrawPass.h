@@ -50,6 +50,7 @@ namespace Wired::Render
             void ComputeDrawCalls(GPU::CommandBufferId commandBufferId) override;
 
             void OnRenderSettingsChanged() override;
+            void TrimMemory(GPU::CopyPass copyPass) override;
 
             [[nodiscard]] std::string GetName() const noexcept { return m_name; }
             [[nodiscard]] std::size_t GetNumSprites() const noexcept { return m_spriteToBatch.size(); }
@@ -78,7 +79,7 @@ namespace Wired::Render
 
             void ProcessAddedSprites(GPU::CopyPass copyPass, const std::vector<SpriteRenderable>& sprites);
             void ProcessUpdatedSprites(GPU::CopyPass copyPass, const std::vector<SpriteRenderable>& sprites);
-            void ProcessRemovedSprites(GPU::CopyPass copyPass, const std::unordered_set<SpriteId>& spriteIds);
+            void ProcessRemovedSprites(GPU::CopyPass copyPass, const std::vector<SpriteId>& spriteIds);
 
             [[nodiscard]] BatchId CreateBatchCPUSide(TextureId textureId);
 
@@ -5,7 +5,7 @@
  */
  
 #include "GPUBuffer.h"
-#include "TransferBufferPool.h"
+#include "StagingRing.h"
 #include "Global.h"
 
 #include "Wired/GPU/WiredGPU.h"
@@ -88,9 +88,7 @@ void GPUBuffer::Destroy()
     m_byteSize = 0;
 }
 
-bool GPUBuffer::Update(GPU::CopyPass copyPass,
-                       const std::string& transferKey,
-                       const std::vector<DataUpdate>& updates)
+bool GPUBuffer::Update(GPU::CopyPass copyPass, const std::vector<DataUpdate>& updates)
 {
     assert(m_bufferId.IsValid());
     if (!m_bufferId.IsValid()) { return false; }
@@ -111,49 +109,50 @@ bool GPUBuffer::Update(GPU::CopyPass copyPass,
         updatesTotalByteSize += update.data.byteSize;
     }
 
+    if (updatesTotalByteSize == 0) { return true; }
+
     //
-    // Fetch a transfer buffer for uploading the new data
+    // Fetch staging memory for uploading the new data
     //
-    const auto transferBuffer = m_pGlobal->pTransferBufferPool->Get(transferKey, {GPU::TransferBufferUsageFlag::Upload}, updatesTotalByteSize, true);
-    if (!transferBuffer)
+    const auto staging = m_pGlobal->pStagingRing->Allocate(updatesTotalByteSize);
+    if (!staging)
     {
         return false;
     }
 
     //
-    // Fill the transfer buffer with data
+    // Fill the staging memory with data, recording where each update's data was put
     //
-    auto mappedTransferData = m_pGlobal->pGPU->MapBuffer(*transferBuffer, true  /* do cycle */);
+    std::vector<GPU::BufferCopyRegion> regions;
+    regions.reserve(updates.size());
+
     std::size_t bytesWritten = 0;
 
     for (const auto& update : updates)
     {
-        memcpy((std::byte*)(*mappedTransferData) + bytesWritten, update.data.pData, update.data.byteSize);
+        if (update.data.byteSize == 0) { continue; }
+
+        memcpy(staging->pData + bytesWritten, update.data.pData, update.data.byteSize);
+
+        regions.push_back(GPU::BufferCopyRegion{
+            .sourceByteOffset = staging->byteOffset + bytesWritten,
+            .destByteOffset = update.destByteOffset,
+            .byteSize = update.data.byteSize
+        });
+
         bytesWritten += update.data.byteSize;
     }
-    m_pGlobal->pGPU->UnmapBuffer(*transferBuffer);
 
     //
     // Transfer the new data to the buffer
     //
-    std::size_t transferBufferOffset = 0;
-
-    for (const auto& update : updates)
-    {
-        m_pGlobal->pGPU->CmdUploadDataToBuffer(
-            copyPass,
-            *transferBuffer,
-            (uint32_t)transferBufferOffset,
-            m_bufferId,
-            update.destByteOffset,
-            update.data.byteSize,
-            false /* no cycle */
-        );
-
-        transferBufferOffset += update.data.byteSize;
-    }
-
-    return true;
+    return m_pGlobal->pGPU->CmdUploadDataToBuffer(
+        copyPass,
+        staging->bufferId,
+        m_bufferId,
+        regions,
+        false /* no cycle */
+    );
 }
 
 bool GPUBuffer::ResizeRetaining(GPU::CopyPass copyPass, const std::size_t& byteSize)
@@ -20,7 +20,6 @@
 
 namespace Wired::Render
 {
-    class TransferBufferPool;
     struct Global;
 
     /**
@@ -64,11 +63,10 @@ namespace Wired::Render
             [[nodiscard]] std::size_t GetByteSize() const noexcept { return m_byteSize; }
 
             /**
-             * Update one or more portions of the buffer's data
+             * Update one or more portions of the buffer's data. The updates are staged together and
+             * uploaded with a single copy command.
              */
-            [[nodiscard]] bool Update(GPU::CopyPass copyPass,
-                                      const std::string& transferKey,
-                                      const std::vector<DataUpdate>& updates);
+            [[nodiscard]] bool Update(GPU::CopyPass copyPass, const std::vector<DataUpdate>& updates);
 
             /**
              * Reallocates the buffer to byteSize bytes. Any data previously in the buffer
@@ -94,7 +92,6 @@ namespace Wired::Render
         private:
 
             Global* m_pGlobal{nullptr};
-            TransferBufferPool* m_pTransferBufferPool{nullptr};
             GPU::BufferUsageFlags m_usage{};
             std::size_t m_byteSize{0};
             bool m_dedicatedMemory{false};
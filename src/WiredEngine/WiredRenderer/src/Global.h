@@ -25,7 +25,7 @@ namespace Wired::GPU
 
 namespace Wired::Render
 {
-    class TransferBufferPool;
+    class StagingRing;
     class Textures;
     class Meshes;
     class Materials;
@@ -38,7 +38,7 @@ namespace Wired::Render
         const NCommon::ILogger* pLogger{nullptr};
         NCommon::IMetrics* pMetrics{nullptr};
         GPU::WiredGPU* pGPU{nullptr};
-        TransferBufferPool* pTransferBufferPool{nullptr};
+        StagingRing* pStagingRing{nullptr};
         Textures* pTextures{nullptr};
         Meshes* pMeshes{nullptr};
         Materials* pMaterials{nullptr};
@@ -10,8 +10,12 @@
 #include "DrawPass/ObjectDrawPass.h"
 #include "DrawPass/SpriteDrawPass.h"
 
+#include <Wired/GPU/WiredGPU.h>
+
 #include <NEON/Common/Log/ILogger.h>
 
+#include <format>
+
 namespace Wired::Render
 {
 
@@ -71,17 +75,42 @@ void Group::ShutDown()
 
 void Group::ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate)
 {
-    m_dataStores.ApplyStateUpdate(commandBufferId, stateUpdate);
-    m_drawPasses.ApplyStateUpdate(commandBufferId, stateUpdate);
+    //
+    // Data stores and draw passes upload all of their state changes within one copy pass
+    //
+    const auto copyPass = m_pGlobal->pGPU->BeginCopyPass(commandBufferId, std::format("GroupStateUpdate-{}", m_name));
+    if (!copyPass)
+    {
+        m_pGlobal->pLogger->Error("Group::ApplyStateUpdate: Failed to begin copy pass");
+        return;
+    }
+
+        m_dataStores.ApplyStateUpdate(*copyPass, stateUpdate);
+        m_drawPasses.ApplyStateUpdate(*copyPass, stateUpdate);
+
+    m_pGlobal->pGPU->EndCopyPass(*copyPass);
+
+    // Lights may create and transition shadow map images, which must happen outside of a copy pass
     m_lights.ApplyStateUpdate(commandBufferId, stateUpdate);
 }
 
+void Group::ApplyInterpolation(GPU::CommandBufferId commandBufferId, const std::optional<RenderInterpolation>& interpolation)
+{
+    m_dataStores.ApplyInterpolation(commandBufferId, interpolation);
+}
+
 void Group::OnRenderSettingsChanged(GPU::CommandBufferId commandBufferId)
 {
     m_drawPasses.OnRenderSettingsChanged();
     m_lights.OnRenderSettingsChanged(commandBufferId);
 }
 
+void Group::TrimMemory(GPU::CopyPass copyPass)
+{
+    m_dataStores.TrimMemory(copyPass);
+    m_drawPasses.TrimMemory(copyPass);
+}
+
 bool Group::CreateDefaultDrawPasses()
 {
     //
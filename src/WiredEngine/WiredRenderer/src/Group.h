@@ -14,6 +14,7 @@
 
 
 #include <Wired/Render/StateUpdate.h>
+#include <Wired/Render/RenderFrameParams.h>
 #include <Wired/GPU/GPUId.h>
 
 #include <string>
@@ -35,9 +36,15 @@ namespace Wired::Render
             [[nodiscard]] std::string GetName() const noexcept { return m_name; }
 
             void ApplyStateUpdate(GPU::CommandBufferId commandBufferId, const StateUpdate& stateUpdate);
+            void ApplyInterpolation(GPU::CommandBufferId commandBufferId, const std::optional<RenderInterpolation>& interpolation);
 
             void OnRenderSettingsChanged(GPU::CommandBufferId commandBufferId);
 
+            /**
+             * Releases unused capacity from the group's data store and draw pass GPU buffers
+             */
+            void TrimMemory(GPU::CopyPass copyPass);
+
             [[nodiscard]] DataStores& GetDataStores() { return m_dataStores; }
             [[nodiscard]] DrawPasses& GetDrawPasses() { return m_drawPasses; }
             [[nodiscard]] GroupLights& GetLights() { return m_lights; }
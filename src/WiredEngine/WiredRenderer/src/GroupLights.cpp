@@ -16,6 +16,7 @@
 #include <NEON/Common/Log/ILogger.h>
 
 #include <format>
+#include <algorithm>
 
 namespace Wired::Render
 {
@@ -195,7 +196,7 @@ void GroupLights::Update(GPU::CommandBufferId commandBufferId, const std::vector
     }
 }
 
-void GroupLights::Remove(GPU::CommandBufferId, const std::unordered_set<LightId>& lightIds)
+void GroupLights::Remove(GPU::CommandBufferId, const std::vector<LightId>& lightIds)
 {
     for (const auto& lightId : lightIds)
     {
@@ -588,6 +589,8 @@ void GroupLights::SyncShadowRenders(GPU::CommandBufferId commandBufferId)
         }
     }
 
+    std::vector<ItemUpdate<ShadowMapPayload>> shadowMapPayloadUpdates;
+
     for (auto& lightIt : m_lightState)
     {
         std::unordered_set<uint8_t> shadowRenderIndices;
@@ -615,11 +618,19 @@ void GroupLights::SyncShadowRenders(GPU::CommandBufferId commandBufferId)
         }
 
         // Refresh all pending refresh shadow renders
-        RefreshShadowRenders(commandBufferId, lightIt.first, shadowRenderIndices);
+        if (!shadowRenderIndices.empty())
+        {
+            RefreshShadowRenders(lightIt.first, shadowRenderIndices, shadowMapPayloadUpdates);
+        }
     }
+
+    // Upload the refreshed lights' shadow map payloads together
+    UpdateGPUShadowMapPayloads(commandBufferId, shadowMapPayloadUpdates);
 }
 
-void GroupLights::RefreshShadowRenders(GPU::CommandBufferId commandBufferId, LightId lightId, const std::unordered_set<uint8_t>& shadowRenderIndices)
+void GroupLights::RefreshShadowRenders(LightId lightId,
+                                       const std::unordered_set<uint8_t>& shadowRenderIndices,
+                                       std::vector<ItemUpdate<ShadowMapPayload>>& shadowMapPayloadUpdates)
 {
     const auto lightIt = m_lightState.find(lightId);
     if (lightIt == m_lightState.cend())
@@ -644,8 +655,8 @@ void GroupLights::RefreshShadowRenders(GPU::CommandBufferId commandBufferId, Lig
         shadowRender.pShadowDrawPass->SetViewProjection(shadowRender.params.viewProjection);
     }
 
-    // Update the shadow render payload data in the GPU
-    UpdateGPUShadowMapPayloads(commandBufferId, lightIt->second);
+    // Queue up the light's new shadow render payload data for uploading to the GPU
+    AppendShadowMapPayloadUpdates(lightIt->second, shadowMapPayloadUpdates);
 
     // Mark the shadow renders as needing rendering
     for (const auto& shadowRenderIndex : shadowRenderIndices)
@@ -681,24 +692,9 @@ std::string GroupLights::GetShadowDrawPassName(const Light& light, unsigned int
     return std::format("Light:{}:{}", light.id.id, shadowMapIndex);
 }
 
-void GroupLights::UpdateGPUShadowMapPayloads(GPU::CommandBufferId commandBufferId, const LightState& lightState)
+void GroupLights::AppendShadowMapPayloadUpdates(const LightState& lightState, std::vector<ItemUpdate<ShadowMapPayload>>& updates)
 {
-    auto copyPass = m_pGlobal->pGPU->BeginCopyPass(commandBufferId, std::format("UpdateGPUShadowMapPayloads-{}-{}", m_groupName, lightState.light.id.id));
-
-    std::vector<ItemUpdate<ShadowMapPayload>> updates;
-
-    std::size_t itemOffsetStart = lightState.light.id.id * MAX_PER_LIGHT_SHADOW_RENDER_COUNT;
-    std::size_t itemOffsetMax = itemOffsetStart + MAX_PER_LIGHT_SHADOW_RENDER_COUNT;
-
-    if (m_shadowMapPayloadBuffer.GetItemSize() < itemOffsetMax + 1)
-    {
-        if (!m_shadowMapPayloadBuffer.Resize(*copyPass, itemOffsetMax + 1))
-        {
-            m_pGlobal->pLogger->Error("GroupLights::SyncShadowMapPayload: Failed to resize buffer");
-            m_pGlobal->pGPU->EndCopyPass(*copyPass);
-            return;
-        }
-    }
+    const std::size_t itemOffsetStart = lightState.light.id.id * MAX_PER_LIGHT_SHADOW_RENDER_COUNT;
 
     for (std::size_t shadowRenderIndex = 0; shadowRenderIndex < lightState.shadowRenders.size(); ++shadowRenderIndex)
     {
@@ -716,13 +712,40 @@ void GroupLights::UpdateGPUShadowMapPayloads(GPU::CommandBufferId commandBufferI
             .index = itemOffsetStart + shadowRenderIndex
         });
     }
+}
 
-    if (!m_shadowMapPayloadBuffer.Update("ShadowMapPayloadsTransfer", *copyPass, updates))
+void GroupLights::UpdateGPUShadowMapPayloads(GPU::CommandBufferId commandBufferId, std::vector<ItemUpdate<ShadowMapPayload>>& updates)
+{
+    if (updates.empty()) { return; }
+
+    // Sorted by index so that the payloads of lights with adjacent ids are copied as one region
+    std::ranges::sort(updates, [](const auto& a, const auto& b){ return a.index < b.index; });
+
+    const auto copyPass = m_pGlobal->pGPU->BeginCopyPass(commandBufferId, std::format("UpdateGPUShadowMapPayloads-{}", m_groupName));
+    if (!copyPass)
     {
-        m_pGlobal->pLogger->Error("GroupLights::SyncShadowMapPayload: Failed to update buffer");
+        m_pGlobal->pLogger->Error("GroupLights::UpdateGPUShadowMapPayloads: Failed to begin copy pass");
         return;
     }
 
+    // Room for every shadow render slot of the highest light id being updated
+    const std::size_t itemOffsetMax = (updates.back().index / MAX_PER_LIGHT_SHADOW_RENDER_COUNT + 1) * MAX_PER_LIGHT_SHADOW_RENDER_COUNT;
+
+    if (m_shadowMapPayloadBuffer.GetItemSize() < itemOffsetMax + 1)
+    {
+        if (!m_shadowMapPayloadBuffer.Resize(*copyPass, itemOffsetMax + 1))
+        {
+            m_pGlobal->pLogger->Error("GroupLights::UpdateGPUShadowMapPayloads: Failed to resize buffer");
+            m_pGlobal->pGPU->EndCopyPass(*copyPass);
+            return;
+        }
+    }
+
+    if (!m_shadowMapPayloadBuffer.Update(*copyPass, updates))
+    {
+        m_pGlobal->pLogger->Error("GroupLights::UpdateGPUShadowMapPayloads: Failed to update buffer");
+    }
+
     m_pGlobal->pGPU->EndCopyPass(*copyPass);
 }
 
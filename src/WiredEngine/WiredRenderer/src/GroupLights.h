@@ -17,6 +17,7 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <optional>
 #include <vector>
 #include <expected>
@@ -95,7 +96,7 @@ namespace Wired::Render
 
             void Add(GPU::CommandBufferId commandBufferId, const std::vector<Light>& lights);
             void Update(GPU::CommandBufferId commandBufferId, const std::vector<Light>& lights);
-            void Remove(GPU::CommandBufferId commandBufferId, const std::unordered_set<LightId>& lightIds);
+            void Remove(GPU::CommandBufferId commandBufferId, const std::vector<LightId>& lightIds);
 
             [[nodiscard]] bool InitShadowRendering(LightState& lightState, GPU::CommandBufferId commandBufferId);
             [[nodiscard]] std::expected<TextureId, bool> CreateShadowMapTexture(const LightState& lightState, GPU::CommandBufferId commandBufferId);
@@ -105,8 +106,11 @@ namespace Wired::Render
 
             [[nodiscard]] static std::string GetShadowDrawPassName(const Light& light, unsigned int shadowMapIndex);
 
-            void RefreshShadowRenders(GPU::CommandBufferId commandBufferId, LightId lightId, const std::unordered_set<uint8_t>& shadowRenderIndices);
-            void UpdateGPUShadowMapPayloads(GPU::CommandBufferId commandBufferId, const LightState& lightState);
+            void RefreshShadowRenders(LightId lightId,
+                                      const std::unordered_set<uint8_t>& shadowRenderIndices,
+                                      std::vector<ItemUpdate<ShadowMapPayload>>& shadowMapPayloadUpdates);
+            static void AppendShadowMapPayloadUpdates(const LightState& lightState, std::vector<ItemUpdate<ShadowMapPayload>>& updates);
+            void UpdateGPUShadowMapPayloads(GPU::CommandBufferId commandBufferId, std::vector<ItemUpdate<ShadowMapPayload>>& updates);
 
         private:
 
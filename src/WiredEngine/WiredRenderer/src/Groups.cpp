@@ -71,4 +71,20 @@ void Groups::OnRenderSettingsChanged(GPU::CommandBufferId commandBufferId)
     }
 }
 
+void Groups::ApplyInterpolation(GPU::CommandBufferId commandBufferId, const std::optional<RenderInterpolation>& interpolation)
+{
+    for (const auto& group : m_groups)
+    {
+        group.second->ApplyInterpolation(commandBufferId, interpolation);
+    }
+}
+
+void Groups::TrimMemory(GPU::CopyPass copyPass)
+{
+    for (const auto& group : m_groups)
+    {
+        group.second->TrimMemory(copyPass);
+    }
+}
+
 }
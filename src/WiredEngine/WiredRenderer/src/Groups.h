@@ -7,12 +7,16 @@
 #ifndef WIREDENGINE_WIREDRENDERER_SRC_GROUPS_H
 #define WIREDENGINE_WIREDRENDERER_SRC_GROUPS_H
 
+#include <Wired/Render/RenderFrameParams.h>
+
 #include <Wired/GPU/GPUId.h>
+#include <Wired/GPU/GPUCommon.h>
 
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <expected>
+#include <optional>
 
 namespace Wired::Render
 {
@@ -33,6 +37,10 @@ namespace Wired::Render
 
             void OnRenderSettingsChanged(GPU::CommandBufferId commandBufferId);
 
+            void ApplyInterpolation(GPU::CommandBufferId commandBufferId, const std::optional<RenderInterpolation>& interpolation);
+
+            void TrimMemory(GPU::CopyPass copyPass);
+
         private:
 
             Global* m_pGlobal;
@@ -11,6 +11,7 @@
 
 #include <format>
 #include <vector>
+#include <span>
 #include <unordered_map>
 #include <algorithm>
 
@@ -43,19 +44,21 @@ namespace Wired::Render
 
             void Destroy();
 
-            [[nodiscard]] bool PushBack(const std::string& transferKey,
-                                        GPU::CopyPass copyPass,
-                                        const std::vector<T>& items);
+            [[nodiscard]] bool PushBack(GPU::CopyPass copyPass, std::span<const T> items);
 
-            [[nodiscard]] bool Update(const std::string& transferKey,
-                                      GPU::CopyPass copyPass,
-                                      const std::vector<ItemUpdate<T>>& updates);
+            [[nodiscard]] bool Update(GPU::CopyPass copyPass, const std::vector<ItemUpdate<T>>& updates);
 
             [[nodiscard]] bool Resize(GPU::CopyPass copyPass, const std::size_t& itemCount);
             [[nodiscard]] bool ResizeAtLeast(GPU::CopyPass copyPass, const std::size_t& itemCount);
 
             [[nodiscard]] bool Reserve(GPU::CopyPass copyPass, const std::size_t& itemCount);
 
+            /**
+             * Releases unused capacity, if a meaningful amount of it exists, by moving the items to a
+             * buffer sized to fit them.
+             */
+            [[nodiscard]] bool ShrinkToFit(GPU::CopyPass copyPass);
+
             [[nodiscard]] GPU::BufferId GetBufferId() const noexcept { return m_dataBuffer.GetBufferId(); }
             [[nodiscard]] std::size_t GetItemSize() const noexcept { return m_itemSize; }
             [[nodiscard]] std::size_t GetItemCapacity() const noexcept { return m_dataBuffer.GetByteSize() / sizeof(T); }
@@ -96,9 +99,7 @@ namespace Wired::Render
     }
 
     template <typename T>
-    bool ItemBuffer<T>::PushBack(const std::string& transferKey,
-                                 GPU::CopyPass copyPass,
-                                 const std::vector<T>& items)
+    bool ItemBuffer<T>::PushBack(GPU::CopyPass copyPass, std::span<const T> items)
     {
         if (items.empty()) { return true; }
 
@@ -120,7 +121,7 @@ namespace Wired::Render
             .destByteOffset = m_itemSize * sizeof(T)
         };
 
-        if (!m_dataBuffer.Update(copyPass, transferKey, {dataUpdate}))
+        if (!m_dataBuffer.Update(copyPass, {dataUpdate}))
         {
             return false;
         }
@@ -160,9 +161,7 @@ namespace Wired::Render
     }
 
     template <typename T>
-    bool ItemBuffer<T>::Update(const std::string& transferKey,
-                               GPU::CopyPass copyPass,
-                               const std::vector<ItemUpdate<T>>& updates)
+    bool ItemBuffer<T>::Update(GPU::CopyPass copyPass, const std::vector<ItemUpdate<T>>& updates)
     {
         if (updates.empty()) { return true; }
 
@@ -182,7 +181,7 @@ namespace Wired::Render
             );
         }
 
-        return m_dataBuffer.Update(copyPass, transferKey, dataUpdates);
+        return m_dataBuffer.Update(copyPass, dataUpdates);
     }
 
     template<typename T>
@@ -237,6 +236,17 @@ namespace Wired::Render
         return ChangeCapacity(copyPass, newBufferByteSize);
     }
 
+    template<typename T>
+    bool ItemBuffer<T>::ShrinkToFit(GPU::CopyPass copyPass)
+    {
+        const auto itemCapacity = GetItemCapacity();
+
+        // Not worth a copy of the buffer to release less than a quarter of it
+        if ((itemCapacity - m_itemSize) < (itemCapacity / 4)) { return true; }
+
+        return ChangeCapacity(copyPass, m_itemSize);
+    }
+
     template<typename T>
     bool ItemBuffer<T>::ChangeCapacity(const std::optional<GPU::CopyPass>& copyPass, const std::size_t& itemCount)
     {
@@ -113,7 +113,7 @@ std::expected<std::vector<MaterialId>, bool> Materials::CreateMaterials(const st
             return std::unexpected(false);
         }
 
-        if (!m_materialPayloadsBuffer.Update("MaterialDataTransfer", *copyPass, materialUpdates))
+        if (!m_materialPayloadsBuffer.Update(*copyPass, materialUpdates))
         {
             m_pGlobal->pLogger->Error("Materials::CreateMaterials: Failed to update payloads buffer");
             m_pGlobal->pGPU->CancelCommandBuffer(*cmdBuffer);
@@ -175,7 +175,7 @@ bool Materials::UpdateMaterial(const MaterialId& materialId, const Material* pMa
             .index = materialId.id
         };
 
-        if (!m_materialPayloadsBuffer.Update("MaterialDataTransfer", *copyPass, {itemUpdate}))
+        if (!m_materialPayloadsBuffer.Update(*copyPass, {itemUpdate}))
         {
             m_pGlobal->pLogger->Error("Materials::UpdateMaterial: Failed to update payloads buffer");
             m_pGlobal->pGPU->CancelCommandBuffer(*cmdBuffer);
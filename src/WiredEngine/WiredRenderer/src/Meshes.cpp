@@ -273,21 +273,21 @@ std::expected<std::vector<MeshId>, bool> Meshes::CreateMeshes(const std::vector<
     // Upload vertices
     if (!staticMeshVertices.empty())
     {
-        allSuccessful &= m_staticMeshVerticesBuffer.PushBack("StaticVertexUpload", *copyPass, staticMeshVertices);
+        allSuccessful &= m_staticMeshVerticesBuffer.PushBack(*copyPass, staticMeshVertices);
     }
     if (!boneMeshVertices.empty())
     {
-        allSuccessful &= m_boneMeshVerticesBuffer.PushBack("BoneVertexUpload", *copyPass, boneMeshVertices);
+        allSuccessful &= m_boneMeshVerticesBuffer.PushBack(*copyPass, boneMeshVertices);
     }
 
     // Upload indices
     if (!staticMeshIndices.empty())
     {
-        allSuccessful &= m_staticMeshIndicesBuffer.PushBack("StaticIndexUpload", *copyPass, staticMeshIndices);
+        allSuccessful &= m_staticMeshIndicesBuffer.PushBack(*copyPass, staticMeshIndices);
     }
     if (!boneMeshIndices.empty())
     {
-        allSuccessful &= m_boneMeshIndicesBuffer.PushBack("BoneIndexUpload", *copyPass, boneMeshIndices);
+        allSuccessful &= m_boneMeshIndicesBuffer.PushBack(*copyPass, boneMeshIndices);
     }
 
     if (!allSuccessful)
@@ -323,7 +323,7 @@ std::expected<std::vector<MeshId>, bool> Meshes::CreateMeshes(const std::vector<
         payloadsUpdates.push_back({.item = meshPayload, .index = meshId.id});
     }
 
-    if (!m_meshPayloadsBuffer.Update("MeshPayloadUpload", *copyPass, payloadsUpdates))
+    if (!m_meshPayloadsBuffer.Update(*copyPass, payloadsUpdates))
     {
         m_pGlobal->pLogger->Error("Meshes::CreateMeshes: Failed to resize mesh payloads");
         m_pGlobal->pGPU->CancelCommandBuffer(*cmdBuffer);
@@ -381,6 +381,22 @@ void Meshes::DestroyMesh(const MeshId& meshId)
     m_meshes.erase(it);
 }
 
+void Meshes::TrimMemory(GPU::CopyPass copyPass)
+{
+    bool allSuccessful = true;
+
+    allSuccessful &= m_staticMeshVerticesBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_staticMeshIndicesBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_boneMeshVerticesBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_boneMeshIndicesBuffer.ShrinkToFit(copyPass);
+    allSuccessful &= m_meshPayloadsBuffer.ShrinkToFit(copyPass);
+
+    if (!allSuccessful)
+    {
+        m_pGlobal->pLogger->Error("Meshes::TrimMemory: Failed to shrink one or more mesh buffers");
+    }
+}
+
 GPU::BufferId Meshes::GetVerticesBuffer(MeshType meshType) const
 {
     switch (meshType)
@@ -72,6 +72,11 @@ namespace Wired::Render
             [[nodiscard]] GPU::BufferId GetMeshPayloadsBuffer() const;
             void DestroyMesh(const MeshId& meshId);
 
+            /**
+             * Releases unused capacity from the vertex, index and mesh payload buffers
+             */
+            void TrimMemory(GPU::CopyPass copyPass);
+
         private:
 
             struct MeshLODPayload
@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERER_SRC_READBACKRING_H
+#define WIREDENGINE_WIREDRENDERER_SRC_READBACKRING_H
+
+#include <vector>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+
+namespace Wired::Render
+{
+    /**
+     * Bookkeeping for a ring of slots which the GPU asynchronously copies readbacks into.
+     *
+     * Tracks which slots have a readback pending and the frame it was recorded in, hands out free slots round
+     * robin, and finds the most recent readback the GPU has finished. Knows nothing of the GPU resources behind
+     * the slots; callers provide whether a slot's resources are still in use by the GPU.
+     */
+    class ReadbackRing
+    {
+        public:
+
+            struct Finished
+            {
+                std::size_t slotIndex{0};
+                uint64_t latencyFrames{0};
+            };
+
+        public:
+
+            /**
+             * Grows the ring to at least slotCount slots
+             */
+            void EnsureSize(std::size_t slotCount)
+            {
+                if (m_pendingFrameIndices.size() < slotCount)
+                {
+                    m_pendingFrameIndices.resize(slotCount);
+                }
+            }
+
+            [[nodiscard]] std::size_t GetSize() const noexcept { return m_pendingFrameIndices.size(); }
+            [[nodiscard]] uint64_t GetFrameIndex() const noexcept { return m_frameIndex; }
+
+            [[nodiscard]] bool IsPending(std::size_t slotIndex) const { return m_pendingFrameIndices.at(slotIndex).has_value(); }
+
+            /**
+             * Advances the current frame, then finds the most recently recorded readback which the GPU has finished,
+             * and marks it as no longer pending. Any older finished readbacks are superseded by it, and are dropped.
+             */
+            template <typename IsSlotInUseFunc>
+            [[nodiscard]] std::optional<Finished> OnFrameStarted(IsSlotInUseFunc isSlotInUse)
+            {
+                m_frameIndex++;
+
+                std::optional<std::size_t> latestFinishedIndex;
+
+                for (std::size_t x = 0; x < m_pendingFrameIndices.size(); ++x)
+                {
+                    auto& pendingFrameIndex = m_pendingFrameIndices[x];
+                    if (!pendingFrameIndex) { continue; }
+
+                    // The GPU is still working on the copy
+                    if (isSlotInUse(x)) { continue; }
+
+                    if (latestFinishedIndex && *m_pendingFrameIndices[*latestFinishedIndex] > *pendingFrameIndex)
+                    {
+                        pendingFrameIndex = std::nullopt;
+                        continue;
+                    }
+
+                    if (latestFinishedIndex)
+                    {
+                        m_pendingFrameIndices[*latestFinishedIndex] = std::nullopt;
+                    }
+
+                    latestFinishedIndex = x;
+                }
+
+                if (!latestFinishedIndex) { return std::nullopt; }
+
+                const auto finished = Finished{
+                    .slotIndex = *latestFinishedIndex,
+                    .latencyFrames = m_frameIndex - *m_pendingFrameIndices[*latestFinishedIndex]
+                };
+
+                m_pendingFrameIndices[*latestFinishedIndex] = std::nullopt;
+
+                return finished;
+            }
+
+            /**
+             * @return The next slot, round robin, which has no readback pending and isn't in use by the GPU, or
+             * std::nullopt if there's no such slot
+             */
+            template <typename IsSlotInUseFunc>
+            [[nodiscard]] std::optional<std::size_t> AcquireFreeSlot(IsSlotInUseFunc isSlotInUse)
+            {
+                for (std::size_t x = 0; x < m_pendingFrameIndices.size(); ++x)
+                {
+                    const auto slotIndex = (m_nextSlotIndex + x) % m_pendingFrameIndices.size();
+
+                    if (m_pendingFrameIndices[slotIndex]) { continue; }
+                    if (isSlotInUse(slotIndex)) { continue; }
+
+                    m_nextSlotIndex = (slotIndex + 1) % m_pendingFrameIndices.size();
+                    return slotIndex;
+                }
+
+                return std::nullopt;
+            }
+
+            /**
+             * Marks that a readback was recorded into the slot during the current frame
+             */
+            void MarkPending(std::size_t slotIndex)
+            {
+                m_pendingFrameIndices.at(slotIndex) = m_frameIndex;
+            }
+
+            /**
+             * Drops any readbacks recorded during the current frame
+             */
+            void CancelFrame()
+            {
+                for (auto& pendingFrameIndex : m_pendingFrameIndices)
+                {
+                    if (pendingFrameIndex && *pendingFrameIndex == m_frameIndex)
+                    {
+                        pendingFrameIndex = std::nullopt;
+                    }
+                }
+            }
+
+            void Reset()
+            {
+                m_pendingFrameIndices.clear();
+                m_nextSlotIndex = 0;
+                m_frameIndex = 0;
+            }
+
+        private:
+
+            std::vector<std::optional<uint64_t>> m_pendingFrameIndices;
+            std::size_t m_nextSlotIndex{0};
+            uint64_t m_frameIndex{0};
+    };
+}
+
+#endif //WIREDENGINE_WIREDRENDERER_SRC_READBACKRING_H
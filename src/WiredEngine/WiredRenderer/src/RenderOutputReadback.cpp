@@ -0,0 +1,377 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "RenderOutputReadback.h"
+#include "Global.h"
+#include "Textures.h"
+
+#include <Wired/Render/Metrics.h>
+
+#include <Wired/GPU/WiredGPU.h>
+
+#include <NEON/Common/Log/ILogger.h>
+#include <NEON/Common/Metrics/IMetrics.h>
+
+#include <cstring>
+
+namespace Wired::Render
+{
+
+// Bytes per texel of the B8G8R8A8 formats that readbacks are done in. Textures in any other format
+// (float render targets) are blitted into a B8G8R8A8 intermediate image first; the blit clamps to
+// [0..1] and doesn't tonemap, the same as presenting the texture does.
+static constexpr std::size_t READBACK_BYTES_PER_TEXEL = 4;
+
+// Whether the GPU layer creates textures with these usages in a format other than B8G8R8A8
+static bool IsNonB8G8R8A8Texture(const TextureCreateParams& createParams)
+{
+    return createParams.usageFlags.contains(TextureUsageFlag::ColorTarget) ||
+           createParams.usageFlags.contains(TextureUsageFlag::PostProcess);
+}
+
+RenderOutputReadback::RenderOutputReadback(Global* pGlobal)
+    : m_pGlobal(pGlobal)
+{
+
+}
+
+RenderOutputReadback::~RenderOutputReadback()
+{
+    m_pGlobal = nullptr;
+}
+
+void RenderOutputReadback::ShutDown()
+{
+    for (const auto& slot : m_slots)
+    {
+        if (slot.bufferId.IsValid())
+        {
+            m_pGlobal->pGPU->DestroyBuffer(slot.bufferId);
+        }
+    }
+    m_slots.clear();
+    m_ring.Reset();
+
+    if (m_intermediate)
+    {
+        m_pGlobal->pGPU->DestroyImage(m_intermediate->imageId);
+        m_intermediate = std::nullopt;
+    }
+
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    m_output = std::nullopt;
+}
+
+void RenderOutputReadback::OnFrameStarted()
+{
+    //
+    // Find the most recent readback which the GPU has finished. Any older finished readbacks are
+    // superseded by it and are dropped without being read.
+    //
+    const auto finished = m_ring.OnFrameStarted([this](std::size_t slotIndex){ return IsSlotInUse(slotIndex); });
+    if (!finished) { return; }
+
+    m_pGlobal->pMetrics->SetCounterValue(METRIC_RENDERER_READBACK_LATENCY_FRAMES, finished->latencyFrames);
+
+    const auto output = ReadSlot(m_slots[finished->slotIndex]);
+    if (!output) { return; }
+
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+    m_output = *output;
+}
+
+void RenderOutputReadback::RecordReadback(GPU::CommandBufferId commandBufferId, const RenderOutputRequest& request)
+{
+    const auto texture = m_pGlobal->pTextures->GetTexture(request.textureId);
+    if (!texture)
+    {
+        m_pGlobal->pLogger->Error("RenderOutputReadback::RecordReadback: No such texture exists: {}", request.textureId.id);
+        return;
+    }
+
+    if (texture->createParams.usageFlags.contains(TextureUsageFlag::DepthStencilTarget))
+    {
+        m_pGlobal->pLogger->Error("RenderOutputReadback::RecordReadback: Depth textures can't be read back: {}", request.textureId.id);
+        return;
+    }
+
+    const auto textureSize = NCommon::Size2DUInt(texture->createParams.size.w, texture->createParams.size.h);
+    const auto readbackSize = request.downscaleSize.value_or(textureSize);
+
+    if (readbackSize.GetWidth() == 0 || readbackSize.GetHeight() == 0)
+    {
+        m_pGlobal->pLogger->Error("RenderOutputReadback::RecordReadback: Readback size must be non-zero");
+        return;
+    }
+
+    //
+    // Find a free slot to read back into. If the GPU is still working on all of them, skip this
+    // frame's readback rather than stalling.
+    //
+    const auto slotIndex = GetFreeSlotIndex();
+    if (!slotIndex)
+    {
+        m_pGlobal->pMetrics->IncrementCounterValue(METRIC_RENDERER_READBACK_SKIPPED_COUNT);
+        return;
+    }
+    auto& slot = m_slots[*slotIndex];
+
+    const std::size_t readbackByteSize = (std::size_t)readbackSize.GetWidth() * readbackSize.GetHeight() * READBACK_BYTES_PER_TEXEL;
+
+    if (!EnsureSlotCapacity(slot, readbackByteSize))
+    {
+        m_pGlobal->pLogger->Error("RenderOutputReadback::RecordReadback: Failed to create readback buffer");
+        return;
+    }
+
+    //
+    // If the output needs to be downscaled or converted, blit the texture into an intermediate image
+    // first and read back from that instead. Blits convert between formats and color spaces as needed.
+    //
+    const bool requiresBlit = (readbackSize != textureSize) ||
+                              (request.colorSpace != texture->createParams.colorSpace) ||
+                              IsNonB8G8R8A8Texture(texture->createParams);
+
+    GPU::ImageId sourceImageId = texture->imageId;
+
+    if (requiresBlit)
+    {
+        const auto intermediateImageId = GetIntermediateImage(commandBufferId, readbackSize, request.colorSpace);
+        if (!intermediateImageId)
+        {
+            m_pGlobal->pLogger->Error("RenderOutputReadback::RecordReadback: Failed to create intermediate image");
+            return;
+        }
+
+        sourceImageId = *intermediateImageId;
+    }
+
+    const auto copyPass = m_pGlobal->pGPU->BeginCopyPass(commandBufferId, "RenderOutputReadback");
+    if (!copyPass)
+    {
+        m_pGlobal->pLogger->Error("RenderOutputReadback::RecordReadback: Failed to begin copy pass");
+        return;
+    }
+
+        if (requiresBlit)
+        {
+            m_pGlobal->pGPU->CmdBlitImage(
+                *copyPass,
+                texture->imageId,
+                GPU::ImageRegion{
+                    .layerIndex = 0,
+                    .mipLevel = 0,
+                    .offsets = {
+                        NCommon::Point3DUInt{0, 0, 0},
+                        NCommon::Point3DUInt{textureSize.GetWidth(), textureSize.GetHeight(), 1}
+                    }
+                },
+                sourceImageId,
+                GPU::ImageRegion{
+                    .layerIndex = 0,
+                    .mipLevel = 0,
+                    .offsets = {
+                        NCommon::Point3DUInt{0, 0, 0},
+                        NCommon::Point3DUInt{readbackSize.GetWidth(), readbackSize.GetHeight(), 1}
+                    }
+                },
+                GPU::Filter::Linear,
+                true
+            );
+        }
+
+        const bool copyRecorded = m_pGlobal->pGPU->CmdDownloadDataFromImage(
+            *copyPass,
+            sourceImageId,
+            GPU::ImageRegion{
+                .layerIndex = 0,
+                .mipLevel = 0,
+                .offsets = {
+                    NCommon::Point3DUInt{0, 0, 0},
+                    NCommon::Point3DUInt{readbackSize.GetWidth(), readbackSize.GetHeight(), 1}
+                }
+            },
+            slot.bufferId,
+            0
+        );
+
+    m_pGlobal->pGPU->EndCopyPass(*copyPass);
+
+    if (!copyRecorded)
+    {
+        m_pGlobal->pLogger->Error("RenderOutputReadback::RecordReadback: Failed to record readback copy");
+        return;
+    }
+
+    slot.size = readbackSize;
+    slot.colorSpace = requiresBlit ? request.colorSpace : texture->createParams.colorSpace;
+
+    m_ring.MarkPending(*slotIndex);
+}
+
+void RenderOutputReadback::OnFrameCancelled()
+{
+    // Readbacks recorded into a command buffer that was never submitted will never be written to
+    m_ring.CancelFrame();
+}
+
+void RenderOutputReadback::ReleaseIdleResources()
+{
+    // Destruction is deferred by the GPU until pending work using the resources has finished
+    for (std::size_t x = 0; x < m_slots.size(); ++x)
+    {
+        auto& slot = m_slots[x];
+        if (m_ring.IsPending(x) || !slot.bufferId.IsValid()) { continue; }
+
+        m_pGlobal->pGPU->DestroyBuffer(slot.bufferId);
+        slot.bufferId = {};
+        slot.byteSize = 0;
+    }
+
+    if (m_intermediate)
+    {
+        m_pGlobal->pGPU->DestroyImage(m_intermediate->imageId);
+        m_intermediate = std::nullopt;
+    }
+}
+
+std::optional<std::shared_ptr<NCommon::ImageData>> RenderOutputReadback::PopLatestOutput()
+{
+    std::lock_guard<std::mutex> lock(m_outputMutex);
+
+    auto output = m_output;
+    m_output = std::nullopt;
+    return output;
+}
+
+std::optional<std::size_t> RenderOutputReadback::GetFreeSlotIndex()
+{
+    // One more slot than frames in flight, so that a readback can be recorded while the GPU works on the
+    // previous frames' readbacks
+    const std::size_t ringSize = m_pGlobal->renderSettings.framesInFlight + 1;
+
+    m_ring.EnsureSize(ringSize);
+    if (m_slots.size() < m_ring.GetSize())
+    {
+        m_slots.resize(m_ring.GetSize());
+    }
+
+    return m_ring.AcquireFreeSlot([this](std::size_t slotIndex){ return IsSlotInUse(slotIndex); });
+}
+
+bool RenderOutputReadback::IsSlotInUse(std::size_t slotIndex) const
+{
+    // Non-blocking; whether the GPU is still working on a copy into the slot's buffer
+    const auto& slot = m_slots[slotIndex];
+    return slot.bufferId.IsValid() && m_pGlobal->pGPU->IsBufferInUse(slot.bufferId);
+}
+
+bool RenderOutputReadback::EnsureSlotCapacity(Slot& slot, std::size_t byteSize)
+{
+    if (slot.bufferId.IsValid() && slot.byteSize >= byteSize)
+    {
+        return true;
+    }
+
+    if (slot.bufferId.IsValid())
+    {
+        m_pGlobal->pGPU->DestroyBuffer(slot.bufferId);
+        slot.bufferId = {};
+        slot.byteSize = 0;
+    }
+
+    const auto transferBufferCreateParams = GPU::TransferBufferCreateParams{
+        .usageFlags = {GPU::TransferBufferUsageFlag::Download},
+        .byteSize = byteSize,
+        .sequentiallyWritten = false
+    };
+
+    const auto bufferId = m_pGlobal->pGPU->CreateTransferBuffer(transferBufferCreateParams, "RenderOutputReadback");
+    if (!bufferId)
+    {
+        return false;
+    }
+
+    slot.bufferId = *bufferId;
+    slot.byteSize = byteSize;
+
+    return true;
+}
+
+std::optional<GPU::ImageId> RenderOutputReadback::GetIntermediateImage(GPU::CommandBufferId commandBufferId,
+                                                                       const NCommon::Size2DUInt& size,
+                                                                       GPU::ColorSpace colorSpace)
+{
+    if (m_intermediate && m_intermediate->size == size && m_intermediate->colorSpace == colorSpace)
+    {
+        return m_intermediate->imageId;
+    }
+
+    // Destruction is deferred by the GPU until pending work using the image has finished
+    if (m_intermediate)
+    {
+        m_pGlobal->pGPU->DestroyImage(m_intermediate->imageId);
+        m_intermediate = std::nullopt;
+    }
+
+    const auto imageCreateParams = GPU::ImageCreateParams{
+        .imageType = GPU::ImageType::Image2D,
+        .usageFlags = {GPU::ImageUsageFlag::TransferSrc, GPU::ImageUsageFlag::TransferDst},
+        .size = {size.GetWidth(), size.GetHeight(), 1},
+        .colorSpace = colorSpace,
+        .numLayers = 1,
+        .numMipLevels = 1
+    };
+
+    const auto imageId = m_pGlobal->pGPU->CreateImage(commandBufferId, imageCreateParams, "RenderOutputReadback");
+    if (!imageId)
+    {
+        return std::nullopt;
+    }
+
+    m_intermediate = Intermediate{
+        .imageId = *imageId,
+        .size = size,
+        .colorSpace = colorSpace
+    };
+
+    return *imageId;
+}
+
+std::optional<std::shared_ptr<NCommon::ImageData>> RenderOutputReadback::ReadSlot(const Slot& slot) const
+{
+    const std::size_t byteSize = (std::size_t)slot.size.GetWidth() * slot.size.GetHeight() * READBACK_BYTES_PER_TEXEL;
+
+    const auto pMapped = m_pGlobal->pGPU->MapBuffer(slot.bufferId, false);
+    if (!pMapped)
+    {
+        m_pGlobal->pLogger->Error("RenderOutputReadback::ReadSlot: Failed to map readback buffer: {}", slot.bufferId.id);
+        return std::nullopt;
+    }
+
+    std::vector<std::byte> pixelBytes(byteSize);
+    std::memcpy(pixelBytes.data(), *pMapped, byteSize);
+
+    (void)m_pGlobal->pGPU->UnmapBuffer(slot.bufferId);
+
+    NCommon::ImageData::PixelFormat pixelFormat{};
+
+    switch (slot.colorSpace)
+    {
+        case GPU::ColorSpace::SRGB: pixelFormat = NCommon::ImageData::PixelFormat::B8G8R8A8_SRGB; break;
+        case GPU::ColorSpace::Linear: pixelFormat = NCommon::ImageData::PixelFormat::B8G8R8A8_LINEAR; break;
+    }
+
+    return std::make_shared<NCommon::ImageData>(
+        std::move(pixelBytes),
+        1,
+        slot.size.GetWidth(),
+        slot.size.GetHeight(),
+        pixelFormat
+    );
+}
+
+}
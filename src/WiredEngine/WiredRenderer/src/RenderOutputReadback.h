@@ -0,0 +1,117 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERER_SRC_RENDEROUTPUTREADBACK_H
+#define WIREDENGINE_WIREDRENDERER_SRC_RENDEROUTPUTREADBACK_H
+
+#include "ReadbackRing.h"
+
+#include <Wired/Render/RenderFrameParams.h>
+
+#include <Wired/GPU/GPUId.h>
+#include <Wired/GPU/GPUCommon.h>
+
+#include <NEON/Common/ImageData.h>
+
+#include <vector>
+#include <memory>
+#include <optional>
+#include <mutex>
+#include <cstdint>
+
+namespace Wired::Render
+{
+    struct Global;
+
+    /**
+     * Copies render output back to the CPU without ever blocking the render thread.
+     *
+     * Keeps a ring of host-visible download buffers. Each frame which requests a readback records a copy of the
+     * requested texture into a free buffer in the ring; if no buffer is free that frame's readback is skipped
+     * rather than waiting on the GPU. At the start of each frame, buffers whose copies the GPU has finished are
+     * read into an ImageData and published for retrieval via PopLatestOutput.
+     */
+    class RenderOutputReadback
+    {
+        public:
+
+            explicit RenderOutputReadback(Global* pGlobal);
+            ~RenderOutputReadback();
+
+            void ShutDown();
+
+            /**
+             * Render thread. Publishes the output of any readbacks which the GPU has finished. Should be called
+             * once per frame, after the GPU's frame has been started.
+             */
+            void OnFrameStarted();
+
+            /**
+             * Render thread. Records a readback of the requested texture into the provided command buffer.
+             */
+            void RecordReadback(GPU::CommandBufferId commandBufferId, const RenderOutputRequest& request);
+
+            /**
+             * Render thread. Drops any readbacks recorded this frame; should be called if the command buffer
+             * they were recorded into is never submitted.
+             */
+            void OnFrameCancelled();
+
+            /**
+             * Render thread. Destroys the intermediate image and any download buffers without a pending readback;
+             * they're re-created on demand by later readbacks.
+             */
+            void ReleaseIdleResources();
+
+            /**
+             * Any thread. Returns the most recently published readback output, if any, since the last call.
+             */
+            [[nodiscard]] std::optional<std::shared_ptr<NCommon::ImageData>> PopLatestOutput();
+
+        private:
+
+            struct Slot
+            {
+                GPU::BufferId bufferId{};
+                std::size_t byteSize{0};
+
+                // Details of the most recent readback recorded into the slot
+                NCommon::Size2DUInt size{0, 0};
+                GPU::ColorSpace colorSpace{GPU::ColorSpace::SRGB};
+            };
+
+            struct Intermediate
+            {
+                GPU::ImageId imageId{};
+                NCommon::Size2DUInt size{0, 0};
+                GPU::ColorSpace colorSpace{GPU::ColorSpace::SRGB};
+            };
+
+        private:
+
+            [[nodiscard]] std::optional<std::size_t> GetFreeSlotIndex();
+            [[nodiscard]] bool IsSlotInUse(std::size_t slotIndex) const;
+            [[nodiscard]] bool EnsureSlotCapacity(Slot& slot, std::size_t byteSize);
+            [[nodiscard]] std::optional<GPU::ImageId> GetIntermediateImage(GPU::CommandBufferId commandBufferId,
+                                                                           const NCommon::Size2DUInt& size,
+                                                                           GPU::ColorSpace colorSpace);
+
+            [[nodiscard]] std::optional<std::shared_ptr<NCommon::ImageData>> ReadSlot(const Slot& slot) const;
+
+        private:
+
+            Global* m_pGlobal;
+
+            ReadbackRing m_ring;
+            std::vector<Slot> m_slots;
+            std::optional<Intermediate> m_intermediate;
+
+            std::mutex m_outputMutex;
+            std::optional<std::shared_ptr<NCommon::ImageData>> m_output;
+    };
+}
+
+#endif //WIREDENGINE_WIREDRENDERER_SRC_RENDEROUTPUTREADBACK_H
@@ -6,7 +6,7 @@
  
 #include "Renderer.h"
 #include "Global.h"
-#include "TransferBufferPool.h"
+#include "StagingRing.h"
 #include "Textures.h"
 #include "Meshes.h"
 #include "Materials.h"
@@ -14,6 +14,7 @@
 #include "Pipelines.h"
 #include "Groups.h"
 #include "Group.h"
+#include "RenderOutputReadback.h"
 
 #include "DrawPass/ObjectDrawPass.h"
 
@@ -43,7 +44,7 @@ namespace Wired::Render
 Renderer::Renderer(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics, GPU::WiredGPU* pGPU)
     : m_pGPU(pGPU)
     , m_global(std::make_unique<Global>())
-    , m_transferBufferPool(std::make_unique<TransferBufferPool>(m_global.get()))
+    , m_stagingRing(std::make_unique<StagingRing>(m_global.get()))
     , m_textures(std::make_unique<Textures>(m_global.get()))
     , m_meshes(std::make_unique<Meshes>(m_global.get()))
     , m_materials(std::make_unique<Materials>(m_global.get()))
@@ -54,11 +55,12 @@ Renderer::Renderer(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics,
     , m_spriteRenderer(std::make_unique<SpriteRenderer>(m_global.get()))
     , m_effectRenderer(std::make_unique<EffectRenderer>(m_global.get()))
     , m_skyBoxRenderer(std::make_unique<SkyBoxRenderer>(m_global.get()))
+    , m_renderOutputReadback(std::make_unique<RenderOutputReadback>(m_global.get()))
 {
     m_global->pLogger = pLogger;
     m_global->pMetrics = pMetrics;
     m_global->pGPU = pGPU;
-    m_global->pTransferBufferPool = m_transferBufferPool.get();
+    m_global->pStagingRing = m_stagingRing.get();
     m_global->pTextures = m_textures.get();
     m_global->pMeshes = m_meshes.get();
     m_global->pMaterials = m_materials.get();
@@ -70,13 +72,14 @@ Renderer::Renderer(const NCommon::ILogger* pLogger, NCommon::IMetrics* pMetrics,
 Renderer::~Renderer()
 {
     m_pGPU = nullptr;
+    m_renderOutputReadback = {};
     m_groups = {};
     m_pipelines = {};
     m_samplers = {};
     m_materials = {};
     m_meshes = {};
     m_textures = {};
-    m_transferBufferPool = {};
+    m_stagingRing = {};
     m_global = {};
 }
 
@@ -121,6 +124,9 @@ bool Renderer::StartUp(const std::optional<std::unique_ptr<GPU::SurfaceDetails>>
         return false;
     }
 
+    // Memory is released at the start of the frame following a report, once our per-frame systems have advanced
+    m_pGPU->SetMemoryPressureCallback([this](const GPU::MemoryPressure&){ m_memoryPressureReported = true; });
+
     //
     // Init ImGui
     //
@@ -137,6 +143,12 @@ bool Renderer::StartUp(const std::optional<std::unique_ptr<GPU::SurfaceDetails>>
     //
     // Start internal systems
     //
+    if (!m_stagingRing->StartUp())
+    {
+        m_global->pLogger->Fatal("Renderer: Failed to start up the staging ring");
+        return false;
+    }
+
     if (!m_textures->StartUp())
     {
         m_global->pLogger->Fatal("Renderer: Failed to start up the textures system");
@@ -209,7 +221,7 @@ void Renderer::ShutDown()
     // Stop our render thread
     m_thread = {};
 
-    m_transferBufferPool->Destroy();
+    m_renderOutputReadback->ShutDown();
 
     // Shut down renderers
     m_skyBoxRenderer->ShutDown();
@@ -224,6 +236,7 @@ void Renderer::ShutDown()
     m_materials->ShutDown();
     m_meshes->ShutDown();
     m_textures->ShutDown();
+    m_stagingRing->ShutDown();
     m_pGPU->ShutDown();
 
     m_global->ids.Reset();
@@ -465,6 +478,58 @@ std::optional<NCommon::Size3DUInt> Renderer::GetTextureSize(TextureId textureId)
     return loadedTexture->createParams.size;
 }
 
+std::future<bool> Renderer::UpdateTexture(TextureId textureId, const std::vector<TextureUpdate>& updates)
+{
+    return m_thread->DispatchForResult("UpdateTexture", [=,this](){ return OnUpdateTexture(textureId, updates); });
+}
+
+bool Renderer::OnUpdateTexture(TextureId textureId, const std::vector<TextureUpdate>& updates)
+{
+    if (updates.empty())
+    {
+        return true;
+    }
+
+    std::vector<TextureTransfer> transfers;
+    transfers.reserve(updates.size());
+
+    for (const auto& update : updates)
+    {
+        transfers.push_back(TextureTransfer{
+            // Source
+            .data = update.pImageData->GetPixelData(0, 0),
+            .dataByteSize = update.pImageData->GetLayerByteSize(),
+            // Dest
+            .textureId = textureId,
+            .level = 0,
+            .layer = 0,
+            .destSize = NCommon::Size2DUInt(update.pImageData->GetPixelWidth(), update.pImageData->GetPixelHeight()),
+            .x = update.x,
+            .y = update.y,
+            .z = 1,
+            .cycle = false // The texture's other contents must be kept
+        });
+    }
+
+    const auto commandBufferId = m_pGPU->AcquireCommandBuffer(true, "OnUpdateTexture");
+    if (!commandBufferId)
+    {
+        m_global->pLogger->Error("Renderer::OnUpdateTexture: Failed to acquire a command buffer");
+        return false;
+    }
+
+    if (!m_textures->TransferData(*commandBufferId, transfers))
+    {
+        m_global->pLogger->Error("Renderer::OnUpdateTexture: Failed to transfer data to texture: {}", textureId.id);
+        m_pGPU->CancelCommandBuffer(*commandBufferId);
+        return false;
+    }
+
+    (void)m_pGPU->SubmitCommandBuffer(*commandBufferId);
+
+    return true;
+}
+
 std::future<bool> Renderer::DestroyTexture(TextureId textureId)
 {
     return m_thread->DispatchForResult("DestroyTexture", [=,this](){ return OnDestroyTexture(textureId); });
@@ -558,10 +623,28 @@ std::future<std::expected<bool, GPU::SurfaceError>> Renderer::RenderFrame(const
     return m_thread->DispatchForResult("RenderFrame", [=,this](){ return OnRenderFrame(renderFrameParams); });
 }
 
+std::optional<std::shared_ptr<NCommon::ImageData>> Renderer::PopRenderOutput()
+{
+    return m_renderOutputReadback->PopLatestOutput();
+}
+
 std::expected<bool, GPU::SurfaceError> Renderer::OnRenderFrame(const RenderFrameParams& renderFrameParams)
 {
     m_pGPU->StartFrame();
 
+    // Move on to this frame's staging memory
+    m_stagingRing->OnFrameStarted();
+
+    // Publish any render output readbacks the GPU has finished since the last frame
+    m_renderOutputReadback->OnFrameStarted();
+
+    // Give back what memory we can if the GPU is running low on it
+    if (m_memoryPressureReported)
+    {
+        m_memoryPressureReported = false;
+        ReleaseMemory();
+    }
+
     auto allFrameWorkTimer = NCommon::Timer(METRIC_RENDERER_CPU_ALL_FRAME_WORK);
 
     ////////////////////////
@@ -574,7 +657,7 @@ std::expected<bool, GPU::SurfaceError> Renderer::OnRenderFrame(const RenderFrame
 
         for (const auto& stateUpdate: renderFrameParams.stateUpdates)
         {
-            ApplyStateUpdate(stateUpdatesCommandBufferId, stateUpdate);
+            ApplyStateUpdate(stateUpdatesCommandBufferId, *stateUpdate);
         }
 
         (void)m_pGPU->SubmitCommandBuffer(stateUpdatesCommandBufferId);
@@ -585,7 +668,7 @@ std::expected<bool, GPU::SurfaceError> Renderer::OnRenderFrame(const RenderFrame
     ////////////////////////
 
     m_pGPU->SyncDownFrameTimestamps();
-    UpdateGPUTimestampMetrics();
+    UpdateGPUMetrics();
 
     const auto renderCommandBufferId = *m_pGPU->AcquireCommandBuffer(true, "Render");
 
@@ -593,6 +676,9 @@ std::expected<bool, GPU::SurfaceError> Renderer::OnRenderFrame(const RenderFrame
 
     m_pGPU->CmdWriteTimestampStart(renderCommandBufferId, METRIC_RENDERER_GPU_ALL_FRAME_WORK);
 
+    // Blend renderables which are moving between simulation steps towards their latest state
+    m_groups->ApplyInterpolation(renderCommandBufferId, renderFrameParams.interpolation);
+
     for (const auto& renderTask : renderFrameParams.renderTasks)
     {
         const auto processResult = ProcessRenderTask(renderCommandBufferId, renderFrameParams, renderTask);
@@ -604,12 +690,22 @@ std::expected<bool, GPU::SurfaceError> Renderer::OnRenderFrame(const RenderFrame
         }
     }
 
+    ////////////////////////
+    // Render Output Readback
+    ////////////////////////
+
+    if (renderFrameParams.renderOutputRequest)
+    {
+        m_renderOutputReadback->RecordReadback(renderCommandBufferId, *renderFrameParams.renderOutputRequest);
+    }
+
     m_pGPU->CmdWriteTimestampFinish(renderCommandBufferId, METRIC_RENDERER_GPU_ALL_FRAME_WORK);
 
     const auto submitResult = m_pGPU->SubmitCommandBuffer(renderCommandBufferId);
     if (!submitResult)
     {
         m_global->pLogger->Info("Renderer::OnRenderFrame: Failed to submit frame command buffer");
+        m_renderOutputReadback->OnFrameCancelled();
         m_pGPU->EndFrame();
         return submitResult;
     }
@@ -1049,10 +1145,107 @@ void RecordTimestampMetric(GPU::WiredGPU* pGPU, NCommon::IMetrics* pMetrics, con
     }
 }
 
-void Renderer::UpdateGPUTimestampMetrics()
+void Renderer::UpdateGPUMetrics()
 {
     RecordTimestampMetric(m_pGPU, m_global->pMetrics, METRIC_RENDERER_GPU_ALL_FRAME_WORK);
     RecordTimestampMetric(m_pGPU, m_global->pMetrics, METRIC_RENDERER_GPU_ALL_SHADOW_MAP_RENDER_WORK);
+
+    // Barriers recorded since the previous frame
+    const auto pipelineBarrierCount = m_pGPU->GetPipelineBarrierCount();
+    m_global->pMetrics->SetCounterValue(METRIC_RENDERER_GPU_PIPELINE_BARRIER_COUNT, pipelineBarrierCount - m_lastPipelineBarrierCount);
+    m_lastPipelineBarrierCount = pipelineBarrierCount;
+
+    // Queue submits made since the previous frame
+    const auto queueSubmitCount = m_pGPU->GetQueueSubmitCount();
+    m_global->pMetrics->SetCounterValue(METRIC_RENDERER_GPU_QUEUE_SUBMIT_COUNT, queueSubmitCount - m_lastQueueSubmitCount);
+    m_lastQueueSubmitCount = queueSubmitCount;
+
+    m_global->pMetrics->SetCounterValue(METRIC_RENDERER_GPU_CYCLED_BUFFER_BYTES, m_pGPU->GetCycledBufferByteSize());
+
+    // Descriptor set cache size, and cache hit rate / transient sets allocated since the previous frame
+    const auto descriptorSetStats = m_pGPU->GetDescriptorSetStats();
+    const auto cacheLookupCount = descriptorSetStats.cacheLookupCount - m_lastDescriptorSetStats.cacheLookupCount;
+    const auto cacheHitCount = descriptorSetStats.cacheHitCount - m_lastDescriptorSetStats.cacheHitCount;
+
+    m_global->pMetrics->SetCounterValue(METRIC_RENDERER_GPU_DESCRIPTOR_CACHE_SIZE, descriptorSetStats.cachedSetCount);
+    m_global->pMetrics->SetDoubleValue(METRIC_RENDERER_GPU_DESCRIPTOR_CACHE_HIT_RATE,
+                                       cacheLookupCount == 0 ? 1.0 : (double)cacheHitCount / (double)cacheLookupCount);
+    m_global->pMetrics->SetCounterValue(METRIC_RENDERER_GPU_TRANSIENT_DESCRIPTOR_COUNT,
+                                        descriptorSetStats.transientSetCount - m_lastDescriptorSetStats.transientSetCount);
+    m_lastDescriptorSetStats = descriptorSetStats;
+
+    UpdateGPUMemoryMetrics();
+}
+
+void Renderer::UpdateGPUMemoryMetrics()
+{
+    std::size_t deviceLocalBudgetByteSize = 0;
+    std::size_t deviceLocalUsageByteSize = 0;
+
+    for (const auto& heapStats : m_pGPU->GetMemoryHeapStats())
+    {
+        m_global->pMetrics->SetCounterValue(std::format("{}{}", METRIC_RENDERER_GPU_HEAP_BUDGET_BYTES_PREFIX, heapStats.heapIndex), heapStats.budgetByteSize);
+        m_global->pMetrics->SetCounterValue(std::format("{}{}", METRIC_RENDERER_GPU_HEAP_USAGE_BYTES_PREFIX, heapStats.heapIndex), heapStats.usageByteSize);
+
+        if (heapStats.deviceLocal)
+        {
+            deviceLocalBudgetByteSize += heapStats.budgetByteSize;
+            deviceLocalUsageByteSize += heapStats.usageByteSize;
+        }
+    }
+
+    m_global->pMetrics->SetCounterValue(METRIC_RENDERER_GPU_MEMORY_BUDGET_BYTES, deviceLocalBudgetByteSize);
+    m_global->pMetrics->SetCounterValue(METRIC_RENDERER_GPU_MEMORY_USAGE_BYTES, deviceLocalUsageByteSize);
+
+    std::unordered_set<std::string> allocationTags;
+
+    for (const auto& it : m_pGPU->GetAllocationByteSizesByTag())
+    {
+        m_global->pMetrics->SetCounterValue(std::format("{}{}", METRIC_RENDERER_GPU_TAG_BYTES_PREFIX, it.first), it.second);
+        allocationTags.insert(it.first);
+        m_lastAllocationTags.erase(it.first);
+    }
+
+    // Zero out the metrics of tags whose allocations have all since been destroyed
+    for (const auto& tag : m_lastAllocationTags)
+    {
+        m_global->pMetrics->SetCounterValue(std::format("{}{}", METRIC_RENDERER_GPU_TAG_BYTES_PREFIX, tag), 0);
+    }
+
+    m_lastAllocationTags = std::move(allocationTags);
+}
+
+void Renderer::ReleaseMemory()
+{
+    m_global->pLogger->Warning("Renderer::ReleaseMemory: GPU memory is running low, releasing unused memory");
+    m_global->pMetrics->IncrementCounterValue(METRIC_RENDERER_GPU_MEMORY_PRESSURE_COUNT);
+
+    // Cached resources which are re-created on demand
+    m_renderOutputReadback->ReleaseIdleResources();
+    m_stagingRing->ReleaseIdleSlots();
+
+    // Unused capacity in growable GPU buffers
+    const auto commandBufferId = m_pGPU->AcquireCommandBuffer(true, "ReleaseMemory");
+    if (!commandBufferId)
+    {
+        m_global->pLogger->Error("Renderer::ReleaseMemory: Failed to acquire a command buffer");
+        return;
+    }
+
+    const auto copyPass = m_pGPU->BeginCopyPass(*commandBufferId, "ReleaseMemory");
+    if (!copyPass)
+    {
+        m_global->pLogger->Error("Renderer::ReleaseMemory: Failed to begin copy pass");
+        m_pGPU->CancelCommandBuffer(*commandBufferId);
+        return;
+    }
+
+        m_meshes->TrimMemory(*copyPass);
+        m_groups->TrimMemory(*copyPass);
+
+    m_pGPU->EndCopyPass(*copyPass);
+
+    (void)m_pGPU->SubmitCommandBuffer(*commandBufferId);
 }
 
 }
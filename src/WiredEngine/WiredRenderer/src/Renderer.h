@@ -14,6 +14,9 @@
 #include <NEON/Common/Thread/MessageDrivenThreadPool.h>
 
 #include <memory>
+#include <string>
+#include <unordered_set>
+#include <cstdint>
 
 namespace NCommon
 {
@@ -29,7 +32,7 @@ namespace Wired::GPU
 namespace Wired::Render
 {
     struct Global;
-    class TransferBufferPool;
+    class StagingRing;
     class Textures;
     class Meshes;
     class Materials;
@@ -41,6 +44,7 @@ namespace Wired::Render
     class SpriteRenderer;
     class EffectRenderer;
     class SkyBoxRenderer;
+    class RenderOutputReadback;
 
     class Renderer : public IRenderer
     {
@@ -70,6 +74,7 @@ namespace Wired::Render
             [[nodiscard]] std::future<std::expected<TextureId, bool>> CreateTexture_FromImage(const NCommon::ImageData* pImageData, TextureType textureType, bool generateMipMaps, const std::string& tag) override;
             [[nodiscard]] std::future<std::expected<TextureId, bool>> CreateTexture_RenderTarget(const TextureUsageFlags& usages, const std::string& tag) override;
             [[nodiscard]] std::optional<NCommon::Size3DUInt> GetTextureSize(TextureId textureId) override;
+            [[nodiscard]] std::future<bool> UpdateTexture(TextureId textureId, const std::vector<TextureUpdate>& updates) override;
             std::future<bool> DestroyTexture(TextureId textureId) override;
 
             // Meshes
@@ -89,6 +94,7 @@ namespace Wired::Render
 
             // Rendering
             [[nodiscard]] std::future<std::expected<bool, GPU::SurfaceError>> RenderFrame(const RenderFrameParams& renderFrameParams) override;
+            [[nodiscard]] std::optional<std::shared_ptr<NCommon::ImageData>> PopRenderOutput() override;
 
             // Events
             [[nodiscard]] std::future<bool> SurfaceDetailsChanged(std::unique_ptr<GPU::SurfaceDetails> surfaceDetails) override;
@@ -110,6 +116,7 @@ namespace Wired::Render
             [[nodiscard]] std::expected<TextureId, bool> OnCreateTexture_FromImage(const NCommon::ImageData* pImageData, TextureType textureType, bool generateMipMaps, const std::string& tag);
             [[nodiscard]] std::expected<TextureId, bool> OnCreateTexture_RenderTarget(const TextureUsageFlags& textureUsageFlags, const std::string& tag);
 
+            bool OnUpdateTexture(TextureId textureId, const std::vector<TextureUpdate>& updates);
             bool OnDestroyTexture(TextureId textureId);
 
             [[nodiscard]] std::expected<std::vector<MeshId>, bool> OnCreateMeshes(const std::vector<const Mesh*>& meshes);
@@ -137,7 +144,10 @@ namespace Wired::Render
             void RecordGroupCameraDrawPassCommands(Group* pGroup, const RendererInput& rendererInput);
             void RecordShadowMapRenders(Group* pGroup, GPU::CommandBufferId commandBufferId);
 
-            void UpdateGPUTimestampMetrics();
+            void UpdateGPUMetrics();
+            void UpdateGPUMemoryMetrics();
+
+            void ReleaseMemory();
 
         private:
 
@@ -145,7 +155,7 @@ namespace Wired::Render
             std::unique_ptr<Global> m_global;
             std::unique_ptr<NCommon::MessageDrivenThreadPool> m_thread;
 
-            std::unique_ptr<TransferBufferPool> m_transferBufferPool;
+            std::unique_ptr<StagingRing> m_stagingRing;
             std::unique_ptr<Textures> m_textures;
             std::unique_ptr<Meshes> m_meshes;
             std::unique_ptr<Materials> m_materials;
@@ -157,6 +167,18 @@ namespace Wired::Render
             std::unique_ptr<SpriteRenderer> m_spriteRenderer;
             std::unique_ptr<EffectRenderer> m_effectRenderer;
             std::unique_ptr<SkyBoxRenderer> m_skyBoxRenderer;
+
+            std::unique_ptr<RenderOutputReadback> m_renderOutputReadback;
+
+            uint64_t m_lastPipelineBarrierCount{0};
+            uint64_t m_lastQueueSubmitCount{0};
+            GPU::DescriptorSetStats m_lastDescriptorSetStats{};
+
+            // Allocation tags which had a metric recorded for them last frame
+            std::unordered_set<std::string> m_lastAllocationTags;
+
+            // Set by the GPU's memory pressure callback, from within StartFrame
+            bool m_memoryPressureReported{false};
     };
 }
 
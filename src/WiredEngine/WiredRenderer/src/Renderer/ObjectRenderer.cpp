@@ -7,7 +7,6 @@
 #include "ObjectRenderer.h"
 
 #include "../Samplers.h"
-#include "../TransferBufferPool.h"
 #include "../Group.h"
 
 #include <NEON/Common/Timer.h>
@@ -241,7 +240,9 @@ void ObjectRenderer::BindSet1(const BatchInput& input, RenderState& renderState)
     m_pGlobal->pGPU->CmdBindUniformData(renderPass, "u_globalData", &globalPayload, sizeof(ObjectGlobalUniformPayload));
     m_pGlobal->pGPU->CmdBindUniformData(renderPass, "u_viewProjectionData", &viewProjectionPayload, sizeof(ViewProjectionUniformPayload));
     m_pGlobal->pGPU->CmdBindStorageReadBuffer(renderPass, "i_objectInstanceData", input.pGroup->GetDataStores().objects.GetInstancePayloadsBuffer());
+    m_pGlobal->pGPU->CmdBindStorageReadBuffer(renderPass, "i_objectSlots", input.pGroup->GetDataStores().objects.GetInstanceSlotsBuffer());
     m_pGlobal->pGPU->CmdBindStorageReadBuffer(renderPass, "i_lightData", input.pGroup->GetDataStores().lights.GetInstancePayloadsBuffer());
+    m_pGlobal->pGPU->CmdBindStorageReadBuffer(renderPass, "i_lightSlots", input.pGroup->GetDataStores().lights.GetInstanceSlotsBuffer());
     m_pGlobal->pGPU->CmdBindStorageReadBuffer(renderPass, "i_shadowMapData", input.pGroup->GetLights().GetShadowMapPayloadBuffer());
 
     if (input.renderType == RenderType::Gpass)
@@ -370,7 +371,7 @@ ObjectRenderer::ObjectGlobalUniformPayload ObjectRenderer::GetGlobalPayload(cons
         .surfaceTransform = glm::mat4(1),
         .lightId = shadowMapLight ? shadowMapLight->id.id : 0,
         .ambientLight = m_pGlobal->renderSettings.ambientLight,
-        .highestLightId = (uint32_t)pGroup->GetDataStores().lights.GetInstanceCount(),
+        .numLights = (uint32_t)pGroup->GetDataStores().lights.GetInstanceCount(),
         .hdrEnabled = m_pGlobal->renderSettings.hdr,
         .shadowCascadeOverlap = m_pGlobal->renderSettings.shadowCascadeOverlapRatio
     };
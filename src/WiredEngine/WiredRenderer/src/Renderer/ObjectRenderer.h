@@ -84,7 +84,7 @@ namespace Wired::Render
 
                 // Lighting
                 alignas(16) glm::vec3 ambientLight{0.0f};
-                alignas(4) uint32_t highestLightId{0};
+                alignas(4) uint32_t numLights{0};
                 alignas(4) uint32_t hdrEnabled{1};
                 alignas(4) float shadowCascadeOverlap{0.0f};
             };
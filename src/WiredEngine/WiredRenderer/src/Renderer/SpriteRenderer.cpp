@@ -218,6 +218,7 @@ void SpriteRenderer::BindSet1(const SpriteRenderer::BatchInput& input, RenderSta
 
     m_pGlobal->pGPU->CmdBindUniformData(renderPass, "u_viewProjectionData", &viewProjectionPayload, sizeof(ViewProjectionUniformPayload));
     m_pGlobal->pGPU->CmdBindStorageReadBuffer(renderPass, "i_spriteInstanceData", input.pGroup->GetDataStores().sprites.GetInstancePayloadsBuffer());
+    m_pGlobal->pGPU->CmdBindStorageReadBuffer(renderPass, "i_spriteSlots", input.pGroup->GetDataStores().sprites.GetInstanceSlotsBuffer());
 
     renderState.OnSetBound(1);
 }
@@ -0,0 +1,323 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "StagingRing.h"
+#include "Global.h"
+
+#include <Wired/Render/Metrics.h>
+
+#include <Wired/GPU/WiredGPU.h>
+
+#include <NEON/Common/Log/ILogger.h>
+#include <NEON/Common/Metrics/IMetrics.h>
+
+#include <algorithm>
+#include <format>
+
+namespace Wired::Render
+{
+
+StagingRing::StagingRing(Global* pGlobal)
+    : m_pGlobal(pGlobal)
+{
+
+}
+
+StagingRing::~StagingRing()
+{
+    m_pGlobal = nullptr;
+}
+
+bool StagingRing::StartUp()
+{
+    m_pGlobal->pLogger->Info("StagingRing: Starting Up");
+
+    // One more slot than frames in flight, so that a frame can write into its slot while the GPU works on
+    // the previous frames' uploads. The pool grows beyond this as needed.
+    m_minSlotCount = m_pGlobal->renderSettings.framesInFlight + 1;
+
+    std::lock_guard<std::mutex> lock(m_slotsMutex);
+
+    for (std::size_t x = 0; x < m_minSlotCount; ++x)
+    {
+        auto slot = CreateSlot(SLOT_BYTE_SIZE, std::format("StagingRing-{}", x));
+        if (!slot)
+        {
+            m_pGlobal->pLogger->Error("StagingRing::StartUp: Failed to create staging buffer");
+            return false;
+        }
+
+        m_freeSlots.push_back(slot->get());
+        m_slots.push_back(std::move(*slot));
+    }
+
+    return true;
+}
+
+void StagingRing::ShutDown()
+{
+    m_pGlobal->pLogger->Info("StagingRing: Shutting down");
+
+    std::lock_guard<std::mutex> lock(m_slotsMutex);
+
+    m_pCurrentSlot = nullptr;
+
+    for (const auto& slot : m_slots)
+    {
+        DestroySlot(*slot);
+    }
+
+    m_slots.clear();
+    m_frameSlots.clear();
+    m_retiredSlots.clear();
+    m_freeSlots.clear();
+    m_minSlotCount = 0;
+}
+
+void StagingRing::OnFrameStarted()
+{
+    std::lock_guard<std::mutex> lock(m_slotsMutex);
+
+    //
+    // Report the previous frame's staging usage
+    //
+    std::size_t frameByteSize = 0;
+    for (const auto& pSlot : m_frameSlots)
+    {
+        frameByteSize += std::min(pSlot->byteOffset.load(), pSlot->byteSize);
+    }
+
+    std::size_t poolByteSize = 0;
+    for (const auto& slot : m_slots)
+    {
+        poolByteSize += slot->byteSize;
+    }
+
+    m_pGlobal->pMetrics->SetCounterValue(METRIC_RENDERER_STAGING_RING_BYTES, frameByteSize);
+    m_pGlobal->pMetrics->SetCounterValue(METRIC_RENDERER_STAGING_POOL_BYTES, poolByteSize);
+
+    //
+    // Retire the previous frame's slots; the new frame moves on to a fresh slot when it first allocates
+    //
+    m_pCurrentSlot = nullptr;
+    m_retiredSlots.insert(m_retiredSlots.end(), m_frameSlots.cbegin(), m_frameSlots.cend());
+    m_frameSlots.clear();
+
+    //
+    // Return retired slots which the GPU has finished copying out of to the pool
+    //
+    std::erase_if(m_retiredSlots, [&](Slot* pSlot){
+        if (m_pGlobal->pGPU->IsBufferInUse(pSlot->bufferId)) { return false; }
+
+        pSlot->idleFrames = 0;
+        m_freeSlots.push_back(pSlot);
+        return true;
+    });
+
+    //
+    // Release slots which have gone unused for a while, e.g. after a burst of uploads
+    //
+    for (auto& pSlot : m_freeSlots)
+    {
+        pSlot->idleFrames++;
+    }
+
+    ReleaseSlotsIdleFor(SLOT_IDLE_FRAMES_BEFORE_RELEASE);
+}
+
+void StagingRing::ReleaseIdleSlots()
+{
+    std::lock_guard<std::mutex> lock(m_slotsMutex);
+
+    ReleaseSlotsIdleFor(0);
+}
+
+void StagingRing::ReleaseSlotsIdleFor(unsigned int minIdleFrames)
+{
+    // Longest idle slots first
+    std::ranges::sort(m_freeSlots, [](const Slot* a, const Slot* b){ return a->idleFrames > b->idleFrames; });
+
+    while (m_slots.size() > m_minSlotCount && !m_freeSlots.empty() && m_freeSlots.front()->idleFrames >= minIdleFrames)
+    {
+        Slot* pSlot = m_freeSlots.front();
+        m_freeSlots.erase(m_freeSlots.begin());
+
+        DestroySlot(*pSlot);
+        std::erase_if(m_slots, [&](const auto& slot){ return slot.get() == pSlot; });
+    }
+}
+
+std::expected<StagingRing::Allocation, bool> StagingRing::Allocate(std::size_t byteSize)
+{
+    if (byteSize == 0) { return std::unexpected(false); }
+
+    const auto alignedByteSize = (byteSize + (ALLOCATION_ALIGNMENT - 1)) & ~(ALLOCATION_ALIGNMENT - 1);
+
+    //
+    // Lock-free sub-allocation from the frame's current slot
+    //
+    if (alignedByteSize <= SLOT_BYTE_SIZE)
+    {
+        const auto allocation = TryAllocate(m_pCurrentSlot.load(), alignedByteSize);
+        if (allocation) { return *allocation; }
+    }
+
+    //
+    // Otherwise the frame needs another slot
+    //
+    return AllocateFromNewSlot(alignedByteSize);
+}
+
+std::optional<StagingRing::Allocation> StagingRing::TryAllocate(Slot* pSlot, std::size_t alignedByteSize)
+{
+    if (pSlot == nullptr) { return std::nullopt; }
+
+    const auto byteOffset = pSlot->byteOffset.fetch_add(alignedByteSize);
+
+    // Slot is full
+    if (byteOffset + alignedByteSize > pSlot->byteSize)
+    {
+        return std::nullopt;
+    }
+
+    return Allocation{
+        .bufferId = pSlot->bufferId,
+        .byteOffset = byteOffset,
+        .pData = pSlot->pData + byteOffset
+    };
+}
+
+std::expected<StagingRing::Allocation, bool> StagingRing::AllocateFromNewSlot(std::size_t alignedByteSize)
+{
+    std::lock_guard<std::mutex> lock(m_slotsMutex);
+
+    //
+    // Uploads larger than a standard slot get a slot sized to fit, which doesn't replace the frame's
+    // current slot
+    //
+    if (alignedByteSize > SLOT_BYTE_SIZE)
+    {
+        const auto pSlot = AcquireSlot(alignedByteSize);
+        if (!pSlot)
+        {
+            m_pGlobal->pLogger->Error("StagingRing::AllocateFromNewSlot: Failed to acquire staging slot of size: {}", alignedByteSize);
+            return std::unexpected(false);
+        }
+
+        m_frameSlots.push_back(*pSlot);
+
+        return *TryAllocate(*pSlot, alignedByteSize);
+    }
+
+    //
+    // Another thread may have already moved the frame on to a new slot while this thread waited for the lock
+    //
+    const auto allocation = TryAllocate(m_pCurrentSlot.load(), alignedByteSize);
+    if (allocation) { return *allocation; }
+
+    //
+    // Move the frame on to a new slot
+    //
+    const auto pSlot = AcquireSlot(SLOT_BYTE_SIZE);
+    if (!pSlot)
+    {
+        m_pGlobal->pLogger->Error("StagingRing::AllocateFromNewSlot: Failed to acquire staging slot");
+        return std::unexpected(false);
+    }
+
+    // Allocate from the slot before publishing it, so that other threads can't fill it up first
+    const auto newSlotAllocation = TryAllocate(*pSlot, alignedByteSize);
+
+    m_frameSlots.push_back(*pSlot);
+    m_pCurrentSlot = *pSlot;
+
+    return *newSlotAllocation;
+}
+
+std::expected<StagingRing::Slot*, bool> StagingRing::AcquireSlot(std::size_t minByteSize)
+{
+    //
+    // Use the smallest free slot which is large enough
+    //
+    auto bestIt = m_freeSlots.end();
+
+    for (auto it = m_freeSlots.begin(); it != m_freeSlots.end(); ++it)
+    {
+        if ((*it)->byteSize < minByteSize) { continue; }
+
+        if (bestIt == m_freeSlots.end() || (*it)->byteSize < (*bestIt)->byteSize)
+        {
+            bestIt = it;
+        }
+    }
+
+    if (bestIt != m_freeSlots.end())
+    {
+        Slot* pSlot = *bestIt;
+        m_freeSlots.erase(bestIt);
+
+        pSlot->byteOffset = 0;
+        pSlot->idleFrames = 0;
+
+        return pSlot;
+    }
+
+    //
+    // Otherwise, grow the pool
+    //
+    const auto byteSize = std::max(minByteSize, SLOT_BYTE_SIZE);
+
+    m_pGlobal->pLogger->Debug("StagingRing: Growing pool with a slot of size: {}", byteSize);
+
+    auto slot = CreateSlot(byteSize, std::format("StagingRing-{}", m_slots.size()));
+    if (!slot)
+    {
+        return std::unexpected(false);
+    }
+
+    Slot* pSlot = slot->get();
+    m_slots.push_back(std::move(*slot));
+
+    return pSlot;
+}
+
+std::expected<std::unique_ptr<StagingRing::Slot>, bool> StagingRing::CreateSlot(std::size_t byteSize, const std::string& userTag)
+{
+    const auto transferBufferCreateParams = GPU::TransferBufferCreateParams{
+        .usageFlags = {GPU::TransferBufferUsageFlag::Upload},
+        .byteSize = byteSize,
+        .sequentiallyWritten = true
+    };
+
+    const auto bufferId = m_pGlobal->pGPU->CreateTransferBuffer(transferBufferCreateParams, userTag);
+    if (!bufferId)
+    {
+        return std::unexpected(false);
+    }
+
+    // Mapped once, for the lifetime of the buffer
+    const auto pMapped = m_pGlobal->pGPU->MapBuffer(*bufferId, false);
+    if (!pMapped)
+    {
+        m_pGlobal->pGPU->DestroyBuffer(*bufferId);
+        return std::unexpected(false);
+    }
+
+    auto slot = std::make_unique<Slot>();
+    slot->bufferId = *bufferId;
+    slot->pData = static_cast<std::byte*>(*pMapped);
+    slot->byteSize = byteSize;
+
+    return slot;
+}
+
+void StagingRing::DestroySlot(const Slot& slot)
+{
+    (void)m_pGlobal->pGPU->UnmapBuffer(slot.bufferId);
+    m_pGlobal->pGPU->DestroyBuffer(slot.bufferId);
+}
+
+}
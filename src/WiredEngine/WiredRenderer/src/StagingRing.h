@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERER_SRC_STAGINGRING_H
+#define WIREDENGINE_WIREDRENDERER_SRC_STAGINGRING_H
+
+#include <Wired/GPU/GPUId.h>
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <expected>
+#include <optional>
+#include <memory>
+#include <cstddef>
+
+namespace Wired::Render
+{
+    struct Global;
+
+    /**
+     * Provides host-visible staging memory for uploading data to the GPU.
+     *
+     * Keeps a pool of persistently mapped upload buffers (slots), initially one more than the number of frames
+     * in flight. Each frame sub-allocates from its current slot by bumping an offset, so handing out staging
+     * memory is usually a single atomic add. When the frame's slot is full another slot is added to the frame,
+     * taken from the pool or created if the pool has none free, and uploads larger than a slot are given a
+     * slot sized to fit. A frame's slots return to the pool once the GPU has finished with them, so the pool
+     * grows to fit the frames' peak staging needs rather than allocating memory per upload. Slots beyond the
+     * initial count which sit idle for a while are released.
+     */
+    class StagingRing
+    {
+        public:
+
+            static constexpr std::size_t SLOT_BYTE_SIZE = 8 * 1024 * 1024;
+            static constexpr std::size_t ALLOCATION_ALIGNMENT = 16;
+            static constexpr unsigned int SLOT_IDLE_FRAMES_BEFORE_RELEASE = 300;
+
+            struct Allocation
+            {
+                GPU::BufferId bufferId{};
+                std::size_t byteOffset{0};
+                std::byte* pData{nullptr};
+            };
+
+        public:
+
+            explicit StagingRing(Global* pGlobal);
+            ~StagingRing();
+
+            [[nodiscard]] bool StartUp();
+            void ShutDown();
+
+            /**
+             * Render thread. Retires the previous frame's slots and returns slots the GPU has finished with to
+             * the pool. Should be called once per frame, after the GPU's frame has been started.
+             */
+            void OnFrameStarted();
+
+            /**
+             * Render thread. Releases all idle slots beyond the initial slot count.
+             */
+            void ReleaseIdleSlots();
+
+            /**
+             * Returns byteSize bytes of mapped staging memory, valid until the next frame has started. The
+             * caller must record the copy out of it into a command buffer which is submitted this frame.
+             */
+            [[nodiscard]] std::expected<Allocation, bool> Allocate(std::size_t byteSize);
+
+        private:
+
+            struct Slot
+            {
+                GPU::BufferId bufferId{};
+                std::byte* pData{nullptr};
+                std::size_t byteSize{0};
+                std::atomic<std::size_t> byteOffset{0};
+                unsigned int idleFrames{0};
+            };
+
+        private:
+
+            [[nodiscard]] static std::optional<Allocation> TryAllocate(Slot* pSlot, std::size_t alignedByteSize);
+            [[nodiscard]] std::expected<Allocation, bool> AllocateFromNewSlot(std::size_t alignedByteSize);
+
+            [[nodiscard]] std::expected<Slot*, bool> AcquireSlot(std::size_t minByteSize);
+            void ReleaseSlotsIdleFor(unsigned int minIdleFrames);
+
+            [[nodiscard]] std::expected<std::unique_ptr<Slot>, bool> CreateSlot(std::size_t byteSize, const std::string& userTag);
+            void DestroySlot(const Slot& slot);
+
+        private:
+
+            Global* m_pGlobal;
+
+            std::size_t m_minSlotCount{0};
+
+            // The slot that allocations are currently being sub-allocated from
+            std::atomic<Slot*> m_pCurrentSlot{nullptr};
+
+            std::mutex m_slotsMutex;
+            std::vector<std::unique_ptr<Slot>> m_slots; // All slots
+            std::vector<Slot*> m_frameSlots;            // Slots used by the current frame
+            std::vector<Slot*> m_retiredSlots;          // Slots used by previous frames, possibly still in use by the GPU
+            std::vector<Slot*> m_freeSlots;             // Slots available for use
+    };
+}
+
+#endif //WIREDENGINE_WIREDRENDERER_SRC_STAGINGRING_H
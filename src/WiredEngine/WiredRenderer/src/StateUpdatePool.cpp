@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Wired/Render/StateUpdatePool.h>
+
+namespace Wired::Render
+{
+
+std::shared_ptr<StateUpdatePool> StateUpdatePool::Create()
+{
+    return std::shared_ptr<StateUpdatePool>(new StateUpdatePool());
+}
+
+std::unique_ptr<StateUpdate> StateUpdatePool::Acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_pooledMutex);
+
+        if (!m_pooled.empty())
+        {
+            auto stateUpdate = std::move(m_pooled.back());
+            m_pooled.pop_back();
+            return stateUpdate;
+        }
+    }
+
+    return std::make_unique<StateUpdate>();
+}
+
+std::shared_ptr<const StateUpdate> StateUpdatePool::Share(std::unique_ptr<StateUpdate> stateUpdate)
+{
+    return std::shared_ptr<const StateUpdate>(stateUpdate.release(), [pPool = shared_from_this()](StateUpdate* pStateUpdate){
+        pPool->Release(pStateUpdate);
+    });
+}
+
+void StateUpdatePool::Release(StateUpdate* pStateUpdate)
+{
+    auto stateUpdate = std::unique_ptr<StateUpdate>(pStateUpdate);
+
+    // Clear while still on the releasing thread, so that acquiring stays cheap
+    stateUpdate->Clear();
+
+    std::lock_guard<std::mutex> lock(m_pooledMutex);
+
+    if (m_pooled.size() < MAX_POOLED_UPDATES)
+    {
+        m_pooled.push_back(std::move(stateUpdate));
+    }
+}
+
+}
@@ -7,6 +7,7 @@
 #include "Textures.h"
 
 #include "Global.h"
+#include "StagingRing.h"
 
 #include "Wired/GPU/WiredGPU.h"
 
@@ -118,9 +119,11 @@ std::optional<LoadedTexture> Textures::GetTexture(TextureId textureId) const
 bool Textures::TransferData(GPU::CommandBufferId commandBufferId, const std::vector<TextureTransfer>& transfers)
 {
     //
-    // Determine the total byte size of all data that's being transferred
+    // Determine the total byte size of all data that's being transferred. Each transfer's data
+    // starts at an aligned offset, as image copies require.
     //
     std::size_t totalTransferByteSize{0};
+    std::vector<std::size_t> transferStartOffsets;
     std::vector<LoadedTexture> transferTextures;
 
     for (const auto& transfer : transfers)
@@ -132,50 +135,30 @@ bool Textures::TransferData(GPU::CommandBufferId commandBufferId, const std::vec
             return false;
         }
 
-        totalTransferByteSize += transfer.dataByteSize;
+        transferStartOffsets.push_back(totalTransferByteSize);
         transferTextures.push_back(*loadedTexture);
-    }
-
-    //
-    // Create a transfer buffer large enough to hold all the transfer data
-    //
-    assert(totalTransferByteSize <= std::numeric_limits<uint32_t>::max());
 
-    const GPU::TransferBufferCreateParams transferBufferCreateParams{
-        .usageFlags = {GPU::TransferBufferUsageFlag::Upload},
-        .byteSize = static_cast<uint32_t>(totalTransferByteSize),
-        .sequentiallyWritten = true
-    };
-
-    const auto transferBufferId = m_pGlobal->pGPU->CreateTransferBuffer(transferBufferCreateParams, "TransferTexture");
-    if (!transferBufferId)
-    {
-        m_pGlobal->pLogger->Error("Textures::TransferData: Failed to create transfer buffer");
-        return false;
+        totalTransferByteSize += (transfer.dataByteSize + (StagingRing::ALLOCATION_ALIGNMENT - 1)) & ~(StagingRing::ALLOCATION_ALIGNMENT - 1);
     }
 
+    if (totalTransferByteSize == 0) { return true; }
+
     //
-    // Map the transfer buffer into memory and fill it with data
+    // Fetch staging memory large enough to hold all the transfer data, and fill it with data
     //
-    auto pTransferData = m_pGlobal->pGPU->MapBuffer(*transferBufferId, false);
-    if (!pTransferData)
+    const auto staging = m_pGlobal->pStagingRing->Allocate(totalTransferByteSize);
+    if (!staging)
     {
-        m_pGlobal->pLogger->Error("Textures::TransferData: Failed to map the transfer buffer");
-        m_pGlobal->pGPU->DestroyBuffer(*transferBufferId);
+        m_pGlobal->pLogger->Error("Textures::TransferData: Failed to allocate staging memory");
         return false;
     }
 
-    std::vector<std::size_t> transferStartOffsets;
-    std::size_t bytePosition = 0;
-
-    for (const auto& transfer : transfers)
+    for (unsigned int x = 0; x < transfers.size(); ++x)
     {
-        transferStartOffsets.push_back(bytePosition);
-        memcpy(static_cast<std::byte*>(*pTransferData) + bytePosition, transfer.data, transfer.dataByteSize);
-        bytePosition += transfer.dataByteSize;
-    }
+        const auto& transfer = transfers.at(x);
 
-    (void)m_pGlobal->pGPU->UnmapBuffer(*transferBufferId);
+        memcpy(staging->pData + transferStartOffsets.at(x), transfer.data, transfer.dataByteSize);
+    }
 
     //
     // Start a copy pass containing a copy command for each transfer
@@ -192,8 +175,8 @@ bool Textures::TransferData(GPU::CommandBufferId commandBufferId, const std::vec
 
         m_pGlobal->pGPU->CmdUploadDataToImage(
             *copyPass,
-            *transferBufferId,
-            transferStartOffsets.at(x),
+            staging->bufferId,
+            staging->byteOffset + transferStartOffsets.at(x),
             loadedTexture.imageId,
             GPU::ImageRegion{
                 .layerIndex = transfer.layer,
@@ -210,11 +193,6 @@ bool Textures::TransferData(GPU::CommandBufferId commandBufferId, const std::vec
 
     m_pGlobal->pGPU->EndCopyPass(*copyPass);
 
-    //
-    // Cleanup
-    //
-    m_pGlobal->pGPU->DestroyBuffer(*transferBufferId);
-
     return true;
 }
 
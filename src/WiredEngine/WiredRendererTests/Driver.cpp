@@ -0,0 +1,18 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include "ReadbackRingTests.h"
+#include "InterpolationTests.h"
+#include "FrameArenaTests.h"
+#include "StateUpdatePoolTests.h"
+
+#include <gtest/gtest.h>
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
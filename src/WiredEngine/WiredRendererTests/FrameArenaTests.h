@@ -0,0 +1,120 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERERTESTS_FRAMEARENATESTS_H
+#define WIREDENGINE_WIREDRENDERERTESTS_FRAMEARENATESTS_H
+
+#include <gtest/gtest.h>
+
+#include <Wired/Render/FrameArena.h>
+
+#include <array>
+#include <numeric>
+#include <cstdint>
+
+namespace Wired::Render
+{
+    TEST(FrameArenaTests, ZeroCountAllocationIsEmpty)
+    {
+        FrameArena<uint32_t> arena(4);
+
+        EXPECT_TRUE(arena.Allocate(0).empty());
+        EXPECT_TRUE(arena.IsEmpty());
+    }
+
+    TEST(FrameArenaTests, AllocationsShareBlockWhileTheyFit)
+    {
+        FrameArena<uint32_t> arena(8);
+
+        const auto a = arena.Allocate(3);
+        const auto b = arena.Allocate(5);
+
+        EXPECT_EQ(a.size(), 3U);
+        EXPECT_EQ(b.size(), 5U);
+        EXPECT_EQ(b.data(), a.data() + 3);
+        EXPECT_FALSE(arena.IsEmpty());
+    }
+
+    TEST(FrameArenaTests, SpansStayValidAsArenaGrows)
+    {
+        FrameArena<uint32_t> arena(4);
+
+        const auto first = arena.Allocate(3);
+        std::iota(first.begin(), first.end(), 100U);
+
+        for (uint32_t x = 0; x < 64; ++x)
+        {
+            std::ranges::fill(arena.Allocate(3), x);
+        }
+
+        EXPECT_EQ(first[0], 100U);
+        EXPECT_EQ(first[1], 101U);
+        EXPECT_EQ(first[2], 102U);
+    }
+
+    TEST(FrameArenaTests, AllocationLargerThanBlockGetsItsOwnBlock)
+    {
+        FrameArena<uint32_t> arena(4);
+
+        const auto small = arena.Allocate(1);
+        const auto large = arena.Allocate(10);
+        const auto afterLarge = arena.Allocate(1);
+
+        EXPECT_EQ(large.size(), 10U);
+
+        // The large block is full, so the following allocation goes into a new block
+        EXPECT_NE(afterLarge.data(), small.data() + 1);
+        EXPECT_NE(afterLarge.data(), large.data() + 10);
+    }
+
+    TEST(FrameArenaTests, ResetReusesMemory)
+    {
+        FrameArena<uint32_t> arena(4);
+
+        const auto a = arena.Allocate(3);
+        const auto b = arena.Allocate(2); // Doesn't fit in a's block
+        const auto c = arena.Allocate(2);
+
+        arena.Reset();
+        EXPECT_TRUE(arena.IsEmpty());
+
+        // The same allocations land in the same memory as before the reset
+        EXPECT_EQ(arena.Allocate(3).data(), a.data());
+        EXPECT_EQ(arena.Allocate(2).data(), b.data());
+        EXPECT_EQ(arena.Allocate(2).data(), c.data());
+    }
+
+    TEST(FrameArenaTests, CopyCopiesItems)
+    {
+        FrameArena<uint32_t> arena(4);
+
+        const std::array<uint32_t, 6> items = {1, 2, 3, 4, 5, 6};
+
+        const auto copy = arena.Copy(items);
+
+        ASSERT_EQ(copy.size(), items.size());
+        EXPECT_NE(copy.data(), items.data());
+        EXPECT_TRUE(std::ranges::equal(copy, items));
+    }
+
+    TEST(FrameArenaTests, MovedArenaKeepsAllocations)
+    {
+        FrameArena<uint32_t> arena(4);
+
+        const auto allocation = arena.Allocate(2);
+        allocation[0] = 7;
+
+        FrameArena<uint32_t> moved(std::move(arena));
+
+        EXPECT_FALSE(moved.IsEmpty());
+        EXPECT_EQ(allocation[0], 7U);
+
+        // The rest of the moved block is still available
+        EXPECT_EQ(moved.Allocate(2).data(), allocation.data() + 2);
+    }
+}
+
+#endif //WIREDENGINE_WIREDRENDERERTESTS_FRAMEARENATESTS_H
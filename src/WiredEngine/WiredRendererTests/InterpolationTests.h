@@ -0,0 +1,189 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERERTESTS_INTERPOLATIONTESTS_H
+#define WIREDENGINE_WIREDRENDERERTESTS_INTERPOLATIONTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "DataStore/ObjectDataStore.h"
+#include "DataStore/SpriteDataStore.h"
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+
+namespace Wired::Render
+{
+    /**
+     * Exposes the data stores' interpolation, which doesn't touch the GPU, for testing
+     */
+    class TestObjectDataStore : public ObjectDataStore
+    {
+        public:
+            TestObjectDataStore() : ObjectDataStore(nullptr) { }
+            using ObjectDataStore::InterpolateInstance;
+    };
+
+    class TestSpriteDataStore : public SpriteDataStore
+    {
+        public:
+            TestSpriteDataStore() : SpriteDataStore(nullptr) { }
+            using SpriteDataStore::InterpolateInstance;
+    };
+
+    static constexpr float INTERPOLATION_EPSILON = 0.0001f;
+
+    static void ExpectTransformNear(const glm::mat4& actual, const glm::mat4& expected)
+    {
+        for (glm::length_t c = 0; c < 4; ++c)
+        {
+            for (glm::length_t r = 0; r < 4; ++r)
+            {
+                EXPECT_NEAR(actual[c][r], expected[c][r], INTERPOLATION_EPSILON) << "column " << c << ", row " << r;
+            }
+        }
+    }
+
+    static ObjectRenderable TestObject(const glm::mat4& modelTransform)
+    {
+        ObjectRenderable renderable{};
+        renderable.id = ObjectId(1);
+        renderable.meshId = MeshId(2);
+        renderable.materialId = MaterialId(3);
+        renderable.modelTransform = modelTransform;
+        return renderable;
+    }
+
+    TEST(InterpolationTests, ObjectEndpointsMatchPreviousAndCurrent)
+    {
+        const TestObjectDataStore store;
+
+        const auto previous = TestObject(glm::translate(glm::mat4(1), glm::vec3(1, 2, 3)) *
+                                         glm::rotate(glm::mat4(1), glm::radians(30.0f), glm::vec3(0, 1, 0)));
+        const auto current = TestObject(glm::translate(glm::mat4(1), glm::vec3(4, 5, 6)) *
+                                        glm::rotate(glm::mat4(1), glm::radians(60.0f), glm::vec3(1, 0, 0)) *
+                                        glm::scale(glm::mat4(1), glm::vec3(2, 3, 4)));
+
+        const auto start = store.InterpolateInstance(previous, current, 0.0f);
+        ASSERT_TRUE(start);
+        ExpectTransformNear(start->modelTransform, previous.modelTransform);
+
+        const auto end = store.InterpolateInstance(previous, current, 1.0f);
+        ASSERT_TRUE(end);
+        ExpectTransformNear(end->modelTransform, current.modelTransform);
+    }
+
+    TEST(InterpolationTests, ObjectTranslationAndScaleAreLerped)
+    {
+        const TestObjectDataStore store;
+
+        const auto previous = TestObject(glm::scale(glm::mat4(1), glm::vec3(1, 1, 1)));
+        const auto current = TestObject(glm::translate(glm::mat4(1), glm::vec3(10, -4, 2)) *
+                                        glm::scale(glm::mat4(1), glm::vec3(3, 5, 1)));
+
+        const auto interpolated = store.InterpolateInstance(previous, current, 0.25f);
+        ASSERT_TRUE(interpolated);
+
+        const auto expected = glm::translate(glm::mat4(1), glm::vec3(2.5f, -1.0f, 0.5f)) *
+                              glm::scale(glm::mat4(1), glm::vec3(1.5f, 2.0f, 1.0f));
+        ExpectTransformNear(interpolated->modelTransform, expected);
+    }
+
+    TEST(InterpolationTests, ObjectRotationIsSlerped)
+    {
+        const TestObjectDataStore store;
+
+        // Scaled, so that the rotation has to be separated from the scale to be blended
+        const auto previous = TestObject(glm::scale(glm::mat4(1), glm::vec3(2)));
+        const auto current = TestObject(glm::rotate(glm::mat4(1), glm::radians(90.0f), glm::vec3(0, 1, 0)) *
+                                        glm::scale(glm::mat4(1), glm::vec3(2)));
+
+        const auto interpolated = store.InterpolateInstance(previous, current, 0.5f);
+        ASSERT_TRUE(interpolated);
+
+        const auto expected = glm::rotate(glm::mat4(1), glm::radians(45.0f), glm::vec3(0, 1, 0)) *
+                              glm::scale(glm::mat4(1), glm::vec3(2));
+        ExpectTransformNear(interpolated->modelTransform, expected);
+    }
+
+    TEST(InterpolationTests, ObjectMirroringIsPreserved)
+    {
+        const TestObjectDataStore store;
+
+        const auto mirror = glm::scale(glm::mat4(1), glm::vec3(-1, 1, 1));
+
+        const auto previous = TestObject(mirror);
+        const auto current = TestObject(glm::translate(glm::mat4(1), glm::vec3(2, 0, 0)) * mirror);
+
+        const auto interpolated = store.InterpolateInstance(previous, current, 0.5f);
+        ASSERT_TRUE(interpolated);
+
+        ExpectTransformNear(interpolated->modelTransform, glm::translate(glm::mat4(1), glm::vec3(1, 0, 0)) * mirror);
+    }
+
+    TEST(InterpolationTests, ObjectKeepsCurrentNonTransformState)
+    {
+        const TestObjectDataStore store;
+
+        auto previous = TestObject(glm::mat4(1));
+        previous.materialId = MaterialId(7);
+        previous.castsShadows = false;
+
+        const auto current = TestObject(glm::translate(glm::mat4(1), glm::vec3(1, 0, 0)));
+
+        const auto interpolated = store.InterpolateInstance(previous, current, 0.5f);
+        ASSERT_TRUE(interpolated);
+        EXPECT_EQ(interpolated->id, current.id);
+        EXPECT_EQ(interpolated->materialId, current.materialId);
+        EXPECT_EQ(interpolated->castsShadows, current.castsShadows);
+    }
+
+    TEST(InterpolationTests, ObjectWithChangedMeshIsNotInterpolated)
+    {
+        const TestObjectDataStore store;
+
+        const auto previous = TestObject(glm::mat4(1));
+        auto current = TestObject(glm::translate(glm::mat4(1), glm::vec3(1, 0, 0)));
+        current.meshId = MeshId(9);
+
+        EXPECT_FALSE(store.InterpolateInstance(previous, current, 0.5f));
+    }
+
+    TEST(InterpolationTests, SpriteTransformIsBlended)
+    {
+        const TestSpriteDataStore store;
+
+        SpriteRenderable previous{};
+        previous.id = SpriteId(1);
+        previous.position = NCommon::Point3DReal(0, 0, 0);
+        previous.orientation = glm::identity<glm::quat>();
+        previous.scale = glm::vec3(1);
+
+        auto current = previous;
+        current.position = NCommon::Point3DReal(4, -2, 8);
+        current.orientation = glm::angleAxis(glm::radians(90.0f), glm::vec3(0, 0, 1));
+        current.scale = glm::vec3(3, 1, 1);
+        current.dstSize = NCommon::Size2DReal(16, 16);
+
+        const auto interpolated = store.InterpolateInstance(previous, current, 0.5f);
+        ASSERT_TRUE(interpolated);
+
+        EXPECT_NEAR(interpolated->position.x, 2.0f, INTERPOLATION_EPSILON);
+        EXPECT_NEAR(interpolated->position.y, -1.0f, INTERPOLATION_EPSILON);
+        EXPECT_NEAR(interpolated->position.z, 4.0f, INTERPOLATION_EPSILON);
+
+        const auto expectedOrientation = glm::angleAxis(glm::radians(45.0f), glm::vec3(0, 0, 1));
+        EXPECT_NEAR(glm::abs(glm::dot(interpolated->orientation, expectedOrientation)), 1.0f, INTERPOLATION_EPSILON);
+
+        EXPECT_NEAR(interpolated->scale.x, 2.0f, INTERPOLATION_EPSILON);
+        EXPECT_NEAR(interpolated->scale.y, 1.0f, INTERPOLATION_EPSILON);
+
+        // Non-transform state comes from the current sprite
+        EXPECT_EQ(interpolated->dstSize, current.dstSize);
+    }
+}
+
+#endif //WIREDENGINE_WIREDRENDERERTESTS_INTERPOLATIONTESTS_H
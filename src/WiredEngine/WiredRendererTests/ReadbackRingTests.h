@@ -0,0 +1,195 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERERTESTS_READBACKRINGTESTS_H
+#define WIREDENGINE_WIREDRENDERERTESTS_READBACKRINGTESTS_H
+
+#include <gtest/gtest.h>
+
+#include "ReadbackRing.h"
+
+#include <unordered_set>
+
+namespace Wired::Render
+{
+    /**
+     * Stands in for the GPU; tracks which slots it's still working on
+     */
+    struct FakeSlotUsage
+    {
+        std::unordered_set<std::size_t> inUseSlots;
+
+        [[nodiscard]] auto Func() const { return [this](std::size_t slotIndex){ return inUseSlots.contains(slotIndex); }; }
+    };
+
+    TEST(ReadbackRingTests, FreeSlotsAreAcquiredRoundRobin)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(3);
+
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 0U);
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 1U);
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 2U);
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 0U);
+    }
+
+    TEST(ReadbackRingTests, PendingAndInUseSlotsAreSkipped)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(3);
+
+        ring.MarkPending(0);
+        usage.inUseSlots.insert(1);
+
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 2U);
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 2U);
+    }
+
+    TEST(ReadbackRingTests, NoSlotWhenAllSlotsBusy)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(2);
+
+        ring.MarkPending(0);
+        usage.inUseSlots.insert(1);
+
+        EXPECT_FALSE(ring.AcquireFreeSlot(usage.Func()));
+
+        ReadbackRing emptyRing;
+        EXPECT_FALSE(emptyRing.AcquireFreeSlot(usage.Func()));
+    }
+
+    TEST(ReadbackRingTests, EnsureSizeOnlyGrows)
+    {
+        ReadbackRing ring;
+        ring.EnsureSize(3);
+        ring.EnsureSize(2);
+
+        EXPECT_EQ(ring.GetSize(), 3U);
+    }
+
+    TEST(ReadbackRingTests, FinishedReadbackReportsLatency)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(3);
+
+        (void)ring.OnFrameStarted(usage.Func());
+        const auto slotIndex = ring.AcquireFreeSlot(usage.Func());
+        ASSERT_TRUE(slotIndex);
+        ring.MarkPending(*slotIndex);
+        usage.inUseSlots.insert(*slotIndex);
+
+        // GPU still working on the copy for the next two frames
+        EXPECT_FALSE(ring.OnFrameStarted(usage.Func()));
+        EXPECT_FALSE(ring.OnFrameStarted(usage.Func()));
+        EXPECT_TRUE(ring.IsPending(*slotIndex));
+
+        usage.inUseSlots.erase(*slotIndex);
+
+        const auto finished = ring.OnFrameStarted(usage.Func());
+        ASSERT_TRUE(finished);
+        EXPECT_EQ(finished->slotIndex, *slotIndex);
+        EXPECT_EQ(finished->latencyFrames, 3U);
+
+        // Popped readbacks are no longer pending, and their slot can be reused
+        EXPECT_FALSE(ring.IsPending(*slotIndex));
+        EXPECT_FALSE(ring.OnFrameStarted(usage.Func()));
+    }
+
+    TEST(ReadbackRingTests, OlderFinishedReadbacksAreSuperseded)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(3);
+
+        // Frame 1 records into slot 0, frame 2 into slot 1, frame 3 into slot 2
+        (void)ring.OnFrameStarted(usage.Func());
+        ring.MarkPending(*ring.AcquireFreeSlot(usage.Func()));
+        usage.inUseSlots.insert(0);
+        (void)ring.OnFrameStarted(usage.Func());
+        ring.MarkPending(*ring.AcquireFreeSlot(usage.Func()));
+        usage.inUseSlots.insert(1);
+        (void)ring.OnFrameStarted(usage.Func());
+        ring.MarkPending(*ring.AcquireFreeSlot(usage.Func()));
+        usage.inUseSlots.insert(2);
+
+        // Frames 1 and 2 finish together; only frame 2's readback is returned
+        usage.inUseSlots.erase(0);
+        usage.inUseSlots.erase(1);
+
+        const auto finished = ring.OnFrameStarted(usage.Func());
+        ASSERT_TRUE(finished);
+        EXPECT_EQ(finished->slotIndex, 1U);
+        EXPECT_EQ(finished->latencyFrames, 2U);
+
+        EXPECT_FALSE(ring.IsPending(0));
+        EXPECT_FALSE(ring.IsPending(1));
+        EXPECT_TRUE(ring.IsPending(2));
+    }
+
+    TEST(ReadbackRingTests, SupersedingIsIndependentOfSlotOrder)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(2);
+
+        // Wrap around so that the newer readback is in the lower slot
+        (void)ring.OnFrameStarted(usage.Func());
+        (void)ring.AcquireFreeSlot(usage.Func());
+        ring.MarkPending(1);
+        (void)ring.OnFrameStarted(usage.Func());
+        ring.MarkPending(0);
+
+        const auto finished = ring.OnFrameStarted(usage.Func());
+        ASSERT_TRUE(finished);
+        EXPECT_EQ(finished->slotIndex, 0U);
+        EXPECT_EQ(finished->latencyFrames, 1U);
+        EXPECT_FALSE(ring.IsPending(1));
+    }
+
+    TEST(ReadbackRingTests, CancelFrameDropsOnlyCurrentFrameReadbacks)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(3);
+
+        (void)ring.OnFrameStarted(usage.Func());
+        ring.MarkPending(0);
+        usage.inUseSlots.insert(0);
+
+        (void)ring.OnFrameStarted(usage.Func());
+        ring.MarkPending(1);
+        ring.CancelFrame();
+
+        EXPECT_TRUE(ring.IsPending(0));
+        EXPECT_FALSE(ring.IsPending(1));
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 1U);
+    }
+
+    TEST(ReadbackRingTests, ResetClearsState)
+    {
+        ReadbackRing ring;
+        FakeSlotUsage usage;
+        ring.EnsureSize(2);
+
+        (void)ring.OnFrameStarted(usage.Func());
+        ring.MarkPending(0);
+        ring.Reset();
+
+        EXPECT_EQ(ring.GetSize(), 0U);
+        EXPECT_EQ(ring.GetFrameIndex(), 0U);
+
+        ring.EnsureSize(2);
+        EXPECT_FALSE(ring.IsPending(0));
+        EXPECT_EQ(ring.AcquireFreeSlot(usage.Func()), 0U);
+    }
+}
+
+#endif //WIREDENGINE_WIREDRENDERERTESTS_READBACKRINGTESTS_H
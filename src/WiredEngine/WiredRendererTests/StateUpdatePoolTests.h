@@ -0,0 +1,155 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#ifndef WIREDENGINE_WIREDRENDERERTESTS_STATEUPDATEPOOLTESTS_H
+#define WIREDENGINE_WIREDRENDERERTESTS_STATEUPDATEPOOLTESTS_H
+
+#include <gtest/gtest.h>
+
+#include <Wired/Render/StateUpdatePool.h>
+
+#include <vector>
+#include <memory>
+#include <thread>
+
+namespace Wired::Render
+{
+    static constexpr std::size_t TEST_RESERVED_CAPACITY = 1000;
+
+    TEST(StateUpdatePoolTests, AcquireFromEmptyPoolCreatesUpdate)
+    {
+        const auto pool = StateUpdatePool::Create();
+
+        const auto stateUpdate = pool->Acquire();
+        ASSERT_NE(stateUpdate, nullptr);
+        EXPECT_TRUE(stateUpdate->IsEmpty());
+    }
+
+    TEST(StateUpdatePoolTests, ReleasedUpdateIsClearedAndRecycled)
+    {
+        const auto pool = StateUpdatePool::Create();
+
+        auto stateUpdate = pool->Acquire();
+        const auto* pStateUpdate = stateUpdate.get();
+
+        stateUpdate->groupName = "Test";
+        stateUpdate->toDeleteLights.reserve(TEST_RESERVED_CAPACITY);
+        stateUpdate->toDeleteLights.push_back(LightId(1));
+        stateUpdate->toDeleteObjectRenderables.push_back(ObjectId(2));
+        (void)stateUpdate->boneTransforms.Allocate(4);
+
+        auto shared = pool->Share(std::move(stateUpdate));
+        EXPECT_EQ(shared.get(), pStateUpdate);
+        EXPECT_FALSE(shared->IsEmpty());
+
+        // Dropping the last reference returns the update to the pool
+        shared.reset();
+
+        const auto recycled = pool->Acquire();
+        EXPECT_EQ(recycled.get(), pStateUpdate);
+        EXPECT_TRUE(recycled->IsEmpty());
+        EXPECT_TRUE(recycled->groupName.empty());
+        EXPECT_TRUE(recycled->boneTransforms.IsEmpty());
+
+        // Memory is kept for reuse
+        EXPECT_GE(recycled->toDeleteLights.capacity(), TEST_RESERVED_CAPACITY);
+    }
+
+    TEST(StateUpdatePoolTests, UpdateReturnsOnlyOnceAllReferencesReleased)
+    {
+        const auto pool = StateUpdatePool::Create();
+
+        auto stateUpdate = pool->Acquire();
+        const auto* pStateUpdate = stateUpdate.get();
+
+        auto shared = pool->Share(std::move(stateUpdate));
+        auto sharedCopy = shared;
+
+        shared.reset();
+        EXPECT_NE(pool->Acquire().get(), pStateUpdate);
+
+        sharedCopy.reset();
+        EXPECT_EQ(pool->Acquire().get(), pStateUpdate);
+    }
+
+    TEST(StateUpdatePoolTests, PoolHoldsBoundedNumberOfUpdates)
+    {
+        const auto pool = StateUpdatePool::Create();
+
+        std::vector<std::shared_ptr<const StateUpdate>> shared;
+
+        for (std::size_t x = 0; x < StateUpdatePool::MAX_POOLED_UPDATES + 2; ++x)
+        {
+            auto stateUpdate = pool->Acquire();
+            stateUpdate->toDeleteSpriteRenderables.reserve(TEST_RESERVED_CAPACITY);
+            shared.push_back(pool->Share(std::move(stateUpdate)));
+        }
+
+        shared.clear();
+
+        // Recycled updates are recognizable by the capacity they kept
+        std::size_t recycledCount = 0;
+
+        for (std::size_t x = 0; x < StateUpdatePool::MAX_POOLED_UPDATES + 2; ++x)
+        {
+            const auto stateUpdate = pool->Acquire();
+            if (stateUpdate->toDeleteSpriteRenderables.capacity() >= TEST_RESERVED_CAPACITY)
+            {
+                recycledCount++;
+            }
+        }
+
+        EXPECT_EQ(recycledCount, StateUpdatePool::MAX_POOLED_UPDATES);
+    }
+
+    TEST(StateUpdatePoolTests, SharedUpdateKeepsPoolAlive)
+    {
+        auto pool = StateUpdatePool::Create();
+        const std::weak_ptr<StateUpdatePool> weakPool = pool;
+
+        auto shared = pool->Share(pool->Acquire());
+
+        pool.reset();
+        EXPECT_FALSE(weakPool.expired());
+
+        shared.reset();
+        EXPECT_TRUE(weakPool.expired());
+    }
+
+    TEST(StateUpdatePoolTests, UpdateCanBeReleasedOnAnotherThread)
+    {
+        const auto pool = StateUpdatePool::Create();
+
+        auto stateUpdate = pool->Acquire();
+        const auto* pStateUpdate = stateUpdate.get();
+        stateUpdate->toDeleteLights.push_back(LightId(1));
+
+        auto shared = pool->Share(std::move(stateUpdate));
+
+        std::thread releaseThread([shared = std::move(shared)]() mutable { shared.reset(); });
+        releaseThread.join();
+
+        const auto recycled = pool->Acquire();
+        EXPECT_EQ(recycled.get(), pStateUpdate);
+        EXPECT_TRUE(recycled->IsEmpty());
+    }
+
+    TEST(StateUpdatePoolTests, RemoveDuplicateDeletes)
+    {
+        StateUpdate stateUpdate{};
+        stateUpdate.toDeleteSpriteRenderables = {SpriteId(3), SpriteId(1), SpriteId(3), SpriteId(2), SpriteId(1)};
+        stateUpdate.toDeleteObjectRenderables = {ObjectId(5), ObjectId(5)};
+        stateUpdate.toDeleteLights = {LightId(4)};
+
+        stateUpdate.RemoveDuplicateDeletes();
+
+        EXPECT_EQ(stateUpdate.toDeleteSpriteRenderables, (std::vector<SpriteId>{SpriteId(1), SpriteId(2), SpriteId(3)}));
+        EXPECT_EQ(stateUpdate.toDeleteObjectRenderables, (std::vector<ObjectId>{ObjectId(5)}));
+        EXPECT_EQ(stateUpdate.toDeleteLights, (std::vector<LightId>{LightId(4)}));
+    }
+}
+
+#endif //WIREDENGINE_WIREDRENDERERTESTS_STATEUPDATEPOOLTESTS_H
@@ -0,0 +1,55 @@
+/*
+ * SPDX-FileCopyrightText: 2025 Joe @ NEON Software
+ *
+ * SPDX-License-Identifier: GPL-3.0-only
+ */
+ 
+#include <Wired/Engine/Package/PackageArchive.h>
+
+#include <NEON/Common/Log/StdLogger.h>
+
+#include <filesystem>
+#include <iostream>
+
+/**
+ * Builds a package archive from a package directory.
+ *
+ * Usage: WiredPackager <package directory> [output archive path]
+ *
+ * If no output path is provided, the archive is written next to the package directory, named after the package.
+ */
+int main(int argc, char* argv[])
+{
+    using namespace Wired;
+
+    if (argc < 2 || argc > 3)
+    {
+        std::cerr << "Usage: WiredPackager <package directory> [output archive path]" << std::endl;
+        return 1;
+    }
+
+    auto packageDirectoryPath = std::filesystem::absolute(std::filesystem::path(argv[1])).lexically_normal();
+
+    // A trailing separator leaves an empty filename, which would otherwise lose the package's name
+    if (!packageDirectoryPath.has_filename())
+    {
+        packageDirectoryPath = packageDirectoryPath.parent_path();
+    }
+
+    auto archiveFilePath = packageDirectoryPath;
+    archiveFilePath.replace_extension(Engine::PACKAGE_ARCHIVE_EXTENSION);
+
+    if (argc == 3)
+    {
+        archiveFilePath = argv[2];
+    }
+
+    NCommon::StdLogger logger(NCommon::LogLevel::Info);
+
+    if (!Engine::WritePackageArchive(&logger, packageDirectoryPath, archiveFilePath))
+    {
+        return 1;
+    }
+
+    return 0;
+}
@@ -17,7 +17,7 @@ struct ObjectGlobalUniformPayload
 
     // Lighting
     vec3 ambientLight;
-    uint highestLightId;
+    uint numLights;
     bool hdrEnabled;
     float shadowCascadeOverlap;                 // Ratio of overlap between cascade cuts
 };
@@ -67,6 +67,11 @@ layout(std430, set = 1, binding = 2) readonly buffer ObjectInstanceDataPayloadBu
     ObjectInstanceDataPayload data[];
 } i_objectInstanceData;
 
+layout(std430, set = 1, binding = 11) readonly buffer ObjectSlotBuffer
+{
+    uint data[]; // Object id -> slot in i_objectInstanceData
+} i_objectSlots;
+
 layout(std430, set = 2, binding = 0) readonly buffer DrawDataPayloadBuffer
 {
     DrawDataPayload data[];
@@ -84,7 +89,7 @@ layout(location = 4) out mat3 o_tbnNormalTransform;
 void main()
 {
     const DrawDataPayload drawDataPayload = i_drawData.data[gl_InstanceIndex];
-    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[drawDataPayload.objectId];
+    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[i_objectSlots.data[drawDataPayload.objectId]];
 
     const vec3 fragPos_worldSpace =
         (instanceDataPayload.modelTransform * vec4(i_vertexPosition_modelSpace, 1.0f)).xyz;
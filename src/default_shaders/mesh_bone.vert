@@ -19,7 +19,7 @@ struct ObjectGlobalUniformPayload
 
     // Lighting
     vec3 ambientLight;
-    uint highestLightId;
+    uint numLights;
     bool hdrEnabled;
     float shadowCascadeOverlap;                 // Ratio of overlap between cascade cuts
 };
@@ -105,6 +105,11 @@ layout(std430, set = 1, binding = 2) readonly buffer ObjectInstanceDataPayloadBu
     ObjectInstanceDataPayload data[];
 } i_objectInstanceData;
 
+layout(std430, set = 1, binding = 11) readonly buffer ObjectSlotBuffer
+{
+    uint data[]; // Object id -> slot in i_objectInstanceData
+} i_objectSlots;
+
 layout(std430, set = 1, binding = 6) readonly buffer BoneTransformsPayloadBuffer
 {
     mat4 data[];
@@ -132,7 +137,7 @@ layout(location = 4) out mat3 o_tbnNormalTransform;
 void main() 
 {
     const DrawDataPayload drawDataPayload = i_drawData.data[gl_InstanceIndex];
-    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[drawDataPayload.objectId];
+    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[i_objectSlots.data[drawDataPayload.objectId]];
     const MeshPayload meshPayload = i_meshPayloads.data[instanceDataPayload.meshId];
     const uint boneStartIndex = i_boneMappingData.data[drawDataPayload.objectId];
 
@@ -41,7 +41,7 @@ struct ObjectGlobalUniformPayload
 
     // Lighting
     vec3 ambientLight;
-    uint highestLightId;
+    uint numLights;
     bool hdrEnabled;
     float shadowCascadeOverlap;                 // Ratio of overlap between cascade cuts
 };
@@ -206,6 +206,11 @@ layout(std430, set = 1, binding = 2) readonly buffer ObjectInstanceDataPayloadBu
     ObjectInstanceDataPayload data[];
 } i_objectInstanceData;
 
+layout(std430, set = 1, binding = 11) readonly buffer ObjectSlotBuffer
+{
+    uint data[]; // Object id -> slot in i_objectInstanceData
+} i_objectSlots;
+
 layout(std430, set = 1, binding = 3) readonly buffer LightPayloadBuffer
 {
     LightPayload data[];
@@ -245,7 +250,7 @@ layout(location = 0) out vec4 o_fragColor;
 void main()
 {
     const DrawDataPayload drawDataPayload = i_drawData.data[i_instanceIndex];
-    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[drawDataPayload.objectId];
+    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[i_objectSlots.data[drawDataPayload.objectId]];
     const PBRMaterialPayload materialPayload = i_materialPayloads.data[instanceDataPayload.materialId];
 
     const FragLightingParameters lightingParams = GetFragLightingParameters(materialPayload);
@@ -264,7 +269,7 @@ void main()
 
     vec3 totalLo = vec3(0.0);
 
-    for (uint i = 1; i <= u_globalData.data.highestLightId; ++i)
+    for (uint i = 0; i < u_globalData.data.numLights; ++i)
     {
         const LightPayload lightPayload = i_lightData.data[i];
         if (!lightPayload.isValid)
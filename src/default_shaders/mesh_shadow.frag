@@ -35,7 +35,7 @@ struct ObjectGlobalUniformPayload
 
     // Lighting
     vec3 ambientLight;
-    uint highestLightId;
+    uint numLights;
     bool hdrEnabled;
     float shadowCascadeOverlap;                 // Ratio of overlap between cascade cuts
 };
@@ -153,11 +153,21 @@ layout(std430, set = 1, binding = 2) readonly buffer ObjectInstanceDataPayloadBu
     ObjectInstanceDataPayload data[];
 } i_objectInstanceData;
 
+layout(std430, set = 1, binding = 11) readonly buffer ObjectSlotBuffer
+{
+    uint data[]; // Object id -> slot in i_objectInstanceData
+} i_objectSlots;
+
 layout(std430, set = 1, binding = 3) readonly buffer LightPayloadBuffer
 {
     LightPayload data[];
 } i_lightData;
 
+layout(std430, set = 1, binding = 12) readonly buffer LightSlotBuffer
+{
+    uint data[]; // Light id -> slot in i_lightData
+} i_lightSlots;
+
 layout(std430, set = 1, binding = 4) readonly buffer ShadowMapPayloadBuffer
 {
     ShadowMapPayload data[];
@@ -178,9 +188,9 @@ layout(set = 3, binding = 5) uniform sampler2D i_emissionSampler;
 void main()
 {
     const DrawDataPayload drawDataPayload = i_drawData.data[i_instanceIndex];
-    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[drawDataPayload.objectId];
+    const ObjectInstanceDataPayload instanceDataPayload = i_objectInstanceData.data[i_objectSlots.data[drawDataPayload.objectId]];
     const PBRMaterialPayload materialPayload = i_materialPayloads.data[instanceDataPayload.materialId];
-    const LightPayload lightPayload = i_lightData.data[u_globalData.data.lightId];
+    const LightPayload lightPayload = i_lightData.data[i_lightSlots.data[u_globalData.data.lightId]];
 
     const vec3 fragPos_worldSpace = i_fragPos_worldSpace;
     const vec3 fragPos_viewSpace = (u_viewProjectionData.data.viewTransform * vec4(i_fragPos_worldSpace, 1.0f)).xyz;
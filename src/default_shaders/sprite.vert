@@ -50,6 +50,11 @@ layout(std430, set = 1, binding = 1) readonly buffer SpriteInstanceDataPayloadBu
     SpriteInstanceDataPayload data[];
 } i_spriteInstanceData;
 
+layout(std430, set = 1, binding = 2) readonly buffer SpriteSlotBuffer
+{
+    uint data[]; // Sprite id -> slot in i_spriteInstanceData
+} i_spriteSlots;
+
 layout(std430, set = 2, binding = 0) readonly buffer DrawDataPayloadBuffer
 {
     DrawDataPayload data[];
@@ -63,7 +68,7 @@ layout(location = 0) out vec2 o_fragTexCoord;           // The vertex's tex coor
 void main() 
 {
     const DrawDataPayload drawDataPayload = i_drawData.data[gl_InstanceIndex];
-    const SpriteInstanceDataPayload instanceDataPayload = i_spriteInstanceData.data[drawDataPayload.spriteId];
+    const SpriteInstanceDataPayload instanceDataPayload = i_spriteInstanceData.data[i_spriteSlots.data[drawDataPayload.spriteId]];
 
     o_fragTexCoord = GetUVCoords(instanceDataPayload, gl_VertexIndex);
     